@@ -24,7 +24,59 @@
 
 namespace OpenRAVE {
 
-typedef boost::recursive_try_mutex EnvironmentMutex;
+/** \brief Recursive mutex protecting the environment, with optional tracing of who holds it and for how long.
+
+    Behaves like boost::recursive_try_mutex. When tracing is enabled with \ref SetTracing, every outermost acquisition
+    records the holder thread, the call site, the time spent waiting, the hold duration and the number of threads that
+    were waiting. The latest acquisitions are kept in a ring buffer and aggregated per call site, both can be queried
+    at any time with \ref GetTracingStatistics. Tracing can also be enabled for all environments by setting the
+    OPENRAVE_TRACE_ENVIRONMENT_MUTEX environment variable to 1 before creating them.
+ */
+class OPENRAVE_API EnvironmentMutex
+{
+public:
+    typedef boost::unique_lock<EnvironmentMutex> scoped_lock;
+    typedef boost::detail::try_lock_wrapper<EnvironmentMutex> scoped_try_lock;
+
+    EnvironmentMutex();
+    ~EnvironmentMutex();
+
+    void lock();
+    bool try_lock();
+    void unlock();
+
+    /// \brief enables or disables tracing. Can be called at any time from any thread.
+    void SetTracing(bool bTracing);
+
+    inline bool IsTracing() const {
+        return _bTracing;
+    }
+
+    /// \brief clears the ring buffer and the per call site statistics
+    void ResetTracingStatistics();
+
+    /// \brief returns the current holder, the statistics per call site and the latest acquisitions in the ring buffer.
+    ///
+    /// Durations are in nanoseconds. Call sites are resolved to symbol names when possible, skipping the boost and std
+    /// lock wrappers (scoped_lock, unique_lock, lock_guard) that called lock.
+    void GetTracingStatistics(rapidjson::Value& rStatistics, rapidjson::Document::AllocatorType& alloc) const;
+
+private:
+    EnvironmentMutex(const EnvironmentMutex&);
+    EnvironmentMutex& operator=(const EnvironmentMutex&);
+
+    /// \brief called after the mutex was acquired by the calling thread
+    ///
+    /// \param ppcallers return addresses of the callers of lock/try_lock, innermost first
+    void _OnAcquired(void* const* ppcallers, int numcallers, uint64_t requesttime);
+
+    boost::recursive_try_mutex _mutex;
+    int _nLockDepth; ///< recursion depth of the current holder, only accessed while holding _mutex
+    bool _bHolderRecorded; ///< true if the current holder was recorded in _pTracingData, only accessed while holding _mutex
+    volatile bool _bTracing;
+    class TracingData;
+    TracingData* _pTracingData; ///< only used when tracing, protected by its own mutex
+};
 
 /** \brief Maintains a world state, which serves as the gateway to all functions offered through %OpenRAVE. See \ref arch_environment.
  */
@@ -737,6 +789,41 @@ public:
     typedef boost::shared_ptr<EnvironmentBaseInfo> EnvironmentBaseInfoPtr;
     typedef boost::shared_ptr<EnvironmentBaseInfo const> EnvironmentBaseInfoConstPtr;
 
+    /// \brief info structure describing only the changes of the environment since a stamp, see \ref ExtractInfoDelta
+    ///
+    /// Bodies that were added or whose structure changed (geometries, joints, names, grabbed bodies, etc) store their full info.
+    /// Bodies that were only moved store their transform and DOF values.
+    class OPENRAVE_API EnvironmentBaseInfoDelta : public InfoBase
+    {
+public:
+        /// \brief transform and DOF values of a body whose structure did not change
+        class OPENRAVE_API BodyStateInfo
+        {
+public:
+            std::string _id;   ///< id of the body
+            std::string _name;   ///< name of the body
+            Transform _transform;   ///< transform of the base link
+            std::vector<dReal> _vDOFValues;   ///< DOF values ordered by DOF index
+        };
+
+        void Reset() override;
+        void SerializeJSON(rapidjson::Value& value, rapidjson::Document::AllocatorType& allocator, dReal fUnitScale, int options=0) const override;
+        void DeserializeJSON(const rapidjson::Value& value, dReal fUnitScale, int options) override;
+
+        int _stamp = 0;   ///< stamp of the environment when the delta was extracted, pass it to the next ExtractInfoDelta call
+        bool _isFull = false;   ///< if true, _vBodyInfos holds all bodies of the environment and bodies not in it should be removed
+        std::vector<KinBody::KinBodyInfoPtr> _vBodyInfos;   ///< full infos of bodies that were added or whose structure changed
+        std::vector<BodyStateInfo> _vBodyStates;   ///< states of bodies whose transform or DOF values changed
+        std::vector< std::pair<std::string, std::string> > _vRemovedBodies;   ///< (id, name) of bodies removed from the environment
+        int _revision = 0;   ///< environment revision number
+        std::string _name;   ///< environment name
+        std::string _description;   ///< environment description
+        std::vector<std::string> _keywords;   ///< some string values for describinging the environment
+        Vector _gravity = Vector(0,0,-9.797930195020351);   ///< gravity and gravity direction of the environment
+    };
+    typedef boost::shared_ptr<EnvironmentBaseInfoDelta> EnvironmentBaseInfoDeltaPtr;
+    typedef boost::shared_ptr<EnvironmentBaseInfoDelta const> EnvironmentBaseInfoDeltaConstPtr;
+
     /// \brief returns environment revision number
     inline int GetRevision() const {
         return _revision;
@@ -763,6 +850,17 @@ public:
     /// \brief update EnvironmentBase according to new EnvironmentBaseInfo
     virtual void UpdateFromInfo(const EnvironmentBaseInfo& info, std::vector<KinBodyPtr>& vCreatedBodies, std::vector<KinBodyPtr>& vModifiedBodies, std::vector<KinBodyPtr>& vRemovedBodies) = 0;
 
+    /// \brief extracts only the changes of the environment since a previous call, cost is proportional to the number of changed bodies.
+    ///
+    /// \param[out] delta filled with the changes. delta._stamp should be passed as nSinceStamp of the next call
+    /// \param[in] nSinceStamp stamp returned by a previous call. If 0 or if the environment cannot compute the changes since the stamp (it was reset, too many removals happened, etc), then a full delta is returned with delta._isFull set.
+    virtual void ExtractInfoDelta(EnvironmentBaseInfoDelta& delta, int nSinceStamp) = 0;
+
+    /// \brief update EnvironmentBase according to a delta returned by ExtractInfoDelta of another environment
+    ///
+    /// The environment is expected to be in sync with the other environment at the stamp the delta was extracted from.
+    virtual void UpdateFromInfoDelta(const EnvironmentBaseInfoDelta& delta, std::vector<KinBodyPtr>& vCreatedBodies, std::vector<KinBodyPtr>& vModifiedBodies, std::vector<KinBodyPtr>& vRemovedBodies) = 0;
+
     int _revision = 0;  ///< environment current revision
     std::string _name;   ///< environment name
     std::string _description;   ///< environment description
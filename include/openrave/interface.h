@@ -197,7 +197,8 @@ public:
 
         The command must be registered by \ref RegisterJSONCommand. A special command '\b help' is
         always supported and provides a way for the user to query the current commands and the help
-        string.
+        string. The profiling commands SetProfilingOptions, GetProfilingStatistics and GetProfilingTrace
+        are also supported by every interface, see \ref RaveSetProfilingOptions.
 
         \param cmdname command name
         \param input the input rapidjson value
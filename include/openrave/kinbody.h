@@ -2776,6 +2776,14 @@ private:
         return _nUpdateStampId;
     }
 
+    /// \brief Return a unique id for every change of the body that is not a transformation or joint angle change.
+    ///
+    /// Geometries, joints, names, grabbed bodies, etc all increment this stamp while SetDOFValues and SetTransform do not.
+    /// Used to check whether the full info of the body has to be extracted or only its state, see \ref EnvironmentBase::ExtractInfoDelta
+    virtual int GetInfoUpdateStamp() const {
+        return _nInfoUpdateStampId;
+    }
+
     virtual void Clone(InterfaceBaseConstPtr preference, int cloningoptions);
 
     /// \brief Register a callback with the interface.
@@ -3068,6 +3076,7 @@ protected:
 
     int _environmentid; ///< \see GetEnvironmentId
     mutable int _nUpdateStampId; ///< \see GetUpdateStamp
+    int _nInfoUpdateStampId; ///< \see GetInfoUpdateStamp
     uint32_t _nParametersChanged; ///< set of parameters that changed and need callbacks
     ManageDataPtr _pManageData;
     uint32_t _nHierarchyComputed; ///< 2 if the joint heirarchy and other cached information is computed. 1 if the hierarchy information is computing
@@ -121,12 +121,60 @@ enum DebugLevel {
 #define OPENRAVECOLOR_DEBUGLEVEL 2 // green
 #define OPENRAVECOLOR_VERBOSELEVEL 4 // blue
 
+#define OPENRAVELEVEL_FATALLEVEL OpenRAVE::Level_Fatal
+#define OPENRAVELEVEL_ERRORLEVEL OpenRAVE::Level_Error
+#define OPENRAVELEVEL_WARNLEVEL OpenRAVE::Level_Warn
+#define OPENRAVELEVEL_INFOLEVEL OpenRAVE::Level_Info
+#define OPENRAVELEVEL_DEBUGLEVEL OpenRAVE::Level_Debug
+#define OPENRAVELEVEL_VERBOSELEVEL OpenRAVE::Level_Verbose
+
 /// \brief Sets the global openrave debug level. A combination of \ref DebugLevel
 OPENRAVE_API void RaveSetDebugLevel(int level);
 
 /// Returns the openrave debug level
 OPENRAVE_API int RaveGetDebugLevel();
 
+/// \brief how log messages are written, see \ref RaveSetLoggingMode
+enum LoggingMode
+{
+    LM_Synchronous = 0, ///< messages are written by the calling thread, the default
+    LM_AsyncText = 1, ///< messages are queued in per-thread ring buffers and written as text by a background thread
+    LM_AsyncBinary = 2, ///< messages are queued like LM_AsyncText and written to a file as binary records
+};
+
+/** \brief Sets how log messages are written.
+
+    In the asynchronous modes, a thread logging a message only copies it into its own ring buffer and a background
+    thread writes it, so logging does not block on the console, log4cxx appenders or other threads. Messages of one
+    thread keep their order. In text mode, the messages of the RAVELOG macros are appended to their log4cxx logger
+    with the location of the caller, like in synchronous mode. When a ring buffer is full, new messages of that thread
+    are dropped and the writer logs how many were dropped.
+
+    The binary mode writes to filename a header "OPENRAVELOG1\n" followed by one record per message: uint64 wall time
+    in nanoseconds since epoch, uint32 thread index, uint8 level, uint32 message size and the message bytes, all
+    little-endian. It avoids the text formatting and the color codes of the console output.
+
+    Switching modes flushes the pending messages. Can also be set with OPENRAVE_LOGGING_MODE=async|binary:filename before \ref RaveInitialize.
+    \throw openrave_exception if the binary file cannot be opened
+ */
+OPENRAVE_API void RaveSetLoggingMode(int mode, const std::string& filename=std::string());
+
+/// \brief returns the current \ref LoggingMode
+OPENRAVE_API int RaveGetLoggingMode();
+
+/// \brief blocks until all the messages queued before the call have been written
+OPENRAVE_API void RaveFlushLogging();
+
+/// \brief queues the message if asynchronous logging is enabled.
+///
+/// \return the number of queued characters, or -1 if logging is synchronous and the caller has to write the message
+OPENRAVE_API int RaveLogAsync(int level, const char* s, size_t len);
+
+/// \brief formats and queues the message if asynchronous logging is enabled. Does not consume list.
+///
+/// \return the number of queued characters, or -1 if logging is synchronous and the caller has to write the message
+OPENRAVE_API int RaveLogAsyncV(int level, const char* fmt, va_list list);
+
 /// extracts only the filename
 inline const char* RaveGetSourceFilename(const char* pfilename)
 {
@@ -158,6 +206,14 @@ OPENRAVE_API log4cxx::LoggerPtr RaveGetLogger();
 /// \brief Get the verbose log4cxx level. The only difference between this and log4cxx::Level::getTrace() is the text VERBOSE.
 OPENRAVE_API log4cxx::LevelPtr RaveGetVerboseLogLevel();
 
+/// \brief queues the message if asynchronous logging is enabled, it is appended to logger with location when written.
+///
+/// \return the number of queued characters, or -1 if logging is synchronous and the caller has to write the message
+OPENRAVE_API int RaveLogAsync(const log4cxx::LoggerPtr& logger, const log4cxx::spi::LocationInfo& location, int level, const char* s, size_t len);
+
+/// \brief formats and queues the message like \ref RaveLogAsync. Does not consume list.
+OPENRAVE_API int RaveLogAsyncV(const log4cxx::LoggerPtr& logger, const log4cxx::spi::LocationInfo& location, int level, const char* fmt, va_list list);
+
 #ifdef LOG4CXX_LOCATION
 #undef LOG4CXX_LOCATION
 #endif
@@ -217,6 +273,9 @@ OPENRAVE_API log4cxx::LevelPtr RaveGetVerboseLogLevel();
 #define DefineRavePrintfA(LEVEL) \
     inline int RavePrintfA ## LEVEL(const log4cxx::LoggerPtr& logger, const log4cxx::spi::LocationInfo& location, const std::string& s) \
     { \
+        if (OpenRAVE::RaveLogAsync(logger, location, OPENRAVELEVEL ## LEVEL, s.c_str(), s.size()) >= 0) { \
+            return s.size(); \
+        } \
         if (!!logger) { \
             if (s.size() > 0 && s[s.size()-1] == '\n') { \
                 std::string s1(s, 0, s.size()-1); \
@@ -243,6 +302,11 @@ OPENRAVE_API log4cxx::LevelPtr RaveGetVerboseLogLevel();
         int slen = 0; \
         int r = 0; \
         va_start(list,fmt); \
+        r = OpenRAVE::RaveLogAsyncV(logger, location, OPENRAVELEVEL ## LEVEL, fmt, list); \
+        if (r >= 0) { \
+            va_end(list); \
+            return r; \
+        } \
         r = vsnprintf(buf, sizeof(buf)/sizeof(char), fmt, list); \
         if (r >= (int)(sizeof(buf)/sizeof(char))) { \
             slen = r+1; \
@@ -278,6 +342,9 @@ DefineRavePrintfA(_INFOLEVEL)
 inline int RavePrintfA(const std::string& s, uint32_t level)
 {
     if( (RaveGetDebugLevel()&Level_OutputMask)>=level ) {
+        if( RaveLogAsync(level, s.c_str(), s.size()) >= 0 ) {
+            return s.size();
+        }
         const log4cxx::LoggerPtr& logger = RaveGetLogger();
         if (!!logger) {
             log4cxx::LevelPtr levelptr = log4cxx::Level::getInfo();
@@ -338,6 +405,9 @@ inline int RavePrintfA(const std::string& s, uint32_t level)
 #define DefineRavePrintfA(LEVEL) \
     inline int RavePrintfA ## LEVEL(const std::string& s) \
     { \
+        if (OpenRAVE::RaveLogAsync(OPENRAVELEVEL ## LEVEL, s.c_str(), s.size()) >= 0) { \
+            return s.size(); \
+        } \
         if((s.size() == 0)||(s[s.size()-1] != '\n')) {  \
             printf("%s\n", s.c_str()); \
         } \
@@ -352,7 +422,10 @@ inline int RavePrintfA(const std::string& s, uint32_t level)
         /*ChangeTextColor (stdout, 0, OPENRAVECOLOR##LEVEL);*/ \
         va_list list; \
         va_start(list,fmt); \
-        int r = vprintf(fmt, list); \
+        int r = OpenRAVE::RaveLogAsyncV(OPENRAVELEVEL ## LEVEL, fmt, list); \
+        if (r < 0) { \
+            r = vprintf(fmt, list); \
+        } \
         va_end(list); \
         /*if( fmt[0] != '\n' ) { printf("\n"); }*/  \
         /*ResetTextColor(stdout);*/ \
@@ -361,6 +434,9 @@ inline int RavePrintfA(const std::string& s, uint32_t level)
 
 inline int RavePrintfA(const std::string& s, uint32_t level)
 {
+    if( RaveLogAsync(level, s.c_str(), s.size()) >= 0 ) {
+        return s.size();
+    }
     if((s.size() == 0)||(s[s.size()-1] != '\n')) { // automatically add a new line
         printf("%s\n", s.c_str());
     }
@@ -397,6 +473,9 @@ DefineRavePrintfA(_INFOLEVEL)
 // for them.
 inline int RavePrintfA_INFOLEVEL(const std::string& s)
 {
+    if( RaveLogAsync(Level_Info, s.c_str(), s.size()) >= 0 ) {
+        return s.size();
+    }
     if((s.size() == 0)||(s[s.size()-1] != '\n')) {     // automatically add a new line
         printf("%s\n", s.c_str());
     }
@@ -410,7 +489,10 @@ inline int RavePrintfA_INFOLEVEL(const char *fmt, ...)
 {
     va_list list;
     va_start(list,fmt);
-    int r = vprintf(fmt, list);
+    int r = RaveLogAsyncV(Level_Info, fmt, list);
+    if( r < 0 ) {
+        r = vprintf(fmt, list);
+    }
     va_end(list);
     //if( fmt[0] != '\n' ) { printf("\n"); }
     return r;
@@ -419,6 +501,9 @@ inline int RavePrintfA_INFOLEVEL(const char *fmt, ...)
 #define DefineRavePrintfA(LEVEL) \
     inline int RavePrintfA ## LEVEL(const std::string& s) \
     { \
+        if (OpenRAVE::RaveLogAsync(OPENRAVELEVEL ## LEVEL, s.c_str(), s.size()) >= 0) { \
+            return s.size(); \
+        } \
         if((s.size() == 0)||(s[s.size()-1] != '\n')) { \
             printf ("%c[0;%d;%dm%s%c[m\n", 0x1B, OPENRAVECOLOR ## LEVEL + 30,8+40,s.c_str(),0x1B); \
         } \
@@ -432,7 +517,10 @@ inline int RavePrintfA_INFOLEVEL(const char *fmt, ...)
     { \
         va_list list; \
         va_start(list,fmt); \
-        int r = vprintf((ChangeTextColor(0, OPENRAVECOLOR ## LEVEL,8) + std::string(fmt) + ResetTextColor()).c_str(), list); \
+        int r = OpenRAVE::RaveLogAsyncV(OPENRAVELEVEL ## LEVEL, fmt, list); \
+        if (r < 0) { \
+            r = vprintf((ChangeTextColor(0, OPENRAVECOLOR ## LEVEL,8) + std::string(fmt) + ResetTextColor()).c_str(), list); \
+        } \
         va_end(list); \
         /*if( fmt[0] != '\n' ) { printf("\n"); } */ \
         return r; \
@@ -442,6 +530,9 @@ inline int RavePrintfA_INFOLEVEL(const char *fmt, ...)
 inline int RavePrintfA(const std::string& s, uint32_t level)
 {
     if( (RaveGetDebugLevel()&Level_OutputMask)>=level ) {
+        if( RaveLogAsync(level, s.c_str(), s.size()) >= 0 ) {
+            return s.size();
+        }
         int color = 0;
         switch(level&Level_OutputMask) {
         case Level_Fatal: color = OPENRAVECOLOR_FATALLEVEL; break;
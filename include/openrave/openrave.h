@@ -101,6 +101,7 @@ namespace OpenRAVE {
 #include <rapidjson/document.h>
 
 #include <openrave/logging.h>
+#include <openrave/profiling.h>
 
 namespace OpenRAVE {
 
@@ -2753,6 +2754,24 @@ OPENRAVE_API int RaveGetDataAccess();
 /// \brief Gets the default viewer type name
 OPENRAVE_API std::string RaveGetDefaultViewerType();
 
+/// \brief function called by \ref RaveRunParallelJobs for every job
+///
+/// \param jobindex index of the job in [0, numjobs)
+/// \param threadindex in [0, RaveGetNumParallelJobThreads()), different for every thread running jobs of the same call. Can be used to index per thread scratch data.
+typedef boost::function<void (int jobindex, int threadindex)> ParallelJobFn;
+
+/// \brief returns the maximum number of threads that run the jobs of one \ref RaveRunParallelJobs call, including the calling thread
+OPENRAVE_API int RaveGetNumParallelJobThreads();
+
+/** \brief Runs fn for every job in [0, numjobs) on the worker threads shared by all environments and plugins, and on the calling thread. Returns when all jobs finished.
+
+    The workers are started on the first call, one less than the number of cores. The call can be made concurrently from many threads
+    and from inside a job. The calling thread always works on its own jobs, so it never waits for unrelated jobs to finish.
+    If jobs throw, the remaining jobs still run and the first exception is rethrown after all of them finished.
+    \param maxthreads if > 0, the maximum number of threads working on the jobs, including the calling thread
+ */
+OPENRAVE_API void RaveRunParallelJobs(const ParallelJobFn& fn, int numjobs, int maxthreads=0);
+
 /** \brief Returns the gettext translated string of the given message id
 
     \param domainname translation domain name
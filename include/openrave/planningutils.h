@@ -58,6 +58,14 @@ OPENRAVE_API int JitterCurrentConfiguration(PlannerBase::PlannerParametersConstP
  */
 OPENRAVE_API void VerifyTrajectory(PlannerBase::PlannerParametersConstPtr parameters, TrajectoryBaseConstPtr trajectory, dReal samplingstep=0.002);
 
+/** \brief computes the order in which to check numitems consecutive items (waypoints or segments) of a path so that the checked items are spread as uniformly as possible along the path at every step.
+
+    The order is a recursive bisection (breadth-first over the halves of the index range, similar to a van der Corput sequence): the middle item is checked first, then the middles of both halves, etc. Since collisions usually span several neighboring items, checking in this order finds an invalid path much earlier than a sequential sweep and allows the caller to exit on the first failure.
+    \param numitems the number of items to order
+    \param vorder filled with a permutation of [0, numitems)
+ */
+OPENRAVE_API void ComputeBisectionOrder(size_t numitems, std::vector<size_t>& vorder);
+
 /** \brief Extends the last ramp of the trajectory in order to reach a goal. THe configuration space matches the positional data of the trajectory.
 
     Useful when appending jittered points to the trajectory.
@@ -429,6 +437,14 @@ public:
     /// \param torquelimitmode 1 if should use instantaneous max torque, 0 if should use nominal torque
     virtual void SetTorqueLimitMode(DynamicsConstraintsType torquelimitmode);
 
+    /// \brief if true, linear segments that only need collision checks take steps based on the current clearance.
+    ///
+    /// The clearance is computed with CO_Distance and divided by an upper bound on how far any point of the check bodies can
+    /// move for a unit step, so steps far from obstacles are large and steps near contact fall back to _vConfigResolution.
+    /// Only used if the collision checkers support CO_Distance and the checked bodies only have revolute and prismatic joints.
+    /// Assumes _neighstatefn does not project the interpolated configurations. By default it is off.
+    virtual void SetAdaptiveStepping(bool bAdaptiveStepping);
+
     /// \brief set user check fucntions
     ///
     /// Two functions can be set, one to be called before check collision and one after.
@@ -456,6 +472,18 @@ protected:
     virtual int _SetAndCheckState(PlannerBase::PlannerParametersConstPtr params, const std::vector<dReal>& vdofvalues, const std::vector<dReal>& vdofvelocities, const std::vector<dReal>& vdofaccels, int options, ConstraintFilterReturnPtr filterreturn);
     virtual void _PrintOnFailure(const std::string& prefix);
 
+    /// \brief checks the linear segment q0 + s*dQ with steps based on the clearance, s in [0,1) if start is 0 and s in (0,1) if start is 1.
+    ///
+    /// \param start 0 if q0 is part of the checked interval
+    /// \param numSteps the number of steps based on _vConfigResolution, steps are never smaller than 1/numSteps
+    /// \return -1 if the adaptive check cannot be used, otherwise the same as Check
+    virtual int _CheckLinearAdaptive(PlannerBase::PlannerParametersConstPtr params, const std::vector<dReal>& q0, int start, int numSteps, int options, ConstraintFilterReturnPtr filterreturn);
+
+    /// \brief computes for every dof of the body the max distance any point can move for a unit change of the dof, independent of the other dof values.
+    ///
+    /// \return false if the body has joints the bound cannot be computed for
+    virtual bool _ComputeDOFDisplacementRadii(KinBodyPtr pbody, std::vector<dReal>& vdofradii);
+
     PlannerBase::PlannerParametersWeakConstPtr _parameters;
     std::vector<dReal> _vtempconfig, _vtempvelconfig, dQ, _vtempveldelta, _vtempaccelconfig, _vperturbedvalues, _vcoeff2, _vcoeff1, _vprevtempconfig, _vprevtempvelconfig, _vtempconfig2, _vdiffconfig, _vdiffvelconfig, _vstepconfig; ///< in configuration space
     CollisionReportPtr _report;
@@ -465,6 +493,13 @@ protected:
     dReal _perturbation;
     boost::array< boost::function<bool() >, 2> _usercheckfns;
 
+    // for adaptive stepping
+    bool _bAdaptiveStepping;
+    std::vector<int> _vcachedbodystamps; ///< info update stamps of _listCheckBodies that _vcacheddofradii were computed at
+    std::vector< std::vector<dReal> > _vcacheddofradii; ///< for every body in _listCheckBodies, the result of _ComputeDOFDisplacementRadii
+    std::vector<dReal> _vconfigradii; ///< displacement radii in configuration space
+    std::vector<int> _vuseddofindices, _vusedconfigindices;
+
     // for dynamics
     ConfigurationSpecification _specvel;
     std::vector< std::pair<int, std::pair<dReal, dReal> > > _vtorquevalues; ///< cache for dof indices and the torque limits that the current torque should be in
@@ -0,0 +1,100 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2006-2016 Rosen Diankov <rosen.diankov@gmail.com>
+//
+// This file is part of OpenRAVE.
+// OpenRAVE is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+/** \file profiling.h
+    \brief Runtime profiling counters of the hot paths. This file is automatically included by openrave.h.
+
+    Profiling is disabled by default and can be turned on at runtime with \ref RaveSetProfilingOptions, or through the
+    SetProfilingOptions JSON command that every interface supports. Statistics are kept per thread, so recording a
+    sample never takes a lock unless tracing is enabled.
+ */
+#ifndef OPENRAVE_PROFILING_H
+#define OPENRAVE_PROFILING_H
+
+namespace OpenRAVE {
+
+/// \brief hot paths that are measured when profiling is enabled
+enum ProfilingCategory
+{
+    PC_CollisionCheck = 0, ///< EnvironmentBase::CheckCollision and EnvironmentBase::CheckStandaloneSelfCollision
+    PC_IkSolve = 1, ///< RobotBase::Manipulator::FindIKSolution and FindIKSolutions
+    PC_PlannerInit = 2, ///< PlannerBase::InitPlan called through planningutils and openravepy
+    PC_PlannerPlan = 3, ///< PlannerBase::PlanPath called through planningutils and openravepy, inclusive of nested planners
+    PC_PlannerPostProcess = 4, ///< PlannerBase::_ProcessPostPlanners
+    PC_TrajectorySample = 5, ///< TrajectoryBase::Sample and the SamplePoints methods
+    PC_EnvironmentLockWait = 6, ///< time spent waiting for the environment mutex in blocking locks that found it held by another thread, and in timed locks
+    PC_NumCategories = 7,
+};
+
+/// \brief what is recorded while profiling, used by \ref RaveSetProfilingOptions
+enum ProfilingOptions
+{
+    PO_Counters = 1, ///< per thread counters, durations and latency histograms
+    PO_Trace = 2, ///< in addition to the counters, stores the latest individual samples of every thread for \ref RaveGetProfilingTrace
+};
+
+/// \brief returns the name of a profiling category, used as keys in the statistics and trace
+OPENRAVE_API const char* RaveGetProfilingCategoryName(ProfilingCategory category);
+
+/// \brief enables profiling with a combination of \ref ProfilingOptions, 0 disables it. Can be called at any time from any thread.
+OPENRAVE_API void RaveSetProfilingOptions(int options);
+
+/// \brief returns the current combination of \ref ProfilingOptions
+OPENRAVE_API int RaveGetProfilingOptions();
+
+/// \brief clears the statistics and trace of all threads
+OPENRAVE_API void RaveResetProfilingStatistics();
+
+/// \brief returns the monotonic time in nanoseconds that profiling samples are measured with
+OPENRAVE_API uint64_t RaveGetProfilingTime();
+
+/// \brief records one sample for the calling thread. Usually called through \ref ProfilingScope
+///
+/// \param starttime time when the measured call started, from \ref RaveGetProfilingTime
+/// \param duration duration of the call in nanoseconds
+OPENRAVE_API void RaveAddProfilingSample(ProfilingCategory category, uint64_t starttime, uint64_t duration);
+
+/// \brief aggregates the statistics of all threads.
+///
+/// For every category, returns the count, total and max duration in nanoseconds, approximate percentiles and a histogram where bin i counts samples with durations in [2^i, 2^(i+1)) ns.
+OPENRAVE_API void RaveGetProfilingStatistics(rapidjson::Value& rStatistics, rapidjson::Document::AllocatorType& alloc);
+
+/// \brief returns the stored samples of all threads in the Chrome trace event format, viewable with chrome://tracing or Perfetto
+OPENRAVE_API void RaveGetProfilingTrace(rapidjson::Value& rTrace, rapidjson::Document::AllocatorType& alloc);
+
+/// \brief measures the lifetime of the scope as one sample of a category if profiling is enabled when the scope starts
+class ProfilingScope
+{
+public:
+    ProfilingScope(ProfilingCategory category) : _category(category), _starttime(0) {
+        if( RaveGetProfilingOptions() ) {
+            _starttime = RaveGetProfilingTime();
+        }
+    }
+    ~ProfilingScope() {
+        if( _starttime > 0 ) {
+            RaveAddProfilingSample(_category, _starttime, RaveGetProfilingTime() - _starttime);
+        }
+    }
+
+private:
+    ProfilingCategory _category;
+    uint64_t _starttime;
+};
+
+} // end namespace OpenRAVE
+
+#endif
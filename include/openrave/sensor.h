@@ -496,6 +496,14 @@ public:
     /// Only valid if this sensor is simulation based. A sensor hooked up to a real device can ignore this call
     virtual bool SimulationStep(dReal fTimeElapsed) OPENRAVE_DUMMY_IMPLEMENTATION;
 
+    /// \brief Returns true if \ref SimulationStep can be called from a worker thread concurrently with other sensors.
+    ///
+    /// The environment stays locked by the thread calling EnvironmentBase::StepSimulation, so such a sensor can only read the scene.
+    /// It cannot lock the environment mutex, modify bodies, or use the environment collision checker, and has to protect its own data.
+    virtual bool SupportsConcurrentSimulationStep() const {
+        return false;
+    }
+
     /// \brief Returns the sensor geometry. This method is thread safe.
     ///
     /// \param type the requested sensor type to create. A sensor can support many types. If type is ST_Invalid, then returns any structure that represents the geometry.
@@ -19,6 +19,7 @@
 #include "halton.h"
 #include "robotconfiguration.h"
 #include "bodyconfiguration.h"
+#include "inversereachability.h"
 
 InterfaceBasePtr CreateInterfaceValidated(InterfaceType type, const std::string& interfacename, std::istream& sinput, EnvironmentBasePtr penv)
 {
@@ -36,6 +37,9 @@ InterfaceBasePtr CreateInterfaceValidated(InterfaceType type, const std::string&
         else if( interfacename == "bodyconfiguration" ) {
             return InterfaceBasePtr(new BodyConfigurationSampler(penv,sinput));
         }
+        else if( interfacename == "inversereachability" ) {
+            return InterfaceBasePtr(new InverseReachabilitySampler(penv,sinput));
+        }
         break;
     default:
         break;
@@ -49,6 +53,7 @@ void GetPluginAttributesValidated(PLUGININFO& info)
     info.interfacenames[PT_SpaceSampler].push_back("Halton");
     info.interfacenames[PT_SpaceSampler].push_back("RobotConfiguration");
     info.interfacenames[PT_SpaceSampler].push_back("BodyConfiguration");
+    info.interfacenames[PT_SpaceSampler].push_back("InverseReachability");
 }
 
 OPENRAVE_PLUGIN_API void DestroyPlugin()
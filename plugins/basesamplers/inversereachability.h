@@ -0,0 +1,378 @@
+// -*- coding: utf-8 --*
+// Copyright (C) 2006-2020 Rosen Diankov <rosen.diankov@gmail.com>
+//
+// This file is part of OpenRAVE.
+// OpenRAVE is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include <boost/bind.hpp>
+#include <boost/algorithm/string/trim.hpp>
+#include <fstream>
+
+/// \brief samples robot base placements from the inverse reachability equivalence classes of inversereachability.py
+class InverseReachabilitySampler : public SpaceSamplerBase
+{
+public:
+    InverseReachabilitySampler(EnvironmentBasePtr penv, std::istream& sinput) : SpaceSamplerBase(penv), _rotweight(0), _xyzdelta(0), _quatdelta(0), _fBandwidthWeight(1)
+    {
+        __description = ":Interface Author: Rosen Diankov\n\n\
+Samples robot base placements so that the manipulator can reach a set of grasps using the inverse reachability distribution of the robot. When creating pass the following parameters::\n\n\
+  InverseReachability [robot name] [manipulator name] [sampler name]\n\n\
+The distribution is loaded with 'Load', which reads the file written by InverseReachabilityModel.saveNative. \
+After 'SetGrasps', every sample is a robot pose (quaternion and translation) near one of the grasps.\n\
+";
+        RegisterCommand("Load",boost::bind(&InverseReachabilitySampler::LoadCommand,this,_1,_2),
+                        "Loads the equivalence classes of the inverse reachability from a file.\n"
+                        "Usage::\n\n  Load filename\n\n");
+        RegisterCommand("SetGrasps",boost::bind(&InverseReachabilitySampler::SetGraspsCommand,this,_1,_2),
+                        "Sets the end effector poses to sample the base for, returns the number of grasps that have a distribution.\n"
+                        "Usage::\n\n  SetGrasps [logllthresh f] [weight f] grasps N [quat trans]*N\n\n");
+        RegisterCommand("SampleVerified",boost::bind(&InverseReachabilitySampler::SampleVerifiedCommand,this,_1,_2),
+                        "Samples base placements and keeps the ones where the robot is collision free and the grasp has an ik solution. "
+                        "Returns the number of placements followed by the robot pose, grasp index and ik solution of each.\n"
+                        "Usage::\n\n  SampleVerified num [maxtries]\n\n");
+        string robotname, manipname, samplername;
+        sinput >> robotname >> manipname >> samplername;
+        _probot = GetEnv()->GetRobot(robotname);
+        if( !!_probot ) {
+            _pmanip = manipname.size() > 0 ? _probot->GetManipulator(manipname) : _probot->GetActiveManipulator();
+        }
+        if( samplername.size() == 0 ) {
+            samplername = "mt19937";
+        }
+        _psampler = RaveCreateSpaceSampler(penv,samplername);
+    }
+
+    void SetSeed(uint32_t seed) {
+        _psampler->SetSeed(seed);
+    }
+
+    void SetSpaceDOF(int dof) {
+        BOOST_ASSERT(dof==3);
+    }
+    /// x, y and the rotation around the z-axis
+    int GetDOF() const {
+        return 3;
+    }
+    /// robot pose as quaternion and translation
+    int GetNumberOfValues() const {
+        return 7;
+    }
+    bool Supports(SampleDataType type) const {
+        return !!_psampler && _vcumweights.size() > 0 && type==SDT_Real;
+    }
+
+    int SampleSequence(std::vector<dReal>& samples, size_t num=1,IntervalType interval=IT_Closed)
+    {
+        samples.resize(7*num);
+        for(size_t i = 0; i < num; ++i) {
+            Transform t = _SamplePose(NULL);
+            samples[7*i+0] = t.rot.x; samples[7*i+1] = t.rot.y; samples[7*i+2] = t.rot.z; samples[7*i+3] = t.rot.w;
+            samples[7*i+4] = t.trans.x; samples[7*i+5] = t.trans.y; samples[7*i+6] = t.trans.z;
+        }
+        return (int)num;
+    }
+
+protected:
+    bool LoadCommand(ostream& sout, istream& sinput)
+    {
+        string filename;
+        getline(sinput, filename);
+        boost::trim(filename);
+        std::ifstream f(filename.c_str(), std::ios::binary);
+        char magic[8];
+        uint32_t header[2]; // version, number of classes
+        double params[3];
+        uint32_t numjointvalues[2];
+        if( !f.read(magic, sizeof(magic)) || memcmp(magic, "ORINVRCH", 8) != 0 || !f.read(reinterpret_cast<char*>(header), sizeof(header)) || header[0] != 1 ) {
+            RAVELOG_WARN_FORMAT("%s is not an inverse reachability file", filename);
+            return false;
+        }
+        if( !f.read(reinterpret_cast<char*>(params), sizeof(params)) || !f.read(reinterpret_cast<char*>(numjointvalues), sizeof(numjointvalues)) ) {
+            return false;
+        }
+        std::vector<double> vjointvalues(numjointvalues[0]);
+        if( vjointvalues.size() > 0 && !f.read(reinterpret_cast<char*>(&vjointvalues[0]), vjointvalues.size()*sizeof(double)) ) {
+            return false;
+        }
+
+        size_t numclasses = header[1];
+        _rotweight = params[0];
+        _xyzdelta = params[1];
+        _quatdelta = params[2];
+        _vjointvalues.assign(vjointvalues.begin(), vjointvalues.end());
+        _vclassmeans.resize(5*numclasses);
+        _vclassweights.resize(2*numclasses);
+        _vclassoffsets.resize(numclasses);
+        _vclasspointoffsets.resize(numclasses+1);
+        _vclasspoints.resize(0);
+        _vcumweights.resize(0);
+
+        // same as InverseReachabilityModel.preprocess
+        dReal samplingbandwidth[2] = { _quatdelta*0.1, _xyzdelta*0.1 };
+        for(size_t iclass = 0; iclass < numclasses; ++iclass) {
+            double stats[7]; // mean quaternion and z, std of the quaternion and z
+            uint32_t numpoints[2];
+            if( !f.read(reinterpret_cast<char*>(stats), sizeof(stats)) || !f.read(reinterpret_cast<char*>(numpoints), sizeof(numpoints)) ) {
+                RAVELOG_WARN_FORMAT("%s is truncated", filename);
+                _vclasspoints.resize(0);
+                _vclassmeans.resize(0);
+                return false;
+            }
+            std::copy(stats, stats+5, _vclassmeans.begin()+5*iclass);
+            dReal classstd[2] = { stats[5] + samplingbandwidth[0], stats[6] + samplingbandwidth[1] };
+            _vclassweights[2*iclass+0] = -0.5/(classstd[0]*classstd[0]);
+            _vclassweights[2*iclass+1] = -0.5/(classstd[1]*classstd[1]);
+            _vclassoffsets[iclass] = RaveLog(1.0/(classstd[0]*classstd[0])+0.3334) - 0.5*RaveLog(PI) - 0.5*RaveLog(classstd[1]);
+
+            _vclasspointoffsets[iclass] = _vclasspoints.size()/4;
+            std::vector<double> vpoints(4*numpoints[0]);
+            if( vpoints.size() > 0 && !f.read(reinterpret_cast<char*>(&vpoints[0]), vpoints.size()*sizeof(double)) ) {
+                RAVELOG_WARN_FORMAT("%s is truncated", filename);
+                _vclasspoints.resize(0);
+                _vclassmeans.resize(0);
+                return false;
+            }
+            _vclasspoints.insert(_vclasspoints.end(), vpoints.begin(), vpoints.end());
+        }
+        _vclasspointoffsets[numclasses] = _vclasspoints.size()/4;
+        sout << numclasses;
+        return true;
+    }
+
+    bool SetGraspsCommand(ostream& sout, istream& sinput)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        dReal logllthresh = 2.0;
+        _vgrasps.resize(0);
+        string cmd;
+        while(!sinput.eof()) {
+            sinput >> cmd;
+            if( !sinput ) {
+                break;
+            }
+            std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::tolower);
+            if( cmd == "logllthresh" ) {
+                sinput >> logllthresh;
+            }
+            else if( cmd == "weight" ) {
+                sinput >> _fBandwidthWeight;
+            }
+            else if( cmd == "grasps" ) {
+                size_t numgrasps = 0;
+                sinput >> numgrasps;
+                _vgrasps.resize(numgrasps);
+                for(size_t igrasp = 0; igrasp < numgrasps; ++igrasp) {
+                    sinput >> _vgrasps[igrasp];
+                }
+            }
+            else {
+                RAVELOG_WARN(str(boost::format("unrecognized command: %s\n")%cmd));
+                break;
+            }
+
+            if( !sinput ) {
+                RAVELOG_ERROR(str(boost::format("failed processing command %s\n")%cmd));
+                return false;
+            }
+        }
+
+        if( !_pmanip || _vclassmeans.size() == 0 ) {
+            RAVELOG_WARN("need a manipulator and a loaded distribution\n");
+            return false;
+        }
+
+        // same as InverseReachabilityModel.sampleBaseDistributionIterator
+        Transform tbase = _pmanip->GetBase()->GetTransform();
+        _trobotinbase = _probot->GetTransform()*tbase.inverse();
+        _fbaseheight = tbase.trans.z;
+        dReal zbaseangle = 0;
+        Vector qbasenorm = _NormalizeZRotation(tbase.rot, zbaseangle);
+        if( RaveAcos(std::min(dReal(1), RaveFabs(qbasenorm.x))) > 0.05 ) {
+            throw OPENRAVE_EXCEPTION_FORMAT0("out of plane rotations for base are not supported", ORE_InvalidState);
+        }
+        dReal cbase = RaveCos(zbaseangle), sbase = RaveSin(zbaseangle);
+
+        _vpoints.resize(0);
+        _vcumweights.resize(0);
+        _vpointgraspindices.resize(0);
+        size_t numvalidgrasps = 0;
+        dReal fcumweight = 0;
+        for(size_t igrasp = 0; igrasp < _vgrasps.size(); ++igrasp) {
+            Transform ttarget = tbase.inverse()*_vgrasps[igrasp];
+            dReal znormangle = 0;
+            Vector qnormalized = _NormalizeZRotation(ttarget.rot, znormangle);
+            int ibestclass = -1;
+            dReal fbestlogll = -std::numeric_limits<dReal>::infinity();
+            for(size_t iclass = 0; iclass < _vclassoffsets.size(); ++iclass) {
+                const dReal* pmean = &_vclassmeans[5*iclass];
+                dReal fquatdist = RaveAcos(std::min(dReal(1), RaveFabs(qnormalized.x*pmean[0] + qnormalized.y*pmean[1] + qnormalized.z*pmean[2] + qnormalized.w*pmean[3])));
+                dReal fz = ttarget.trans.z - pmean[4];
+                dReal logll = fquatdist*fquatdist*_vclassweights[2*iclass] + fz*fz*_vclassweights[2*iclass+1] + _vclassoffsets[iclass];
+                if( logll > fbestlogll ) {
+                    fbestlogll = logll;
+                    ibestclass = iclass;
+                }
+            }
+            if( ibestclass < 0 || fbestlogll < logllthresh ) {
+                continue;
+            }
+
+            // transform the class points by the base and grasp pose
+            dReal ctarget = RaveCos(znormangle), starget = RaveSin(znormangle);
+            Vector vtrans(cbase*ttarget.trans.x - sbase*ttarget.trans.y + tbase.trans.x, sbase*ttarget.trans.x + cbase*ttarget.trans.y + tbase.trans.y, 0);
+            dReal crot = cbase*ctarget - sbase*starget, srot = sbase*ctarget + cbase*starget;
+            for(size_t ipoint = _vclasspointoffsets[ibestclass]; ipoint < _vclasspointoffsets[ibestclass+1]; ++ipoint) {
+                const dReal* ppoint = &_vclasspoints[4*ipoint];
+                _vpoints.push_back((ppoint[0] + znormangle + zbaseangle)*_rotweight);
+                _vpoints.push_back(crot*ppoint[1] - srot*ppoint[2] + vtrans.x);
+                _vpoints.push_back(srot*ppoint[1] + crot*ppoint[2] + vtrans.y);
+                fcumweight += ppoint[3];
+                _vcumweights.push_back(fcumweight);
+                _vpointgraspindices.push_back(igrasp);
+            }
+            ++numvalidgrasps;
+        }
+        sout << numvalidgrasps;
+        return true;
+    }
+
+    bool SampleVerifiedCommand(ostream& sout, istream& sinput)
+    {
+        size_t num = 1, maxtries = 0;
+        sinput >> num;
+        if( !sinput ) {
+            return false;
+        }
+        sinput >> maxtries;
+        if( maxtries == 0 ) {
+            maxtries = 100*num;
+        }
+        if( _vcumweights.size() == 0 ) {
+            RAVELOG_WARN("no grasps with a base distribution\n");
+            return false;
+        }
+
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        RobotBase::RobotStateSaver saver(_probot);
+        std::vector<int> vdofindices;
+        _GetBaseChainDOFIndices(vdofindices);
+        if( vdofindices.size() == _vjointvalues.size() && vdofindices.size() > 0 ) {
+            _probot->SetDOFValues(_vjointvalues, KinBody::CLA_CheckLimits, vdofindices);
+        }
+
+        std::stringstream ssresults;
+        ssresults << std::setprecision(std::numeric_limits<dReal>::digits10+1);
+        std::vector<dReal> vsolution;
+        size_t numvalid = 0;
+        for(size_t itry = 0; itry < maxtries && numvalid < num; ++itry) {
+            size_t igrasp = 0;
+            Transform trobot = _SamplePose(&igrasp);
+            _probot->SetTransform(trobot);
+            if( _pmanip->CheckIndependentCollision() ) {
+                continue;
+            }
+            if( !_pmanip->FindIKSolution(_vgrasps.at(igrasp), vsolution, IKFO_CheckEnvCollisions) ) {
+                continue;
+            }
+            ssresults << trobot << " " << igrasp << " ";
+            for(size_t i = 0; i < vsolution.size(); ++i) {
+                ssresults << vsolution[i] << " ";
+            }
+            ++numvalid;
+        }
+        sout << numvalid << " " << ssresults.str();
+        return true;
+    }
+
+    /// \brief samples a point of the kernel density and returns the robot pose
+    Transform _SamplePose(size_t* pgraspindex)
+    {
+        if( _vcumweights.size() == 0 ) {
+            throw OPENRAVE_EXCEPTION_FORMAT0("no grasps with a base distribution", ORE_InvalidState);
+        }
+        _vtempsamples.resize(4);
+        _psampler->SampleSequence(_vtempsamples, 4, IT_OpenEnd);
+        size_t ipoint = std::upper_bound(_vcumweights.begin(), _vcumweights.end(), _vtempsamples[0]*_vcumweights.back()) - _vcumweights.begin();
+        ipoint = std::min(ipoint, _vcumweights.size()-1);
+        if( !!pgraspindex ) {
+            *pgraspindex = _vpointgraspindices[ipoint];
+        }
+        dReal bandwidth[3] = { _rotweight*_quatdelta*_fBandwidthWeight, _xyzdelta*_fBandwidthWeight, _xyzdelta*_fBandwidthWeight };
+        dReal normals[3];
+        _SampleNormal(_vtempsamples[1], _vtempsamples[2], normals[0], normals[1]);
+        _vtempsamples.resize(2);
+        _psampler->SampleSequence(_vtempsamples, 2, IT_OpenEnd);
+        dReal unused;
+        _SampleNormal(_vtempsamples[0], _vtempsamples[1], normals[2], unused);
+
+        dReal halfangle = 0.5*(_vpoints[3*ipoint] + bandwidth[0]*normals[0])/_rotweight;
+        Transform t;
+        t.rot = Vector(RaveCos(halfangle), 0, 0, RaveSin(halfangle));
+        t.trans = Vector(_vpoints[3*ipoint+1] + bandwidth[1]*normals[1], _vpoints[3*ipoint+2] + bandwidth[2]*normals[2], _fbaseheight);
+        return _trobotinbase*t;
+    }
+
+    /// \brief Box-Muller transform of two uniform samples in [0,1)
+    static void _SampleNormal(dReal u0, dReal u1, dReal& n0, dReal& n1)
+    {
+        dReal r = RaveSqrt(-2*RaveLog(1-u0));
+        n0 = r*RaveCos(2*PI*u1);
+        n1 = r*RaveSin(2*PI*u1);
+    }
+
+    /// \brief removes the rotation around the z-axis from quat and returns it in zangle, same as normalizeZRotation in openravepy_ext.py
+    static Vector _NormalizeZRotation(const Vector& quat, dReal& zangle)
+    {
+        dReal angle = RaveAtan2(-quat.w, quat.x);
+        dReal s = RaveSin(angle), c = RaveCos(angle);
+        zangle = -2*angle;
+        return Vector(c*quat.x - s*quat.w, c*quat.y - s*quat.z, c*quat.z + s*quat.y, c*quat.w + s*quat.x);
+    }
+
+    /// \brief dofs of the chain from the robot base to the manipulator base, same as InverseReachabilityModel.getdofindices
+    void _GetBaseChainDOFIndices(std::vector<int>& vdofindices) const
+    {
+        vdofindices.resize(0);
+        std::vector<KinBody::JointPtr> vjoints;
+        _probot->GetChain(0, _pmanip->GetBase()->GetIndex(), vjoints);
+        for(size_t ijoint = 0; ijoint < vjoints.size(); ++ijoint) {
+            if( vjoints[ijoint]->GetDOFIndex() >= 0 && !vjoints[ijoint]->IsStatic() ) {
+                for(int idof = 0; idof < vjoints[ijoint]->GetDOF(); ++idof) {
+                    vdofindices.push_back(vjoints[ijoint]->GetDOFIndex()+idof);
+                }
+            }
+        }
+    }
+
+    SpaceSamplerBasePtr _psampler;
+    RobotBasePtr _probot;
+    RobotBase::ManipulatorPtr _pmanip;
+
+    // equivalence classes, contiguous so the grasps can be matched quickly
+    dReal _rotweight, _xyzdelta, _quatdelta;
+    std::vector<dReal> _vjointvalues; ///< values of the dofs from the robot base to the manipulator base the distribution was computed for
+    std::vector<dReal> _vclassmeans; ///< 5 values per class, mean quaternion and z
+    std::vector<dReal> _vclassweights; ///< 2 values per class, -0.5/bandwidth^2 of the quaternion distance and z
+    std::vector<dReal> _vclassoffsets; ///< log normalization of every class
+    std::vector<dReal> _vclasspoints; ///< 4 values per point, z-angle, x, y, weight
+    std::vector<size_t> _vclasspointoffsets; ///< index of the first point of every class
+
+    // distribution for the current grasps
+    std::vector<Transform> _vgrasps;
+    Transform _trobotinbase;
+    dReal _fbaseheight, _fBandwidthWeight;
+    std::vector<dReal> _vpoints; ///< 3 values per point, z-angle*rotweight, x, y in the world
+    std::vector<dReal> _vcumweights;
+    std::vector<size_t> _vpointgraspindices;
+    std::vector<dReal> _vtempsamples;
+};
@@ -0,0 +1,730 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2006-2011 Rosen Diankov <rosen.diankov@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef OPENRAVE_BASEDEPTHCAMERA_H
+#define OPENRAVE_BASEDEPTHCAMERA_H
+
+#include <boost/lexical_cast.hpp>
+
+/// \brief depth camera that rasterizes the collision meshes of the scene on the CPU
+class BaseDepthCameraSensor : public SensorBase
+{
+protected:
+    class BaseDepthCameraXMLReader : public BaseXMLReader
+    {
+public:
+        BaseDepthCameraXMLReader(boost::shared_ptr<BaseDepthCameraSensor> psensor) : _psensor(psensor) {
+        }
+
+        virtual ProcessElement startElement(const std::string& name, const AttributesList& atts)
+        {
+            if( !!_pcurreader ) {
+                if( _pcurreader->startElement(name,atts) == PE_Support ) {
+                    return PE_Support;
+                }
+                return PE_Ignore;
+            }
+            static boost::array<string, 15> tags = { { "sensor", "kk", "intrinsic", "width", "height", "image_dimensions", "framerate", "power", "color", "minrange", "min_range", "maxrange", "max_range", "threads", "tile_size"}};
+            if( find(tags.begin(),tags.end(),name) == tags.end() ) {
+                return PE_Pass;
+            }
+            ss.str("");
+            return PE_Support;
+        }
+
+        virtual bool endElement(const std::string& name)
+        {
+            if( !!_pcurreader ) {
+                if( _pcurreader->endElement(name) ) {
+                    _pcurreader.reset();
+                }
+                return false;
+            }
+            else if( name == "sensor" ) {
+                return true;
+            }
+            else if((name == "kk")||(name == "KK")) {
+                ss >> _psensor->_pgeom->KK.fx >> _psensor->_pgeom->KK.fy >> _psensor->_pgeom->KK.cx >> _psensor->_pgeom->KK.cy;
+            }
+            else if( name == "intrinsic" ) {
+                dReal dummy0, dummy1;
+                ss >> _psensor->_pgeom->KK.fx >> dummy0 >> _psensor->_pgeom->KK.cx >> dummy1 >> _psensor->_pgeom->KK.fy >> _psensor->_pgeom->KK.cy;
+            }
+            else if( name == "image_dimensions" ) {
+                ss >> _psensor->_pgeom->width >> _psensor->_pgeom->height;
+            }
+            else if( name == "width" ) {
+                ss >> _psensor->_pgeom->width;
+            }
+            else if( name == "height" ) {
+                ss >> _psensor->_pgeom->height;
+            }
+            else if( name == "framerate" ) {
+                ss >> _psensor->_framerate;
+            }
+            else if( name == "power" ) {
+                ss >> _psensor->_bPower;
+            }
+            else if( name == "color" ) {
+                ss >> _psensor->_vColor.x >> _psensor->_vColor.y >> _psensor->_vColor.z;
+                // ok if not everything specified
+                if( !ss ) {
+                    ss.clear();
+                }
+            }
+            else if((name == "minrange")||(name == "min_range")) {
+                ss >> _psensor->_fMinRange;
+            }
+            else if((name == "maxrange")||(name == "max_range")) {
+                ss >> _psensor->_fMaxRange;
+            }
+            else if( name == "threads" ) {
+                ss >> _psensor->_nThreads;
+            }
+            else if( name == "tile_size" ) {
+                ss >> _psensor->_nTileSize;
+            }
+            else {
+                RAVELOG_WARN(str(boost::format("bad tag: %s")%name));
+            }
+            if( !ss ) {
+                RAVELOG_WARN(str(boost::format("BaseDepthCameraSensor error parsing %s\n")%name));
+            }
+            return false;
+        }
+
+        virtual void characters(const std::string& ch)
+        {
+            if( !!_pcurreader ) {
+                _pcurreader->characters(ch);
+            }
+            else {
+                ss.clear();
+                ss << ch;
+            }
+        }
+
+protected:
+        BaseXMLReaderPtr _pcurreader;
+        boost::shared_ptr<BaseDepthCameraSensor> _psensor;
+        stringstream ss;
+    };
+
+    /// \brief collision mesh of one geometry and its transform in the camera frame
+    struct SceneGeometry
+    {
+        const TriMesh* pmesh;
+        Transform tcamera;
+        int bodyid;
+    };
+
+    /// \brief triangle projected to the image, x and y are in pixels and invz is 1/depth so it can be interpolated linearly
+    struct ScreenTriangle
+    {
+        float x[3], y[3], invz[3];
+        int bodyid;
+    };
+
+    /// \brief triangles projected by one thread and binned into the tiles they overlap
+    struct ThreadScratch
+    {
+        std::vector<ScreenTriangle> vtriangles;
+        std::vector< std::vector<uint32_t> > vtilebins; ///< for every tile, the indices into vtriangles
+    };
+
+public:
+    static BaseXMLReaderPtr CreateXMLReader(InterfaceBasePtr ptr, const AttributesList& atts)
+    {
+        return BaseXMLReaderPtr(new BaseDepthCameraXMLReader(boost::dynamic_pointer_cast<BaseDepthCameraSensor>(ptr)));
+    }
+
+    BaseDepthCameraSensor(EnvironmentBasePtr penv) : SensorBase(penv)
+    {
+        __description = ":Interface Author: Rosen Diankov\n\nProvides a simulated depth camera that rasterizes the collision meshes of all enabled links on the CPU, so it runs headless without any viewer or GPU. The image is split into tiles that are rendered by the parallel job threads shared with the rest of OpenRAVE. The output is an organized point cloud as laser data in row major order (index=row*width+column) and a grayscale depth image as camera data. The XML parameters are the same as :ref:`sensor-basecamera` along with:\n\
+* min_range, max_range - depth range in meters, pixels outside of it have no measurement.\n\
+* threads - maximum number of rendering threads, 0 uses all the parallel job threads.\n\
+* tile_size - width and height of the tiles in pixels.\n\
+\n\
+Geometry and data rendering are off by default. The sensor is then stepped concurrently with the other sensors of the environment.\n\
+";
+        RegisterCommand("render",boost::bind(&BaseDepthCameraSensor::_Render,this,_1,_2),
+                        "Set rendering of the plots (1 or 0).");
+        RegisterCommand("collidingbodies",boost::bind(&BaseDepthCameraSensor::_CollidingBodies,this,_1,_2),
+                        "Returns the ids of the bodies that every pixel sees, 0 if none.");
+        RegisterCommand("setintrinsic",boost::bind(&BaseDepthCameraSensor::_SetIntrinsic,this,_1,_2),
+                        "Set the intrinsic parameters of the camera (fx,fy,cx,cy).");
+        RegisterCommand("setdims",boost::bind(&BaseDepthCameraSensor::_SetDims,this,_1,_2),
+                        "Set the dimensions of the image (width,height)");
+        RegisterCommand("RenderDepth",boost::bind(&BaseDepthCameraSensor::_RenderDepthCommand,this,_1,_2),
+                        "Renders the scene right away regardless of power and framerate. The environment should be locked by the caller.");
+        RegisterCommand("GetDepthImage",boost::bind(&BaseDepthCameraSensor::_GetDepthImage,this,_1,_2),
+                        "Returns width, height and the depth of every pixel in meters in row major order, 0 if there is no measurement.");
+
+        _pgeom.reset(new CameraGeomData());
+        _pdata.reset(new LaserSensorData());
+        _pcameradata.reset(new CameraSensorData());
+        _pgeom->KK.fx = 500; _pgeom->KK.fy = 500; _pgeom->KK.cx = 320; _pgeom->KK.cy = 240;
+        _pgeom->width = 640; _pgeom->height = 480;
+        _fMinRange = 0.05;
+        _fMaxRange = 10;
+        _nThreads = 0;
+        _nTileSize = 32;
+        _framerate = 5;
+        _fTimeToImage = 0;
+        _bPower = false;
+        _bRenderData = false;
+        _bRenderGeometry = false;
+        _vColor = RaveVector<float>(0.5f,0.5f,1,1);
+        _Reset();
+    }
+
+    virtual int Configure(ConfigureCommand command, bool blocking)
+    {
+        switch(command) {
+        case CC_PowerOn:
+            _bPower = true;
+            _Reset();
+            return _bPower;
+        case CC_PowerOff:
+            _bPower = false;
+            _Reset();
+            return _bPower;
+        case CC_PowerCheck:
+            return _bPower;
+        case CC_RenderDataOn:
+            _bRenderData = true;
+            return _bRenderData;
+        case CC_RenderDataOff: {
+            boost::mutex::scoped_lock lock(_mutexdata);
+            _listGraphicsHandles.clear();
+            _bRenderData = false;
+            return _bRenderData;
+        }
+        case CC_RenderDataCheck:
+            return _bRenderData;
+        case CC_RenderGeometryOn:
+            _bRenderGeometry = true;
+            return _bRenderData;
+        case CC_RenderGeometryOff: {
+            boost::mutex::scoped_lock lock(_mutexdata);
+            _graphgeometry.reset();
+            _bRenderGeometry = false;
+            return _bRenderData;
+        }
+        case CC_RenderGeometryCheck:
+            return _bRenderGeometry;
+        }
+        throw openrave_exception(str(boost::format("SensorBase::Configure: unknown command 0x%x")%command));
+    }
+
+    virtual void SetSensorGeometry(SensorGeometryConstPtr pgeometry)
+    {
+        OPENRAVE_ASSERT_OP(pgeometry->GetType(), ==, ST_Camera );
+        *_pgeom = *boost::static_pointer_cast<CameraGeomData const>(pgeometry);
+        _Reset();
+    }
+
+    virtual bool SimulationStep(dReal fTimeElapsed)
+    {
+        _fTimeToImage -= fTimeElapsed;
+        if( _fTimeToImage <= 0 && _bPower ) {
+            _fTimeToImage = 1 / (dReal)_framerate;
+            _RenderDepth();
+            // the viewer is not thread safe, so plots are only updated when not stepped concurrently with other sensors
+            _RenderData();
+        }
+        return true;
+    }
+
+    /// \brief only reads the link transforms and collision meshes, never the collision checker
+    virtual bool SupportsConcurrentSimulationStep() const
+    {
+        return !_bRenderData && !_bRenderGeometry;
+    }
+
+    virtual SensorGeometryConstPtr GetSensorGeometry(SensorType type)
+    {
+        if(( type == ST_Invalid) ||( type == ST_Camera) ) {
+            CameraGeomData* pgeom = new CameraGeomData();
+            *pgeom = *_pgeom;
+            return SensorGeometryConstPtr(boost::shared_ptr<CameraGeomData>(pgeom));
+        }
+        if( type == ST_Laser ) {
+            LaserGeomData* pgeom = new LaserGeomData();
+            pgeom->min_range = _fMinRange;
+            pgeom->max_range = _fMaxRange;
+            pgeom->time_scan = 1 / (dReal)_framerate;
+            if( _pgeom->KK.fx > 0 && _pgeom->KK.fy > 0 ) {
+                pgeom->min_angle[0] = RaveAtan2(-_pgeom->KK.cx, _pgeom->KK.fx);
+                pgeom->max_angle[0] = RaveAtan2((dReal)_pgeom->width-_pgeom->KK.cx, _pgeom->KK.fx);
+                pgeom->min_angle[1] = RaveAtan2(-_pgeom->KK.cy, _pgeom->KK.fy);
+                pgeom->max_angle[1] = RaveAtan2((dReal)_pgeom->height-_pgeom->KK.cy, _pgeom->KK.fy);
+                pgeom->resolution[0] = 1/_pgeom->KK.fx;
+                pgeom->resolution[1] = 1/_pgeom->KK.fy;
+            }
+            return SensorGeometryConstPtr(boost::shared_ptr<LaserGeomData>(pgeom));
+        }
+        return SensorGeometryConstPtr();
+    }
+
+    virtual SensorDataPtr CreateSensorData(SensorType type)
+    {
+        if(( type == ST_Invalid) ||( type == ST_Laser) ) {
+            return SensorDataPtr(boost::shared_ptr<LaserSensorData>(new LaserSensorData()));
+        }
+        if( type == ST_Camera ) {
+            return SensorDataPtr(boost::shared_ptr<CameraSensorData>(new CameraSensorData()));
+        }
+        return SensorDataPtr();
+    }
+
+    virtual bool GetSensorData(SensorDataPtr psensordata)
+    {
+        if( psensordata->GetType() == ST_Laser ) {
+            boost::mutex::scoped_lock lock(_mutexdata);
+            *boost::dynamic_pointer_cast<LaserSensorData>(psensordata) = *_pdata;
+            return true;
+        }
+        if( psensordata->GetType() == ST_Camera ) {
+            boost::mutex::scoped_lock lock(_mutexdata);
+            if( _pcameradata->vimagedata.size() > 0 ) {
+                *boost::dynamic_pointer_cast<CameraSensorData>(psensordata) = *_pcameradata;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    virtual bool Supports(SensorType type) {
+        return type == ST_Laser || type == ST_Camera;
+    }
+
+    virtual void SetTransform(const Transform& trans)
+    {
+        _trans = trans;
+    }
+
+    virtual const Transform& GetTransform() {
+        return _trans;
+    }
+
+    virtual void Clone(InterfaceBaseConstPtr preference, int cloningoptions)
+    {
+        SensorBase::Clone(preference,cloningoptions);
+        boost::shared_ptr<BaseDepthCameraSensor const> r = boost::dynamic_pointer_cast<BaseDepthCameraSensor const>(preference);
+        *_pgeom = *r->_pgeom;
+        _vColor = r->_vColor;
+        _trans = r->_trans;
+        _fMinRange = r->_fMinRange;
+        _fMaxRange = r->_fMaxRange;
+        _nThreads = r->_nThreads;
+        _nTileSize = r->_nTileSize;
+        _framerate = r->_framerate;
+        _fTimeToImage = r->_fTimeToImage;
+        _bRenderGeometry = r->_bRenderGeometry;
+        _bRenderData = r->_bRenderData;
+        _bPower = r->_bPower;
+        _Reset();
+    }
+
+    void Serialize(BaseXMLWriterPtr writer, int options=0) const override
+    {
+        _pgeom->SerializeXML(writer, options);
+        AttributesList atts;
+        writer->AddChild("min_range",atts)->SetCharData(boost::lexical_cast<std::string>(_fMinRange));
+        writer->AddChild("max_range",atts)->SetCharData(boost::lexical_cast<std::string>(_fMaxRange));
+        writer->AddChild("threads",atts)->SetCharData(boost::lexical_cast<std::string>(_nThreads));
+        writer->AddChild("tile_size",atts)->SetCharData(boost::lexical_cast<std::string>(_nTileSize));
+    }
+
+protected:
+    virtual void _Reset()
+    {
+        boost::mutex::scoped_lock lock(_mutexdata);
+        _listGraphicsHandles.clear();
+        _graphgeometry.reset();
+        _pdata->positions.resize(1);
+        _pdata->positions[0] = _trans.trans;
+        _pdata->ranges.resize(0);
+        _pdata->intensity.resize(0);
+        _pdata->__stamp = 0;
+        _pcameradata->vimagedata.resize(0);
+        _pcameradata->__stamp = 0;
+        _vdepth.resize(0);
+        _vbodyids.resize(0);
+    }
+
+    /// \brief renders the depth image and point cloud of the current scene, the caller should have the environment locked
+    void _RenderDepth()
+    {
+        const int width = _pgeom->width, height = _pgeom->height;
+        if( width <= 0 || height <= 0 || _pgeom->KK.fx <= 0 || _pgeom->KK.fy <= 0 ) {
+            return;
+        }
+        const int tilesize = max(8, _nTileSize);
+        const int numtilesx = (width+tilesize-1)/tilesize, numtilesy = (height+tilesize-1)/tilesize;
+        const int numtiles = numtilesx*numtilesy;
+
+        // the jobs run on the workers shared by all environments, _nThreads only limits how many of them render this camera
+        const int maxthreads = max(0, _nThreads);
+        _vthreadscratch.resize(RaveGetNumParallelJobThreads());
+        FOREACH(itscratch, _vthreadscratch) {
+            itscratch->vtriangles.resize(0);
+            itscratch->vtilebins.resize(numtiles);
+            FOREACH(itbin, itscratch->vtilebins) {
+                itbin->resize(0);
+            }
+        }
+
+        // gather the collision meshes of the scene, reading them does not need the collision checker
+        Transform tcamera = _trans;
+        Transform tcamerainv = tcamera.inverse();
+        GetEnv()->GetBodies(_vbodiescache);
+        _vscenegeoms.resize(0);
+        FOREACHC(itbody, _vbodiescache) {
+            if( (*itbody)->GetEnvironmentId() == 0 || !(*itbody)->IsEnabled() ) {
+                continue;
+            }
+            FOREACHC(itlink, (*itbody)->GetLinks()) {
+                if( !(*itlink)->IsEnabled() ) {
+                    continue;
+                }
+                Transform tlink = tcamerainv * (*itlink)->GetTransform();
+                FOREACHC(itgeom, (*itlink)->GetGeometries()) {
+                    const TriMesh& mesh = (*itgeom)->GetCollisionMesh();
+                    if( mesh.indices.size() < 3 ) {
+                        continue;
+                    }
+                    SceneGeometry scenegeom;
+                    scenegeom.pmesh = &mesh;
+                    scenegeom.tcamera = tlink * (*itgeom)->GetTransform();
+                    scenegeom.bodyid = (*itbody)->GetEnvironmentId();
+                    _vscenegeoms.push_back(scenegeom);
+                }
+            }
+        }
+
+        // project and bin the triangles of every geometry in parallel
+        RaveRunParallelJobs(boost::bind(&BaseDepthCameraSensor::_ProjectGeometry, this, _1, _2, tilesize, numtilesx, numtilesy), (int)_vscenegeoms.size(), maxthreads);
+
+        // rasterize every tile in parallel, tiles do not share pixels so there are no write conflicts
+        _vdepthwork.resize(width*height);
+        _vbodyidswork.resize(width*height);
+        _vrangeswork.resize(width*height);
+        _vintensitywork.resize(width*height);
+        _vimagework.resize(3*width*height);
+        RaveRunParallelJobs(boost::bind(&BaseDepthCameraSensor::_RasterizeTile, this, _1, _2, tilesize, numtilesx, tcamera), numtiles, maxthreads);
+        _vbodiescache.resize(0);
+
+        boost::mutex::scoped_lock lock(_mutexdata);
+        _pdata->__trans = tcamera;
+        _pdata->__stamp = GetEnv()->GetSimulationTime();
+        _pdata->positions.resize(1);
+        _pdata->positions[0] = tcamera.trans;
+        _pdata->ranges.swap(_vrangeswork);
+        _pdata->intensity.swap(_vintensitywork);
+        _pcameradata->__trans = tcamera;
+        _pcameradata->__stamp = _pdata->__stamp;
+        _pcameradata->vimagedata.swap(_vimagework);
+        _vdepth.swap(_vdepthwork);
+        _vbodyids.swap(_vbodyidswork);
+    }
+
+    /// \brief transforms the triangles of one geometry to the camera, clips them at the near plane and bins them into the tiles
+    void _ProjectGeometry(int geomindex, int threadindex, int tilesize, int numtilesx, int numtilesy)
+    {
+        const SceneGeometry& scenegeom = _vscenegeoms.at(geomindex);
+        ThreadScratch& scratch = _vthreadscratch.at(threadindex);
+        const TriMesh& mesh = *scenegeom.pmesh;
+        const dReal fznear = max(_fMinRange, dReal(1e-4));
+        const dReal fx = _pgeom->KK.fx, fy = _pgeom->KK.fy, cx = _pgeom->KK.cx, cy = _pgeom->KK.cy;
+        const dReal fwidth = _pgeom->width, fheight = _pgeom->height;
+
+        Vector vpoly[4];
+        for(size_t itri = 0; itri+2 < mesh.indices.size(); itri += 3) {
+            Vector v[3];
+            int numinside = 0;
+            for(int j = 0; j < 3; ++j) {
+                v[j] = scenegeom.tcamera * mesh.vertices[mesh.indices[itri+j]];
+                if( v[j].z >= fznear ) {
+                    ++numinside;
+                }
+            }
+            if( numinside == 0 ) {
+                continue;
+            }
+            if( v[0].z > _fMaxRange && v[1].z > _fMaxRange && v[2].z > _fMaxRange ) {
+                continue;
+            }
+
+            // clip against the near plane, this gives a triangle or a quad
+            int numpoly = 0;
+            if( numinside == 3 ) {
+                vpoly[0] = v[0]; vpoly[1] = v[1]; vpoly[2] = v[2];
+                numpoly = 3;
+            }
+            else {
+                for(int j = 0; j < 3; ++j) {
+                    const Vector& vcur = v[j];
+                    const Vector& vnext = v[(j+1)%3];
+                    bool bcurinside = vcur.z >= fznear, bnextinside = vnext.z >= fznear;
+                    if( bcurinside ) {
+                        vpoly[numpoly++] = vcur;
+                    }
+                    if( bcurinside != bnextinside ) {
+                        dReal t = (fznear - vcur.z)/(vnext.z - vcur.z);
+                        vpoly[numpoly++] = vcur + (vnext - vcur)*t;
+                    }
+                }
+            }
+
+            ScreenTriangle screentri;
+            screentri.bodyid = scenegeom.bodyid;
+            for(int ifan = 1; ifan+1 < numpoly; ++ifan) {
+                const Vector* pverts[3] = { &vpoly[0], &vpoly[ifan], &vpoly[ifan+1]};
+                dReal minx = fwidth, maxx = -1, miny = fheight, maxy = -1;
+                for(int j = 0; j < 3; ++j) {
+                    dReal invz = 1/pverts[j]->z;
+                    dReal x = fx*pverts[j]->x*invz + cx, y = fy*pverts[j]->y*invz + cy;
+                    screentri.x[j] = (float)x;
+                    screentri.y[j] = (float)y;
+                    screentri.invz[j] = (float)invz;
+                    minx = min(minx, x); maxx = max(maxx, x);
+                    miny = min(miny, y); maxy = max(maxy, y);
+                }
+                // pixel centers are at integer coordinates, skip triangles that do not cover any of them
+                int iminx = max(0, (int)ceil(minx)), imaxx = min(_pgeom->width-1, (int)floor(maxx));
+                int iminy = max(0, (int)ceil(miny)), imaxy = min(_pgeom->height-1, (int)floor(maxy));
+                if( iminx > imaxx || iminy > imaxy ) {
+                    continue;
+                }
+                uint32_t triindex = scratch.vtriangles.size();
+                scratch.vtriangles.push_back(screentri);
+                for(int tiley = iminy/tilesize; tiley <= imaxy/tilesize && tiley < numtilesy; ++tiley) {
+                    for(int tilex = iminx/tilesize; tilex <= imaxx/tilesize && tilex < numtilesx; ++tilex) {
+                        scratch.vtilebins[tiley*numtilesx+tilex].push_back(triindex);
+                    }
+                }
+            }
+        }
+    }
+
+    /// \brief rasterizes all triangles binned into a tile with a z-buffer on 1/depth and converts the tile to the outputs
+    void _RasterizeTile(int tileindex, int threadindex, int tilesize, int numtilesx, const Transform& tcamera)
+    {
+        const int width = _pgeom->width, height = _pgeom->height;
+        const int x0 = (tileindex%numtilesx)*tilesize, y0 = (tileindex/numtilesx)*tilesize;
+        const int x1 = min(x0+tilesize, width), y1 = min(y0+tilesize, height);
+        const float fmininvz = _fMaxRange > 0 ? (float)(1/_fMaxRange) : 0;
+
+        // 0 is infinitely far
+        for(int y = y0; y < y1; ++y) {
+            std::fill(&_vdepthwork[y*width+x0], &_vdepthwork[y*width+x1-1]+1, 0.0f);
+            std::fill(&_vbodyidswork[y*width+x0], &_vbodyidswork[y*width+x1-1]+1, 0);
+        }
+
+        FOREACHC(itscratch, _vthreadscratch) {
+            FOREACHC(ittriindex, itscratch->vtilebins.at(tileindex)) {
+                const ScreenTriangle& tri = itscratch->vtriangles[*ittriindex];
+                float area = (tri.x[1]-tri.x[0])*(tri.y[2]-tri.y[0]) - (tri.x[2]-tri.x[0])*(tri.y[1]-tri.y[0]);
+                if( fabsf(area) < 1e-12f ) {
+                    continue;
+                }
+                float invarea = 1/area;
+                int minx = max(x0, (int)ceil(min(tri.x[0], min(tri.x[1], tri.x[2])))), maxx = min(x1-1, (int)floor(max(tri.x[0], max(tri.x[1], tri.x[2]))));
+                int miny = max(y0, (int)ceil(min(tri.y[0], min(tri.y[1], tri.y[2])))), maxy = min(y1-1, (int)floor(max(tri.y[0], max(tri.y[1], tri.y[2]))));
+                if( minx > maxx || miny > maxy ) {
+                    continue;
+                }
+
+                // barycentric weights of edges opposite to vertex 0 and 1, both are linear in x and y
+                float dw0dx = (tri.y[1]-tri.y[2])*invarea, dw0dy = (tri.x[2]-tri.x[1])*invarea;
+                float dw1dx = (tri.y[2]-tri.y[0])*invarea, dw1dy = (tri.x[0]-tri.x[2])*invarea;
+                float w0row = ((tri.x[1]-minx)*(tri.y[2]-miny) - (tri.x[2]-minx)*(tri.y[1]-miny))*invarea;
+                float w1row = ((tri.x[2]-minx)*(tri.y[0]-miny) - (tri.x[0]-minx)*(tri.y[2]-miny))*invarea;
+                for(int y = miny; y <= maxy; ++y, w0row += dw0dy, w1row += dw1dy) {
+                    float w0 = w0row, w1 = w1row;
+                    float* pdepth = &_vdepthwork[y*width];
+                    int* pbodyid = &_vbodyidswork[y*width];
+                    for(int x = minx; x <= maxx; ++x, w0 += dw0dx, w1 += dw1dx) {
+                        float w2 = 1 - w0 - w1;
+                        if( w0 < 0 || w1 < 0 || w2 < 0 ) {
+                            continue;
+                        }
+                        float invz = w0*tri.invz[0] + w1*tri.invz[1] + w2*tri.invz[2];
+                        if( invz > pdepth[x] && invz >= fmininvz ) {
+                            pdepth[x] = invz;
+                            pbodyid[x] = tri.bodyid;
+                        }
+                    }
+                }
+            }
+        }
+
+        // convert 1/depth to depth, the point cloud and the grayscale image
+        const dReal ifx = 1/_pgeom->KK.fx, ify = 1/_pgeom->KK.fy;
+        const dReal fdepthscale = _fMaxRange > _fMinRange ? 255/(_fMaxRange-_fMinRange) : 0;
+        for(int y = y0; y < y1; ++y) {
+            for(int x = x0; x < x1; ++x) {
+                int index = y*width+x;
+                Vector vdir((x-_pgeom->KK.cx)*ifx, (y-_pgeom->KK.cy)*ify, 1);
+                vdir = tcamera.rotate(vdir);
+                if( _vdepthwork[index] > 0 ) {
+                    dReal depth = 1/(dReal)_vdepthwork[index];
+                    _vdepthwork[index] = (float)depth;
+                    _vrangeswork[index] = vdir*depth;
+                    _vintensitywork[index] = 1;
+                    uint8_t gray = (uint8_t)max(dReal(0), min(dReal(255), 255 - (depth-_fMinRange)*fdepthscale));
+                    _vimagework[3*index+0] = _vimagework[3*index+1] = _vimagework[3*index+2] = gray;
+                }
+                else {
+                    _vrangeswork[index] = vdir*_fMaxRange;
+                    _vintensitywork[index] = 0;
+                    _vimagework[3*index+0] = _vimagework[3*index+1] = _vimagework[3*index+2] = 0;
+                }
+            }
+        }
+    }
+
+    void _RenderData()
+    {
+        if( _bRenderGeometry ) {
+            if( !_graphgeometry ) {
+                dReal ik0 = 1/_pgeom->KK.fx, ik1 = 1/_pgeom->KK.fy;
+                vector<RaveVector<float> > viconpoints(5);
+                viconpoints[0] = Vector(0,0,0);
+                viconpoints[1] = 0.1f*Vector(-_pgeom->KK.cx*ik0, -_pgeom->KK.cy*ik1, 1);
+                viconpoints[2] = 0.1f*Vector(((dReal)_pgeom->width-_pgeom->KK.cx)*ik0, -_pgeom->KK.cy*ik1, 1);
+                viconpoints[3] = 0.1f*Vector(((dReal)_pgeom->width-_pgeom->KK.cx)*ik0, ((dReal)_pgeom->height-_pgeom->KK.cy)*ik1, 1);
+                viconpoints[4] = 0.1f*Vector(-_pgeom->KK.cx*ik0, ((dReal)_pgeom->height-_pgeom->KK.cy)*ik1, 1);
+                boost::array<int,18> viconindices = { { 0,1,2, 0,2,3, 0,3,4, 0,4,1, 1,2,3, 1,3,4}};
+                RaveVector<float> vcolor = _vColor*0.5f;
+                vcolor.w = 0.7f;
+                _graphgeometry = GetEnv()->drawtrimesh(&viconpoints[0].x, sizeof(viconpoints[0]), &viconindices[0], 6, vcolor);
+            }
+            if( !!_graphgeometry ) {
+                _graphgeometry->SetTransform(_trans);
+            }
+        }
+
+        if( _bRenderData ) {
+            vector<RaveVector<float> > vpoints;
+            {
+                boost::mutex::scoped_lock lock(_mutexdata);
+                vpoints.reserve(_pdata->ranges.size());
+                for(size_t i = 0; i < _pdata->ranges.size(); ++i) {
+                    if( _pdata->intensity[i] > 0 ) {
+                        vpoints.push_back(_pdata->ranges[i] + _pdata->positions.at(0));
+                    }
+                }
+            }
+            list<GraphHandlePtr> listhandles;
+            if( vpoints.size() > 0 ) {
+                listhandles.push_back(GetEnv()->plot3(&vpoints[0].x, vpoints.size(), sizeof(vpoints[0]), 2.0f, _vColor));
+            }
+            _listGraphicsHandles.swap(listhandles);
+        }
+        else {
+            _listGraphicsHandles.clear();
+        }
+    }
+
+    bool _Render(ostream& sout, istream& sinput)
+    {
+        sinput >> _bRenderData;
+        return !!sinput;
+    }
+
+    bool _CollidingBodies(ostream& sout, istream& sinput)
+    {
+        boost::mutex::scoped_lock lock(_mutexdata);
+        FOREACH(it, _vbodyids) {
+            sout << *it << " ";
+        }
+        return true;
+    }
+
+    bool _SetIntrinsic(ostream& sout, istream& sinput)
+    {
+        sinput >> _pgeom->KK.fx >> _pgeom->KK.fy >> _pgeom->KK.cx >> _pgeom->KK.cy;
+        if( !!sinput ) {
+            _Reset();
+            return true;
+        }
+        return false;
+    }
+
+    bool _SetDims(ostream& sout, istream& sinput)
+    {
+        sinput >> _pgeom->width >> _pgeom->height;
+        if( !!sinput ) {
+            _Reset();
+            return true;
+        }
+        return false;
+    }
+
+    bool _RenderDepthCommand(ostream& sout, istream& sinput)
+    {
+        _RenderDepth();
+        return true;
+    }
+
+    bool _GetDepthImage(ostream& sout, istream& sinput)
+    {
+        boost::mutex::scoped_lock lock(_mutexdata);
+        if( _vdepth.size() == 0 ) {
+            return false;
+        }
+        sout << _pgeom->width << " " << _pgeom->height;
+        FOREACHC(it, _vdepth) {
+            sout << " " << *it;
+        }
+        return true;
+    }
+
+    boost::shared_ptr<CameraGeomData> _pgeom;
+    boost::shared_ptr<LaserSensorData> _pdata; ///< organized point cloud
+    boost::shared_ptr<CameraSensorData> _pcameradata; ///< grayscale depth image, brighter is closer
+    std::vector<float> _vdepth; ///< depth of every pixel in meters, 0 if no measurement
+    std::vector<int> _vbodyids; ///< environment id of the body every pixel sees, 0 if none
+
+    // rendering state, only used by the thread calling _RenderDepth and the workers while it runs
+    std::vector<ThreadScratch> _vthreadscratch; ///< indexed by the thread index given by RaveRunParallelJobs
+    std::vector<KinBodyPtr> _vbodiescache; ///< keeps the bodies alive while their meshes are read
+    std::vector<SceneGeometry> _vscenegeoms;
+    std::vector<float> _vdepthwork;
+    std::vector<int> _vbodyidswork;
+    std::vector<RaveVector<dReal> > _vrangeswork;
+    std::vector<dReal> _vintensitywork;
+    std::vector<uint8_t> _vimagework;
+
+    RaveVector<float> _vColor;
+    Transform _trans;
+    dReal _fMinRange, _fMaxRange; ///< depth range in meters
+    int _nThreads; ///< maximum number of rendering threads including the calling thread, 0 for all the parallel job threads
+    int _nTileSize; ///< width and height of the tiles in pixels
+    float _framerate;
+    dReal _fTimeToImage;
+    list<GraphHandlePtr> _listGraphicsHandles;
+    GraphHandlePtr _graphgeometry;
+
+    mutable boost::mutex _mutexdata;
+    bool _bRenderData, _bRenderGeometry, _bPower;
+
+    friend class BaseDepthCameraXMLReader;
+};
+
+#endif
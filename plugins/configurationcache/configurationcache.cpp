@@ -21,6 +21,7 @@ namespace configurationcache
 CollisionCheckerBasePtr CreateCacheCollisionChecker(EnvironmentBasePtr penv, std::istream& sinput);
 SpaceSamplerBasePtr CreateConfigurationJitterer(EnvironmentBasePtr penv, std::istream& sinput);
 SpaceSamplerBasePtr CreateWorkspaceConfigurationJitterer(EnvironmentBasePtr penv, std::istream& sinput);
+PlannerBasePtr CreatePathLibraryPlanner(EnvironmentBasePtr penv, std::istream& sinput);
 }
 
 InterfaceBasePtr CreateInterfaceValidated(InterfaceType type, const std::string& interfacename, std::istream& sinput, EnvironmentBasePtr penv)
@@ -39,6 +40,11 @@ InterfaceBasePtr CreateInterfaceValidated(InterfaceType type, const std::string&
             return configurationcache::CreateWorkspaceConfigurationJitterer(penv,sinput);
         }
         break;
+    case PT_Planner:
+        if( interfacename == "pathlibrary" ) {
+            return configurationcache::CreatePathLibraryPlanner(penv,sinput);
+        }
+        break;
     default:
         break;
     }
@@ -50,6 +56,7 @@ void GetPluginAttributesValidated(PLUGININFO& info)
     info.interfacenames[PT_CollisionChecker].push_back("CacheChecker");
     info.interfacenames[PT_SpaceSampler].push_back("ConfigurationJitterer");
     info.interfacenames[PT_SpaceSampler].push_back("WorkspaceConfigurationJitterer");
+    info.interfacenames[PT_Planner].push_back("PathLibrary");
 }
 
 OPENRAVE_PLUGIN_API void DestroyPlugin()
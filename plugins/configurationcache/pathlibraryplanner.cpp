@@ -0,0 +1,537 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2014 Alejandro Perez & Rosen Diankov
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "openraveplugindefs.h"
+#include "configurationcachetree.h"
+
+#include <boost/algorithm/string.hpp>
+
+namespace configurationcache
+{
+
+/** \brief planner that reuses the paths of previous queries.
+
+    Every successful path is stored in a trajectory and indexed in a CacheTree by the feature [start, goal]. Like in
+    ConfigurationCache, the feature distances are weighted by the inverse dof resolutions. A new query retrieves the paths
+    stored at the nearest feature if it is within _fMaxFeatureDist, connects them to the new start and goal, and repairs the
+    segments that became invalid with local BiRRT calls. If no stored path can be repaired, the query is solved with the
+    fallback planner and its path is added to the library. Once the library has _nMaxPaths paths, new paths replace the stored
+    ones in the order they were added.
+ */
+class PathLibraryPlanner : public PlannerBase
+{
+public:
+    PathLibraryPlanner(EnvironmentBasePtr penv, std::istream& sinput) : PlannerBase(penv)
+    {
+        __description = ":Interface Author: Alejandro Perez and Rosen Diankov\n\n\
+Experience-based planner that stores successful paths indexed by their start and goal configurations. A new query retrieves the paths with the nearest start and goal, repairs their invalid segments with local BiRRT calls, and uses the fallback planner if no path could be repaired. The library persists across PlanPath calls and is capped in size, the oldest paths are replaced first.";
+        RegisterCommand("SetFallbackPlanner", boost::bind(&PathLibraryPlanner::_SetFallbackPlannerCommand,this,_1,_2),
+                        "sets the planner used when no stored path can be repaired, default is BiRRT. Format: plannername");
+        RegisterCommand("SetRepairParameters", boost::bind(&PathLibraryPlanner::_SetRepairParametersCommand,this,_1,_2),
+                        "sets the maximum iterations of every local repair and the maximum number of stored paths per feature. Format: maxrepairiterations maxpathsperfeature");
+        RegisterCommand("SetLibraryParameters", boost::bind(&PathLibraryPlanner::_SetLibraryParametersCommand,this,_1,_2),
+                        "sets the maximum number of stored paths (default 1000) and the maximum distance of a stored feature to the query feature in units of the dof resolutions (default 100). Format: maxpaths maxfeaturedist");
+        RegisterCommand("SaveLibrary", boost::bind(&PathLibraryPlanner::_SaveLibraryCommand,this,_1,_2),
+                        "saves all the stored paths to a file. Format: filename");
+        RegisterCommand("LoadLibrary", boost::bind(&PathLibraryPlanner::_LoadLibraryCommand,this,_1,_2),
+                        "loads stored paths from a file, the planner has to be initialized with the same configuration specification. Format: filename");
+        RegisterCommand("ClearLibrary", boost::bind(&PathLibraryPlanner::_ClearLibraryCommand,this,_1,_2),
+                        "removes all the stored paths");
+        RegisterCommand("GetLibraryInfo", boost::bind(&PathLibraryPlanner::_GetLibraryInfoCommand,this,_1,_2),
+                        "returns the number of stored paths, number of features, number of queries solved from the library, and number of queries solved by the fallback planner");
+        _fallbackplannername = "BiRRT";
+        _nMaxRepairIterations = 200;
+        _nMaxPathsPerFeature = 4;
+        _nMaxPaths = 1000;
+        _fMaxFeatureDist = 100;
+        _fInsertionDist = 0.1; // _freespacethresh*_insertiondistancemult of ConfigurationCache
+        _nNextReplacedPath = 0;
+        _nLibraryHits = 0;
+        _nFallbacks = 0;
+    }
+    virtual ~PathLibraryPlanner() {
+    }
+
+    virtual bool InitPlan(RobotBasePtr pbase, PlannerParametersConstPtr pparams)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        pparams->Validate();
+        _parameters.reset(new PlannerParameters());
+        _parameters->copy(pparams);
+        _robot = pbase;
+
+        const int dof = _parameters->GetDOF();
+        if( (_parameters->vgoalconfig.size() % dof) != 0 || _parameters->vgoalconfig.size() == 0 || _parameters->vinitialconfig.size() < (size_t)dof ) {
+            RAVELOG_WARN_FORMAT("env=%d, initial or goal configurations are improperly specified", GetEnv()->GetId());
+            _parameters.reset();
+            return false;
+        }
+
+        if( !_featuretree || _libraryspec != _parameters->_configurationspecification ) {
+            if( _vpaths.size() > 0 ) {
+                RAVELOG_INFO_FORMAT("env=%d, configuration specification changed, clearing %d stored paths", GetEnv()->GetId()%_vpaths.size());
+            }
+            _libraryspec = _parameters->_configurationspecification;
+            _InitFeatureTree();
+        }
+
+        // local repairs and the fallback are raw paths, the post-processing is done once on the final path
+        _fallbackparameters.reset(new RRTParameters());
+        _fallbackparameters->copy(_parameters);
+        _fallbackparameters->_sPostProcessingPlanner = "";
+        _fallbackparameters->_sPostProcessingParameters = "";
+        _repairparameters.reset(new RRTParameters());
+        _repairparameters->copy(_fallbackparameters);
+        _repairparameters->_nMaxIterations = _nMaxRepairIterations;
+        _repairparameters->_nMaxPlanningTime = 0;
+
+        if( !_repairplanner ) {
+            _repairplanner = RaveCreatePlanner(GetEnv(), "BiRRT");
+            if( !_repairplanner ) {
+                RAVELOG_WARN_FORMAT("env=%d, failed to create BiRRT for local repairs", GetEnv()->GetId());
+                _parameters.reset();
+                return false;
+            }
+        }
+        if( !_fallbackplanner || _fallbackplanner->GetXMLId() != _fallbackplannername ) {
+            _fallbackplanner = RaveCreatePlanner(GetEnv(), _fallbackplannername);
+            if( !_fallbackplanner ) {
+                RAVELOG_WARN_FORMAT("env=%d, failed to create fallback planner %s", GetEnv()->GetId()%_fallbackplannername);
+                _parameters.reset();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    virtual PlannerStatus PlanPath(TrajectoryBasePtr ptraj, int planningoptions) override
+    {
+        if(!_parameters) {
+            return OPENRAVE_PLANNER_STATUS(str(boost::format("env=%d, PathLibraryPlanner::PlanPath - Error, planner not initialized")%GetEnv()->GetId()), PS_Failed);
+        }
+
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        uint64_t basetimeus = utils::GetMonotonicTime();
+        PlannerParameters::StateSaver savestate(_parameters);
+
+        const int dof = _parameters->GetDOF();
+        std::vector<dReal> vstart(_parameters->vinitialconfig.begin(), _parameters->vinitialconfig.begin()+dof), vgoal(dof);
+        std::vector<dReal> vpath;
+        {
+            CollisionOptionsStateSaver optionstate(GetEnv()->GetCollisionChecker(),GetEnv()->GetCollisionChecker()->GetCollisionOptions()|CO_ActiveDOFs,false);
+            // gather the candidate paths of all goals sorted by the distance of their feature to the query
+            std::vector< std::pair<dReal, std::pair<int, int> > > vcandidates; // (distance, (path index, goal index))
+            for(size_t igoal = 0; igoal*dof < _parameters->vgoalconfig.size(); ++igoal) {
+                std::copy(_parameters->vgoalconfig.begin()+igoal*dof, _parameters->vgoalconfig.begin()+(igoal+1)*dof, vgoal.begin());
+                _ComputeFeature(vstart, vgoal, _vfeature);
+                std::pair<CacheTreeNodeConstPtr, dReal> nn = _featuretree->FindNearestNode(_vfeature);
+                if( !nn.first || nn.second > _fMaxFeatureDist ) {
+                    // repairing a path between far away configurations is slower than planning from scratch
+                    continue;
+                }
+                std::map<std::vector<dReal>, std::vector<int> >::const_iterator itfeature = _mapFeaturePaths.find(std::vector<dReal>(nn.first->GetConfigurationState(), nn.first->GetConfigurationState()+2*dof));
+                if( itfeature != _mapFeaturePaths.end() ) {
+                    FOREACHC(itpath, itfeature->second) {
+                        vcandidates.push_back(std::make_pair(nn.second, std::make_pair(*itpath, (int)igoal)));
+                    }
+                }
+            }
+            std::sort(vcandidates.begin(), vcandidates.end());
+
+            FOREACHC(itcandidate, vcandidates) {
+                if( _parameters->_nMaxPlanningTime > 0 && utils::GetMonotonicTime()-basetimeus >= 1000*(uint64_t)_parameters->_nMaxPlanningTime ) {
+                    break;
+                }
+                std::copy(_parameters->vgoalconfig.begin()+itcandidate->second.second*dof, _parameters->vgoalconfig.begin()+(itcandidate->second.second+1)*dof, vgoal.begin());
+                if( _RepairPath(_vpaths.at(itcandidate->second.first), vstart, vgoal, vpath) ) {
+                    break;
+                }
+                vpath.resize(0);
+            }
+        }
+
+        if( vpath.size() > 0 ) {
+            ++_nLibraryHits;
+            RAVELOG_DEBUG_FORMAT("env=%d, path repaired from library in %u[us], %d points", GetEnv()->GetId()%(utils::GetMonotonicTime()-basetimeus)%(vpath.size()/dof));
+        }
+        else {
+            // full planning, the robot state was restored by the repair planners
+            if( !_fallbackplanner->InitPlan(_robot, _fallbackparameters) ) {
+                std::string description = str(boost::format("env=%d, failed to initialize fallback planner %s")%GetEnv()->GetId()%_fallbackplannername);
+                RAVELOG_WARN(description);
+                return OPENRAVE_PLANNER_STATUS(description, PS_Failed);
+            }
+            if( !_fallbacktraj ) {
+                _fallbacktraj = RaveCreateTrajectory(GetEnv(), ptraj->GetXMLId());
+            }
+            _fallbacktraj->Init(_parameters->_configurationspecification);
+            PlannerStatus status = _fallbackplanner->PlanPath(_fallbacktraj);
+            if( !(status.GetStatusCode() & PS_HasSolution) ) {
+                return status;
+            }
+            _fallbacktraj->GetWaypoints(0, _fallbacktraj->GetNumWaypoints(), vpath, _parameters->_configurationspecification);
+            int goalindex = _FindGoalIndex(vpath);
+            std::copy(_parameters->vgoalconfig.begin()+goalindex*dof, _parameters->vgoalconfig.begin()+(goalindex+1)*dof, vgoal.begin());
+            _AddPath(vstart, vgoal, _fallbacktraj);
+            ++_nFallbacks;
+            RAVELOG_DEBUG_FORMAT("env=%d, no stored path could be repaired, planned with %s in %u[us], library has %d paths", GetEnv()->GetId()%_fallbackplannername%(utils::GetMonotonicTime()-basetimeus)%_vpaths.size());
+        }
+
+        if( ptraj->GetConfigurationSpecification().GetDOF() == 0 ) {
+            ptraj->Init(_parameters->_configurationspecification);
+        }
+        ptraj->Insert(ptraj->GetNumWaypoints(), vpath, _parameters->_configurationspecification);
+        return _ProcessPostPlanners(_robot,ptraj);
+    }
+
+    virtual PlannerParametersConstPtr GetParameters() const {
+        return _parameters;
+    }
+
+protected:
+    void _InitFeatureTree()
+    {
+        const int dof = _parameters->GetDOF();
+        // weight every dof by its inverse resolution like ConfigurationCache does
+        std::vector<dReal> vweights(2*dof);
+        dReal maxdistance2 = 0;
+        for(int i = 0; i < dof; ++i) {
+            dReal fresolution = i < (int)_parameters->_vConfigResolution.size() ? _parameters->_vConfigResolution[i] : 0;
+            vweights[i] = vweights[dof+i] = fresolution > 0 ? 1/fresolution : 100;
+            dReal f = (_parameters->_vConfigUpperLimit.at(i)-_parameters->_vConfigLowerLimit.at(i))*vweights[i];
+            maxdistance2 += 2*f*f;
+        }
+        _featuretree.reset(new CacheTree(2*dof));
+        _featuretree->Init(vweights, RaveSqrt(maxdistance2));
+        _vpaths.resize(0);
+        _vpathfeatures.resize(0);
+        _mapFeaturePaths.clear();
+        _nNextReplacedPath = 0;
+    }
+
+    void _ComputeFeature(const std::vector<dReal>& vstart, const std::vector<dReal>& vgoal, std::vector<dReal>& vfeature) const
+    {
+        vfeature.resize(vstart.size()+vgoal.size());
+        std::copy(vstart.begin(), vstart.end(), vfeature.begin());
+        std::copy(vgoal.begin(), vgoal.end(), vfeature.begin()+vstart.size());
+    }
+
+    /// \brief stores the path and indexes it by its start and goal
+    void _AddPath(const std::vector<dReal>& vstart, const std::vector<dReal>& vgoal, TrajectoryBaseConstPtr ptraj)
+    {
+        const int dof = _parameters->GetDOF();
+        _ComputeFeature(vstart, vgoal, _vfeature);
+        int ret = _featuretree->InsertNode(_vfeature, CollisionReportPtr(), _fInsertionDist);
+        if( ret == 0 ) {
+            RAVELOG_WARN_FORMAT("env=%d, failed to insert path feature into the library", GetEnv()->GetId());
+            return;
+        }
+        std::vector<dReal> vkey = _vfeature;
+        if( ret < 0 ) {
+            // too close to an existing feature, share its paths
+            std::pair<CacheTreeNodeConstPtr, dReal> nn = _featuretree->FindNearestNode(_vfeature);
+            if( !nn.first ) {
+                return;
+            }
+            vkey.assign(nn.first->GetConfigurationState(), nn.first->GetConfigurationState()+2*dof);
+        }
+        std::vector<int>& vpathindices = _mapFeaturePaths[vkey];
+        TrajectoryBasePtr pstoredtraj = RaveCreateTrajectory(GetEnv(), ptraj->GetXMLId());
+        pstoredtraj->Clone(ptraj, 0);
+        int ipath;
+        if( (int)vpathindices.size() >= _nMaxPathsPerFeature ) {
+            // replace the oldest path of the feature
+            ipath = vpathindices.front();
+            std::rotate(vpathindices.begin(), vpathindices.begin()+1, vpathindices.end());
+        }
+        else {
+            if( (int)_vpaths.size() < _nMaxPaths ) {
+                ipath = _vpaths.size();
+                _vpaths.push_back(TrajectoryBasePtr());
+                _vpathfeatures.push_back(std::vector<dReal>());
+            }
+            else {
+                // the library is full, replace the paths in the order they were added
+                ipath = _nNextReplacedPath;
+                _nNextReplacedPath = (_nNextReplacedPath+1) % _vpaths.size();
+                _RemovePathFromFeature(ipath, vkey);
+            }
+            vpathindices.push_back(ipath);
+        }
+        _vpaths.at(ipath) = pstoredtraj;
+        _vpathfeatures.at(ipath) = vkey;
+    }
+
+    /// \brief removes the path from the paths of its feature. The feature is removed from the tree once it has no paths, unless it is vkeepkey.
+    void _RemovePathFromFeature(int ipath, const std::vector<dReal>& vkeepkey)
+    {
+        const std::vector<dReal>& vkey = _vpathfeatures.at(ipath);
+        std::map<std::vector<dReal>, std::vector<int> >::iterator itfeature = _mapFeaturePaths.find(vkey);
+        if( itfeature == _mapFeaturePaths.end() ) {
+            return;
+        }
+        itfeature->second.erase(std::remove(itfeature->second.begin(), itfeature->second.end(), ipath), itfeature->second.end());
+        if( itfeature->second.size() == 0 && vkey != vkeepkey ) {
+            std::pair<CacheTreeNodeConstPtr, dReal> nn = _featuretree->FindNearestNode(vkey);
+            if( !!nn.first && nn.second <= g_fEpsilon ) {
+                _featuretree->RemoveNode(nn.first);
+            }
+            _mapFeaturePaths.erase(itfeature);
+        }
+    }
+
+    /// \brief returns the index of the goal configuration closest to the end of the path
+    int _FindGoalIndex(const std::vector<dReal>& vpath) const
+    {
+        const int dof = _parameters->GetDOF();
+        std::vector<dReal> vend(vpath.end()-dof, vpath.end()), vgoal(dof);
+        int goalindex = 0;
+        dReal fbestdist = std::numeric_limits<dReal>::infinity();
+        for(size_t igoal = 0; igoal*dof < _parameters->vgoalconfig.size(); ++igoal) {
+            std::copy(_parameters->vgoalconfig.begin()+igoal*dof, _parameters->vgoalconfig.begin()+(igoal+1)*dof, vgoal.begin());
+            dReal fdist = _parameters->_distmetricfn(vend, vgoal);
+            if( fdist < fbestdist ) {
+                fbestdist = fdist;
+                goalindex = igoal;
+            }
+        }
+        return goalindex;
+    }
+
+    /// \brief connects the stored path to vstart and vgoal and repairs the invalid segments with local BiRRT calls
+    ///
+    /// Waypoints that became invalid are skipped, and the segment between the surrounding valid waypoints is repaired.
+    /// \return true if the repaired path in vpath is valid
+    bool _RepairPath(TrajectoryBasePtr pstoredtraj, const std::vector<dReal>& vstart, const std::vector<dReal>& vgoal, std::vector<dReal>& vpath)
+    {
+        const int dof = _parameters->GetDOF();
+        pstoredtraj->GetWaypoints(0, pstoredtraj->GetNumWaypoints(), _vstoredpath, _parameters->_configurationspecification);
+        std::vector<dReal> vwaypoints;
+        vwaypoints.reserve(_vstoredpath.size()+2*dof);
+        vwaypoints.insert(vwaypoints.end(), vstart.begin(), vstart.end());
+        vwaypoints.insert(vwaypoints.end(), _vstoredpath.begin(), _vstoredpath.end());
+        vwaypoints.insert(vwaypoints.end(), vgoal.begin(), vgoal.end());
+        size_t numwaypoints = vwaypoints.size()/dof;
+
+        std::vector<dReal> vprev(vstart), vnext(dof);
+        vpath = vstart;
+        for(size_t iwaypoint = 1; iwaypoint < numwaypoints; ++iwaypoint) {
+            std::copy(vwaypoints.begin()+iwaypoint*dof, vwaypoints.begin()+(iwaypoint+1)*dof, vnext.begin());
+            if( iwaypoint+1 < numwaypoints && _parameters->CheckPathAllConstraints(vnext, vnext, std::vector<dReal>(), std::vector<dReal>(), 0, IT_OpenStart) != 0 ) {
+                continue;
+            }
+            if( _parameters->CheckPathAllConstraints(vprev, vnext, std::vector<dReal>(), std::vector<dReal>(), 0, IT_OpenStart) != 0 ) {
+                if( !_RepairSegment(vprev, vnext, vpath) ) {
+                    return false;
+                }
+            }
+            vpath.insert(vpath.end(), vnext.begin(), vnext.end());
+            vprev = vnext;
+        }
+        return true;
+    }
+
+    /// \brief plans between two valid configurations with the local repair planner and appends the intermediate waypoints to vpath
+    bool _RepairSegment(const std::vector<dReal>& vstart, const std::vector<dReal>& vgoal, std::vector<dReal>& vpath)
+    {
+        _repairparameters->vinitialconfig = vstart;
+        _repairparameters->vgoalconfig = vgoal;
+        if( !_repairplanner->InitPlan(_robot, _repairparameters) ) {
+            return false;
+        }
+        if( !_repairtraj ) {
+            _repairtraj = RaveCreateTrajectory(GetEnv(), "");
+        }
+        _repairtraj->Init(_parameters->_configurationspecification);
+        if( !(_repairplanner->PlanPath(_repairtraj).GetStatusCode() & PS_HasSolution) ) {
+            return false;
+        }
+        const int dof = _parameters->GetDOF();
+        _vrepairpath.resize(0);
+        if( _repairtraj->GetNumWaypoints() > 2 ) {
+            _repairtraj->GetWaypoints(1, _repairtraj->GetNumWaypoints()-1, _vrepairpath, _parameters->_configurationspecification);
+            vpath.insert(vpath.end(), _vrepairpath.begin(), _vrepairpath.end());
+        }
+        RAVELOG_VERBOSE_FORMAT("env=%d, repaired segment with %d waypoints", GetEnv()->GetId()%(_vrepairpath.size()/dof));
+        return true;
+    }
+
+    bool _SetFallbackPlannerCommand(std::ostream& sout, std::istream& sinput)
+    {
+        std::string plannername;
+        sinput >> plannername;
+        if( !sinput || plannername.size() == 0 ) {
+            return false;
+        }
+        _fallbackplannername = plannername;
+        return true;
+    }
+
+    bool _SetRepairParametersCommand(std::ostream& sout, std::istream& sinput)
+    {
+        int maxrepairiterations = _nMaxRepairIterations, maxpathsperfeature = _nMaxPathsPerFeature;
+        sinput >> maxrepairiterations >> maxpathsperfeature;
+        if( maxrepairiterations <= 0 || maxpathsperfeature <= 0 ) {
+            return false;
+        }
+        _nMaxRepairIterations = maxrepairiterations;
+        _nMaxPathsPerFeature = maxpathsperfeature;
+        if( !!_repairparameters ) {
+            _repairparameters->_nMaxIterations = _nMaxRepairIterations;
+        }
+        return true;
+    }
+
+    bool _SetLibraryParametersCommand(std::ostream& sout, std::istream& sinput)
+    {
+        int maxpaths = _nMaxPaths;
+        dReal maxfeaturedist = _fMaxFeatureDist;
+        sinput >> maxpaths >> maxfeaturedist;
+        if( maxpaths <= 0 || maxfeaturedist <= 0 ) {
+            return false;
+        }
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        if( maxpaths < (int)_vpaths.size() && !!_featuretree && !!_parameters ) {
+            RAVELOG_INFO_FORMAT("env=%d, library has %d paths, which is more than the new maximum %d, so clearing it", GetEnv()->GetId()%_vpaths.size()%maxpaths);
+            _InitFeatureTree();
+        }
+        _nMaxPaths = maxpaths;
+        _fMaxFeatureDist = maxfeaturedist;
+        return true;
+    }
+
+    bool _SaveLibraryCommand(std::ostream& sout, std::istream& sinput)
+    {
+        std::string filename;
+        getline(sinput, filename);
+        boost::trim(filename);
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        std::ofstream f(filename.c_str());
+        if( !f ) {
+            RAVELOG_WARN_FORMAT("env=%d, failed to open %s for writing", GetEnv()->GetId()%filename);
+            return false;
+        }
+        f << std::setprecision(std::numeric_limits<dReal>::digits10+1);
+        int numpaths = 0;
+        FOREACHC(itfeature, _mapFeaturePaths) {
+            numpaths += itfeature->second.size();
+        }
+        f << numpaths << std::endl;
+        FOREACHC(itfeature, _mapFeaturePaths) {
+            FOREACHC(itpath, itfeature->second) {
+                // the feature of the path is its start and goal
+                FOREACHC(itvalue, itfeature->first) {
+                    f << *itvalue << " ";
+                }
+                f << std::endl;
+                std::stringstream sstraj;
+                _vpaths.at(*itpath)->serialize(sstraj);
+                std::string strajdata = sstraj.str();
+                f << strajdata.size() << std::endl << strajdata << std::endl;
+            }
+        }
+        return !!f;
+    }
+
+    bool _LoadLibraryCommand(std::ostream& sout, std::istream& sinput)
+    {
+        std::string filename;
+        getline(sinput, filename);
+        boost::trim(filename);
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        if( !_parameters ) {
+            RAVELOG_WARN_FORMAT("env=%d, planner has to be initialized before loading the library", GetEnv()->GetId());
+            return false;
+        }
+        std::ifstream f(filename.c_str());
+        int numpaths = 0;
+        f >> numpaths;
+        if( !f ) {
+            RAVELOG_WARN_FORMAT("env=%d, failed to read %s", GetEnv()->GetId()%filename);
+            return false;
+        }
+        const int dof = _parameters->GetDOF();
+        std::vector<dReal> vfeature(2*dof);
+        std::vector<dReal> vstart(dof), vgoal(dof);
+        std::string strajdata;
+        int numloaded = 0;
+        for(int ipath = 0; ipath < numpaths; ++ipath) {
+            FOREACH(itvalue, vfeature) {
+                f >> *itvalue;
+            }
+            size_t datasize = 0;
+            f >> datasize;
+            f.ignore(1);
+            strajdata.resize(datasize);
+            if( !f || (datasize > 0 && !f.read(&strajdata[0], datasize)) ) {
+                RAVELOG_WARN_FORMAT("env=%d, %s is truncated after %d paths", GetEnv()->GetId()%filename%numloaded);
+                return false;
+            }
+            std::stringstream sstraj(strajdata);
+            TrajectoryBasePtr ptraj = RaveCreateTrajectory(GetEnv(), "");
+            ptraj->deserialize(sstraj);
+            std::copy(vfeature.begin(), vfeature.begin()+dof, vstart.begin());
+            std::copy(vfeature.begin()+dof, vfeature.end(), vgoal.begin());
+            _AddPath(vstart, vgoal, ptraj);
+            ++numloaded;
+        }
+        RAVELOG_DEBUG_FORMAT("env=%d, loaded %d paths from %s", GetEnv()->GetId()%numloaded%filename);
+        return true;
+    }
+
+    bool _ClearLibraryCommand(std::ostream& sout, std::istream& sinput)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        if( !!_featuretree ) {
+            _InitFeatureTree();
+        }
+        return true;
+    }
+
+    bool _GetLibraryInfoCommand(std::ostream& sout, std::istream& sinput)
+    {
+        sout << _vpaths.size() << " " << _mapFeaturePaths.size() << " " << _nLibraryHits << " " << _nFallbacks;
+        return true;
+    }
+
+    PlannerParametersPtr _parameters;
+    RRTParametersPtr _fallbackparameters, _repairparameters;
+    RobotBasePtr _robot;
+    PlannerBasePtr _fallbackplanner, _repairplanner;
+    TrajectoryBasePtr _fallbacktraj, _repairtraj;
+    std::string _fallbackplannername;
+    int _nMaxRepairIterations; ///< maximum iterations of a local repair
+    int _nMaxPathsPerFeature; ///< maximum number of paths stored at the same feature, the oldest path is replaced
+    int _nMaxPaths; ///< maximum number of paths in the library
+    dReal _fMaxFeatureDist; ///< stored paths are only repaired if their feature is closer than this to the query, in units of the dof resolutions
+    dReal _fInsertionDist; ///< features closer than this to a stored feature share its paths, in units of the dof resolutions
+
+    // the library, persists across queries
+    CacheTreePtr _featuretree; ///< nearest neighbor structure on the [start, goal] features
+    std::map<std::vector<dReal>, std::vector<int> > _mapFeaturePaths; ///< feature stored in _featuretree -> indices into _vpaths
+    std::vector<TrajectoryBasePtr> _vpaths;
+    std::vector< std::vector<dReal> > _vpathfeatures; ///< the key in _mapFeaturePaths of every path
+    int _nNextReplacedPath; ///< index into _vpaths replaced next once the library is full
+    ConfigurationSpecification _libraryspec;
+    int _nLibraryHits, _nFallbacks;
+
+    // cache
+    std::vector<dReal> _vfeature, _vstoredpath, _vrepairpath;
+};
+
+PlannerBasePtr CreatePathLibraryPlanner(EnvironmentBasePtr penv, std::istream& sinput)
+{
+    return PlannerBasePtr(new PathLibraryPlanner(penv, sinput));
+}
+
+}
@@ -84,7 +84,7 @@ public:
         RegisterCommand("Grasp",boost::bind(&GrasperModule::_GraspCommand,this,_1,_2),
                         "Performs a grasp and returns contact points");
         RegisterCommand("GraspThreaded",boost::bind(&GrasperModule::_GraspThreadedCommand,this,_1,_2),
-                        "Parllelizes the computation of the grasp planning and force closure. Number of threads can be specified with 'numthreads'.");
+                        "Parllelizes the computation of the grasp planning and force closure. Number of threads can be specified with 'numthreads'. Valid grasps are returned in id order and 'randomseed' seeds the grasping noise, so the results do not depend on the number of threads.");
         RegisterCommand("ComputeDistanceMap",boost::bind(&GrasperModule::_ComputeDistanceMapCommand,this,_1,_2),
                         "Computes a distance map around a particular point in space");
         RegisterCommand("GetStableContacts",boost::bind(&GrasperModule::_GetStableContactsCommand,this,_1,_2),
@@ -666,6 +666,7 @@ public:
             forceclosurethreshold = 0;
             ffinestep = 0.001f;
             bCheckGraspIK = false;
+            randomseed = 0;
         }
 
         string targetname;
@@ -687,6 +688,14 @@ public:
         Vector affineaxis;
 
         bool bCheckGraspIK;
+        uint32_t randomseed; ///< combined with the grasp id to seed the grasping noise of every grasp
+
+        // grasp space, grasp ids index into it
+        vector< pair<Vector, Vector> > approachrays;
+        vector<dReal> rolls;
+        vector< vector<dReal> > preshapes;
+        vector<Vector> manipulatordirections;
+        vector<dReal> standoffs;
     };
 
     struct GraspParametersThread
@@ -716,11 +725,11 @@ public:
         WorkerParametersPtr worker_params(new WorkerParameters());
         int numthreads = 2;
         string cmd;
-        vector< pair<Vector, Vector> > approachrays;
-        vector<dReal> rolls;
-        vector< vector<dReal> > preshapes;
-        vector<Vector> manipulatordirections;
-        vector<dReal> standoffs;
+        vector< pair<Vector, Vector> >& approachrays = worker_params->approachrays;
+        vector<dReal>& rolls = worker_params->rolls;
+        vector< vector<dReal> >& preshapes = worker_params->preshapes;
+        vector<Vector>& manipulatordirections = worker_params->manipulatordirections;
+        vector<dReal>& standoffs = worker_params->standoffs;
         size_t startindex = 0;
         size_t maxgrasps = 0;
 
@@ -772,6 +781,9 @@ public:
             else if( cmd == "numthreads" ) {
                 sinput >> numthreads;
             }
+            else if( cmd == "randomseed" ) {
+                sinput >> worker_params->randomseed;
+            }
             // grasp specific
             else if( cmd == "approachrays" ) {
                 int numapproachrays = 0;
@@ -836,59 +848,55 @@ public:
         worker_params->affinedofs = _robot->GetAffineDOF();
         worker_params->affineaxis = _robot->GetAffineRotationAxis();
 
-        EnvironmentBasePtr pcloneenv = GetEnv()->CloneSelf(Clone_Bodies|Clone_Simulation);
-
-        _bContinueWorker = true;
-        // start worker threads
-        vector<boost::shared_ptr<boost::thread> > listthreads(numthreads);
-        FOREACH(itthread,listthreads) {
-            itthread->reset(new boost::thread(boost::bind(&GrasperModule::_WorkerThread,this,worker_params,pcloneenv)));
-        }
-
-        _listGraspResults.clear();
         size_t numgrasps = approachrays.size()*rolls.size()*preshapes.size()*standoffs.size()*manipulatordirections.size();
         if( maxgrasps == 0 ) {
             maxgrasps = numgrasps;
         }
         RAVELOG_INFO(str(boost::format("number of grasps to test: %d\n")%numgrasps));
-        size_t id = startindex;
-        for(id=startindex; id < numgrasps; ++id) {
-            size_t istandoff = id % standoffs.size();
-            size_t ipreshape = (id / standoffs.size()) % preshapes.size();
-            size_t iroll = (id / (preshapes.size() * standoffs.size())) % rolls.size();
-            size_t iapproachray = (id / (rolls.size() * preshapes.size() * standoffs.size()))%approachrays.size();
-            size_t imanipulatordirection = (id / (rolls.size() * preshapes.size() * standoffs.size()*approachrays.size()));
 
+        {
             boost::mutex::scoped_lock lock(_mutexGrasp);
-            if( _listGraspResults.size() >= maxgrasps ) {
-                break;
-            }
+            _nGraspStartIndex = startindex;
+            _nNextGraspId = startindex;
+            _nGraspEndIndex = max(startindex, numgrasps);
+            _nGraspFrontier = startindex;
+            _nNumValidGrasps = 0;
+            _nMaxGrasps = maxgrasps;
+            _vGraspResults.resize(0);
+            _vGraspResults.resize(_nGraspEndIndex-startindex);
+            _vGraspDone.resize(0);
+            _vGraspDone.resize(_nGraspEndIndex-startindex, 0);
+        }
+        if( _nNextGraspId < _nGraspEndIndex ) {
+            EnvironmentBasePtr pcloneenv = GetEnv()->CloneSelf(Clone_Bodies|Clone_Simulation);
 
-            // initialize _graspParamsWork
-            BOOST_ASSERT(!_graspParamsWork);
-            _graspParamsWork.reset(new GraspParametersThread());
-            _graspParamsWork->id = id;
-            _graspParamsWork->vtargetposition = approachrays.at(iapproachray).first;
-            _graspParamsWork->vtargetdirection = approachrays.at(iapproachray).second;
-            _graspParamsWork->vmanipulatordirection = manipulatordirections.at(imanipulatordirection);
-            _graspParamsWork->ftargetroll = rolls.at(iroll);
-            _graspParamsWork->fstandoff = standoffs.at(istandoff);
-            _graspParamsWork->preshape = preshapes.at(ipreshape);
-            _condGraspHasWork.notify_one();     // notify there is work
-            _condGraspReceivedWork.wait(lock);     // wait for more work
+            // start worker threads, each pulls the next grasp id until all are dispatched
+            vector<boost::shared_ptr<boost::thread> > listthreads(max(1,numthreads));
+            FOREACH(itthread,listthreads) {
+                itthread->reset(new boost::thread(boost::bind(&GrasperModule::_WorkerThread,this,worker_params,pcloneenv)));
+            }
+            FOREACH(itthread,listthreads) {
+                (*itthread)->join();
+            }
+            listthreads.clear();
+            pcloneenv->Destroy();
         }
 
-        // wait for workers
-        _bContinueWorker = false;
-        FOREACH(itthread,listthreads) {
-            _condGraspHasWork.notify_all();     // signal
-            (*itthread)->join();
+        // grasps are reported in id order, so the results do not depend on the number of threads or their scheduling
+        list<GraspParametersThreadPtr> listGraspResults;
+        for(size_t id = _nGraspStartIndex; id < _nGraspEndIndex; ++id) {
+            const GraspParametersThreadPtr& result = _vGraspResults.at(id-_nGraspStartIndex);
+            if( !!result ) {
+                listGraspResults.push_back(result);
+            }
         }
-        listthreads.clear();
+        _vGraspResults.clear();
+        _vGraspDone.clear();
+        size_t id = _nGraspEndIndex;
 
         // parse results to output
-        sout << id << " " << _listGraspResults.size() << " ";
-        FOREACH(itresult, _listGraspResults) {
+        sout << id << " " << listGraspResults.size() << " ";
+        FOREACH(itresult, listGraspResults) {
             sout << (*itresult)->vtargetposition.x << " " << (*itresult)->vtargetposition.y << " " << (*itresult)->vtargetposition.z << " ";
             sout << (*itresult)->vtargetdirection.x << " " << (*itresult)->vtargetdirection.y << " " << (*itresult)->vtargetdirection.z << " ";
             sout << (*itresult)->ftargetroll << " " << (*itresult)->fstandoff << " ";
@@ -950,21 +958,17 @@ public:
             coloptions &= ~CO_Contacts;
             pcloneenv->GetCollisionChecker()->SetCollisionOptions(coloptions|CO_Contacts);
 
-            while(_bContinueWorker) {
+            while(1) {
+                size_t id;
                 {
-                    // wait for work
                     boost::mutex::scoped_lock lock(_mutexGrasp);
-                    if( !_graspParamsWork ) {
-                        _condGraspHasWork.wait(lock);
-                        // after signal
-                        if( !_graspParamsWork ) {
-                            continue;
-                        }
+                    if( _nNextGraspId >= _nGraspEndIndex ) {
+                        break;
                     }
-                    grasp_params = _graspParamsWork;
-                    _graspParamsWork.reset();
-                    _condGraspReceivedWork.notify_all();
+                    id = _nNextGraspId++;
                 }
+                grasp_params = _GetGraspParameters(*worker_params, id);
+                GraspResultRecorder recorder(*this, grasp_params); // records the grasp as failed unless bSuccess is set
 
                 RAVELOG_DEBUG(str(boost::format("grasp %d: start")%grasp_params->id));
 
@@ -1065,6 +1069,7 @@ public:
                     vector<Transform> vfinaltransformations; vfinaltransformations.reserve(worker_params->nGraspingNoiseRetries);
                     vector< vector<dReal> > vfinalvalues; vfinalvalues.reserve(worker_params->nGraspingNoiseRetries);
                     for(int igrasp = 0; igrasp < worker_params->nGraspingNoiseRetries; ++igrasp) {
+                        params->_nRandomGeneratorSeed = _GetGraspSeed(worker_params->randomseed, grasp_params->id, igrasp);
                         probot->SetActiveDOFs(worker_params->vactiveindices);
                         probot->SetActiveDOFValues(grasp_params->preshape);
                         probot->SetActiveDOFs(worker_params->vactiveindices,worker_params->affinedofs,worker_params->affineaxis);
@@ -1162,19 +1167,88 @@ public:
                 }
 
                 RAVELOG_DEBUG(str(boost::format("grasp %d: success")%grasp_params->id));
-
-                boost::mutex::scoped_lock lock(_mutexGrasp);
-                _listGraspResults.push_back(grasp_params);
+                recorder.bSuccess = true;
             }
         }
         pcloneenv->Destroy();
     }
 
-    bool _bContinueWorker;
-    boost::mutex _mutexGrasp;
-    GraspParametersThreadPtr _graspParamsWork;
-    list<GraspParametersThreadPtr> _listGraspResults;
-    boost::condition _condGraspHasWork, _condGraspReceivedWork;
+    /// \brief converts a grasp id into its approach ray, roll, preshape, standoff and manipulator direction
+    static GraspParametersThreadPtr _GetGraspParameters(const WorkerParameters& worker_params, size_t id)
+    {
+        size_t istandoff = id % worker_params.standoffs.size();
+        size_t ipreshape = (id / worker_params.standoffs.size()) % worker_params.preshapes.size();
+        size_t iroll = (id / (worker_params.preshapes.size() * worker_params.standoffs.size())) % worker_params.rolls.size();
+        size_t iapproachray = (id / (worker_params.rolls.size() * worker_params.preshapes.size() * worker_params.standoffs.size()))%worker_params.approachrays.size();
+        size_t imanipulatordirection = (id / (worker_params.rolls.size() * worker_params.preshapes.size() * worker_params.standoffs.size()*worker_params.approachrays.size()));
+
+        GraspParametersThreadPtr grasp_params(new GraspParametersThread());
+        grasp_params->id = id;
+        grasp_params->vtargetposition = worker_params.approachrays.at(iapproachray).first;
+        grasp_params->vtargetdirection = worker_params.approachrays.at(iapproachray).second;
+        grasp_params->vmanipulatordirection = worker_params.manipulatordirections.at(imanipulatordirection);
+        grasp_params->ftargetroll = worker_params.rolls.at(iroll);
+        grasp_params->fstandoff = worker_params.standoffs.at(istandoff);
+        grasp_params->preshape = worker_params.preshapes.at(ipreshape);
+        grasp_params->mindist = 0;
+        grasp_params->volume = 0;
+        return grasp_params;
+    }
+
+    /// \brief seed of one grasping noise trial, only depends on the user seed, grasp id and trial so the noise does not change with the thread evaluating the grasp
+    static uint32_t _GetGraspSeed(uint32_t randomseed, size_t id, int igrasp)
+    {
+        uint64_t h = (uint64_t)randomseed*0x9e3779b97f4a7c15ULL + (uint64_t)id*0xbf58476d1ce4e5b9ULL + (uint64_t)igrasp*0x94d049bb133111ebULL;
+        h ^= h >> 31;
+        h *= 0xbf58476d1ce4e5b9ULL;
+        h ^= h >> 29;
+        uint32_t seed = (uint32_t)(h ^ (h >> 32));
+        return seed != 0 ? seed : 1; // 0 means unseeded for the grasper planner
+    }
+
+    /// \brief stores the result of a grasp id, advances the frontier of finished ids and stops dispatching once maxgrasps valid grasps precede it
+    void _FinishGrasp(GraspParametersThreadPtr grasp_params, bool bSuccess)
+    {
+        boost::mutex::scoped_lock lock(_mutexGrasp);
+        size_t index = grasp_params->id - _nGraspStartIndex;
+        if( bSuccess ) {
+            _vGraspResults.at(index) = grasp_params;
+        }
+        _vGraspDone.at(index) = 1;
+        while( _nGraspFrontier < _nGraspEndIndex && _vGraspDone.at(_nGraspFrontier-_nGraspStartIndex) ) {
+            if( !!_vGraspResults.at(_nGraspFrontier-_nGraspStartIndex) ) {
+                ++_nNumValidGrasps;
+            }
+            ++_nGraspFrontier;
+            if( _nNumValidGrasps >= _nMaxGrasps ) {
+                // later ids can still be running, their results are ignored
+                _nGraspEndIndex = _nGraspFrontier;
+                break;
+            }
+        }
+    }
+
+    /// \brief records the grasp when leaving the scope of the worker loop
+    class GraspResultRecorder
+    {
+public:
+        GraspResultRecorder(GrasperModule& module, GraspParametersThreadPtr grasp_params) : bSuccess(false), _module(module), _grasp_params(grasp_params) {
+        }
+        ~GraspResultRecorder() {
+            _module._FinishGrasp(_grasp_params, bSuccess);
+        }
+        bool bSuccess;
+private:
+        GrasperModule& _module;
+        GraspParametersThreadPtr _grasp_params;
+    };
+
+    boost::mutex _mutexGrasp; ///< protects the grasp dispatching and results below
+    size_t _nGraspStartIndex, _nNextGraspId, _nGraspEndIndex; ///< ids in [_nNextGraspId, _nGraspEndIndex) still have to be dispatched
+    size_t _nGraspFrontier; ///< all ids before it are finished
+    size_t _nNumValidGrasps, _nMaxGrasps; ///< number of valid grasps before the frontier
+    vector<GraspParametersThreadPtr> _vGraspResults; ///< valid grasps indexed by id-_nGraspStartIndex
+    vector<uint8_t> _vGraspDone; ///< 1 if the id is finished
 
 protected:
     void _ComputeJointMaxLengths(vector<dReal>& vjointlengths)
@@ -48,6 +48,15 @@ public:
         _parameters.reset(new GraspParameters(GetEnv()));
         _parameters->copy(pparams);
 
+        // a non-zero seed makes the grasping noise reproducible and independent of other threads using the global generator
+        _uniformsampler.reset();
+        if( _parameters->_nRandomGeneratorSeed != 0 ) {
+            _uniformsampler = RaveCreateSpaceSampler(GetEnv(),"mt19937");
+            if( !!_uniformsampler ) {
+                _uniformsampler->SetSeed(_parameters->_nRandomGeneratorSeed);
+            }
+        }
+
         if( _parameters->btightgrasp ) {
             RAVELOG_WARN("tight grasping not supported yet\n");
         }
@@ -131,11 +140,11 @@ public:
         if( !!_parameters->targetbody ) {
             tTarget = _parameters->targetbody->GetTransform();
             if( _parameters->fgraspingnoise > 0 ) {
-                dReal frotratio = RaveRandomFloat();     // ratio due to rotation
-                Vector vrandtrans = _parameters->fgraspingnoise*(1-frotratio)*Vector(2.0f*RaveRandomFloat()-1.0f, 2.0f*RaveRandomFloat()-1.0f, 2.0f*RaveRandomFloat()-1.0f);
+                dReal frotratio = _RandomFloat();     // ratio due to rotation
+                Vector vrandtrans = _parameters->fgraspingnoise*(1-frotratio)*Vector(2.0f*_RandomFloat()-1.0f, 2.0f*_RandomFloat()-1.0f, 2.0f*_RandomFloat()-1.0f);
                 Vector vrandaxis;
                 while(1) {
-                    vrandaxis = Vector(2.0f*RaveRandomFloat()-1.0f, 2.0f*RaveRandomFloat()-1.0f, 2.0f*RaveRandomFloat()-1.0f);
+                    vrandaxis = Vector(2.0f*_RandomFloat()-1.0f, 2.0f*_RandomFloat()-1.0f, 2.0f*_RandomFloat()-1.0f);
                     if( vrandaxis.lengthsqr3() > 0 && vrandaxis.lengthsqr3() <= 1 ) {
                         break;
                     }
@@ -150,7 +159,7 @@ public:
                     ab = _parameters->targetbody->ComputeAABB();
                 }
                 dReal fmaxradius = RaveSqrt(ab.extents.lengthsqr3());
-                tTargetOffset.rot = quatFromAxisAngle(vrandaxis,RaveRandomFloat()*_parameters->fgraspingnoise*frotratio*fmaxradius);
+                tTargetOffset.rot = quatFromAxisAngle(vrandaxis,_RandomFloat()*_parameters->fgraspingnoise*frotratio*fmaxradius);
                 Vector abposglobal = _parameters->targetbody->GetTransform()*ab.pos;
                 tTargetOffset.trans = tTargetOffset.rotate(-abposglobal)+abposglobal+vrandtrans;
             }
@@ -703,7 +712,15 @@ protected:
 
         return ct;
     }
+
+    /// \brief uniform random number in [0,1] for the grasping noise
+    inline dReal _RandomFloat()
+    {
+        return !!_uniformsampler ? _uniformsampler->SampleSequenceOneReal() : RaveRandomFloat();
+    }
+
     CollisionReportPtr _report;
+    SpaceSamplerBasePtr _uniformsampler; ///< only set if the parameters have a random seed
     boost::shared_ptr<GraspParameters> _parameters;
     RobotBasePtr _robot;
     vector<KinBody::LinkPtr> _vAvoidLinkGeometry;
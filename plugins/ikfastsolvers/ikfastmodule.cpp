@@ -14,6 +14,7 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "plugindefs.h"
+#include "reachabilitymap.h"
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 
@@ -345,6 +346,32 @@ public:
 * float sampledegeneratecases - probability in [0,1] specifies the probability of sampling joint values on [-pi/2,0,pi/2] (default is 0.2).\n\n\
 * int selfcollision - if true, will check IK only for non-self colliding positions of the robot (default is 0).\n\n\
 * string robot - name of the robot to test. the active manipulator of the roobt is used.\n\n");
+        RegisterCommand("ComputeReachability",boost::bind(&IkFastModule::ComputeReachability,this,_1,_2),
+                        "Computes the kinematic reachability map of a manipulator on all cores and writes it to a memory mappable file. Same sampling as the kinematicreachability database. Input parameters are:\n\n\
+* string robot - name of the robot, the active manipulator is used unless manipname is set.\n\n\
+* string manipname - name of the manipulator.\n\n\
+* string filename - file to write the map to (required).\n\n\
+* float xyzdelta - voxel size (default is 0.04).\n\n\
+* float quatdelta - distance between rotation samples (default is 0.5), ignored if numrotations is set.\n\n\
+* int numrotations - number of rotations to test at every voxel, at most 65535.\n\n\
+* float maxradius - radius around the first arm joint to compute, default is the arm length.\n\n\
+* int translationonly - if 1, only tests the identity rotation.\n\n\
+* int usefreespace - if 1, counts all the ik solutions.\n\n\
+* int rotationbits - if 1 (default), stores which rotations are reachable at every voxel.\n\n\
+* int numthreads - number of threads, default is the number of cores.\n\n\
+returns the number of reachable voxels");
+        RegisterCommand("LoadReachability",boost::bind(&IkFastModule::LoadReachability,this,_1,_2),
+                        "Memory maps a reachability map computed with ComputeReachability.\n"
+                        "Usage::\n\n  LoadReachability filename\n\n"
+                        "returns the robot and manipulator names the map was computed for");
+        RegisterCommand("FindBestBasePlacements",boost::bind(&IkFastModule::FindBestBasePlacements,this,_1,_2),
+                        "Scores robot base placements with the loaded reachability map, the score is the average reachability of the end effector poses. Input parameters are:\n\n\
+* string robot - name of the robot, default is the one of the map.\n\n\
+* poses N [quat trans]*N - end effector poses in the world.\n\n\
+* bases M [quat trans]*M - candidate robot transforms.\n\n\
+* grid xmin xmax ymin ymax delta numangles - candidate robot transforms on a plane at the current robot height rotating around z.\n\n\
+* int num - maximum number of placements to return (default is 10).\n\n\
+returns the number of placements followed by score quat trans of each, best first");
     }
 
     virtual ~IkFastModule() {
@@ -890,6 +917,203 @@ public:
         return true;
     }
 
+    bool ComputeReachability(ostream& sout, istream& sinput)
+    {
+        string cmd, filename, manipname;
+        RobotBasePtr robot;
+        ReachabilityMapBuilder::Parameters params;
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        while(!sinput.eof()) {
+            sinput >> cmd;
+            if( !sinput ) {
+                break;
+            }
+            std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::tolower);
+            if( cmd == "robot" ) {
+                string name;
+                sinput >> name;
+                robot = GetEnv()->GetRobot(name);
+            }
+            else if( cmd == "manipname" ) {
+                sinput >> manipname;
+            }
+            else if( cmd == "filename" ) {
+                sinput >> filename;
+            }
+            else if( cmd == "xyzdelta" ) {
+                sinput >> params.xyzdelta;
+            }
+            else if( cmd == "quatdelta" ) {
+                sinput >> params.quatdelta;
+            }
+            else if( cmd == "numrotations" ) {
+                sinput >> params.numrotations;
+            }
+            else if( cmd == "maxradius" ) {
+                sinput >> params.maxradius;
+            }
+            else if( cmd == "translationonly" ) {
+                sinput >> params.bTranslationOnly;
+            }
+            else if( cmd == "usefreespace" ) {
+                sinput >> params.bFreeSpace;
+            }
+            else if( cmd == "rotationbits" ) {
+                sinput >> params.bRotationBits;
+            }
+            else if( cmd == "numthreads" ) {
+                sinput >> params.numthreads;
+            }
+            else {
+                RAVELOG_WARN(str(boost::format("unrecognized command: %s\n")%cmd));
+                break;
+            }
+
+            if( !sinput ) {
+                RAVELOG_ERROR(str(boost::format("failed processing command %s\n")%cmd));
+                return false;
+            }
+        }
+
+        if( !robot || filename.size() == 0 ) {
+            RAVELOG_WARN("need robot and filename\n");
+            return false;
+        }
+        if( params.numrotations > s_nMaxReachabilityRotations ) {
+            RAVELOG_WARN_FORMAT("numrotations %d is more than %d", params.numrotations%s_nMaxReachabilityRotations);
+            return false;
+        }
+        RobotBase::ManipulatorConstPtr pmanip = manipname.size() > 0 ? robot->GetManipulator(manipname) : robot->GetActiveManipulator();
+        if( !pmanip || !pmanip->GetIkSolver() ) {
+            RAVELOG_WARN_FORMAT("robot %s manipulator '%s' does not have an ik solver", robot->GetName()%manipname);
+            return false;
+        }
+
+        uint64_t starttime = utils::GetMicroTime();
+        ReachabilityMapBuilder builder;
+        std::string name = pmanip->GetName();
+        size_t numreachable = builder.Build(pmanip, params, filename, lock);
+        RAVELOG_INFO_FORMAT("computed reachability of %s in %fs, %d reachable voxels", name%(1e-6*(utils::GetMicroTime()-starttime))%numreachable);
+        sout << numreachable;
+        return true;
+    }
+
+    bool LoadReachability(ostream& sout, istream& sinput)
+    {
+        string filename;
+        getline(sinput, filename);
+        boost::trim(filename);
+        ReachabilityMapPtr reachabilitymap(new ReachabilityMap());
+        reachabilitymap->Load(filename);
+        _reachabilitymap = reachabilitymap;
+        sout << _reachabilitymap->GetHeader().robotname << " " << _reachabilitymap->GetHeader().manipname;
+        return true;
+    }
+
+    bool FindBestBasePlacements(ostream& sout, istream& sinput)
+    {
+        if( !_reachabilitymap ) {
+            RAVELOG_WARN("reachability map is not loaded\n");
+            return false;
+        }
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        const ReachabilityMapHeader& header = _reachabilitymap->GetHeader();
+        RobotBasePtr robot = GetEnv()->GetRobot(header.robotname);
+        vector<Transform> vposes, vbases;
+        size_t num = 10;
+        string cmd;
+        while(!sinput.eof()) {
+            sinput >> cmd;
+            if( !sinput ) {
+                break;
+            }
+            std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::tolower);
+            if( cmd == "robot" ) {
+                string name;
+                sinput >> name;
+                robot = GetEnv()->GetRobot(name);
+            }
+            else if( cmd == "poses" ) {
+                size_t numposes = 0;
+                sinput >> numposes;
+                vposes.resize(numposes);
+                FOREACH(it, vposes) {
+                    sinput >> *it;
+                }
+            }
+            else if( cmd == "bases" ) {
+                size_t numbases = 0;
+                sinput >> numbases;
+                vbases.resize(numbases);
+                FOREACH(it, vbases) {
+                    sinput >> *it;
+                }
+            }
+            else if( cmd == "grid" ) {
+                dReal xmin, xmax, ymin, ymax, delta;
+                int numangles;
+                sinput >> xmin >> xmax >> ymin >> ymax >> delta >> numangles;
+                if( !!sinput && !!robot && delta > 0 && numangles > 0 ) {
+                    Transform tbase = robot->GetTransform();
+                    for(dReal x = xmin; x <= xmax; x += delta) {
+                        for(dReal y = ymin; y <= ymax; y += delta) {
+                            for(int iangle = 0; iangle < numangles; ++iangle) {
+                                tbase.rot = quatFromAxisAngle(Vector(0,0,1), 2*PI*iangle/numangles);
+                                tbase.trans.x = x;
+                                tbase.trans.y = y;
+                                vbases.push_back(tbase);
+                            }
+                        }
+                    }
+                }
+            }
+            else if( cmd == "num" ) {
+                sinput >> num;
+            }
+            else {
+                RAVELOG_WARN(str(boost::format("unrecognized command: %s\n")%cmd));
+                break;
+            }
+
+            if( !sinput ) {
+                RAVELOG_ERROR(str(boost::format("failed processing command %s\n")%cmd));
+                return false;
+            }
+        }
+
+        if( !robot ) {
+            RAVELOG_WARN_FORMAT("robot %s is not in the environment", header.robotname);
+            return false;
+        }
+        RobotBase::ManipulatorConstPtr pmanip = robot->GetManipulator(header.manipname);
+        if( !pmanip ) {
+            RAVELOG_WARN_FORMAT("robot %s does not have manipulator %s", robot->GetName()%header.manipname);
+            return false;
+        }
+        if( vposes.size() == 0 ) {
+            return false;
+        }
+
+        // manipulator base relative to the robot in the current configuration
+        Transform tBaseInRobot = robot->GetTransform().inverse()*pmanip->GetBase()->GetTransform();
+        vector< pair<dReal, size_t> > vscores(vbases.size());
+        for(size_t ibase = 0; ibase < vbases.size(); ++ibase) {
+            Transform tbaseinv = (vbases[ibase]*tBaseInRobot).inverse();
+            dReal fscore = 0;
+            FOREACHC(itpose, vposes) {
+                fscore += _reachabilitymap->Evaluate(tbaseinv*(*itpose));
+            }
+            vscores[ibase] = make_pair(fscore/vposes.size(), ibase);
+        }
+        num = min(num, vscores.size());
+        std::partial_sort(vscores.begin(), vscores.begin()+num, vscores.end(), std::greater< pair<dReal, size_t> >());
+        sout << num << " ";
+        for(size_t i = 0; i < num; ++i) {
+            sout << vscores[i].first << " " << vbases.at(vscores[i].second) << " ";
+        }
+        return true;
+    }
+
     bool DebugIKFindSolution(RobotBase::ManipulatorPtr pmanip, const IkParameterization& twrist, std::vector<dReal>& viksolution, int filteroptions, std::vector<dReal>& parameters, int paramindex, dReal deltafree)
     {
         // ignore boundary cases since next to limits and can fail due to limit errosr
@@ -1558,6 +1782,7 @@ public:
     }
 
     string _ikfastversion; ///< current ikfast version (assuming doesn't change during process lifetime)
+    ReachabilityMapPtr _reachabilitymap; ///< loaded with LoadReachability
     string _platform; ///<  current platform architecture. ie x86-64
 };
 
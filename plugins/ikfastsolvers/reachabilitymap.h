@@ -0,0 +1,557 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2006-2012 Rosen Diankov <rosen.diankov@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef OPENRAVE_IKFAST_REACHABILITYMAP_H
+#define OPENRAVE_IKFAST_REACHABILITYMAP_H
+
+#include "plugindefs.h"
+#include <boost/thread/condition.hpp>
+
+#ifdef Boost_IOSTREAMS_FOUND
+#include <boost/iostreams/device/mapped_file.hpp>
+#endif
+
+/// \brief fixed size header of the reachability map file.
+///
+/// The header is followed by numrotations quaternions (4 doubles each) and then dims[0]*dims[1]*dims[2] voxel records
+/// of recordsize bytes in x major order, so the file can be memory mapped and indexed directly. A voxel record is
+/// - uint16_t number of reachable rotations
+/// - uint16_t total number of ik solutions (saturated)
+/// - if RMF_RotationBits is set, one bit per rotation that is reachable, padded to 4 bytes
+struct ReachabilityMapHeader
+{
+    char magic[8]; ///< "ORREACH"
+    uint32_t version;
+    uint32_t flags; ///< ReachabilityMapFlags
+    int32_t dims[3]; ///< number of voxels along each axis
+    uint32_t numrotations;
+    double xyzdelta; ///< voxel size
+    double quatdelta; ///< average distance between the neighboring rotations
+    double origin[3]; ///< center of voxel (0,0,0) in the manipulator base link coordinate system
+    double maxradius; ///< voxels further than it from the first arm joint anchor are not computed
+    uint32_t recordsize; ///< size of each voxel record in bytes
+    uint32_t reserved;
+    char robotname[64];
+    char manipname[64];
+};
+
+enum ReachabilityMapFlags
+{
+    RMF_RotationBits = 1, ///< voxel records store which rotations are reachable
+    RMF_FreeSpace = 2, ///< all ik solutions are counted
+    RMF_TranslationOnly = 4, ///< only the identity rotation was tested
+};
+
+static const char s_ReachabilityMapMagic[8] = "ORREACH";
+static const uint32_t s_ReachabilityMapVersion = 1;
+static const uint32_t s_nMaxReachabilityRotations = 0xffff; ///< the number of reachable rotations of a voxel is stored in 16 bits
+
+/// \brief reachability density of the manipulator end effector over a voxelized space around the manipulator base, mirrors kinematicreachability.py
+class ReachabilityMap
+{
+public:
+    ReachabilityMap() : _pheader(NULL), _pquats(NULL), _pvoxels(NULL) {
+    }
+
+    /// \brief memory maps the file if possible, otherwise reads it. throws openrave_exception on errors
+    void Load(const std::string& filename)
+    {
+        _pheader = NULL;
+        _pquats = NULL;
+        _pvoxels = NULL;
+        const char* pdata = NULL;
+        size_t datasize = 0;
+#ifdef Boost_IOSTREAMS_FOUND
+        _mappedfile.reset(new boost::iostreams::mapped_file_source());
+        try {
+            _mappedfile->open(filename);
+        }
+        catch(const std::exception& ex) {
+            throw OPENRAVE_EXCEPTION_FORMAT("failed to map reachability file %s: %s", filename%ex.what(), ORE_InvalidArguments);
+        }
+        pdata = _mappedfile->data();
+        datasize = _mappedfile->size();
+#else
+        std::ifstream f(filename.c_str(), std::ios::binary);
+        if( !f ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("failed to open reachability file %s", filename, ORE_InvalidArguments);
+        }
+        _vdata.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+        pdata = _vdata.size() > 0 ? &_vdata[0] : NULL;
+        datasize = _vdata.size();
+#endif
+        if( datasize < sizeof(ReachabilityMapHeader) ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("reachability file %s is too small", filename, ORE_InvalidArguments);
+        }
+        const ReachabilityMapHeader* pheader = reinterpret_cast<const ReachabilityMapHeader*>(pdata);
+        if( memcmp(pheader->magic, s_ReachabilityMapMagic, sizeof(s_ReachabilityMapMagic)) != 0 || pheader->version != s_ReachabilityMapVersion ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("%s is not a reachability file of version %d", filename%s_ReachabilityMapVersion, ORE_InvalidArguments);
+        }
+        if( pheader->numrotations == 0 || pheader->numrotations > s_nMaxReachabilityRotations ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("reachability file %s has %d rotations, has to be in [1, %d]", filename%pheader->numrotations%s_nMaxReachabilityRotations, ORE_InvalidArguments);
+        }
+        size_t numvoxels = (size_t)pheader->dims[0]*(size_t)pheader->dims[1]*(size_t)pheader->dims[2];
+        size_t expectedsize = sizeof(ReachabilityMapHeader) + 4*sizeof(double)*pheader->numrotations + numvoxels*pheader->recordsize;
+        if( datasize < expectedsize ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("reachability file %s is truncated, %d < %d", filename%datasize%expectedsize, ORE_InvalidArguments);
+        }
+        _pheader = pheader;
+        _pquats = reinterpret_cast<const double*>(pdata + sizeof(ReachabilityMapHeader));
+        _pvoxels = reinterpret_cast<const uint8_t*>(_pquats + 4*pheader->numrotations);
+    }
+
+    inline bool IsLoaded() const {
+        return !!_pheader;
+    }
+
+    inline const ReachabilityMapHeader& GetHeader() const {
+        return *_pheader;
+    }
+
+    /// \brief returns the voxel index containing the position in the manipulator base coordinate system, or -1 if outside
+    int64_t GetVoxelIndex(const Vector& pos) const
+    {
+        int32_t index[3];
+        for(int i = 0; i < 3; ++i) {
+            index[i] = (int32_t)floor((pos[i]-_pheader->origin[i])/_pheader->xyzdelta + 0.5);
+            if( index[i] < 0 || index[i] >= _pheader->dims[i] ) {
+                return -1;
+            }
+        }
+        return ((int64_t)index[0]*_pheader->dims[1] + index[1])*_pheader->dims[2] + index[2];
+    }
+
+    /// \brief fraction of the rotations reachable at the voxel, reachability3d in kinematicreachability.py
+    inline dReal GetReachability(int64_t ivoxel) const {
+        return dReal(_GetUInt16(_GetRecord(ivoxel)))/dReal(_pheader->numrotations);
+    }
+
+    /// \brief number of ik solutions per rotation at the voxel, reachabilitydensity3d in kinematicreachability.py
+    inline dReal GetDensity(int64_t ivoxel) const {
+        return dReal(_GetUInt16(_GetRecord(ivoxel)+2))/dReal(_pheader->numrotations);
+    }
+
+    inline bool IsRotationReachable(int64_t ivoxel, uint32_t irotation) const {
+        return !!(_GetRecord(ivoxel)[4+(irotation>>3)] & (1<<(irotation&7)));
+    }
+
+    /// \brief returns the index of the sampled rotation closest to quat
+    uint32_t FindNearestRotation(const Vector& quat) const
+    {
+        uint32_t ibest = 0;
+        dReal fbest = -1;
+        for(uint32_t i = 0; i < _pheader->numrotations; ++i) {
+            const double* q = _pquats + 4*i;
+            dReal f = RaveFabs(q[0]*quat.x + q[1]*quat.y + q[2]*quat.z + q[3]*quat.w);
+            if( f > fbest ) {
+                fbest = f;
+                ibest = i;
+            }
+        }
+        return ibest;
+    }
+
+    /// \brief reachability of an end effector pose in the manipulator base coordinate system, in [0,1]
+    ///
+    /// If the rotations are stored, it is 1 when the closest sampled rotation is reachable at the voxel, otherwise it is the fraction of reachable rotations.
+    dReal Evaluate(const Transform& tEEInBase) const
+    {
+        int64_t ivoxel = GetVoxelIndex(tEEInBase.trans);
+        if( ivoxel < 0 ) {
+            return 0;
+        }
+        const uint8_t* precord = _GetRecord(ivoxel);
+        if( _GetUInt16(precord) == 0 ) {
+            return 0;
+        }
+        if( (_pheader->flags & RMF_RotationBits) && !(_pheader->flags & RMF_TranslationOnly) ) {
+            return IsRotationReachable(ivoxel, FindNearestRotation(tEEInBase.rot)) ? dReal(1) : dReal(0);
+        }
+        return GetReachability(ivoxel);
+    }
+
+    /// \brief evenly distributed unit quaternions using the super-fibonacci spiral (Alexa 2022). q and -q are both sampled, so the rotation density is doubled.
+    static void SampleRotations(uint32_t num, std::vector<Vector>& vquats)
+    {
+        const double phi = sqrt(2.0), psi = 1.533751168755204288118041;
+        vquats.resize(num);
+        for(uint32_t i = 0; i < num; ++i) {
+            double s = i + 0.5;
+            double r = sqrt(s/num), R = sqrt(1.0-s/num);
+            double alpha = 2*M_PI*s/phi, beta = 2*M_PI*s/psi;
+            vquats[i] = Vector(r*sin(alpha), r*cos(alpha), R*sin(beta), R*cos(beta));
+        }
+    }
+
+private:
+    inline const uint8_t* _GetRecord(int64_t ivoxel) const {
+        return _pvoxels + ivoxel*_pheader->recordsize;
+    }
+    static inline uint16_t _GetUInt16(const uint8_t* p) {
+        uint16_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    const ReachabilityMapHeader* _pheader;
+    const double* _pquats;
+    const uint8_t* _pvoxels;
+#ifdef Boost_IOSTREAMS_FOUND
+    boost::shared_ptr<boost::iostreams::mapped_file_source> _mappedfile;
+#else
+    std::vector<char> _vdata;
+#endif
+};
+
+typedef boost::shared_ptr<ReachabilityMap> ReachabilityMapPtr;
+
+/// \brief computes the reachability map of a manipulator on several threads and streams the voxel records to a file in order
+class ReachabilityMapBuilder
+{
+public:
+    struct Parameters
+    {
+        Parameters() : xyzdelta(0.04), quatdelta(0.5), maxradius(0), numrotations(0), numthreads(0), bTranslationOnly(false), bFreeSpace(false), bRotationBits(true) {
+        }
+        dReal xyzdelta, quatdelta; ///< quatdelta is only used to compute the number of rotations if numrotations is 0
+        dReal maxradius; ///< if 0, computed from the arm length
+        uint32_t numrotations;
+        int numthreads; ///< if 0, uses all the cores
+        bool bTranslationOnly, bFreeSpace, bRotationBits;
+    };
+
+    ReachabilityMapBuilder() : _nNextChunk(0), _nNumChunks(0) {
+    }
+
+    /// \brief computes the map of the manipulator and writes it to filename.
+    ///
+    /// \param lockenv lock of the environment of the robot, has to be locked. It is released once the workers have cloned the environment, so the environment is not blocked while the map is computed.
+    /// \return number of voxels with at least one reachable rotation
+    size_t Build(RobotBase::ManipulatorConstPtr pmanip, const Parameters& params, const std::string& filename, EnvironmentMutex::scoped_lock& lockenv)
+    {
+        RobotBasePtr probot = pmanip->GetRobot();
+        EnvironmentBasePtr penv = probot->GetEnv();
+        if( params.xyzdelta <= 0 ) {
+            throw OPENRAVE_EXCEPTION_FORMAT0("xyzdelta has to be positive", ORE_InvalidArguments);
+        }
+        if( params.numrotations > s_nMaxReachabilityRotations ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("numrotations %d is more than %d", params.numrotations%s_nMaxReachabilityRotations, ORE_InvalidArguments);
+        }
+
+        ReachabilityMapHeader& header = _header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, s_ReachabilityMapMagic, sizeof(s_ReachabilityMapMagic));
+        header.version = s_ReachabilityMapVersion;
+        strncpy(header.robotname, probot->GetName().c_str(), sizeof(header.robotname)-1);
+        strncpy(header.manipname, pmanip->GetName().c_str(), sizeof(header.manipname)-1);
+
+        // put the manipulator base at the origin, like kinematicreachability.py
+        Vector vbaseanchor;
+        {
+            RobotBase::RobotStateSaver saver(probot);
+            _trobot = pmanip->GetBase()->GetTransform().inverse()*probot->GetTransform();
+            probot->SetTransform(_trobot);
+            std::vector<KinBody::JointPtr> varmjoints;
+            FOREACHC(itjoint, probot->GetDependencyOrderedJoints()) {
+                if( find(pmanip->GetArmIndices().begin(), pmanip->GetArmIndices().end(), (*itjoint)->GetDOFIndex()) != pmanip->GetArmIndices().end() ) {
+                    varmjoints.push_back(*itjoint);
+                }
+            }
+            if( varmjoints.size() == 0 ) {
+                throw OPENRAVE_EXCEPTION_FORMAT("manipulator %s has no arm joints", pmanip->GetName(), ORE_InvalidArguments);
+            }
+            vbaseanchor = varmjoints.at(0)->GetAnchor();
+            Vector veetrans = pmanip->GetTransform().trans;
+            dReal farmlength = 0;
+            for(std::vector<KinBody::JointPtr>::reverse_iterator itjoint = varmjoints.rbegin(); itjoint != varmjoints.rend(); ++itjoint) {
+                farmlength += RaveSqrt((veetrans-(*itjoint)->GetAnchor()).lengthsqr3());
+                veetrans = (*itjoint)->GetAnchor();
+            }
+            header.maxradius = params.maxradius > 0 ? params.maxradius : farmlength + params.xyzdelta*RaveSqrt(3.0)*1.05;
+        }
+
+        int32_t nsteps = (int32_t)floor(header.maxradius/params.xyzdelta);
+        header.xyzdelta = params.xyzdelta;
+        for(int i = 0; i < 3; ++i) {
+            header.dims[i] = 2*nsteps;
+            header.origin[i] = vbaseanchor[i] - nsteps*params.xyzdelta;
+        }
+        _vbaseanchor = vbaseanchor;
+
+        if( params.bTranslationOnly ) {
+            header.flags |= RMF_TranslationOnly;
+            _vquats.resize(1, Vector(1,0,0,0));
+        }
+        else {
+            uint32_t numrotations = params.numrotations;
+            if( numrotations == 0 ) {
+                // each rotation covers a ball of radius quatdelta on the unit quaternion sphere of area 2*pi^2
+                if( params.quatdelta <= 0 ) {
+                    throw OPENRAVE_EXCEPTION_FORMAT0("quatdelta has to be positive", ORE_InvalidArguments);
+                }
+                double fnumrotations = ceil(2*M_PI*M_PI/(params.quatdelta*params.quatdelta*params.quatdelta));
+                if( fnumrotations > s_nMaxReachabilityRotations ) {
+                    throw OPENRAVE_EXCEPTION_FORMAT("quatdelta %f needs %d rotations, more than %d", params.quatdelta%fnumrotations%s_nMaxReachabilityRotations, ORE_InvalidArguments);
+                }
+                numrotations = std::max(1, (int)fnumrotations);
+            }
+            ReachabilityMap::SampleRotations(numrotations, _vquats);
+            header.quatdelta = _ComputeAverageNeighborDistance(_vquats);
+        }
+        header.numrotations = _vquats.size();
+        if( params.bFreeSpace ) {
+            header.flags |= RMF_FreeSpace;
+        }
+        size_t rotationbytes = 0;
+        if( params.bRotationBits ) {
+            header.flags |= RMF_RotationBits;
+            rotationbytes = ((_vquats.size()+7)/8 + 3) & ~(size_t)3;
+        }
+        header.recordsize = 4 + rotationbytes;
+        _bFreeSpace = params.bFreeSpace;
+
+        size_t numvoxels = (size_t)header.dims[0]*header.dims[1]*header.dims[2];
+        _nNumChunks = (numvoxels + s_nVoxelsPerChunk - 1)/s_nVoxelsPerChunk;
+        _nNextChunk = 0;
+        _mapFinishedChunks.clear();
+        RAVELOG_INFO_FORMAT("reachability of %s: radius %f, %d voxels, %d rotations, quatdelta %f", pmanip->GetName()%header.maxradius%numvoxels%header.numrotations%header.quatdelta);
+
+        FILE* f = fopen(filename.c_str(), "wb");
+        if( !f ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("failed to open %s for writing", filename, ORE_InvalidArguments);
+        }
+        boost::shared_ptr<FILE> pfile(f, fclose);
+        fwrite(&header, sizeof(header), 1, f);
+        FOREACHC(itquat, _vquats) {
+            double q[4] = { itquat->x, itquat->y, itquat->z, itquat->w };
+            fwrite(q, sizeof(q), 1, f);
+        }
+
+        // every thread works on its own clone since the ik solvers and collision checkers are not thread safe
+        int numthreads = params.numthreads > 0 ? params.numthreads : std::max(1, (int)boost::thread::hardware_concurrency());
+        std::vector<EnvironmentBasePtr> vclones(numthreads);
+        FOREACH(itclone, vclones) {
+            *itclone = penv->CloneSelf(Clone_Bodies);
+        }
+        std::string robotname = probot->GetName(), manipname = pmanip->GetName();
+        probot.reset();
+        pmanip.reset();
+        // the workers only use the clones, so the environment can be used while they compute
+        lockenv.unlock();
+        std::vector<boost::shared_ptr<boost::thread> > vthreads(numthreads);
+        for(int i = 0; i < numthreads; ++i) {
+            vthreads[i].reset(new boost::thread(boost::bind(&ReachabilityMapBuilder::_WorkerThread, this, vclones[i], robotname, manipname)));
+        }
+
+        // write the chunks in order as they finish
+        size_t numreachable = 0;
+        uint32_t starttime = utils::GetMilliTime();
+        try {
+            for(size_t ichunk = 0; ichunk < _nNumChunks; ++ichunk) {
+                std::vector<uint8_t> vchunk;
+                {
+                    boost::mutex::scoped_lock lock(_mutex);
+                    std::map<size_t, std::vector<uint8_t> >::iterator itchunk;
+                    while( (itchunk = _mapFinishedChunks.find(ichunk)) == _mapFinishedChunks.end() ) {
+                        if( !!_pexception ) {
+                            throw *_pexception;
+                        }
+                        _condChunkFinished.wait(lock);
+                    }
+                    vchunk.swap(itchunk->second);
+                    _mapFinishedChunks.erase(itchunk);
+                }
+                for(size_t ioffset = 0; ioffset < vchunk.size(); ioffset += header.recordsize) {
+                    if( vchunk[ioffset] != 0 || vchunk[ioffset+1] != 0 ) {
+                        ++numreachable;
+                    }
+                }
+                if( fwrite(&vchunk[0], 1, vchunk.size(), f) != vchunk.size() ) {
+                    throw OPENRAVE_EXCEPTION_FORMAT("failed to write %s", filename, ORE_Failed);
+                }
+                if( (ichunk % 1000) == 999 ) {
+                    RAVELOG_INFO_FORMAT("reachability %d/%d voxels, %fs", (ichunk*s_nVoxelsPerChunk)%numvoxels%(0.001*(utils::GetMilliTime()-starttime)));
+                }
+            }
+        }
+        catch(...) {
+            _StopWorkers(vthreads, vclones);
+            throw;
+        }
+        _StopWorkers(vthreads, vclones);
+        return numreachable;
+    }
+
+private:
+    static const size_t s_nVoxelsPerChunk = 64;
+
+    void _WorkerThread(EnvironmentBasePtr penv, const std::string& robotname, const std::string& manipname)
+    {
+        try {
+            EnvironmentMutex::scoped_lock lock(penv->GetMutex());
+            RobotBasePtr probot = penv->GetRobot(robotname);
+            RobotBase::ManipulatorPtr pmanip = probot->GetManipulator(manipname);
+            probot->SetTransform(_trobot);
+            probot->SetActiveManipulator(pmanip);
+
+            // only the manipulator links can self-collide, same as getManipulatorLinks in kinematicreachability.py
+            std::vector<KinBody::LinkPtr> vmaniplinks;
+            pmanip->GetChildLinks(vmaniplinks);
+            std::vector<int> vdofindices = pmanip->GetArmIndices();
+            std::vector<KinBody::JointPtr> vbasejoints;
+            probot->GetChain(0, pmanip->GetBase()->GetIndex(), vbasejoints);
+            FOREACHC(itjoint, vbasejoints) {
+                if( (*itjoint)->GetDOFIndex() >= 0 && !(*itjoint)->IsStatic() ) {
+                    for(int idof = 0; idof < (*itjoint)->GetDOF(); ++idof) {
+                        vdofindices.push_back((*itjoint)->GetDOFIndex()+idof);
+                    }
+                }
+            }
+            FOREACHC(itdofindex, vdofindices) {
+                KinBody::JointPtr pjoint = probot->GetJointFromDOFIndex(*itdofindex);
+                vmaniplinks.push_back(pjoint->GetFirstAttached());
+                vmaniplinks.push_back(pjoint->GetSecondAttached());
+            }
+            std::vector<KinBody::LinkPtr> vrigidlinks;
+            for(size_t i = 0; i < vmaniplinks.size(); ++i) {
+                if( !!vmaniplinks[i] ) {
+                    vmaniplinks[i]->GetRigidlyAttachedLinks(vrigidlinks);
+                    FOREACHC(itlink, vrigidlinks) {
+                        if( find(vmaniplinks.begin(), vmaniplinks.end(), *itlink) == vmaniplinks.end() ) {
+                            vmaniplinks.push_back(*itlink);
+                        }
+                    }
+                }
+            }
+            FOREACHC(itlink, probot->GetLinks()) {
+                (*itlink)->Enable(find(vmaniplinks.begin(), vmaniplinks.end(), *itlink) != vmaniplinks.end());
+            }
+
+            const ReachabilityMapHeader& header = _header;
+            size_t numvoxels = (size_t)header.dims[0]*header.dims[1]*header.dims[2];
+            dReal fmaxradiussqr = header.maxradius*header.maxradius;
+            std::vector<dReal> vsolution;
+            std::vector< std::vector<dReal> > vsolutions;
+            IkParameterization ikparam;
+            Transform t;
+            while(1) {
+                size_t ichunk;
+                {
+                    boost::mutex::scoped_lock lockchunk(_mutex);
+                    if( _nNextChunk >= _nNumChunks || !!_pexception ) {
+                        break;
+                    }
+                    ichunk = _nNextChunk++;
+                }
+
+                size_t voxelstart = ichunk*s_nVoxelsPerChunk, voxelend = std::min(numvoxels, voxelstart+s_nVoxelsPerChunk);
+                std::vector<uint8_t> vchunk((voxelend-voxelstart)*header.recordsize, 0);
+                for(size_t ivoxel = voxelstart; ivoxel < voxelend; ++ivoxel) {
+                    size_t iz = ivoxel % header.dims[2], iy = (ivoxel/header.dims[2]) % header.dims[1], ix = ivoxel/((size_t)header.dims[2]*header.dims[1]);
+                    t.trans = Vector(header.origin[0] + ix*header.xyzdelta, header.origin[1] + iy*header.xyzdelta, header.origin[2] + iz*header.xyzdelta);
+                    if( (t.trans-_vbaseanchor).lengthsqr3() >= fmaxradiussqr ) {
+                        continue;
+                    }
+                    uint8_t* precord = &vchunk[(ivoxel-voxelstart)*header.recordsize];
+                    uint32_t numrotvalid = 0, numvalid = 0;
+                    for(size_t irot = 0; irot < _vquats.size(); ++irot) {
+                        t.rot = _vquats[irot];
+                        ikparam.SetTransform6D(t);
+                        size_t numsolutions = 0;
+                        if( _bFreeSpace ) {
+                            if( pmanip->FindIKSolutions(ikparam, vsolutions, 0) ) {
+                                numsolutions = vsolutions.size();
+                            }
+                        }
+                        else if( pmanip->FindIKSolution(ikparam, vsolution, 0) ) {
+                            numsolutions = 1;
+                        }
+                        if( numsolutions > 0 ) {
+                            ++numrotvalid;
+                            numvalid += numsolutions;
+                            if( header.flags & RMF_RotationBits ) {
+                                precord[4+(irot>>3)] |= 1<<(irot&7);
+                            }
+                        }
+                    }
+                    uint16_t counts[2] = { (uint16_t)numrotvalid, (uint16_t)std::min(numvalid, (uint32_t)0xffff) };
+                    memcpy(precord, counts, sizeof(counts));
+                }
+
+                boost::mutex::scoped_lock lockchunk(_mutex);
+                _mapFinishedChunks[ichunk].swap(vchunk);
+                _condChunkFinished.notify_all();
+            }
+        }
+        catch(const std::exception& ex) {
+            RAVELOG_WARN_FORMAT("reachability worker failed: %s", ex.what());
+            boost::mutex::scoped_lock lock(_mutex);
+            if( !_pexception ) {
+                _pexception.reset(new openrave_exception(ex.what(), ORE_Failed));
+            }
+            _condChunkFinished.notify_all();
+        }
+    }
+
+    void _StopWorkers(std::vector<boost::shared_ptr<boost::thread> >& vthreads, std::vector<EnvironmentBasePtr>& vclones)
+    {
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+            _nNextChunk = _nNumChunks;
+        }
+        FOREACH(itthread, vthreads) {
+            (*itthread)->join();
+        }
+        vthreads.clear();
+        FOREACH(itclone, vclones) {
+            (*itclone)->Destroy();
+        }
+        vclones.clear();
+        _mapFinishedChunks.clear();
+    }
+
+    /// \brief mean angle to the closest other rotation, quatdelta of kinematicreachability.py
+    static dReal _ComputeAverageNeighborDistance(const std::vector<Vector>& vquats)
+    {
+        if( vquats.size() < 2 ) {
+            return 0;
+        }
+        dReal fsum = 0;
+        for(size_t i = 0; i < vquats.size(); ++i) {
+            dReal fmaxdot = 0;
+            for(size_t j = 0; j < vquats.size(); ++j) {
+                if( i != j ) {
+                    fmaxdot = std::max(fmaxdot, RaveFabs(vquats[i].dot(vquats[j])));
+                }
+            }
+            fsum += RaveAcos(std::min(fmaxdot, dReal(1)));
+        }
+        return fsum/vquats.size();
+    }
+
+    ReachabilityMapHeader _header;
+    Transform _trobot; ///< robot transform that puts the manipulator base at the origin
+    Vector _vbaseanchor;
+    std::vector<Vector> _vquats;
+    bool _bFreeSpace;
+
+    boost::mutex _mutex; ///< protects the state below
+    boost::condition _condChunkFinished;
+    size_t _nNextChunk, _nNumChunks;
+    std::map<size_t, std::vector<uint8_t> > _mapFinishedChunks; ///< finished chunks waiting to be written
+    boost::shared_ptr<openrave_exception> _pexception;
+};
+
+#endif
@@ -20,6 +20,16 @@
 
 class ODEPhysicsEngine : public OpenRAVE::PhysicsEngineBase
 {
+    static const int s_nMaxContacts = 16; ///< maximum number of contacts generated for one pair of geometries
+    static const int s_nPairsPerJob = 32; ///< minimum number of geometry pairs a worker collides at a time
+
+    /// \brief pair of leaf geometries whose bounding boxes overlap and that passed all the filters of the broad phase
+    struct CollisionPair
+    {
+        dGeomID o1, o2;
+        KinBody::LinkPtr plink1, plink2;
+    };
+
     // ODE joint helper fns
     static dReal DummyGetParam(dJointID id, int param)
     {
@@ -139,6 +149,24 @@ public:
                 }
                 RAVELOG_DEBUG("Setting QuickStep iterations to: %d\n",_physics->_num_iterations);
             }
+            else if( name == "numthreads") {
+                int temp=0;
+                _ss >> temp;
+                // 0 uses all cores
+                if (temp >= 0) {
+                    _physics->_nNumThreads = temp;
+                }
+                RAVELOG_DEBUG("Setting number of threads to: %d\n",_physics->_nNumThreads);
+            }
+            else if( name == "timestep") {
+                dReal temp=0;
+                _ss >> temp;
+                // 0 steps with the elapsed time of the environment
+                if (temp >= 0) {
+                    _physics->_fFixedTimeStep = temp;
+                }
+                RAVELOG_DEBUG("Setting fixed time step to: %f\n",_physics->_fFixedTimeStep);
+            }
             else if( name == "surfacelayer") {
                 float temp=0;
                 _ss >> temp;
@@ -170,8 +198,8 @@ public:
             }
         }
 
-        static const boost::array<string, 11>& GetTags() {
-            static const boost::array<string, 11> tags = {{"friction","selfcollision", "gravity", "contact", "erp", "cfm", "elastic_reduction_parameter", "constraint_force_mixing", "dcontactapprox", "numiterations", "surfacelayer" }};
+        static const boost::array<string, 13>& GetTags() {
+            static const boost::array<string, 13> tags = {{"friction","selfcollision", "gravity", "contact", "erp", "cfm", "elastic_reduction_parameter", "constraint_force_mixing", "dcontactapprox", "numiterations", "surfacelayer", "numthreads", "timestep" }};
             return tags;
         }
 
@@ -199,8 +227,12 @@ It is possible to set ODE physics engine and its properties inside the <environm
       <selfcollision>1</selfcollision>\n\
       <dcontactapprox>1</dcontactapprox>\n\
       <numiterations>1</numiterations>\n\
+      <numthreads>0</numthreads>\n\
+      <timestep>0.001</timestep>\n\
     </odeproperties>\n\
   </physicsengine>\n\n\
+**numthreads** is the maximum number of threads used to collide the contact pairs and to solve the independent islands of bodies, capped by the number of parallel job threads, 0 uses all of them. The contact pairs are collided in parallel only if the plugin is built with ODE_USE_MULTITHREAD. \
+**timestep** is a fixed internal time step, the elapsed time of every environment step is accumulated and simulated in steps of this size. 0 simulates with the elapsed time directly.\n\n\
 The possible properties that can be set are: ";
         FOREACHC(it, PhysicsPropertiesXMLReader::GetTags()) {
             ss << "**" << *it << "**, ";
@@ -216,6 +248,13 @@ The possible properties that can be set are: ";
         _surface_mode = 0;
         _surfacelayer = 0.001;
         _options = OpenRAVE::PEO_SelfCollisions;
+        _nNumThreads = 0;
+        _fFixedTimeStep = 0;
+        _fTimeAccumulator = 0;
+#ifdef ODE_HAVE_THREADING_IMPLEMENTATION
+        _threadingimpl = NULL;
+        _threadpool = NULL;
+#endif
 
         memset(_jointadd, 0, sizeof(_jointadd));
         _jointadd[dJointTypeBall] = DummyAddForce;
@@ -235,6 +274,7 @@ The possible properties that can be set are: ";
         _jointgetvel[dJointTypeHinge2].push_back(dJointGetHinge2Angle2Rate);
     }
     virtual ~ODEPhysicsEngine() {
+        _DestroyStepThreading();
         _odespace->Destroy();
     }
 
@@ -260,6 +300,8 @@ The possible properties that can be set are: ";
         dWorldSetCFM(_odespace->GetWorld(),_globalcfm);
         dWorldSetQuickStepNumIterations (_odespace->GetWorld(), _num_iterations);
         dWorldSetContactSurfaceLayer(_odespace->GetWorld(), _surfacelayer);
+        _fTimeAccumulator = 0;
+        _InitStepThreading();
         return true;
     }
 
@@ -267,6 +309,8 @@ The possible properties that can be set are: ";
     {
         _listcallbacks.clear();
         _report.reset();
+        _DestroyStepThreading();
+        _vcollisionpairs.clear();
         _odespace->DestroyEnvironment();
         vector<KinBodyPtr> vbodies;
         GetEnv()->GetBodies(vbodies);
@@ -321,6 +365,8 @@ The possible properties that can be set are: ";
         _globalerp = r->_globalerp;
         _surface_mode = r->_surface_mode;
         _num_iterations = r->_num_iterations;
+        _nNumThreads = r->_nNumThreads;
+        _fFixedTimeStep = r->_fFixedTimeStep;
         if( !!_odespace && _odespace->IsInitialized() ) {
             dWorldSetERP(_odespace->GetWorld(),_globalerp);
             dWorldSetCFM(_odespace->GetWorld(),_globalcfm);
@@ -501,22 +547,20 @@ The possible properties that can be set are: ";
             _listcallbacks.clear();
         }
 
-        dSpaceCollide (_odespace->GetSpace(),this,nearCallback);
-
         vector<KinBodyPtr> vbodies;
         GetEnv()->GetBodies(vbodies);
 
-        if( _options & OpenRAVE::PEO_SelfCollisions ) {
-            FOREACHC(itbody, vbodies) {
-                if( (*itbody)->GetLinks().size() > 1 ) {
-                    // more than one link, check collision
-                    dSpaceCollide(_odespace->GetBodySpace(*itbody), this, nearCallback);
-                }
+        if( _fFixedTimeStep > 0 ) {
+            // keep the remainder for the next call so the simulated time matches the environment time
+            _fTimeAccumulator += fTimeElapsed;
+            while( _fTimeAccumulator >= _fFixedTimeStep*(1-1e-6) ) {
+                _StepWorld(vbodies, _fFixedTimeStep);
+                _fTimeAccumulator -= _fFixedTimeStep;
             }
         }
-
-        dWorldQuickStep(_odespace->GetWorld(), fTimeElapsed);
-        dJointGroupEmpty (_odespace->GetContactGroup());
+        else {
+            _StepWorld(vbodies, fTimeElapsed);
+        }
 
         // synchronize all the objects from the ODE world to the OpenRAVE world
         Transform t;
@@ -549,11 +593,39 @@ The possible properties that can be set are: ";
 
 
 private:
+    /// \brief collides and steps the ODE world once
+    ///
+    /// The broad phase runs serially and collects the overlapping pairs, since colliding spaces modifies their internal state.
+    /// The narrow phase of all pairs runs on the parallel job threads if ODE was built with ODE_USE_MULTITHREAD. The contact joints are created serially in the order of the pairs,
+    /// so the result does not depend on the number of threads. dWorldQuickStep solves the independent islands in parallel if
+    /// ODE has a threading implementation.
+    void _StepWorld(const vector<KinBodyPtr>& vbodies, dReal fTimeElapsed)
+    {
+        _vcollisionpairs.resize(0);
+        dSpaceCollide (_odespace->GetSpace(),this,nearCallback);
+
+        if( _options & OpenRAVE::PEO_SelfCollisions ) {
+            FOREACHC(itbody, vbodies) {
+                if( (*itbody)->GetLinks().size() > 1 ) {
+                    // more than one link, check collision
+                    dSpaceCollide(_odespace->GetBodySpace(*itbody), this, nearCallback);
+                }
+            }
+        }
+
+        _CollidePairs();
+        _AddContactJoints();
+
+        dWorldQuickStep(_odespace->GetWorld(), fTimeElapsed);
+        dJointGroupEmpty (_odespace->GetContactGroup());
+    }
+
     static void nearCallback(void *data, dGeomID o1, dGeomID o2)
     {
         ((ODEPhysicsEngine*)data)->_nearCallback(o1,o2);
     }
 
+    /// \brief broad phase callback, stores the pair if it should be collided
     void _nearCallback(dGeomID o1, dGeomID o2)
     {
         if( !dGeomIsEnabled(o1) || !dGeomIsEnabled(o2) ) {
@@ -601,70 +673,216 @@ private:
                 return;
         }
 
-        const int N = 16;
-        dContact contact[N];
-        int n = dCollide (o1,o2,N,&contact[0].geom,sizeof(dContact));
-        if( n <= 0 ) {
-            return;
-        }
-
-        if( _listcallbacks.size() > 0 ) {
-            // fill the collision report
-            _report->Reset(OpenRAVE::CO_Contacts);
-            _report->plink1 = pkb1;
-            _report->plink2 = pkb2;
+        CollisionPair pair;
+        pair.o1 = o1;
+        pair.o2 = o2;
+        pair.plink1 = pkb1;
+        pair.plink2 = pkb2;
+        _vcollisionpairs.push_back(pair);
+    }
 
-            dGeomID checkgeom1 = dGeomGetClass(o1) == dGeomTransformClass ? dGeomTransformGetGeom(o1) : o1;
-            for(int i = 0; i < n; ++i) {
-                _report->contacts.push_back(CollisionReport::CONTACT(contact[i].geom.pos, checkgeom1 != contact[i].geom.g1 ? -Vector(contact[i].geom.normal) : Vector(contact[i].geom.normal), contact[i].geom.depth));
+    /// \brief narrow phase of all the pairs collected by the broad phase
+    void _CollidePairs()
+    {
+        int numpairs = (int)_vcollisionpairs.size();
+        // the contact buffers only grow, so they are not reallocated every step
+        if( (int)_vcontacts.size() < numpairs*s_nMaxContacts ) {
+            _vcontacts.resize(numpairs*s_nMaxContacts);
+        }
+        _vnumcontacts.resize(numpairs);
+#ifdef ODE_USE_MULTITHREAD
+        int nthreads = _GetNumThreads();
+        if( numpairs > s_nPairsPerJob && nthreads > 1 ) {
+            int numjobs = _SplitPairsIntoJobs();
+            if( numjobs > 1 ) {
+                RaveRunParallelJobs(boost::bind(&ODEPhysicsEngine::_CollidePairsJob, this, _1, _2), numjobs, nthreads);
+                return;
             }
+        }
+#endif
+        // the colliders share global data unless ODE is multi-threaded
+        for(int ipair = 0; ipair < numpairs; ++ipair) {
+            _CollidePair(ipair);
+        }
+    }
 
-            FOREACH(itfn, _listcallbacks) {
-                OpenRAVE::CollisionAction action = (*itfn)(_report,true);
-                if( action != OpenRAVE::CA_DefaultAction ) {
-                    return;
+    /// \brief groups the pairs into jobs so that no geometry is collided by two jobs, returns the number of jobs
+    ///
+    /// dCollide writes the cached final transform of the geometries it collides, and every link geometry is wrapped in a dGeomTransform,
+    /// so two pairs sharing a geometry cannot run concurrently. The pairs connected through shared geometries always go to the same job.
+    int _SplitPairsIntoJobs()
+    {
+        int numpairs = (int)_vcollisionpairs.size();
+        // union-find over the pairs, joining every pair with the previous pair that used one of its geometries
+        _vpairgroups.resize(numpairs);
+        _mapgeompairs.clear();
+        for(int ipair = 0; ipair < numpairs; ++ipair) {
+            _vpairgroups[ipair] = ipair;
+            dGeomID geoms[2] = {_vcollisionpairs[ipair].o1, _vcollisionpairs[ipair].o2};
+            for(int igeom = 0; igeom < 2; ++igeom) {
+                std::map<dGeomID, int>::iterator itgeom = _mapgeompairs.find(geoms[igeom]);
+                if( itgeom == _mapgeompairs.end() ) {
+                    _mapgeompairs[geoms[igeom]] = ipair;
+                }
+                else {
+                    int group0 = _FindPairGroup(itgeom->second), group1 = _FindPairGroup(ipair);
+                    _vpairgroups[max(group0, group1)] = min(group0, group1);
                 }
             }
         }
 
-        // process collisions
-        for (int i=0; i<n; i++) {
-            contact[i].surface.mode = _surface_mode;
-            contact[i].surface.mu = (dReal)_globalfriction;
-            contact[i].surface.mu2 = (dReal)_globalfriction;
-            //        contact[i].surface.slip1 = 0.7;
-            //        contact[i].surface.slip2 = 0.7;
-            //        contact[i].surface.mode = dContactSoftERP | dContactSoftCFM | dContactApprox1 | dContactSlip1 | dContactSlip2;
-            //        contact[i].surface.mu = 50.0; // was: dInfinity
-            //        contact[i].surface.soft_erp = 0.96;
-            //        contact[i].surface.soft_cfm = 0.04;
-            dJointID c = dJointCreateContact (_odespace->GetWorld(),_odespace->GetContactGroup(),contact+i);
+        // gather the pairs of each group, then pack whole groups into jobs of at least s_nPairsPerJob pairs
+        _vgrouppairs.resize(numpairs);
+        for(int ipair = 0; ipair < numpairs; ++ipair) {
+            _vgrouppairs[ipair] = std::make_pair(_FindPairGroup(ipair), ipair);
+        }
+        std::sort(_vgrouppairs.begin(), _vgrouppairs.end());
+        _vjobpairs.resize(numpairs);
+        _vjobstarts.resize(0);
+        for(int index = 0; index < numpairs; ++index) {
+            bool bNewGroup = index == 0 || _vgrouppairs[index].first != _vgrouppairs[index-1].first;
+            if( bNewGroup && (_vjobstarts.size() == 0 || index - _vjobstarts.back() >= s_nPairsPerJob) ) {
+                _vjobstarts.push_back(index);
+            }
+            _vjobpairs[index] = _vgrouppairs[index].second;
+        }
+        int numjobs = (int)_vjobstarts.size();
+        _vjobstarts.push_back(numpairs);
+        return numjobs;
+    }
+
+    int _FindPairGroup(int ipair)
+    {
+        while( _vpairgroups[ipair] != ipair ) {
+            _vpairgroups[ipair] = _vpairgroups[_vpairgroups[ipair]];
+            ipair = _vpairgroups[ipair];
+        }
+        return ipair;
+    }
+
+    void _CollidePairsJob(int jobindex, int threadindex)
+    {
+#ifdef ODE_USE_MULTITHREAD
+        // the parallel job threads are shared, so allocate the collision data of this thread the first time it collides.
+        // Does nothing if it was already allocated.
+        dAllocateODEDataForThread(dAllocateMaskAll);
+#endif
+        for(int index = _vjobstarts.at(jobindex); index < _vjobstarts.at(jobindex+1); ++index) {
+            _CollidePair(_vjobpairs[index]);
+        }
+    }
+
+    inline void _CollidePair(int ipair)
+    {
+        const CollisionPair& pair = _vcollisionpairs[ipair];
+        _vnumcontacts[ipair] = dCollide(pair.o1, pair.o2, s_nMaxContacts, &_vcontacts[ipair*s_nMaxContacts].geom, sizeof(dContact));
+    }
+
+    /// \brief calls the collision callbacks and creates the contact joints of all colliding pairs
+    void _AddContactJoints()
+    {
+        for(size_t ipair = 0; ipair < _vcollisionpairs.size(); ++ipair) {
+            int n = _vnumcontacts[ipair];
+            if( n <= 0 ) {
+                continue;
+            }
+            const CollisionPair& pair = _vcollisionpairs[ipair];
+            dContact* contact = &_vcontacts[ipair*s_nMaxContacts];
+
+            if( _listcallbacks.size() > 0 ) {
+                // fill the collision report
+                _report->Reset(OpenRAVE::CO_Contacts);
+                _report->plink1 = pair.plink1;
+                _report->plink2 = pair.plink2;
+
+                dGeomID checkgeom1 = dGeomGetClass(pair.o1) == dGeomTransformClass ? dGeomTransformGetGeom(pair.o1) : pair.o1;
+                for(int i = 0; i < n; ++i) {
+                    _report->contacts.push_back(CollisionReport::CONTACT(contact[i].geom.pos, checkgeom1 != contact[i].geom.g1 ? -Vector(contact[i].geom.normal) : Vector(contact[i].geom.normal), contact[i].geom.depth));
+                }
+
+                bool bIgnore = false;
+                FOREACH(itfn, _listcallbacks) {
+                    OpenRAVE::CollisionAction action = (*itfn)(_report,true);
+                    if( action != OpenRAVE::CA_DefaultAction ) {
+                        bIgnore = true;
+                        break;
+                    }
+                }
+                if( bIgnore ) {
+                    continue;
+                }
+            }
 
             // make sure that static objects are not enabled by adding a joint attaching them
+            dBodyID b1 = dGeomGetBody(pair.o1), b2 = dGeomGetBody(pair.o2);
             if( b1 ) {
                 b1 = dBodyIsEnabled(b1) ? b1 : 0;
             }
             if( b2 ) {
                 b2 = dBodyIsEnabled(b2) ? b2 : 0;
             }
-            dJointAttach (c, b1, b2);
 
-            //wprintf(L"intersection %s %s\n", ((KinBody::Link*)dBodyGetData(b1))->GetName(), ((KinBody::Link*)dBodyGetData(b2))->GetName());
+            // process collisions
+            for (int i=0; i<n; i++) {
+                contact[i].surface.mode = _surface_mode;
+                contact[i].surface.mu = (dReal)_globalfriction;
+                contact[i].surface.mu2 = (dReal)_globalfriction;
+                dJointID c = dJointCreateContact (_odespace->GetWorld(),_odespace->GetContactGroup(),contact+i);
+                dJointAttach (c, b1, b2);
+            }
+        }
+    }
+
+    inline int _GetNumThreads() const
+    {
+        // the pairs are collided on the shared parallel job threads, and the island threads only run after them, so never use more threads than that pool has
+        int nthreads = RaveGetNumParallelJobThreads();
+        if( _nNumThreads > 0 ) {
+            nthreads = min(nthreads, _nNumThreads);
+        }
+        return max(1, nthreads);
+    }
+
+    /// \brief lets dWorldQuickStep solve the independent islands of the world on a thread pool
+    void _InitStepThreading()
+    {
+        _DestroyStepThreading();
+#ifdef ODE_HAVE_THREADING_IMPLEMENTATION
+        int nthreads = _GetNumThreads();
+        if( nthreads <= 1 ) {
+            return;
+        }
+        _threadingimpl = dThreadingAllocateMultiThreadedImplementation();
+        if( !_threadingimpl ) {
+            RAVELOG_DEBUG("ODE does not support multi-threaded stepping\n");
+            return;
+        }
+        _threadpool = dThreadingAllocateThreadPool(nthreads-1, 0, dAllocateFlagBasicData, NULL);
+        if( !_threadpool ) {
+            dThreadingFreeImplementation(_threadingimpl);
+            _threadingimpl = NULL;
+            return;
+        }
+        dThreadingThreadPoolServeMultiThreadedImplementation(_threadpool, _threadingimpl);
+        dWorldSetStepThreadingImplementation(_odespace->GetWorld(), dThreadingImplementationGetFunctions(_threadingimpl), _threadingimpl);
+        dWorldSetStepIslandsProcessingMaxThreadCount(_odespace->GetWorld(), nthreads);
+#endif
+    }
 
-            //        contact[i].surface.slip1 = 0.7;
-            //        contact[i].surface.slip2 = 0.7;
-            //        contact[i].surface.mode = dContactSoftERP | dContactSoftCFM | dContactApprox1 | dContactSlip1 | dContactSlip2;
-            //        contact[i].surface.mu = 50.0; // was: dInfinity
-            //        contact[i].surface.soft_erp = 0.96;
-            //        contact[i].surface.soft_cfm = 0.04;
-            //        dJointID c = dJointCreateContact (world,contactgroup,&contact[i]);
-            //        dJointAttach (c,
-            //            dGeomGetBody(contact[i].geom.g1),
-            //            dGeomGetBody(contact[i].geom.g2));
+    void _DestroyStepThreading()
+    {
+#ifdef ODE_HAVE_THREADING_IMPLEMENTATION
+        if( !!_threadingimpl ) {
+            dThreadingImplementationShutdownProcessing(_threadingimpl);
+            dThreadingFreeThreadPool(_threadpool);
+            if( !!_odespace && _odespace->IsInitialized() ) {
+                dWorldSetStepThreadingImplementation(_odespace->GetWorld(), NULL, NULL);
+            }
+            dThreadingFreeImplementation(_threadingimpl);
+            _threadingimpl = NULL;
+            _threadpool = NULL;
         }
-        //
-        //        dJointID c = dJointCreateContact (GetEnv()->world,GetEnv()->contactgroup,&contact);
-        //        dJointAttach (c,b1,b2);
+#endif
     }
 
     void _SyncCallback(ODESpace::KinBodyInfoConstPtr pinfo)
@@ -706,6 +924,24 @@ private:
     vector<JointGetFn> _jointgetvel[12];
     std::list<EnvironmentBase::CollisionCallbackFn> _listcallbacks;
     CollisionReportPtr _report;
+
+    int _nNumThreads; ///< number of threads for collision and island solving, 0 uses all the parallel job threads
+    dReal _fFixedTimeStep; ///< if > 0, the world is always stepped with this time step
+    dReal _fTimeAccumulator; ///< elapsed time that was not simulated yet when using _fFixedTimeStep
+
+    // reused across steps
+    std::vector<CollisionPair> _vcollisionpairs; ///< pairs found by the broad phase of the current step
+    std::vector<dContact> _vcontacts; ///< s_nMaxContacts contacts for every pair in _vcollisionpairs
+    std::vector<int> _vnumcontacts; ///< number of contacts for every pair in _vcollisionpairs
+    std::vector<int> _vpairgroups; ///< union-find parent of every pair, pairs sharing a geometry are in the same group
+    std::map<dGeomID, int> _mapgeompairs; ///< first pair that uses each geometry
+    std::vector< std::pair<int, int> > _vgrouppairs; ///< (group, pair index) sorted by group
+    std::vector<int> _vjobpairs; ///< pair indices ordered by job
+    std::vector<int> _vjobstarts; ///< start of every job in _vjobpairs, followed by the number of pairs
+#ifdef ODE_HAVE_THREADING_IMPLEMENTATION
+    dThreadingImplementationID _threadingimpl;
+    dThreadingThreadPoolID _threadpool;
+#endif
 };
 
 #endif
@@ -0,0 +1,546 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2006-2020 Rosen Diankov <rosen.diankov@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include "plugindefs.h"
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+/// \brief statistics of the geometry moved by one joint
+struct JointStatistics
+{
+    JointStatistics() : jointindex(-1), sweptvolume(0), sphereradius(0), maxaxisdist(0) {
+    }
+    int jointindex;
+    dReal sweptvolume; ///< volume swept by all the links and grabbed bodies moved by the joint when it goes through its limits
+    Vector spherepos; ///< for revolute joints, the sphere of jointspheres in linkstatistics.py, computed from the link AABBs and the spheres of the child joints
+    dReal sphereradius;
+    dReal maxaxisdist; ///< for revolute joints, max distance of the geometry from the axis, ie the max displacement per radian
+};
+
+typedef boost::shared_ptr< std::vector<JointStatistics> > JointStatisticsListPtr;
+
+class LinkStatistics : public ModuleBase
+{
+    /// \brief surface points of the geometry moved by one joint, the joint only reads them so can be processed by any thread
+    struct JointSweep
+    {
+        int jointindex;
+        bool bRevolute;
+        Vector vanchor, vaxis;
+        dReal fmin, fmax; ///< range of the joint relative to its current value
+        std::vector<Vector> vpoints;
+        dReal maxaxisdist; ///< max distance of the points from the axis
+        Vector vmin; ///< corner of the voxel grid
+        int dims[3]; ///< dimensions of the voxel grid
+        uint64_t numvoxels;
+        int numsteps; ///< number of joint values at which the points are voxelized
+    };
+
+public:
+    LinkStatistics(EnvironmentBasePtr penv) : ModuleBase(penv)
+    {
+        __description = ":Interface Author: Rosen Diankov\n\n\
+Computes the swept volumes and bounding spheres of the geometry moved by every joint of a robot by voxelizing the collision meshes. \
+The results are used for the DOF weights and resolutions, see linkstatistics.py. They are cached in memory and in the database directory with the kinematics geometry hash of the robot and the grabbed bodies.";
+        RegisterCommand("ComputeJointStatistics",boost::bind(&LinkStatistics::ComputeJointStatisticsCommand,this,_1,_2),
+                        "Computes the statistics of the revolute and prismatic joints of a robot at its current configuration. Returns the number of joints followed by 'jointindex sweptvolume spherepos sphereradius maxaxisdist' for every joint. The spheres of the revolute joints are the same as the ones computed by linkstatistics.py.\n\n\
+:param robot: name of the robot\n\
+:param xyzdelta: voxel size, default is 0.005\n\
+:param maxthreads: max number of threads, default is the hardware concurrency. The voxel grids of all the threads together never use more than 1GB\n\
+:param usecache: if 1 (default), uses the cached statistics if the robot was already processed\n");
+    }
+
+    virtual ~LinkStatistics() {
+    }
+
+    virtual bool SendCommand(std::ostream& sout, std::istream& sinput)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        return ModuleBase::SendCommand(sout,sinput);
+    }
+
+protected:
+    bool ComputeJointStatisticsCommand(ostream& sout, istream& sinput)
+    {
+        string cmd;
+        KinBodyPtr pbody;
+        dReal xyzdelta = 0.005;
+        int maxthreads = 0;
+        bool busecache = true;
+        while(!sinput.eof()) {
+            sinput >> cmd;
+            if( !sinput ) {
+                break;
+            }
+            std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::tolower);
+            if( cmd == "robot" ) {
+                string name;
+                sinput >> name;
+                pbody = GetEnv()->GetKinBody(name);
+            }
+            else if( cmd == "xyzdelta" ) {
+                sinput >> xyzdelta;
+            }
+            else if( cmd == "maxthreads" ) {
+                sinput >> maxthreads;
+            }
+            else if( cmd == "usecache" ) {
+                sinput >> busecache;
+            }
+            else {
+                RAVELOG_WARN(str(boost::format("unrecognized command: %s\n")%cmd));
+                break;
+            }
+
+            if( !sinput ) {
+                RAVELOG_ERROR(str(boost::format("failed processing command %s\n")%cmd));
+                return false;
+            }
+        }
+        if( !pbody ) {
+            RAVELOG_WARN("need a robot\n");
+            return false;
+        }
+        if( xyzdelta <= 0 ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("xyzdelta %f has to be positive", xyzdelta, ORE_InvalidArguments);
+        }
+
+        std::string key = _GetCacheKey(pbody, xyzdelta);
+        JointStatisticsListPtr pstats;
+        if( busecache ) {
+            pstats = _LoadCache(pbody, key);
+        }
+        if( !pstats ) {
+            uint32_t starttime = utils::GetMilliTime();
+            pstats = _ComputeJointStatistics(pbody, xyzdelta, maxthreads);
+            RAVELOG_DEBUG_FORMAT("computed statistics of %d joints of %s in %fs", pstats->size()%pbody->GetName()%(0.001*(utils::GetMilliTime()-starttime)));
+            _SaveCache(pbody, key, pstats);
+        }
+
+        sout << std::setprecision(std::numeric_limits<dReal>::digits10+1);
+        sout << pstats->size() << " ";
+        FOREACHC(itstat, *pstats) {
+            sout << itstat->jointindex << " " << itstat->sweptvolume << " " << itstat->spherepos.x << " " << itstat->spherepos.y << " " << itstat->spherepos.z << " " << itstat->sphereradius << " " << itstat->maxaxisdist << " ";
+        }
+        return true;
+    }
+
+    /// \brief the statistics depend on the kinematics and geometry of the robot, its configuration and the bodies it grabs
+    std::string _GetCacheKey(KinBodyPtr pbody, dReal xyzdelta)
+    {
+        std::stringstream ss;
+        ss << std::setprecision(std::numeric_limits<dReal>::digits10+1);
+        ss << pbody->GetKinematicsGeometryHash() << " " << xyzdelta << " " << pbody->GetTransform();
+        std::vector<dReal> vdofvalues;
+        pbody->GetDOFValues(vdofvalues);
+        FOREACHC(itvalue, vdofvalues) {
+            ss << " " << *itvalue;
+        }
+        std::vector<KinBody::GrabbedInfoPtr> vgrabbedinfo;
+        pbody->GetGrabbedInfo(vgrabbedinfo);
+        FOREACHC(itgrabbed, vgrabbedinfo) {
+            KinBodyPtr pgrabbed = GetEnv()->GetKinBody((*itgrabbed)->_grabbedname);
+            ss << " " << (*itgrabbed)->_robotlinkname << " " << (*itgrabbed)->_trelative << " " << (!!pgrabbed ? pgrabbed->GetKinematicsGeometryHash() : std::string());
+        }
+        return ss.str();
+    }
+
+    std::string _GetCacheFilename(KinBodyPtr pbody, const std::string& key, bool bRead)
+    {
+        return RaveFindDatabaseFile(str(boost::format("robot.%s/linkstatistics.%s.native")%pbody->GetKinematicsGeometryHash()%utils::GetMD5HashString(key)), bRead);
+    }
+
+    JointStatisticsListPtr _LoadCache(KinBodyPtr pbody, const std::string& key)
+    {
+        {
+            boost::mutex::scoped_lock lock(s_mutexCache);
+            std::map<std::string, JointStatisticsListPtr>::iterator it = s_mapCache.find(key);
+            if( it != s_mapCache.end() ) {
+                return it->second;
+            }
+        }
+
+        std::string filename = _GetCacheFilename(pbody, key, true);
+        if( filename.size() == 0 ) {
+            return JointStatisticsListPtr();
+        }
+        std::ifstream f(filename.c_str(), std::ios::binary);
+        char header[16];
+        uint32_t numstats = 0;
+        if( !f.read(header, sizeof(header)) || memcmp(header, s_header, sizeof(header)) != 0 || !f.read(reinterpret_cast<char*>(&numstats), sizeof(numstats)) ) {
+            RAVELOG_WARN_FORMAT("%s is not a link statistics file", filename);
+            return JointStatisticsListPtr();
+        }
+        JointStatisticsListPtr pstats(new std::vector<JointStatistics>(numstats));
+        FOREACH(itstat, *pstats) {
+            int32_t jointindex;
+            double values[6];
+            if( !f.read(reinterpret_cast<char*>(&jointindex), sizeof(jointindex)) || !f.read(reinterpret_cast<char*>(values), sizeof(values)) ) {
+                RAVELOG_WARN_FORMAT("%s is truncated", filename);
+                return JointStatisticsListPtr();
+            }
+            itstat->jointindex = jointindex;
+            itstat->sweptvolume = values[0];
+            itstat->spherepos = Vector(values[1], values[2], values[3]);
+            itstat->sphereradius = values[4];
+            itstat->maxaxisdist = values[5];
+        }
+        boost::mutex::scoped_lock lock(s_mutexCache);
+        s_mapCache[key] = pstats;
+        return pstats;
+    }
+
+    void _SaveCache(KinBodyPtr pbody, const std::string& key, JointStatisticsListPtr pstats)
+    {
+        {
+            boost::mutex::scoped_lock lock(s_mutexCache);
+            s_mapCache[key] = pstats;
+        }
+        std::string filename = _GetCacheFilename(pbody, key, false);
+        std::ofstream f(filename.c_str(), std::ios::binary);
+        if( !f ) {
+            RAVELOG_WARN_FORMAT("failed to write link statistics to %s", filename);
+            return;
+        }
+        uint32_t numstats = pstats->size();
+        f.write(s_header, sizeof(s_header));
+        f.write(reinterpret_cast<const char*>(&numstats), sizeof(numstats));
+        FOREACHC(itstat, *pstats) {
+            int32_t jointindex = itstat->jointindex;
+            double values[6] = { itstat->sweptvolume, itstat->spherepos.x, itstat->spherepos.y, itstat->spherepos.z, itstat->sphereradius, itstat->maxaxisdist };
+            f.write(reinterpret_cast<const char*>(&jointindex), sizeof(jointindex));
+            f.write(reinterpret_cast<const char*>(values), sizeof(values));
+        }
+    }
+
+    JointStatisticsListPtr _ComputeJointStatistics(KinBodyPtr pbody, dReal xyzdelta, int maxthreads)
+    {
+        // like LinkStatisticsModel._ComputeJointSpheres, use the current configuration. LinkStatisticsModel.generate sets the zero configuration itself.
+        // sample the surfaces of the links and grabbed bodies once
+        std::vector< std::vector<Vector> > vlinkpoints(pbody->GetLinks().size());
+        for(size_t ilink = 0; ilink < vlinkpoints.size(); ++ilink) {
+            KinBody::LinkPtr plink = pbody->GetLinks()[ilink];
+            _SampleSurface(plink->GetCollisionData(), plink->GetTransform(), 0.5*xyzdelta, vlinkpoints[ilink]);
+        }
+        std::vector<KinBodyPtr> vgrabbed;
+        pbody->GetGrabbed(vgrabbed);
+        FOREACHC(itgrabbed, vgrabbed) {
+            KinBody::LinkPtr pgrabbinglink = pbody->IsGrabbing(**itgrabbed);
+            if( !pgrabbinglink ) {
+                continue;
+            }
+            FOREACHC(itlink, (*itgrabbed)->GetLinks()) {
+                _SampleSurface((*itlink)->GetCollisionData(), (*itlink)->GetTransform(), 0.5*xyzdelta, vlinkpoints.at(pgrabbinglink->GetIndex()));
+            }
+        }
+
+        std::vector<JointSweep> vsweeps;
+        std::vector<KinBody::JointPtr> vjoints = pbody->GetDependencyOrderedJoints();
+        FOREACHC(itjoint, vjoints) {
+            KinBody::JointPtr pjoint = *itjoint;
+            if( pjoint->GetDOF() != 1 || (!pjoint->IsRevolute(0) && !pjoint->IsPrismatic(0)) ) {
+                continue;
+            }
+            vsweeps.push_back(JointSweep());
+            JointSweep& sweep = vsweeps.back();
+            sweep.jointindex = pjoint->GetJointIndex();
+            sweep.bRevolute = pjoint->IsRevolute(0);
+            sweep.vanchor = pjoint->GetAnchor();
+            sweep.vaxis = pjoint->GetAxis(0);
+            std::vector<dReal> vlower, vupper;
+            pjoint->GetLimits(vlower, vupper);
+            dReal fvalue = pjoint->GetValue(0);
+            sweep.fmin = vlower.at(0) - fvalue;
+            sweep.fmax = vupper.at(0) - fvalue;
+            if( sweep.bRevolute && (pjoint->IsCircular(0) || sweep.fmax - sweep.fmin > 2*PI) ) {
+                sweep.fmin = -PI;
+                sweep.fmax = PI;
+            }
+            for(size_t ilink = 0; ilink < vlinkpoints.size(); ++ilink) {
+                if( pbody->DoesAffect(sweep.jointindex, ilink) ) {
+                    sweep.vpoints.insert(sweep.vpoints.end(), vlinkpoints[ilink].begin(), vlinkpoints[ilink].end());
+                }
+            }
+            _InitSweepGrid(sweep, xyzdelta);
+        }
+
+        // the sweeps only read their own points, so every joint can be voxelized by a different thread
+        JointStatisticsListPtr pstats(new std::vector<JointStatistics>(vsweeps.size()));
+        int numthreads = maxthreads > 0 ? maxthreads : std::max(1, (int)boost::thread::hardware_concurrency());
+        numthreads = std::min(numthreads, (int)vsweeps.size());
+        _nNextSweep = 0;
+        _nUsedVoxels = 0;
+        _errormessage.clear();
+        std::vector<boost::shared_ptr<boost::thread> > vthreads(std::max(0, numthreads-1));
+        FOREACH(itthread, vthreads) {
+            itthread->reset(new boost::thread(boost::bind(&LinkStatistics::_SweepThread, this, boost::cref(vsweeps), xyzdelta, boost::ref(*pstats))));
+        }
+        _SweepThread(vsweeps, xyzdelta, *pstats);
+        FOREACH(itthread, vthreads) {
+            (*itthread)->join();
+        }
+        if( _errormessage.size() > 0 ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("failed to compute link statistics of %s: %s", pbody->GetName()%_errormessage, ORE_Failed);
+        }
+        _ComputeJointSpheres(pbody, *pstats);
+        return pstats;
+    }
+
+    /// \brief sets the spheres of the revolute joints exactly like LinkStatisticsModel._ComputeJointSpheres, since they are used for the DOF weights.
+    ///
+    /// The sphere of a joint is centered at its anchor and contains the AABBs of the links rigidly attached to its child link.
+    /// It is then grown to contain the spheres of the joints attached to these links. Joints without a sweep are appended.
+    static void _ComputeJointSpheres(KinBodyPtr pbody, std::vector<JointStatistics>& vstats)
+    {
+        std::map<int, size_t> mapstatsindices; ///< joint index -> index in vstats
+        for(size_t istat = 0; istat < vstats.size(); ++istat) {
+            mapstatsindices[vstats[istat].jointindex] = istat;
+        }
+        std::map<int, std::pair<Vector, dReal> > mapjointspheres;
+        std::vector<KinBody::LinkPtr> vchildlinks;
+        std::vector<KinBody::JointPtr> vjoints = pbody->GetDependencyOrderedJoints();
+        FOREACHR(itjoint, vjoints) {
+            KinBody::JointPtr pjoint = *itjoint;
+            if( !pjoint->IsRevolute(0) ) {
+                continue;
+            }
+            pjoint->GetHierarchyChildLink()->GetRigidlyAttachedLinks(vchildlinks);
+            Vector vspherepos = pjoint->GetAnchor();
+            dReal fsphereradius = 0;
+            FOREACHC(itlink, vchildlinks) {
+                Transform tlink = (*itlink)->GetTransform();
+                AABB ab = (*itlink)->ComputeLocalAABB();
+                Vector vlinkpos = tlink.rotate(ab.pos) + tlink.trans;
+                fsphereradius = std::max(fsphereradius, RaveSqrt(ab.extents.lengthsqr3()) + RaveSqrt((vspherepos - vlinkpos).lengthsqr3()));
+            }
+
+            // grow the box around the sphere to contain the spheres of the child joints, which were processed before
+            Vector vmin = vspherepos - Vector(fsphereradius, fsphereradius, fsphereradius);
+            Vector vmax = vspherepos + Vector(fsphereradius, fsphereradius, fsphereradius);
+            std::vector< std::pair<Vector, dReal> > vchildspheres;
+            FOREACHC(itchildjoint, pbody->GetJoints()) {
+                if( std::find(vchildlinks.begin(), vchildlinks.end(), (*itchildjoint)->GetHierarchyParentLink()) == vchildlinks.end() ) {
+                    continue;
+                }
+                std::map<int, std::pair<Vector, dReal> >::const_iterator itchildsphere = mapjointspheres.find((*itchildjoint)->GetJointIndex());
+                if( itchildsphere == mapjointspheres.end() ) {
+                    continue;
+                }
+                vchildspheres.push_back(itchildsphere->second);
+                dReal fchildradius = itchildsphere->second.second;
+                for(int j = 0; j < 3; ++j) {
+                    vmin[j] = std::min(vmin[j], itchildsphere->second.first[j] - fchildradius);
+                    vmax[j] = std::max(vmax[j], itchildsphere->second.first[j] + fchildradius);
+                }
+            }
+
+            Vector vnewspherepos = 0.5*(vmin + vmax);
+            dReal fnewsphereradius = RaveSqrt((vnewspherepos - vspherepos).lengthsqr3()) + fsphereradius;
+            FOREACHC(itchildsphere, vchildspheres) {
+                fnewsphereradius = std::max(fnewsphereradius, RaveSqrt((vnewspherepos - itchildsphere->first).lengthsqr3()) + itchildsphere->second);
+            }
+            mapjointspheres[pjoint->GetJointIndex()] = std::make_pair(vnewspherepos, fnewsphereradius);
+
+            std::map<int, size_t>::iterator itstatsindex = mapstatsindices.find(pjoint->GetJointIndex());
+            if( itstatsindex == mapstatsindices.end() ) {
+                vstats.push_back(JointStatistics());
+                vstats.back().jointindex = pjoint->GetJointIndex();
+                itstatsindex = mapstatsindices.insert(std::make_pair(pjoint->GetJointIndex(), vstats.size()-1)).first;
+            }
+            vstats[itstatsindex->second].spherepos = vnewspherepos;
+            vstats[itstatsindex->second].sphereradius = fnewsphereradius;
+        }
+    }
+
+    /// \brief computes the sweeps in order. A thread only allocates its grid when the grids of all the threads fit in s_nMaxVoxels.
+    void _SweepThread(const std::vector<JointSweep>& vsweeps, dReal xyzdelta, std::vector<JointStatistics>& vstats)
+    {
+        while(1) {
+            size_t isweep;
+            {
+                boost::mutex::scoped_lock lock(_mutexSweep);
+                if( _nNextSweep >= vsweeps.size() || _errormessage.size() > 0 ) {
+                    break;
+                }
+                isweep = _nNextSweep++;
+                // every grid is at most s_nMaxVoxels, so this always succeeds once the other threads are done
+                while( _nUsedVoxels + vsweeps[isweep].numvoxels > s_nMaxVoxels ) {
+                    _conditionVoxels.wait(lock);
+                }
+                _nUsedVoxels += vsweeps[isweep].numvoxels;
+            }
+            try {
+                std::vector<uint8_t> vgrid;
+                _ComputeSweep(vsweeps[isweep], xyzdelta, vgrid, vstats[isweep]);
+            }
+            catch(const std::exception& ex) {
+                boost::mutex::scoped_lock lock(_mutexSweep);
+                _errormessage = ex.what();
+            }
+            {
+                boost::mutex::scoped_lock lock(_mutexSweep);
+                _nUsedVoxels -= vsweeps[isweep].numvoxels;
+            }
+            _conditionVoxels.notify_all();
+        }
+    }
+
+    /// \brief computes the voxel grid containing the swept volume with one empty voxel all around so that the outside is connected
+    static void _InitSweepGrid(JointSweep& sweep, dReal xyzdelta)
+    {
+        sweep.maxaxisdist = 0;
+        sweep.numvoxels = 0;
+        sweep.numsteps = 0;
+        sweep.dims[0] = sweep.dims[1] = sweep.dims[2] = 0;
+        if( sweep.vpoints.size() == 0 ) {
+            return;
+        }
+
+        dReal fpointradius = 0; ///< max distance of the points from the anchor
+        Vector vmin = sweep.vpoints[0], vmax = sweep.vpoints[0];
+        FOREACHC(itpoint, sweep.vpoints) {
+            Vector v = *itpoint - sweep.vanchor;
+            fpointradius = std::max(fpointradius, RaveSqrt(v.lengthsqr3()));
+            sweep.maxaxisdist = std::max(sweep.maxaxisdist, RaveSqrt(sweep.vaxis.cross(v).lengthsqr3()));
+            for(int j = 0; j < 3; ++j) {
+                vmin[j] = std::min(vmin[j], (*itpoint)[j]);
+                vmax[j] = std::max(vmax[j], (*itpoint)[j]);
+            }
+        }
+
+        if( sweep.bRevolute ) {
+            vmin = sweep.vanchor - Vector(fpointradius, fpointradius, fpointradius);
+            vmax = sweep.vanchor + Vector(fpointradius, fpointradius, fpointradius);
+            sweep.numsteps = 1 + (int)ceil((sweep.fmax - sweep.fmin)*sweep.maxaxisdist/(0.5*xyzdelta));
+        }
+        else {
+            for(int j = 0; j < 3; ++j) {
+                dReal f0 = sweep.vaxis[j]*sweep.fmin, f1 = sweep.vaxis[j]*sweep.fmax;
+                vmin[j] += std::min(f0, f1);
+                vmax[j] += std::max(f0, f1);
+            }
+            sweep.numsteps = 1 + (int)ceil((sweep.fmax - sweep.fmin)/(0.5*xyzdelta));
+        }
+        sweep.vmin = vmin - Vector(xyzdelta, xyzdelta, xyzdelta);
+        for(int j = 0; j < 3; ++j) {
+            sweep.dims[j] = 2 + (int)ceil((vmax[j] - sweep.vmin[j])/xyzdelta);
+        }
+        sweep.numvoxels = (uint64_t)sweep.dims[0]*sweep.dims[1]*sweep.dims[2];
+        if( sweep.numvoxels > s_nMaxVoxels ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("joint %d needs %d voxels, increase xyzdelta", sweep.jointindex%sweep.numvoxels, ORE_InvalidArguments);
+        }
+    }
+
+    /// \brief voxelizes the points at every step of the joint and fills the voxels enclosed by the swept surfaces
+    static void _ComputeSweep(const JointSweep& sweep, dReal xyzdelta, std::vector<uint8_t>& vgrid, JointStatistics& stats)
+    {
+        stats.jointindex = sweep.jointindex;
+        stats.spherepos = sweep.vanchor;
+        stats.sphereradius = 0;
+        stats.maxaxisdist = sweep.maxaxisdist;
+        stats.sweptvolume = 0;
+        if( sweep.vpoints.size() == 0 ) {
+            return;
+        }
+        const Vector& vmin = sweep.vmin;
+        const int* dims = sweep.dims;
+        const int numsteps = sweep.numsteps;
+        const uint64_t numvoxels = sweep.numvoxels;
+
+        vgrid.resize(numvoxels);
+        std::fill(vgrid.begin(), vgrid.end(), 0);
+
+        dReal fidelta = 1/xyzdelta;
+        for(int istep = 0; istep < numsteps; ++istep) {
+            dReal fvalue = numsteps > 1 ? sweep.fmin + (sweep.fmax - sweep.fmin)*istep/(numsteps-1) : dReal(0);
+            Transform t;
+            if( sweep.bRevolute ) {
+                t.rot = quatFromAxisAngle(sweep.vaxis, fvalue);
+                t.trans = sweep.vanchor - t.rotate(sweep.vanchor);
+            }
+            else {
+                t.trans = sweep.vaxis*fvalue;
+            }
+            FOREACHC(itpoint, sweep.vpoints) {
+                Vector v = (t*(*itpoint) - vmin)*fidelta;
+                int x = (int)v.x, y = (int)v.y, z = (int)v.z;
+                if( x >= 0 && x < dims[0] && y >= 0 && y < dims[1] && z >= 0 && z < dims[2] ) {
+                    vgrid[((size_t)z*dims[1] + y)*dims[0] + x] = 1;
+                }
+            }
+        }
+
+        // flood the outside from the corner, everything not reached is inside the swept volume
+        size_t numoutside = 0;
+        std::vector<size_t> vstack(1, 0);
+        vgrid[0] = 2;
+        while(vstack.size() > 0) {
+            size_t index = vstack.back();
+            vstack.pop_back();
+            ++numoutside;
+            int x = index % dims[0], y = (index / dims[0]) % dims[1], z = index / ((size_t)dims[0]*dims[1]);
+            size_t vneighs[6];
+            int numneighs = 0;
+            if( x > 0 ) vneighs[numneighs++] = index - 1;
+            if( x+1 < dims[0] ) vneighs[numneighs++] = index + 1;
+            if( y > 0 ) vneighs[numneighs++] = index - dims[0];
+            if( y+1 < dims[1] ) vneighs[numneighs++] = index + dims[0];
+            if( z > 0 ) vneighs[numneighs++] = index - (size_t)dims[0]*dims[1];
+            if( z+1 < dims[2] ) vneighs[numneighs++] = index + (size_t)dims[0]*dims[1];
+            for(int ineigh = 0; ineigh < numneighs; ++ineigh) {
+                if( vgrid[vneighs[ineigh]] == 0 ) {
+                    vgrid[vneighs[ineigh]] = 2;
+                    vstack.push_back(vneighs[ineigh]);
+                }
+            }
+        }
+        stats.sweptvolume = (numvoxels - numoutside)*xyzdelta*xyzdelta*xyzdelta;
+    }
+
+    /// \brief appends points on the triangles of the mesh so that no two neighboring points are further than delta
+    static void _SampleSurface(const TriMesh& trimesh, const Transform& t, dReal delta, std::vector<Vector>& vpoints)
+    {
+        for(size_t i = 0; i+2 < trimesh.indices.size(); i += 3) {
+            Vector v0 = t*trimesh.vertices.at(trimesh.indices[i]), v1 = t*trimesh.vertices.at(trimesh.indices[i+1]), v2 = t*trimesh.vertices.at(trimesh.indices[i+2]);
+            dReal fmaxedge = RaveSqrt(std::max((v1-v0).lengthsqr3(), std::max((v2-v1).lengthsqr3(), (v0-v2).lengthsqr3())));
+            int n = std::max(1, (int)ceil(fmaxedge/delta));
+            for(int a = 0; a <= n; ++a) {
+                for(int b = 0; a+b <= n; ++b) {
+                    vpoints.push_back(v0 + (v1-v0)*(dReal(a)/n) + (v2-v0)*(dReal(b)/n));
+                }
+            }
+        }
+    }
+
+    boost::mutex _mutexSweep; ///< protects _nNextSweep, _nUsedVoxels and _errormessage
+    boost::condition_variable _conditionVoxels; ///< notified when a thread frees its grid
+    size_t _nNextSweep;
+    uint64_t _nUsedVoxels; ///< voxels allocated by all the threads
+    std::string _errormessage;
+
+    static const uint64_t s_nMaxVoxels = (uint64_t)1<<30; ///< max total size of the voxel grids of all the threads
+    static const char s_header[16];
+    static boost::mutex s_mutexCache;
+    static std::map<std::string, JointStatisticsListPtr> s_mapCache; ///< statistics shared by all environments, indexed by _GetCacheKey
+};
+
+const char LinkStatistics::s_header[16] = "OPENRAVELINKST2";
+boost::mutex LinkStatistics::s_mutexCache;
+std::map<std::string, JointStatisticsListPtr> LinkStatistics::s_mapCache;
+
+ModuleBasePtr CreateLinkStatistics(EnvironmentBasePtr penv) {
+    return ModuleBasePtr(new LinkStatistics(penv));
+}
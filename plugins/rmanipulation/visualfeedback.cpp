@@ -15,6 +15,8 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "commonmanipulation.h"
 #include <boost/algorithm/string/replace.hpp>
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/array.hpp>
 
 /// samples rays from the projected OBB and returns true if the test function returns true
 /// for all the rays. Otherwise, returns false
@@ -568,6 +570,158 @@ private:
         vector<Transform> _vcameras;         ///< camera transformations in local coord systems
     };
 
+    /// \brief visibility of the camera poses relative to the target, quantized into cells so that queries are a table lookup
+    ///
+    /// Only depends on the target geometry, the camera convex hull and the links rigidly attached to the camera, so can be computed offline and saved.
+    class VisibilityMap
+    {
+public:
+        enum VisibilityFlags
+        {
+            VF_InConvexHull = 1, ///< the target geometry is inside the camera visibility convex hull
+            VF_NotOccludedByRigid = 2, ///< the target is not occluded by the links rigidly attached to the camera
+            VF_Visible = 3,
+        };
+
+        VisibilityMap() : ftransres(0.01), frotres(0.02) {
+        }
+
+        void Clear()
+        {
+            vtransforms.resize(0);
+            vflags.resize(0);
+            vvisibletransforms.resize(0);
+            _mapcells.clear();
+        }
+
+        inline bool IsEmpty() const {
+            return vtransforms.size() == 0;
+        }
+
+        void Add(const Transform& tCameraInTarget, uint8_t flags)
+        {
+            vtransforms.push_back(tCameraInTarget);
+            vflags.push_back(flags);
+            if( flags == VF_Visible ) {
+                vvisibletransforms.push_back(tCameraInTarget);
+            }
+            std::pair<std::map<CellKey, CellFlags>::iterator, bool> itinserted = _mapcells.insert(std::make_pair(_GetCellKey(tCameraInTarget), CellFlags(flags, flags)));
+            if( !itinserted.second ) {
+                itinserted.first->second.first &= flags;
+                itinserted.first->second.second |= flags;
+            }
+        }
+
+        /// \brief returns the VisibilityFlags of the cell containing the camera pose
+        ///
+        /// \return -1 if no pose of the map falls in the cell, or if the poses in the cell do not all have the same flags. The caller then has to do the exact check.
+        int Lookup(const Transform& tCameraInTarget) const
+        {
+            std::map<CellKey, CellFlags>::const_iterator it = _mapcells.find(_GetCellKey(tCameraInTarget));
+            if( it == _mapcells.end() || it->second.first != it->second.second ) {
+                return -1;
+            }
+            return it->second.first;
+        }
+
+        bool Save(const std::string& filename) const
+        {
+            std::ofstream f(filename.c_str(), std::ios::binary);
+            if( !f ) {
+                return false;
+            }
+            f.write(s_header, sizeof(s_header));
+            _WriteString(f, targetlinkname);
+            _WriteString(f, targetgeomname);
+            _WriteString(f, sensorname);
+            double res[2] = { ftransres, frotres };
+            f.write(reinterpret_cast<const char*>(res), sizeof(res));
+            uint64_t num = vtransforms.size();
+            f.write(reinterpret_cast<const char*>(&num), sizeof(num));
+            for(size_t i = 0; i < vtransforms.size(); ++i) {
+                const Transform& t = vtransforms[i];
+                double values[7] = { t.rot.x, t.rot.y, t.rot.z, t.rot.w, t.trans.x, t.trans.y, t.trans.z };
+                f.write(reinterpret_cast<const char*>(values), sizeof(values));
+                f.write(reinterpret_cast<const char*>(&vflags[i]), 1);
+            }
+            return !!f;
+        }
+
+        bool Load(const std::string& filename)
+        {
+            Clear();
+            std::ifstream f(filename.c_str(), std::ios::binary);
+            char header[sizeof(s_header)];
+            if( !f.read(header, sizeof(header)) || memcmp(header, s_header, sizeof(header)) != 0 ) {
+                return false;
+            }
+            double res[2];
+            uint64_t num = 0;
+            if( !_ReadString(f, targetlinkname) || !_ReadString(f, targetgeomname) || !_ReadString(f, sensorname) || !f.read(reinterpret_cast<char*>(res), sizeof(res)) || !f.read(reinterpret_cast<char*>(&num), sizeof(num)) ) {
+                return false;
+            }
+            ftransres = res[0];
+            frotres = res[1];
+            vtransforms.reserve(num);
+            vflags.reserve(num);
+            for(uint64_t i = 0; i < num; ++i) {
+                double values[7];
+                uint8_t flags = 0;
+                if( !f.read(reinterpret_cast<char*>(values), sizeof(values)) || !f.read(reinterpret_cast<char*>(&flags), 1) ) {
+                    Clear();
+                    return false;
+                }
+                Add(Transform(Vector(values[0], values[1], values[2], values[3]), Vector(values[4], values[5], values[6])), flags);
+            }
+            return true;
+        }
+
+        std::string targetlinkname, targetgeomname, sensorname; ///< what the map was computed for
+        dReal ftransres, frotres; ///< cell size of the camera translation and of the quaternion coefficients
+        vector<Transform> vtransforms; ///< camera poses in the target link coordinate system
+        vector<uint8_t> vflags; ///< VisibilityFlags of every pose
+        vector<Transform> vvisibletransforms; ///< poses that are VF_Visible, used for goal sampling
+
+private:
+        typedef boost::array<int32_t, 7> CellKey;
+        typedef std::pair<uint8_t, uint8_t> CellFlags; ///< flags common to all poses of the cell, and flags of any pose of the cell
+
+        CellKey _GetCellKey(const Transform& t) const
+        {
+            // q and -q are the same rotation
+            Vector q = t.rot.x < 0 ? -t.rot : t.rot;
+            CellKey key;
+            key[0] = (int32_t)floor(t.trans.x/ftransres);
+            key[1] = (int32_t)floor(t.trans.y/ftransres);
+            key[2] = (int32_t)floor(t.trans.z/ftransres);
+            key[3] = (int32_t)floor(q.x/frotres);
+            key[4] = (int32_t)floor(q.y/frotres);
+            key[5] = (int32_t)floor(q.z/frotres);
+            key[6] = (int32_t)floor(q.w/frotres);
+            return key;
+        }
+
+        static void _WriteString(std::ostream& f, const std::string& s)
+        {
+            uint32_t len = s.size();
+            f.write(reinterpret_cast<const char*>(&len), sizeof(len));
+            f.write(s.c_str(), len);
+        }
+
+        static bool _ReadString(std::istream& f, std::string& s)
+        {
+            uint32_t len = 0;
+            if( !f.read(reinterpret_cast<char*>(&len), sizeof(len)) ) {
+                return false;
+            }
+            s.resize(len);
+            return len == 0 || !!f.read(&s[0], len);
+        }
+
+        static const char s_header[16];
+        std::map<CellKey, CellFlags> _mapcells;
+    };
+
     VisualFeedback(EnvironmentBasePtr penv) : ModuleBase(penv), _preport(new CollisionReport())
     {
         __description = ":Interface Author: Rosen Diankov\n\n\
@@ -595,9 +749,18 @@ Visibility computation checks occlusion with other objects using ray sampling in
 :param sphere: Sets the transforms along a sphere density and the distances\n\
 :param conedirangle: Prunes the currently set transforms along a cone centered at the local target center and directed towards conedirangle with a half-angle of ``|conedirangle|``. Can specify multiple cones for an OR effect. The cone represents the visibility of the pattern, should not represent the field of view of the camera.");
         RegisterCommand("SetCameraTransforms",boost::bind(&VisualFeedback::SetCameraTransforms,this,_1,_2),
-                        "Sets new camera transformations. Can optionally choose a minimum distance from all planes of the camera convex hull (includes gripper mask)");
+                        "Sets new camera transformations and clears the visibility map. Can optionally choose a minimum distance from all planes of the camera convex hull (includes gripper mask)");
         RegisterCommand("ComputeVisibility",boost::bind(&VisualFeedback::ComputeVisibility,this,_1,_2),
-                        "Computes the visibility of the current robot configuration");
+                        "Computes the visibility of the current robot configuration. If a visibility map is set, the camera pose is first looked up in it and only the occlusion by the environment is checked. Poses falling in a cell that is not in the map, or whose poses do not all have the same visibility, get the full check.");
+        RegisterCommand("ComputeVisibilityMap",boost::bind(&VisualFeedback::ComputeVisibilityMap,this,_1,_2),
+                        "Computes the visibility map of the current camera transforms, checking the camera convex hull and the occlusion by links rigidly attached to the camera for every transform. Returns the number of visible transforms.\n\n\
+:param transres: cell size of the camera translation\n\
+:param rotres: cell size of the camera quaternion coefficients\n\
+:param checkrigid: if 1 (default), checks occlusion by the links rigidly attached to the camera");
+        RegisterCommand("SaveVisibilityMap",boost::bind(&VisualFeedback::SaveVisibilityMap,this,_1,_2),
+                        "Saves the visibility map to a file");
+        RegisterCommand("LoadVisibilityMap",boost::bind(&VisualFeedback::LoadVisibilityMap,this,_1,_2),
+                        "Loads a visibility map from a file, it has to be computed for the current target link and sensor. The visible transforms of the map are used for goal sampling.");
         RegisterCommand("ComputeVisibleConfiguration",boost::bind(&VisualFeedback::ComputeVisibleConfiguration,this,_1,_2),
                         "Gives a camera transformation, computes the visibility of the object and returns the robot configuration that takes the camera to its specified position, otherwise returns false");
         RegisterCommand("SampleVisibilityGoal",boost::bind(&VisualFeedback::SampleVisibilityGoal,this,_1,_2),
@@ -623,6 +786,7 @@ Visibility computation checks occlusion with other objects using ray sampling in
         _pmanip.reset();
         _pcamerageom.reset();
         _visibilitytransforms.clear();
+        _visibilitymap.Clear();
         _preport.reset();
         ModuleBase::Destroy();
     }
@@ -669,6 +833,7 @@ Visibility computation checks occlusion with other objects using ray sampling in
         _pcamerageom.reset();
         _targetlink.reset();
         _targetGeomName.clear();
+        _visibilitymap.Clear();
         RobotBase::AttachedSensorPtr psensor;
         RobotBase::ManipulatorPtr pmanip;
         _sensorrobot = _robot;
@@ -1078,6 +1243,7 @@ Visibility computation checks occlusion with other objects using ray sampling in
     {
         string cmd;
         _visibilitytransforms.resize(0);
+        _visibilitymap.Clear(); // computed for the previous transforms
         dReal mindist = 0;
         while(!sinput.eof()) {
             sinput >> cmd;
@@ -1130,16 +1296,146 @@ Visibility computation checks occlusion with other objects using ray sampling in
         bool bcheckocclusion = true;
         sinput >> bcheckocclusion;
 
+        int visibilityflags = -1;
+        Transform tCameraInTarget;
+        if( !_visibilitymap.IsEmpty() ) {
+            tCameraInTarget = _targetlink->GetTransform().inverse()*_psensor->GetTransform();
+            visibilityflags = _visibilitymap.Lookup(tCameraInTarget);
+            if( visibilityflags >= 0 ) {
+                if( visibilityflags != VisibilityMap::VF_Visible ) {
+                    sout << 0;
+                    return true;
+                }
+                if( !bcheckocclusion ) {
+                    sout << 1;
+                    return true;
+                }
+            }
+        }
+
         RobotBase::RobotStateSaver saver(_robot);
         _robot->SetActiveManipulator(_pmanip);
         _robot->SetActiveDOFs(_pmanip->GetArmIndices());
         boost::shared_ptr<VisibilityConstraintFunction> pconstraintfn(new VisibilityConstraintFunction(shared_problem()));
 
         std::string errormsg;
+        if( visibilityflags >= 0 ) {
+            // convex hull is known from the map, only the environment can occlude
+            sout << !pconstraintfn->IsOccluded(tCameraInTarget, false, errormsg);
+            return true;
+        }
         sout << pconstraintfn->IsVisible(bcheckocclusion, false, errormsg);
         return true;
     }
 
+    bool ComputeVisibilityMap(ostream& sout, istream& sinput)
+    {
+        string cmd;
+        bool bCheckRigid = true;
+        VisibilityMap visibilitymap;
+        while(!sinput.eof()) {
+            sinput >> cmd;
+            if( !sinput ) {
+                break;
+            }
+            std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::tolower);
+
+            if( cmd == "transres" ) {
+                sinput >> visibilitymap.ftransres;
+            }
+            else if( cmd == "rotres" ) {
+                sinput >> visibilitymap.frotres;
+            }
+            else if( cmd == "checkrigid" ) {
+                sinput >> bCheckRigid;
+            }
+            else {
+                RAVELOG_WARN(str(boost::format("unrecognized command: %s\n")%cmd));
+                break;
+            }
+
+            if( !sinput ) {
+                RAVELOG_ERROR(str(boost::format("failed processing command %s\n")%cmd));
+                return false;
+            }
+        }
+
+        if( !_targetlink || !_psensor ) {
+            RAVELOG_WARN("camera and target are not set\n");
+            return false;
+        }
+        if( visibilitymap.ftransres <= 0 || visibilitymap.frotres <= 0 ) {
+            RAVELOG_WARN("visibility map resolutions have to be positive\n");
+            return false;
+        }
+
+        visibilitymap.targetlinkname = _targetlink->GetName();
+        visibilitymap.targetgeomname = _targetGeomName;
+        visibilitymap.sensorname = _psensor->GetName();
+
+        KinBody::KinBodyStateSaver saver(_targetlink->GetParent(),KinBody::Save_LinkTransformation);
+        _targetlink->SetTransform(Transform());
+        boost::shared_ptr<VisibilityConstraintFunction> pconstraintfn(new VisibilityConstraintFunction(shared_problem()));
+        FOREACHC(itcamera, _visibilitytransforms) {
+            uint8_t flags = 0;
+            if( pconstraintfn->InConvexHull(*itcamera) ) {
+                flags |= VisibilityMap::VF_InConvexHull;
+                if( !bCheckRigid || !pconstraintfn->IsOccludedByRigid(*itcamera) ) {
+                    flags |= VisibilityMap::VF_NotOccludedByRigid;
+                }
+            }
+            visibilitymap.Add(*itcamera, flags);
+        }
+        pconstraintfn.reset();
+
+        _visibilitymap = visibilitymap;
+        sout << _visibilitymap.vvisibletransforms.size();
+        return true;
+    }
+
+    bool SaveVisibilityMap(ostream& sout, istream& sinput)
+    {
+        string filename;
+        if( !getline(sinput, filename) ) {
+            return false;
+        }
+        boost::trim(filename);
+        if( _visibilitymap.IsEmpty() ) {
+            RAVELOG_WARN("visibility map is not computed\n");
+            return false;
+        }
+        if( !_visibilitymap.Save(filename) ) {
+            RAVELOG_WARN_FORMAT("failed to write visibility map to %s", filename);
+            return false;
+        }
+        return true;
+    }
+
+    bool LoadVisibilityMap(ostream& sout, istream& sinput)
+    {
+        string filename;
+        if( !getline(sinput, filename) ) {
+            return false;
+        }
+        boost::trim(filename);
+        if( !_targetlink || !_psensor ) {
+            RAVELOG_WARN("camera and target are not set\n");
+            return false;
+        }
+        VisibilityMap visibilitymap;
+        if( !visibilitymap.Load(filename) ) {
+            RAVELOG_WARN_FORMAT("failed to read visibility map from %s", filename);
+            return false;
+        }
+        if( visibilitymap.targetlinkname != _targetlink->GetName() || visibilitymap.targetgeomname != _targetGeomName || visibilitymap.sensorname != _psensor->GetName() ) {
+            RAVELOG_WARN_FORMAT("visibility map %s was computed for target %s:%s and sensor %s", filename%visibilitymap.targetlinkname%visibilitymap.targetgeomname%visibilitymap.sensorname);
+            return false;
+        }
+        _visibilitymap = visibilitymap;
+        sout << _visibilitymap.vvisibletransforms.size();
+        return true;
+    }
+
     bool SetParameter(ostream& sout, istream& sinput)
     {
         string cmd;
@@ -1267,7 +1563,7 @@ Visibility computation checks occlusion with other objects using ray sampling in
             return false;
         }
 
-        boost::shared_ptr<GoalSampleFunction> pgoalsampler(new GoalSampleFunction(shared_problem(),_visibilitytransforms));
+        boost::shared_ptr<GoalSampleFunction> pgoalsampler(new GoalSampleFunction(shared_problem(),_GetSampleTransforms()));
 
         uint64_t starttime = utils::GetMicroTime();
         vector<dReal> vsample;
@@ -1350,7 +1646,7 @@ Visibility computation checks occlusion with other objects using ray sampling in
         _robot->SetActiveManipulator(_pmanip);
         _robot->SetActiveDOFs(_pmanip->GetArmIndices(), affinedofs);
 
-        boost::shared_ptr<GoalSampleFunction> pgoalsampler(new GoalSampleFunction(shared_problem(),_visibilitytransforms));
+        boost::shared_ptr<GoalSampleFunction> pgoalsampler(new GoalSampleFunction(shared_problem(),_GetSampleTransforms()));
         pgoalsampler->_fSampleGoalProb = fSampleGoalProb;
         _robot->RegrabAll();
 
@@ -1526,6 +1822,12 @@ Visibility computation checks occlusion with other objects using ray sampling in
         return false;
     }
 
+    /// \brief camera transforms to sample goals from, the visibility map already pruned the transforms that cannot see the target
+    const vector<Transform>& _GetSampleTransforms() const
+    {
+        return _visibilitymap.IsEmpty() ? _visibilitytransforms : _visibilitymap.vvisibletransforms;
+    }
+
 protected:
     RobotBasePtr _robot, _sensorrobot;
     bool _bIgnoreSensorCollision; ///< if true will ignore any collisions with vf->_sensorrobot
@@ -1538,6 +1840,7 @@ protected:
     SensorBase::CameraGeomDataConstPtr _pcamerageom;
     Transform _tToManip;     ///< transforms a coord system from the link to the gripper coordsystem. tLinkInWorld * _tToManip = tManipInWorld
     vector<Transform> _visibilitytransforms; ///< the transform with respect to the targetlink and camera (or vice-versa)
+    VisibilityMap _visibilitymap; ///< precomputed visibility of the camera poses relative to the target, empty if not computed
     dReal _fRayMinDist, _fAllowableOcclusion, _fSampleRayDensity;
 
     CollisionReportPtr _preport;
@@ -1546,6 +1849,8 @@ protected:
     Vector _vcenterconvex;     ///< center point on the z=1 plane of the convex region
 };
 
+const char VisualFeedback::VisibilityMap::s_header[16] = "OPENRAVEVISMAP1";
+
 ModuleBasePtr CreateVisualFeedback(EnvironmentBasePtr penv) {
     return ModuleBasePtr(new VisualFeedback(penv));
 }
@@ -14,6 +14,7 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "openraveplugindefs.h"
+#include <openrave/planningutils.h>
 
 class LinearSmoother : public PlannerBase
 {
@@ -498,7 +499,10 @@ protected:
                 continue;
             }
 
-            for(size_t i = 0; i+1 < vpathvalues.size(); ++i) {
+            // check the new segments in bisection order so that a shortcut through an obstacle is rejected early
+            planningutils::ComputeBisectionOrder(vpathvalues.size()-1, _vsegmentorder);
+            FOREACHC(itsegment, _vsegmentorder) {
+                size_t i = *itsegment;
                 IntervalType interval = i+2==vpathvalues.size() ? IT_Open : IT_OpenStart;
                 if (!SegmentFeasible(vpathvalues.at(i).first, vpathvalues.at(i+1).first, interval)) {
                     bsuccess = false;
@@ -696,7 +700,10 @@ protected:
                 continue;
             }
 
-            for(size_t i = 0; i+1 < vpathvalues.size(); ++i) {
+            // check the new segments in bisection order so that a shortcut through an obstacle is rejected early
+            planningutils::ComputeBisectionOrder(vpathvalues.size()-1, _vsegmentorder);
+            FOREACHC(itsegment, _vsegmentorder) {
+                size_t i = *itsegment;
                 IntervalType interval = i+2==vpathvalues.size() ? IT_Open : IT_OpenStart;
                 if (!SegmentFeasible(vpathvalues.at(i).first, vpathvalues.at(i+1).first, interval)) {
                     bsuccess = false;
@@ -1273,6 +1280,7 @@ protected:
     RobotBasePtr _probot;
     PlannerBasePtr _linearretimer;
     std::vector<dReal> _vConfigVelocityLimitInv;
+    std::vector<size_t> _vsegmentorder; ///< cache for the order in which to check the shortcut segments
     int _nUseSingleDOFSmoothing;
 };
 
@@ -327,29 +327,30 @@ public:
     // Check manipulator's linear velocity and acceleration if they violate the given limits (_maxmanipspeed and
     // _maxmanipaccel). Linear velocity and accelerations are computed at checkpoints (itmanipinfo->checkpoints).
     //
-    // Checking is done only at the start and the end of each parabolic segment. Within one parabolic segment,
-    // manipaccel tends to increase or decrease monotonically and therefore, the maximum is occuring at either end. We
-    // can reduce computational load by only checking at both end instead of checking at every subdivided segment and
-    // still having the same result.
+    // Checking is done at the critical times of rampndVect, ie the start and the end of every parabolic
+    // segment. Within one parabolic segment, manipaccel tends to increase or decrease monotonically and therefore, the
+    // maximum is occuring at either end. We can reduce computational load by only checking at both end instead of
+    // checking at every subdivided segment and still having the same result.
     //
-    // After having found a point where manip constraints are violated, we compute Jacobian at that configuration and
-    // use it to estimate contribution of each dof to the velocity/acceleration at the checkpoint so as to scale the
+    // All the critical times are evaluated together, see _ComputeCriticalStates. The robot is only set once per
+    // distinct configuration and the end-effector velocities and accelerations are computed from the jacobians and
+    // hessians of the manipulator dofs instead of the velocities and accelerations of all the links.
+    //
+    // After having found a point where manip constraints are violated, we use the jacobian at that configuration to
+    // estimate contribution of each dof to the velocity/acceleration at the checkpoint so as to scale the
     // vellimits/accellimits of that dof down accordingly.
     //
     // Notes:
-    // 1. For acceleration computation, we estimate the relation between joint accel and end-effector accel to be
-    //    a = J * qdd
-    //    to save computation time.
-    // 2. We compute the contribution of each dof to "linear" velocity/acceleration of the "end-effector point" instead of
+    // 1. We compute the contribution of each dof to "linear" velocity/acceleration of the "end-effector point" instead of
     //    the actual checkpoint.
-    // 3. Consider velocity, for example. From the Jacobian equation v = J*qd, we have that how the velocity of each dof
+    // 2. Consider velocity, for example. From the Jacobian equation v = J*qd, we have that how the velocity of each dof
     //    contributes to the linear eff velocity depends on the respective column of J. For example, if the i-th column
     //    of J is perpendicular to v, then dof i does not contribute to the velocity limit violation at that
     //    moment. Therefore, we can give a score to each dof to indicate how much it contributes to the eff velocity,
     //    and this score is computed from the dot product between the respective column of J and v. Now we rank dofs
     //    based on their contributions and the dof with the most contribution will have its velocity limit scaled down
     //    the most, and so on.
-    // 4. If acceleration limits are violated, the scaling factors will be computed from the acceleration equation,
+    // 3. If acceleration limits are violated, the scaling factors will be computed from the acceleration equation,
     //    regardless of whether or not velocity limits are violated. Otherwise, if velocity limits are violated, the
     //    scaling factors will be computed from the velocity equation.
     RampOptimizerInternal::CheckReturn CheckManipConstraints2(const std::vector<RampOptimizerInternal::RampND> &rampndVect, IntervalType interval=IT_OpenStart, bool bUseNewHeuristic=true)
@@ -363,579 +364,322 @@ public:
         dReal reductionFactorCutoff = 0.8; // If the originally computed reductionFactor is *not* less than this value,
                                            // we don't computed scaling factors separately for each DOF and use the
                                            // usual procedure.
-        dReal fMaxReductionFactor = 1; // scaling factor for the DOF with least contribution to constriant violation
-
-        Vector endeffvellin, endeffvelang, endeffacclin, endeffaccang;
-        dReal maxactualmanipspeed = 0, maxactualmanipaccel = 0;
-
         dReal multiplier = 0.85;     // a multiplier to the scaling factor computed from the ratio between the violating value and the bound
         int retcode = 0;
         dReal maxallowedmult = 0.92; // the final reduction factor should not less than this value
 
-        // Check manipspeed and manipaccel at the beginning of the segment
-        std::vector<RampOptimizerInternal::RampND>::const_iterator itrampnd = rampndVect.begin();
-        int velViolationIndex = -1; // index to manipinfo that violates manip vel constraint (-1 if constraints are respected)
-        int accelViolationIndex = -1; // index to manipinfo that violates manip accel constraint (-1 if constraints are respected)
-        Vector vVelViolation, vAccelViolation;
-        int curmanipindex = 0;
-        bool bBoundExceeded = false;
-
-        std::vector<dReal>& vDOFValuesAtViolation = _vdofvalues, &vDOFVelAtViolation = _vdofvelocities, &vDOFAccelAtViolation = _vdofaccelerations;
-        vDOFValuesAtViolation.resize(0);
-        vDOFVelAtViolation.resize(0);
-        vDOFAccelAtViolation.resize(0);
-
-        if( !(interval == IT_OpenStart) ) {
-            FOREACHC(itmanipinfo, _listCheckManips) {
-                bBoundExceeded = false;
-                KinBodyPtr probot = itmanipinfo->plink->GetParent();
-                itrampnd->GetAVect(ac);
-                qfillactive.resize(itmanipinfo->vuseddofindices.size());
-                _vfillactive.resize(itmanipinfo->vuseddofindices.size());
-                _afill.resize(probot->GetDOF());
-                for(size_t index = 0; index < itmanipinfo->vuseddofindices.size(); ++index) {
-                    qfillactive[index] = itrampnd->GetX0At(itmanipinfo->vconfigindices.at(index));
-                    _vfillactive[index] = itrampnd->GetV0At(itmanipinfo->vconfigindices[index]);
-                    _afill[itmanipinfo->vuseddofindices.at(index)] = ac.at(itmanipinfo->vconfigindices[index]);
-                }
-
-                int endeffindex = itmanipinfo->plink->GetIndex();
-                KinBody::KinBodyStateSaver saver(probot, KinBody::Save_LinkTransformation|KinBody::Save_LinkVelocities);
+        _ComputeCriticalStates(rampndVect, interval);
+        dReal maxactualmanipspeed = _velviolation.fvalue, maxactualmanipaccel = _accelviolation.fvalue;
 
-                // Set the robot to the new state
-                probot->SetDOFValues(qfillactive, KinBody::CLA_CheckLimits, itmanipinfo->vuseddofindices);
-                probot->SetDOFVelocities(_vfillactive, KinBody::CLA_CheckLimits, itmanipinfo->vuseddofindices);
-                probot->GetLinkVelocities(endeffvels);
-                probot->GetLinkAccelerations(_afill,endeffaccs);
-                endeffvellin = endeffvels.at(endeffindex).first;
-                endeffvelang = endeffvels.at(endeffindex).second;
-                endeffacclin = endeffaccs.at(endeffindex).first;
-                endeffaccang = endeffaccs.at(endeffindex).second;
-                Transform R = itmanipinfo->plink->GetTransform();
-
-                FOREACH(itpoint, itmanipinfo->checkpoints) {
-                    Vector point = R.rotate(*itpoint);
-
-                    if( _maxmanipspeed > 0 ) {
-                        // Compute the linear velocity: v_total = v + w x r
-                        Vector vpoint = endeffvellin + endeffvelang.cross(point);
-                        dReal actualmanipspeed = RaveSqrt(vpoint.lengthsqr3());
-                        if( actualmanipspeed > maxactualmanipspeed ) {
-                            bBoundExceeded = true;
-                            maxactualmanipspeed = actualmanipspeed;
-                            velViolationIndex = curmanipindex;
-                            vVelViolation = vpoint;
-                        }
-                    }
-
-                    if( _maxmanipaccel > 0 ) {
-                        // Compute the linear acceleration: a_total = a + w x (w x r) + (alpha x r)
-                        Vector apoint = endeffacclin + endeffvelang.cross(endeffvelang.cross(point)) + endeffaccang.cross(point);
-                        dReal actualmanipaccel = RaveSqrt(apoint.lengthsqr3());
-                        if( actualmanipaccel > maxactualmanipaccel ) {
-                            bBoundExceeded = true;
-                            maxactualmanipaccel = actualmanipaccel;
-                            accelViolationIndex = curmanipindex;
-                            vAccelViolation = apoint;
-                        }
-                    }
-                }
-                if( bBoundExceeded ) {
-                    // Keep these values for later computation if constraints are violated
-                    vDOFValuesAtViolation = qfillactive;
-                    vDOFVelAtViolation = _vfillactive;
-                    vDOFAccelAtViolation = _afill;
-                }
-                // Finished iterating through all checkpoints
-                ++curmanipindex;
-            }
-            // Finished iterating through all manipulators
+        if( bUseNewHeuristic ) {
+            RampOptimizerInternal::CheckReturn retcheck;
+            retcheck.retcode = 0;
+            retcheck.fTimeBasedSurpassMult = reductionFactor;
+            retcheck.fMaxManipSpeed = maxactualmanipspeed;
+            retcheck.fMaxManipAccel = maxactualmanipaccel;
 
-            if( bUseNewHeuristic ) {
-                RampOptimizerInternal::CheckReturn retcheck;
-                retcheck.retcode = 0;
+            if( _maxmanipaccel > 0 && maxactualmanipaccel > _maxmanipaccel ) {
+                // Accel limits are violated
+                reductionFactor = RaveSqrt(min(multiplier*_maxmanipaccel/maxactualmanipaccel, maxallowedmult));
+                retcheck.retcode = CFO_CheckTimeBasedConstraints;
                 retcheck.fTimeBasedSurpassMult = reductionFactor;
-                retcheck.fMaxManipSpeed = maxactualmanipspeed;
-                retcheck.fMaxManipAccel = maxactualmanipaccel;
-
-                if( _maxmanipaccel > 0 && maxactualmanipaccel > _maxmanipaccel ) {
-                    // Accel limits are violated
-                    reductionFactor = RaveSqrt(min(multiplier*_maxmanipaccel/maxactualmanipaccel, maxallowedmult));
-                    retcheck.retcode = CFO_CheckTimeBasedConstraints;
-                    retcheck.fTimeBasedSurpassMult = reductionFactor;
-                    if( reductionFactor >= reductionFactorCutoff ) {
-                        // Constraints are not severely violated. Don't bother to compute Jacobian and that stuff
-                        return retcheck;
-                    }
-
-                    std::list< ManipConstraintInfo2 >::iterator itmanipinfo = _listCheckManips.begin();
-                    std::advance(itmanipinfo, accelViolationIndex);
-                    RobotBasePtr probot = itmanipinfo->pmanip->GetRobot();
-                    KinBody::KinBodyStateSaver saver(probot, KinBody::Save_LinkTransformation|KinBody::Save_LinkVelocities);
-                    // Set the robot to the new state
-                    probot->SetDOFValues(vDOFValuesAtViolation, KinBody::CLA_CheckLimits, itmanipinfo->vuseddofindices);
-                    Transform tlink = itmanipinfo->plink->GetTransform();
-                    // compute jacobians, make sure to transform by the world frame
-                    probot->CalculateJacobian(itmanipinfo->plink->GetIndex(), tlink.trans, _vtransjacobian);
-                    int armdof = itmanipinfo->pmanip->GetArmDOF();
-                    for( int idof = 0; idof < armdof; ++idof ) {
-                        Vector vtransaxis(_vtransjacobian[idof], _vtransjacobian[armdof+idof], _vtransjacobian[2*armdof+idof]);
-                        _vdotproducts[idof] = vDOFAccelAtViolation[idof] > 0 ? vtransaxis.dot3(vAccelViolation) : -vtransaxis.dot3(vAccelViolation);
-                        if( RaveFabs(_vdotproducts[idof]) <= g_fEpsilonLinear ) {
-                            _vdotproducts[idof] = 0;
-                        }
-                    }
-                    // sort while keeping indices
-                    std::size_t n(0);
-                    std::generate(_vindices.begin(), _vindices.end(), [&] { return n++; });
-                    std::sort(_vindices.begin(), _vindices.end(), [&](int i1, int i2) {
-                            return _vdotproducts[i1] < _vdotproducts[i2];
-                        });
-                    dReal minPositiveDotProduct = _vdotproducts[_vindices.back()];
-                    if( minPositiveDotProduct <= 0 ) {
-                        // Is this possible?
-                        return retcheck;
-                    }
-                    int minPositiveDotProductIndex = 0;
-                    for( int i = 0; i < armdof; ++i ) {
-                        minPositiveDotProduct = _vdotproducts[_vindices[i]];
-                        _vscalingfactors[_vindices[i]] = 1.0;
-                        if( minPositiveDotProduct > 0 ) {
-                            minPositiveDotProductIndex = i;
-                            break;
-                        }
-                    }
-                    // Suppose the positive dot products are d1, d2, ..., dn (sorted in the ascending
-                    // order). We want to build a linear function f (for convenience) such that f(d1) =
-                    // rmax (least scaling for the DOF with least contribution) and f(dn) = reductionFactor
-                    // (large reduction factor for DOF with most contribution). Since we build a linear
-                    // function, we have
-                    //         f(i) = m(d1/di) + (rmax - m)
-                    // where m = (rmax - reductionFactor)/(1 - d1/dn)
-                    if( minPositiveDotProductIndex == (int)(_vdotproducts.size() - 1) ) {
-                        // Cannot use the above formula since the denominator is zero so just setting the scaling factor for this one dof.
-                        _vscalingfactors[_vindices[minPositiveDotProductIndex]] = reductionFactor;
-                    }
-                    else {
-                        dReal m = (fMaxReductionFactor - reductionFactor) / (1 - minPositiveDotProduct/_vdotproducts[_vindices.back()]);
-                        for( int i = minPositiveDotProductIndex; i < armdof; ++i ) {
-                            int idof = _vindices[i];
-                            _vscalingfactors[idof] = m*(minPositiveDotProduct/_vdotproducts[idof]) + (fMaxReductionFactor - m);
-                        }
-                    }
-                    retcheck.vReductionFactors = _vscalingfactors;
-#ifdef PROGRESS_DEBUG
-                    std::stringstream ss; ss << "env=" << probot->GetEnv()->GetId() << "; reductionFactor=" << reductionFactor << "; minPositiveDotProductIndex=" << minPositiveDotProductIndex << "; vdotproducts=[";
-                    FOREACHC(itval, _vdotproducts) {
-                        ss << *itval << ", ";
-                    }
-                    ss << "]; vindices=[";
-                    FOREACHC(itval, _vindices) {
-                        ss << *itval << ", ";
-                    }
-                    ss << "]; vscalingfactors=[";
-                    FOREACHC(itval, _vscalingfactors) {
-                        ss << *itval << ", ";
-                    }
-                    ss << "];";
-                    RAVELOG_DEBUG(ss.str());
-#endif
+                if( reductionFactor < reductionFactorCutoff ) {
+                    _ComputeReductionFactors(_accelviolation, _accelviolation.vdofaccelerations, reductionFactor, retcheck);
                 }
-                else if( _maxmanipspeed > 0 && maxactualmanipspeed > _maxmanipspeed ) {
-                    // Vel limits are violated
-                    reductionFactor = min(multiplier*_maxmanipspeed/maxactualmanipspeed, maxallowedmult);
-                    retcheck.retcode = CFO_CheckTimeBasedConstraints;
-                    retcheck.fTimeBasedSurpassMult = reductionFactor;
-                    if( reductionFactor >= reductionFactorCutoff ) {
-                        // Constraints are not severely violated. Don't bother to compute Jacobian and that stuff
-                        return retcheck;
-                    }
-
-                    std::list< ManipConstraintInfo2 >::iterator itmanipinfo = _listCheckManips.begin();
-                    std::advance(itmanipinfo, velViolationIndex);
-                    RobotBasePtr probot = itmanipinfo->pmanip->GetRobot();
-                    KinBody::KinBodyStateSaver saver(probot, KinBody::Save_LinkTransformation|KinBody::Save_LinkVelocities);
-                    // Set the robot to the new state
-                    probot->SetDOFValues(vDOFValuesAtViolation, KinBody::CLA_CheckLimits, itmanipinfo->vuseddofindices);
-                    Transform tlink = itmanipinfo->plink->GetTransform();
-                    // compute jacobians, make sure to transform by the world frame
-                    probot->CalculateJacobian(itmanipinfo->plink->GetIndex(), tlink.trans, _vtransjacobian);
-                    int armdof = itmanipinfo->pmanip->GetArmDOF();
-                    for( int idof = 0; idof < armdof; ++idof ) {
-                        Vector vtransaxis(_vtransjacobian[idof], _vtransjacobian[armdof+idof], _vtransjacobian[2*armdof+idof]);
-                        _vdotproducts[idof] = vDOFVelAtViolation[idof] > 0 ? vtransaxis.dot3(vVelViolation) : -vtransaxis.dot3(vVelViolation);
-                        if( RaveFabs(_vdotproducts[idof]) <= g_fEpsilonLinear ) {
-                            _vdotproducts[idof] = 0;
-                        }
-                    }
-                    // sort while keeping indices
-                    std::size_t n(0);
-                    std::generate(_vindices.begin(), _vindices.end(), [&] { return n++; });
-                    std::sort(_vindices.begin(), _vindices.end(), [&](int i1, int i2) {
-                            return _vdotproducts[i1] < _vdotproducts[i2];
-                        });
-                    dReal minPositiveDotProduct = _vdotproducts[_vindices.back()];
-                    if( minPositiveDotProduct <= 0 ) {
-                        // Is this possible?
-                        return retcheck;
-                    }
-                    int minPositiveDotProductIndex = 0;
-                    for( int i = 0; i < armdof; ++i ) {
-                        minPositiveDotProduct = _vdotproducts[_vindices[i]];
-                        _vscalingfactors[_vindices[i]] = 1.0;
-                        if( minPositiveDotProduct > 0 ) {
-                            minPositiveDotProductIndex = i;
-                            break;
-                        }
-                    }
-                    // Suppose the positive dot products are d1, d2, ..., dn (sorted in the ascending
-                    // order). We want to build a linear function f (for convenience) such that f(d1) =
-                    // 1 (no scaling for the DOF with least contribution) and f(dn) = reductionFactor
-                    // (large reduction factor for DOF with most contribution). Since we build a linear
-                    // function, we have
-                    //         f(i) = m(d1/di) + (rmax - m)
-                    // where m = (rmax - reductionFactor)/(1 - d1/dn)
-                    if( minPositiveDotProductIndex == (int)(_vdotproducts.size() - 1) ) {
-                        // Cannot use the above formula since the denominator is zero so just setting the scaling factor for this one dof.
-                        _vscalingfactors[_vindices[minPositiveDotProductIndex]] = reductionFactor;
-                    }
-                    else {
-                        dReal m = (fMaxReductionFactor - reductionFactor) / (1 - minPositiveDotProduct/_vdotproducts[_vindices.back()]);
-                        for( int i = minPositiveDotProductIndex; i < armdof; ++i ) {
-                            int idof = _vindices[i];
-                            _vscalingfactors[idof] = m*(minPositiveDotProduct/_vdotproducts[idof]) + (fMaxReductionFactor - m);
-                        }
-                    }
-                    retcheck.vReductionFactors = _vscalingfactors;
-#ifdef PROGRESS_DEBUG
-                    std::stringstream ss; ss << "env=" << probot->GetEnv()->GetId() << "; reductionFactor=" << reductionFactor << "; minPositiveDotProductIndex=" << minPositiveDotProductIndex << "; vdotproducts=[";
-                    FOREACHC(itval, _vdotproducts) {
-                        ss << *itval << ", ";
-                    }
-                    ss << "]; vindices=[";
-                    FOREACHC(itval, _vindices) {
-                        ss << *itval << ", ";
-                    }
-                    ss << "]; vscalingfactors=[";
-                    FOREACHC(itval, _vscalingfactors) {
-                        ss << *itval << ", ";
-                    }
-                    ss << "];";
-                    RAVELOG_DEBUG(ss.str());
-#endif
-                }
-                return retcheck;
+                // Otherwise constraints are not severely violated. Don't bother to compute the scaling factors
             }
-            else {
-                bBoundExceeded = false;
-                if( _maxmanipspeed > 0 && maxactualmanipspeed > _maxmanipspeed ) {
-                    bBoundExceeded = true;
-                    retcode = CFO_CheckTimeBasedConstraints;
-                    // If the actual max value is very close to the bound (i.e., almost not violating
-                    // the bound), the multiplier will be too large (too close to 1) to be useful.
-                    reductionFactor = min(multiplier*_maxmanipspeed/maxactualmanipspeed, maxallowedmult);
-                }
-                if( _maxmanipaccel > 0 && maxactualmanipaccel > _maxmanipaccel ) {
-                    bBoundExceeded = true;
-                    retcode = CFO_CheckTimeBasedConstraints;
-                    // If the actual max value is very close to the bound (i.e., almost not violating
-                    // the bound), the multiplier will be too large (too close to 1) to be useful.
-                    reductionFactor = RaveSqrt(min(multiplier*_maxmanipaccel/maxactualmanipaccel, maxallowedmult));
+            else if( _maxmanipspeed > 0 && maxactualmanipspeed > _maxmanipspeed ) {
+                // Vel limits are violated
+                reductionFactor = min(multiplier*_maxmanipspeed/maxactualmanipspeed, maxallowedmult);
+                retcheck.retcode = CFO_CheckTimeBasedConstraints;
+                retcheck.fTimeBasedSurpassMult = reductionFactor;
+                if( reductionFactor < reductionFactorCutoff ) {
+                    _ComputeReductionFactors(_velviolation, _velviolation.vdofvelocities, reductionFactor, retcheck);
                 }
             }
+            return retcheck;
+        }
 
-            // The ramp passes all the check and it's very short so return now.
-            if( (itrampnd == rampndVect.end() - 1) && (itrampnd->GetDuration() <= g_fEpsilonLinear) ) {
-                // No further checking is needed since the segment contains only one very small ramp.
-                if( bBoundExceeded ) {
+        if( _maxmanipspeed > 0 && maxactualmanipspeed > _maxmanipspeed ) {
+            retcode = CFO_CheckTimeBasedConstraints;
+            // If the actual max value is very close to the bound (i.e., almost not violating
+            // the bound), the multiplier will be too large (too close to 1) to be useful.
+            reductionFactor = min(multiplier*_maxmanipspeed/maxactualmanipspeed, maxallowedmult);
+        }
+        if( _maxmanipaccel > 0 && maxactualmanipaccel > _maxmanipaccel ) {
+            retcode = CFO_CheckTimeBasedConstraints;
+            // If the actual max value is very close to the bound (i.e., almost not violating
+            // the bound), the multiplier will be too large (too close to 1) to be useful.
+            reductionFactor = RaveSqrt(min(multiplier*_maxmanipaccel/maxactualmanipaccel, maxallowedmult));
+        }
 #ifdef PROGRESS_DEBUG
-                    std::stringstream ss; ss << std::setprecision(std::numeric_limits<dReal>::digits10+1);
-                    ss << "q=[";
-                    SerializeValues(ss, vDOFValuesAtViolation);
-                    ss << "]; qd=[";
-                    SerializeValues(ss, vDOFVelAtViolation);
-                    ss << "]; qdd=[";
-                    SerializeValues(ss, vDOFAccelAtViolation);
-                    ss << "];";
-                    RAVELOG_VERBOSE_FORMAT("env=%d, maxmanipspeed=%.15e; maxactualmanipspeed=%.15e; maxmanipaccel=%.15e; maxactualmanipaccel=%.15e; reductionFactor=%.15e; %s", _penv->GetId()%_maxmanipspeed%maxactualmanipspeed%_maxmanipaccel%maxactualmanipaccel%reductionFactor%ss.str());
+        if( retcode != 0 ) {
+            const ManipViolation& violation = _maxmanipaccel > 0 && maxactualmanipaccel > _maxmanipaccel ? _accelviolation : _velviolation;
+            std::stringstream ss; ss << std::setprecision(std::numeric_limits<dReal>::digits10+1);
+            ss << "q=[";
+            SerializeValues(ss, violation.vdofvalues);
+            ss << "]; qd=[";
+            SerializeValues(ss, violation.vdofvelocities);
+            ss << "]; qdd=[";
+            SerializeValues(ss, violation.vdofaccelerations);
+            ss << "];";
+            RAVELOG_VERBOSE_FORMAT("env=%d, maxmanipspeed=%.15e; maxactualmanipspeed=%.15e; maxmanipaccel=%.15e; maxactualmanipaccel=%.15e; reductionFactor=%.15e; %s", _penv->GetId()%_maxmanipspeed%maxactualmanipspeed%_maxmanipaccel%maxactualmanipaccel%reductionFactor%ss.str());
+        }
 #endif
-                    return RampOptimizerInternal::CheckReturn(retcode, reductionFactor, maxactualmanipspeed, maxactualmanipaccel);
-                }
-                else {
-                    return RampOptimizerInternal::CheckReturn(0);
-                }
-            }
+        return RampOptimizerInternal::CheckReturn(retcode, reductionFactor, maxactualmanipspeed, maxactualmanipaccel);
+    }
+
+private:
+    /// \brief the state of the manipulator dofs where the largest checkpoint speed or acceleration occurs
+    struct ManipViolation
+    {
+        ManipViolation() : fvalue(0), pmanipinfo(NULL) {
+        }
+        dReal fvalue; ///< the speed or acceleration of the checkpoint
+        Vector vpoint; ///< the velocity or acceleration of the checkpoint
+        const ManipConstraintInfo2* pmanipinfo;
+        std::vector<dReal> vdofvalues, vdofvelocities, vdofaccelerations; ///< indexed by ManipConstraintInfo2::vuseddofindices
+        std::vector<dReal> vtransjacobian; ///< translation jacobian of the end effector with respect to vuseddofindices
+    };
+
+    /// \brief computes the checkpoint velocities and accelerations at all the critical times of rampndVect and stores the largest ones in _velviolation and _accelviolation
+    ///
+    /// The critical times are the start (unless interval is IT_OpenStart) and the end of every ramp. The configuration
+    /// at the end of a ramp is the start of the next one, so the jacobians and hessians computed for it are used for the
+    /// accelerations of both ramps.
+    void _ComputeCriticalStates(const std::vector<RampOptimizerInternal::RampND>& rampndVect, IntervalType interval)
+    {
+        _velviolation.fvalue = 0;
+        _velviolation.pmanipinfo = NULL;
+        _accelviolation.fvalue = 0;
+        _accelviolation.pmanipinfo = NULL;
+        if( rampndVect.size() == 0 ) {
+            return;
         }
 
-        // Check manipspeed and manipaccel at the end of the segment
-        itrampnd = rampndVect.end() - 1;
-        curmanipindex = 0;
         FOREACHC(itmanipinfo, _listCheckManips) {
-            bBoundExceeded = false;
             KinBodyPtr probot = itmanipinfo->plink->GetParent();
-            itrampnd->GetAVect(ac);
-            qfillactive.resize(itmanipinfo->vuseddofindices.size());
-            _vfillactive.resize(itmanipinfo->vuseddofindices.size());
-            _afill.resize(probot->GetDOF());
-            for(size_t index = 0; index < itmanipinfo->vuseddofindices.size(); ++index) {
-                qfillactive[index] = itrampnd->GetX1At(itmanipinfo->vconfigindices.at(index));
-                _vfillactive[index] = itrampnd->GetV1At(itmanipinfo->vconfigindices[index]);
-                _afill[itmanipinfo->vuseddofindices.at(index)] = ac.at(itmanipinfo->vconfigindices[index]);
-            }
-
+            KinBody::KinBodyStateSaver saver(probot, KinBody::Save_LinkTransformation);
             int endeffindex = itmanipinfo->plink->GetIndex();
-            KinBody::KinBodyStateSaver saver(probot, KinBody::Save_LinkTransformation|KinBody::Save_LinkVelocities);
-
-            // Set the robot to the new state
-            probot->SetDOFValues(qfillactive, KinBody::CLA_CheckLimits, itmanipinfo->vuseddofindices);
-            probot->SetDOFVelocities(_vfillactive, KinBody::CLA_CheckLimits, itmanipinfo->vuseddofindices);
-            probot->GetLinkVelocities(endeffvels);
-            probot->GetLinkAccelerations(_afill,endeffaccs);
-            endeffvellin = endeffvels.at(endeffindex).first;
-            endeffvelang = endeffvels.at(endeffindex).second;
-            endeffacclin = endeffaccs.at(endeffindex).first;
-            endeffaccang = endeffaccs.at(endeffindex).second;
-            Transform R = itmanipinfo->plink->GetTransform();
-
-            FOREACH(itpoint, itmanipinfo->checkpoints) {
-                Vector point = R.rotate(*itpoint);
-
-                if( _maxmanipspeed > 0 ) {
-                    // Compute the linear velocity: v_total = v + w x r
-                    Vector vpoint = endeffvellin + endeffvelang.cross(point);
-                    dReal actualmanipspeed = RaveSqrt(vpoint.lengthsqr3());
-                    if( actualmanipspeed > maxactualmanipspeed ) {
-                        bBoundExceeded = true;
-                        maxactualmanipspeed = actualmanipspeed;
-                        velViolationIndex = curmanipindex;
-                        vVelViolation = vpoint;
+            size_t numdof = itmanipinfo->vuseddofindices.size();
+            qfillactive.resize(numdof);
+            _vfillactive.resize(numdof);
+            _vaccelstart.resize(numdof);
+            _vaccelend.resize(numdof);
+
+            for(size_t itime = (interval == IT_OpenStart ? 1 : 0); itime <= rampndVect.size(); ++itime) {
+                // the configuration at itime is the start of ramp itime and the end of ramp itime-1
+                const RampOptimizerInternal::RampND* prampstart = itime < rampndVect.size() ? &rampndVect[itime] : NULL;
+                const RampOptimizerInternal::RampND* prampend = itime > 0 ? &rampndVect[itime-1] : NULL;
+                for(size_t index = 0; index < numdof; ++index) {
+                    int configindex = itmanipinfo->vconfigindices.at(index);
+                    if( !!prampend ) {
+                        qfillactive[index] = prampend->GetX1At(configindex);
+                        _vfillactive[index] = prampend->GetV1At(configindex);
+                        _vaccelend[index] = prampend->GetAAt(configindex);
                     }
-                }
-
-                if( _maxmanipaccel > 0 ) {
-                    // Compute the linear acceleration: a_total = a + w x (w x r) + (alpha x r)
-                    Vector apoint = endeffacclin + endeffvelang.cross(endeffvelang.cross(point)) + endeffaccang.cross(point);
-                    dReal actualmanipaccel = RaveSqrt(apoint.lengthsqr3());
-                    if( actualmanipaccel > maxactualmanipaccel ) {
-                        bBoundExceeded = true;
-                        maxactualmanipaccel = actualmanipaccel;
-                        accelViolationIndex = curmanipindex;
-                        vAccelViolation = apoint;
+                    else {
+                        qfillactive[index] = prampstart->GetX0At(configindex);
+                        _vfillactive[index] = prampstart->GetV0At(configindex);
+                    }
+                    if( !!prampstart ) {
+                        _vaccelstart[index] = prampstart->GetAAt(configindex);
                     }
                 }
-            }
-            if( bBoundExceeded ) {
-                vDOFValuesAtViolation = qfillactive;
-                vDOFVelAtViolation = _vfillactive;
-                vDOFAccelAtViolation = _afill;
-            }
-            // Finished iterating through all checkpoints
-            ++curmanipindex;
-        }
-        // Finished iterating through all manipulators
 
-        if( bUseNewHeuristic ) {
-            RampOptimizerInternal::CheckReturn retcheck;
-            retcheck.retcode = 0;
-            retcheck.fTimeBasedSurpassMult = reductionFactor;
-            retcheck.fMaxManipSpeed = maxactualmanipspeed;
-            retcheck.fMaxManipAccel = maxactualmanipaccel;
+                probot->SetDOFValues(qfillactive, KinBody::CLA_CheckLimits, itmanipinfo->vuseddofindices);
+                Transform tlink = itmanipinfo->plink->GetTransform();
+                probot->ComputeJacobianTranslation(endeffindex, tlink.trans, _vtransjacobian, itmanipinfo->vuseddofindices);
+                probot->ComputeJacobianAxisAngle(endeffindex, _vangularjacobian, itmanipinfo->vuseddofindices);
 
-            if( _maxmanipaccel > 0 && maxactualmanipaccel > _maxmanipaccel ) {
-                reductionFactor = RaveSqrt(min(multiplier*_maxmanipaccel/maxactualmanipaccel, maxallowedmult));
-                retcheck.retcode = CFO_CheckTimeBasedConstraints;
-                retcheck.fTimeBasedSurpassMult = reductionFactor;
-                if( reductionFactor >= reductionFactorCutoff ) {
-                    // Constraints are not severely violated. Don't bother to compute Jacobian and that stuff
-                    return retcheck;
+                // v = J*qd, w = Jw*qd
+                Vector endeffvellin = _MultJacobian(_vtransjacobian, _vfillactive), endeffvelang = _MultJacobian(_vangularjacobian, _vfillactive);
+                Vector endeffacccoriolislin, endeffacccoriolisang;
+                if( _maxmanipaccel > 0 ) {
+                    // a = J*qdd + qd^T*H*qd, the second term is the same for both ramps
+                    probot->ComputeHessianTranslation(endeffindex, tlink.trans, _vtranshessian, itmanipinfo->vuseddofindices);
+                    probot->ComputeHessianAxisAngle(endeffindex, _vangularhessian, itmanipinfo->vuseddofindices);
+                    endeffacccoriolislin = _MultHessian(_vtranshessian, _vfillactive);
+                    endeffacccoriolisang = _MultHessian(_vangularhessian, _vfillactive);
                 }
 
-                std::list< ManipConstraintInfo2 >::iterator itmanipinfo = _listCheckManips.begin();
-                std::advance(itmanipinfo, accelViolationIndex);
-                RobotBasePtr probot = itmanipinfo->pmanip->GetRobot();
-                KinBody::KinBodyStateSaver saver(probot, KinBody::Save_LinkTransformation|KinBody::Save_LinkVelocities);
-                // Set the robot to the new state
-                probot->SetDOFValues(vDOFValuesAtViolation, KinBody::CLA_CheckLimits, itmanipinfo->vuseddofindices);
-                Transform tlink = itmanipinfo->plink->GetTransform();
-                // compute jacobians, make sure to transform by the world frame
-                probot->CalculateJacobian(itmanipinfo->plink->GetIndex(), tlink.trans, _vtransjacobian);
-                int armdof = itmanipinfo->pmanip->GetArmDOF();
-                for( int idof = 0; idof < armdof; ++idof ) {
-                    Vector vtransaxis(_vtransjacobian[idof], _vtransjacobian[armdof+idof], _vtransjacobian[2*armdof+idof]);
-                    _vdotproducts[idof] = vDOFAccelAtViolation[idof] > 0 ? vtransaxis.dot3(vAccelViolation) : -vtransaxis.dot3(vAccelViolation);
-                    if( RaveFabs(_vdotproducts[idof]) <= g_fEpsilonLinear ) {
-                        _vdotproducts[idof] = 0;
+                for(int iramp = 0; iramp < 2; ++iramp) {
+                    const std::vector<dReal>& vaccel = iramp == 0 ? _vaccelend : _vaccelstart;
+                    if( (iramp == 0 && !prampend) || (iramp == 1 && !prampstart) ) {
+                        continue;
                     }
-                }
-                // sort while keeping indices
-                std::size_t n(0);
-                std::generate(_vindices.begin(), _vindices.end(), [&] { return n++; });
-                std::sort(_vindices.begin(), _vindices.end(), [&](int i1, int i2) {
-                        return _vdotproducts[i1] < _vdotproducts[i2];
-                    });
-                dReal minPositiveDotProduct = _vdotproducts[_vindices.back()];
-                if( minPositiveDotProduct <= 0 ) {
-                    // Is this possible?
-                    return retcheck;
-                }
-                int minPositiveDotProductIndex = 0;
-                for( int i = 0; i < armdof; ++i ) {
-                    minPositiveDotProduct = _vdotproducts[_vindices[i]];
-                    _vscalingfactors[_vindices[i]] = 1.0;
-                    if( minPositiveDotProduct > 0 ) {
-                        minPositiveDotProductIndex = i;
-                        break;
+                    if( iramp == 1 && _maxmanipaccel <= 0 && !!prampend ) {
+                        continue; // velocities were already checked
                     }
-                }
-                // Suppose the positive dot products are d1, d2, ..., dn (sorted in the ascending
-                // order). We want to build a linear function f (for convenience) such that f(d1) =
-                // 1 (no scaling for the DOF with least contribution) and f(dn) = reductionFactor
-                // (large reduction factor for DOF with most contribution). Since we build a linear
-                // function, we have
-                //         f(i) = m(d1/di) + (rmax - m)
-                // where m = (rmax - reductionFactor)/(1 - d1/dn)
-                if( minPositiveDotProductIndex == (int)(_vdotproducts.size() - 1) ) {
-                    // Cannot use the above formula since the denominator is zero so just setting the scaling factor for this one dof.
-                    _vscalingfactors[_vindices[minPositiveDotProductIndex]] = reductionFactor;
-                }
-                else {
-                    dReal m = (fMaxReductionFactor - reductionFactor) / (1 - minPositiveDotProduct/_vdotproducts[_vindices.back()]);
-                    for( int i = minPositiveDotProductIndex; i < armdof; ++i ) {
-                        int idof = _vindices[i];
-                        _vscalingfactors[idof] = m*(minPositiveDotProduct/_vdotproducts[idof]) + (fMaxReductionFactor - m);
-                    }
-                }
-                retcheck.vReductionFactors = _vscalingfactors;
-#ifdef PROGRESS_DEBUG
-                std::stringstream ss; ss << "env=" << probot->GetEnv()->GetId() << "; reductionFactor=" << reductionFactor << "; minPositiveDotProductIndex=" << minPositiveDotProductIndex << "; vdotproducts=[";
-                FOREACHC(itval, _vdotproducts) {
-                    ss << *itval << ", ";
-                }
-                ss << "]; vindices=[";
-                FOREACHC(itval, _vindices) {
-                    ss << *itval << ", ";
-                }
-                ss << "]; vscalingfactors=[";
-                FOREACHC(itval, _vscalingfactors) {
-                    ss << *itval << ", ";
-                }
-                ss << "];";
-                RAVELOG_DEBUG(ss.str());
-#endif
-            }
-            else if( _maxmanipspeed > 0 && maxactualmanipspeed > _maxmanipspeed ) {
-                reductionFactor = min(multiplier*_maxmanipspeed/maxactualmanipspeed, maxallowedmult);
-                retcheck.retcode = CFO_CheckTimeBasedConstraints;
-                retcheck.fTimeBasedSurpassMult = reductionFactor;
-                if( reductionFactor >= reductionFactorCutoff ) {
-                    // Constraints are not severely violated. Don't bother to compute Jacobian and that stuff
-                    return retcheck;
-                }
+                    Vector endeffacclin, endeffaccang;
+                    if( _maxmanipaccel > 0 ) {
+                        endeffacclin = _MultJacobian(_vtransjacobian, vaccel) + endeffacccoriolislin;
+                        endeffaccang = _MultJacobian(_vangularjacobian, vaccel) + endeffacccoriolisang;
+                    }
+
+                    bool bBoundExceeded = false;
+                    Vector vVelViolation, vAccelViolation;
+                    dReal maxspeed = _velviolation.fvalue, maxaccel = _accelviolation.fvalue;
+                    FOREACHC(itpoint, itmanipinfo->checkpoints) {
+                        Vector point = tlink.rotate(*itpoint);
+
+                        if( _maxmanipspeed > 0 ) {
+                            // Compute the linear velocity: v_total = v + w x r
+                            Vector vpoint = endeffvellin + endeffvelang.cross(point);
+                            dReal actualmanipspeed = RaveSqrt(vpoint.lengthsqr3());
+                            if( actualmanipspeed > maxspeed ) {
+                                bBoundExceeded = true;
+                                maxspeed = actualmanipspeed;
+                                vVelViolation = vpoint;
+                            }
+                        }
 
-                std::list< ManipConstraintInfo2 >::iterator itmanipinfo = _listCheckManips.begin();
-                std::advance(itmanipinfo, velViolationIndex);
-                RobotBasePtr probot = itmanipinfo->pmanip->GetRobot();
-                KinBody::KinBodyStateSaver saver(probot, KinBody::Save_LinkTransformation|KinBody::Save_LinkVelocities);
-                // Set the robot to the new state
-                probot->SetDOFValues(vDOFValuesAtViolation, KinBody::CLA_CheckLimits, itmanipinfo->vuseddofindices);
-                Transform tlink = itmanipinfo->plink->GetTransform();
-                // compute jacobians, make sure to transform by the world frame
-                probot->CalculateJacobian(itmanipinfo->plink->GetIndex(), tlink.trans, _vtransjacobian);
-                int armdof = itmanipinfo->pmanip->GetArmDOF();
-                for( int idof = 0; idof < armdof; ++idof ) {
-                    Vector vtransaxis(_vtransjacobian[idof], _vtransjacobian[armdof+idof], _vtransjacobian[2*armdof+idof]);
-                    _vdotproducts[idof] = vDOFVelAtViolation[idof] > 0 ? vtransaxis.dot3(vVelViolation) : -vtransaxis.dot3(vVelViolation);
-                    if( RaveFabs(_vdotproducts[idof]) <= g_fEpsilonLinear ) {
-                        _vdotproducts[idof] = 0;
-                    }
-                }
-                // sort while keeping indices
-                std::size_t n(0);
-                std::generate(_vindices.begin(), _vindices.end(), [&] { return n++; });
-                std::sort(_vindices.begin(), _vindices.end(), [&](int i1, int i2) {
-                        return _vdotproducts[i1] < _vdotproducts[i2];
-                    });
-                dReal minPositiveDotProduct = _vdotproducts[_vindices.back()];
-                if( minPositiveDotProduct <= 0 ) {
-                    // Is this possible?
-                    return retcheck;
-                }
-                int minPositiveDotProductIndex = 0;
-                for( int i = 0; i < armdof; ++i ) {
-                    minPositiveDotProduct = _vdotproducts[_vindices[i]];
-                    _vscalingfactors[_vindices[i]] = 1.0;
-                    if( minPositiveDotProduct > 0 ) {
-                        minPositiveDotProductIndex = i;
-                        break;
+                        if( _maxmanipaccel > 0 ) {
+                            // Compute the linear acceleration: a_total = a + w x (w x r) + (alpha x r)
+                            Vector apoint = endeffacclin + endeffvelang.cross(endeffvelang.cross(point)) + endeffaccang.cross(point);
+                            dReal actualmanipaccel = RaveSqrt(apoint.lengthsqr3());
+                            if( actualmanipaccel > maxaccel ) {
+                                bBoundExceeded = true;
+                                maxaccel = actualmanipaccel;
+                                vAccelViolation = apoint;
+                            }
+                        }
                     }
-                }
-                // Suppose the positive dot products are d1, d2, ..., dn (sorted in the ascending
-                // order). We want to build a linear function f (for convenience) such that f(d1) =
-                // 1 (no scaling for the DOF with least contribution) and f(dn) = reductionFactor
-                // (large reduction factor for DOF with most contribution). Since we build a linear
-                // function, we have
-                //         f(i) = m(d1/di) + (1 - m)
-                // where m = (1 - reductionFactor)/(1 - d1/dn)
-                if( minPositiveDotProductIndex == (int)(_vdotproducts.size() - 1) ) {
-                    // Cannot use the above formula since the denominator is zero so just setting the scaling factor for this one dof.
-                    _vscalingfactors[_vindices[minPositiveDotProductIndex]] = reductionFactor;
-                }
-                else {
-                    dReal m = (fMaxReductionFactor - reductionFactor) / (1 - minPositiveDotProduct/_vdotproducts[_vindices.back()]);
-                    for( int i = minPositiveDotProductIndex; i < armdof; ++i ) {
-                        int idof = _vindices[i];
-                        _vscalingfactors[idof] = m*(minPositiveDotProduct/_vdotproducts[idof]) + (fMaxReductionFactor - m);
+                    if( bBoundExceeded ) {
+                        // Keep these values for later computation if constraints are violated
+                        if( maxspeed > _velviolation.fvalue ) {
+                            _SetViolation(_velviolation, maxspeed, vVelViolation, *itmanipinfo, vaccel);
+                        }
+                        if( maxaccel > _accelviolation.fvalue ) {
+                            _SetViolation(_accelviolation, maxaccel, vAccelViolation, *itmanipinfo, vaccel);
+                        }
                     }
                 }
-                retcheck.vReductionFactors = _vscalingfactors;
-#ifdef PROGRESS_DEBUG
-                std::stringstream ss; ss << "env=" << probot->GetEnv()->GetId() << "; reductionFactor=" << reductionFactor << "; minPositiveDotProductIndex=" << minPositiveDotProductIndex << "; vdotproducts=[";
-                FOREACHC(itval, _vdotproducts) {
-                    ss << *itval << ", ";
-                }
-                ss << "]; vindices=[";
-                FOREACHC(itval, _vindices) {
-                    ss << *itval << ", ";
-                }
-                ss << "]; vscalingfactors=[";
-                FOREACHC(itval, _vscalingfactors) {
-                    ss << *itval << ", ";
-                }
-                ss << "];";
-                RAVELOG_DEBUG(ss.str());
-#endif
             }
-            return retcheck;
         }
-        else {
-            if( _maxmanipspeed > 0 && maxactualmanipspeed > _maxmanipspeed ) {
-                retcode = CFO_CheckTimeBasedConstraints;
-                // If the actual max value is very close to the bound (i.e., almost not violating
-                // the bound), the multiplier will be too large (too close to 1) to be useful.
-                reductionFactor = min(multiplier*_maxmanipspeed/maxactualmanipspeed, maxallowedmult);
+    }
+
+    void _SetViolation(ManipViolation& violation, dReal fvalue, const Vector& vpoint, const ManipConstraintInfo2& manipinfo, const std::vector<dReal>& vaccel)
+    {
+        violation.fvalue = fvalue;
+        violation.vpoint = vpoint;
+        violation.pmanipinfo = &manipinfo;
+        violation.vdofvalues = qfillactive;
+        violation.vdofvelocities = _vfillactive;
+        violation.vdofaccelerations = vaccel;
+        violation.vtransjacobian = _vtransjacobian;
+    }
+
+    /// \brief scales down the limits of the dofs that contribute the most to the violation, the dof with the least contribution is not scaled
+    ///
+    /// \param vdofmotion the velocities or accelerations of the dofs at the violation
+    void _ComputeReductionFactors(const ManipViolation& violation, const std::vector<dReal>& vdofmotion, dReal reductionFactor, RampOptimizerInternal::CheckReturn& retcheck)
+    {
+        if( !violation.pmanipinfo ) {
+            return;
+        }
+        dReal fMaxReductionFactor = 1; // scaling factor for the DOF with least contribution to constriant violation
+        const ManipConstraintInfo2& manipinfo = *violation.pmanipinfo;
+        int numdof = manipinfo.vuseddofindices.size();
+        _vdotproducts.resize(numdof);
+        _vindices.resize(numdof);
+        for( int idof = 0; idof < numdof; ++idof ) {
+            Vector vtransaxis(violation.vtransjacobian[idof], violation.vtransjacobian[numdof+idof], violation.vtransjacobian[2*numdof+idof]);
+            _vdotproducts[idof] = vdofmotion[idof] > 0 ? vtransaxis.dot3(violation.vpoint) : -vtransaxis.dot3(violation.vpoint);
+            if( RaveFabs(_vdotproducts[idof]) <= g_fEpsilonLinear ) {
+                _vdotproducts[idof] = 0;
             }
-            if( _maxmanipaccel > 0 && maxactualmanipaccel > _maxmanipaccel ) {
-                retcode = CFO_CheckTimeBasedConstraints;
-                // If the actual max value is very close to the bound (i.e., almost not violating
-                // the bound), the multiplier will be too large (too close to 1) to be useful.
-                reductionFactor = RaveSqrt(min(multiplier*_maxmanipaccel/maxactualmanipaccel, maxallowedmult));
+        }
+        // sort while keeping indices
+        std::size_t n(0);
+        std::generate(_vindices.begin(), _vindices.end(), [&] { return n++; });
+        std::sort(_vindices.begin(), _vindices.end(), [&](int i1, int i2) {
+                return _vdotproducts[i1] < _vdotproducts[i2];
+            });
+        if( numdof == 0 || _vdotproducts[_vindices.back()] <= 0 ) {
+            // Is this possible?
+            return;
+        }
+        std::fill(_vscalingfactors.begin(), _vscalingfactors.end(), 1.0);
+        dReal minPositiveDotProduct = 0;
+        int minPositiveDotProductIndex = 0;
+        for( int i = 0; i < numdof; ++i ) {
+            minPositiveDotProduct = _vdotproducts[_vindices[i]];
+            if( minPositiveDotProduct > 0 ) {
+                minPositiveDotProductIndex = i;
+                break;
+            }
+        }
+        // Suppose the positive dot products are d1, d2, ..., dn (sorted in the ascending
+        // order). We want to build a linear function f (for convenience) such that f(d1) =
+        // rmax (least scaling for the DOF with least contribution) and f(dn) = reductionFactor
+        // (large reduction factor for DOF with most contribution). Since we build a linear
+        // function, we have
+        //         f(i) = m(d1/di) + (rmax - m)
+        // where m = (rmax - reductionFactor)/(1 - d1/dn)
+        if( minPositiveDotProductIndex == numdof - 1 ) {
+            // Cannot use the above formula since the denominator is zero so just setting the scaling factor for this one dof.
+            _vscalingfactors.at(manipinfo.vconfigindices[_vindices[minPositiveDotProductIndex]]) = reductionFactor;
+        }
+        else {
+            dReal m = (fMaxReductionFactor - reductionFactor) / (1 - minPositiveDotProduct/_vdotproducts[_vindices.back()]);
+            for( int i = minPositiveDotProductIndex; i < numdof; ++i ) {
+                int idof = _vindices[i];
+                _vscalingfactors.at(manipinfo.vconfigindices[idof]) = m*(minPositiveDotProduct/_vdotproducts[idof]) + (fMaxReductionFactor - m);
             }
+        }
+        retcheck.vReductionFactors = _vscalingfactors;
 #ifdef PROGRESS_DEBUG
-            std::stringstream ss; ss << std::setprecision(std::numeric_limits<dReal>::digits10+1);
-            ss << "q=[";
-            SerializeValues(ss, vDOFValuesAtViolation);
-            ss << "]; qd=[";
-            SerializeValues(ss, vDOFVelAtViolation);
-            ss << "]; qdd=[";
-            SerializeValues(ss, vDOFAccelAtViolation);
-            ss << "];";
-            RAVELOG_VERBOSE_FORMAT("env=%d, maxmanipspeed=%.15e; maxactualmanipspeed=%.15e; maxmanipaccel=%.15e; maxactualmanipaccel=%.15e; reductionFactor=%.15e; %s", _penv->GetId()%_maxmanipspeed%maxactualmanipspeed%_maxmanipaccel%maxactualmanipaccel%reductionFactor%ss.str());
+        std::stringstream ss; ss << "env=" << _penv->GetId() << "; reductionFactor=" << reductionFactor << "; minPositiveDotProductIndex=" << minPositiveDotProductIndex << "; vdotproducts=[";
+        FOREACHC(itval, _vdotproducts) {
+            ss << *itval << ", ";
+        }
+        ss << "]; vindices=[";
+        FOREACHC(itval, _vindices) {
+            ss << *itval << ", ";
+        }
+        ss << "]; vscalingfactors=[";
+        FOREACHC(itval, _vscalingfactors) {
+            ss << *itval << ", ";
+        }
+        ss << "];";
+        RAVELOG_DEBUG(ss.str());
 #endif
-            return RampOptimizerInternal::CheckReturn(retcode, reductionFactor, maxactualmanipspeed, maxactualmanipaccel);
+    }
+
+    /// \brief returns jacobian*v for a 3xN jacobian
+    static inline Vector _MultJacobian(const std::vector<dReal>& jacobian, const std::vector<dReal>& v)
+    {
+        size_t numdof = v.size();
+        Vector result;
+        for(size_t i = 0; i < numdof; ++i) {
+            result.x += jacobian[i]*v[i];
+            result.y += jacobian[numdof+i]*v[i];
+            result.z += jacobian[2*numdof+i]*v[i];
         }
+        return result;
+    }
+
+    /// \brief returns v^T*hessian*v for a Nx3xN hessian
+    static inline Vector _MultHessian(const std::vector<dReal>& hessian, const std::vector<dReal>& v)
+    {
+        size_t numdof = v.size();
+        Vector result;
+        for(size_t i = 0; i < numdof; ++i) {
+            if( v[i] == 0 ) {
+                continue;
+            }
+            const dReal* phessian = &hessian[3*numdof*i];
+            for(size_t k = 0; k < numdof; ++k) {
+                dReal f = v[i]*v[k];
+                result.x += phessian[k]*f;
+                result.y += phessian[numdof+k]*f;
+                result.z += phessian[2*numdof+k]*f;
+            }
+        }
+        return result;
     }
 
-private:
     EnvironmentBasePtr _penv;
     std::string _manipname;
     std::vector<KinBodyPtr> listUsedBodies;
@@ -944,12 +688,11 @@ private:
 
 //@{ cache
     std::list< ManipConstraintInfo2 > _listCheckManips; ///< the manipulators and the points on their end efffectors to check for velocity and acceleration constraints
-    std::vector<dReal> ac, qfillactive, _vfillactive; // the active DOF
-    std::vector<dReal> _afill; // full robot DOF
-    std::vector<std::pair<Vector,Vector> > endeffvels, endeffaccs;
-    std::vector<dReal> _vtransjacobian, _vangularjacobian, _vbestvels2, _vbestaccels2;
-    std::vector<dReal> _vdotproducts, _vscalingfactors, _vdofvalues, _vdofvelocities, _vdofaccelerations;
+    std::vector<dReal> qfillactive, _vfillactive, _vaccelstart, _vaccelend; // the used DOF of the manipulator
+    std::vector<dReal> _vtransjacobian, _vangularjacobian, _vtranshessian, _vangularhessian, _vbestvels2, _vbestaccels2;
+    std::vector<dReal> _vdotproducts, _vscalingfactors;
     std::vector<int> _vindices;
+    ManipViolation _velviolation, _accelviolation;
 //@}
 
 };
@@ -65,7 +65,7 @@ public:
         {
             std::vector<dReal> &vswitchtimes=_vswitchtimes;
             std::vector<dReal> &q0=_q0, &q1=_q1, &dq0=_dq0, &dq1=_dq1;
-            std::vector<uint8_t> &vsearchsegments=_vsearchsegments;
+            std::vector<size_t> &vsearchsegments=_vsearchsegments;
 
             // If all necessary constraints are checked (specified by options), then we set constraintChecked to true.
             if( (options & constraintmask) == constraintmask ) {
@@ -105,13 +105,8 @@ public:
                 return ret0;
             }
 
-            _vsearchsegments.resize(rampndVect.size(), 0);
-            for (size_t isegment = 0; isegment < rampndVect.size(); ++isegment) {
-                _vsearchsegments[isegment] = isegment;
-            }
-            // Just in case, check the middle config first.
-            int midindex = _vsearchsegments.size() / 2; // midindex
-            std::swap(_vsearchsegments[0], _vsearchsegments[midindex]);
+            // Check the switch configurations in bisection order so that an infeasible config is found early.
+            planningutils::ComputeBisectionOrder(rampndVect.size(), _vsearchsegments);
             for (size_t j = 0; j < _vsearchsegments.size(); ++j) {
                 rampndVect[_vsearchsegments[j]].GetX1Vect(q1);
                 if( feas->NeedDerivativeForFeasibility() ) {
@@ -221,66 +216,19 @@ public:
                     options = CFO_CheckSelfCollisions;
                 }
 
-                // Instead of checking configurations sequentially from left to right, we give
-                // higher priority to some configurations. Suppose rampndVectOut.size() is N.
-                // First, check the ramp index: 0, 4N/8, 2N/8, 6N/8, N/8, 5N/8, 3N/8, 7N/8. Then we
-                // check the remaining ramps in the usual order.
-
-                // TODO: maybe arranging vsearchsegments totally randomly might have better average performance.
+                // Instead of checking configurations sequentially from left to right, check them in
+                // bisection order: N/2, N/4, 3N/4, N/8, ... so that the checked configurations are
+                // spread along the whole trajectory and a collision is found as early as possible.
+                size_t nconfigs;
                 if( bExpectedModifiedConfigurations ) {
                     // In this case, all intermediate configurations are already kept in rampndVectOut.
-                    vsearchsegments.resize(rampndVectOut.size());
+                    nconfigs = rampndVectOut.size();
                 }
                 else {
-                    size_t nconfigs = _vcacheintermediateconfigurations.size()/tol.size();
+                    nconfigs = _vcacheintermediateconfigurations.size()/tol.size();
                     BOOST_ASSERT(nconfigs > 0);
-                    vsearchsegments.resize(nconfigs);
-                }
-                for( size_t j = 0; j < vsearchsegments.size(); ++j ) {
-                    vsearchsegments[j] = j;
                 }
-                do {
-                    size_t index, index2 = 0;
-
-                    index = vsearchsegments.size() * (4/8);
-                    std::swap(vsearchsegments[index2], vsearchsegments[index]); index2++;
-
-                    index = vsearchsegments.size() * (2/8);
-                    if( index <= index2 ) {
-                        break;
-                    }
-                    std::swap(vsearchsegments[index2], vsearchsegments[index]); index2++;
-
-                    index = vsearchsegments.size() * (6/8);
-                    if( index <= index2 ) {
-                        break;
-                    }
-                    std::swap(vsearchsegments[index2], vsearchsegments[index]); index2++;
-
-                    index = vsearchsegments.size() * (1/8);
-                    if( index <= index2 ) {
-                        break;
-                    }
-                    std::swap(vsearchsegments[index2], vsearchsegments[index]); index2++;
-
-                    index = vsearchsegments.size() * (5/8);
-                    if( index <= index2 ) {
-                        break;
-                    }
-                    std::swap(vsearchsegments[index2], vsearchsegments[index]); index2++;
-
-                    index = vsearchsegments.size() * (3/8);
-                    if( index <= index2 ) {
-                        break;
-                    }
-                    std::swap(vsearchsegments[index2], vsearchsegments[index]); index2++;
-
-                    index = vsearchsegments.size() * (7/8);
-                    if( index <= index2 ) {
-                        break;
-                    }
-                    std::swap(vsearchsegments[index2], vsearchsegments[index]); index2++;
-                } while (0);
+                planningutils::ComputeBisectionOrder(nconfigs, vsearchsegments);
 
 #ifdef SMOOTHER2_TIMING_DEBUG
                 uint32_t tStartCollisionChecking = utils::GetMicroTime();
@@ -345,7 +293,7 @@ private:
         // Cache
         std::vector<dReal> _vswitchtimes;
         std::vector<dReal> _q0, _q1, _dq0, _dq1;
-        std::vector<uint8_t> _vsearchsegments;
+        std::vector<size_t> _vsearchsegments;
         std::vector<RampOptimizer::RampND> _cacheRampNDVectIn, _cacheRampNDVectOut;
         std::vector<dReal> _vcacheintermediateconfigurations; ///< for keeping intermediate configurations that are checked in CheckPathAllConstraints
 
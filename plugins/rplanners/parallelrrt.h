@@ -0,0 +1,563 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2006-2010 Rosen Diankov (rosen.diankov@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef  PARALLEL_BIRRT_PLANNER_H
+#define  PARALLEL_BIRRT_PLANNER_H
+
+#include "rrt.h"
+
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition.hpp>
+
+/** \brief bi-directional RRT-Connect that grows several pairs of trees on separate threads.
+
+    Every worker owns an environment clone, a forward tree from the initial configurations and a backward tree from its
+    share of the goals. The nodes each worker adds are published to a cover tree guarded by a mutex, so that the other
+    workers can extend towards them and connections happen across all the trees.
+ */
+class ParallelBirrtPlanner : public RrtPlanner<SimpleNode>
+{
+    typedef BirrtPlanner::GOALPATH GOALPATH;
+
+    /// \brief grows one forward and one backward tree inside its own environment clone
+    class Worker : public BirrtPlanner
+    {
+public:
+        Worker(EnvironmentBasePtr penv, ParallelBirrtPlanner& planner, int workerindex) : BirrtPlanner(penv), _planner(planner), _workerindex(workerindex), _publishedForward(0), _publishedBackward(1) {
+        }
+        virtual ~Worker() {
+        }
+
+        /// \param vglobalgoalindices for every goal in params->vgoalconfig, its index in the goals of the parallel planner
+        bool InitWorker(RobotBasePtr pbase, RRTParametersPtr params, const std::vector<int>& vglobalgoalindices)
+        {
+            _vglobalgoalindices = vglobalgoalindices;
+            if( !InitPlan(pbase, params) ) {
+                return false;
+            }
+            EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+            dReal fmaxdistance = _parameters->_distmetricfn(_parameters->_vConfigLowerLimit, _parameters->_vConfigUpperLimit);
+            _publishedForward.Init(shared_planner(), _parameters->GetDOF(), _parameters->_distmetricfn, _parameters->_fStepLength, fmaxdistance);
+            _publishedBackward.Init(shared_planner(), _parameters->GetDOF(), _parameters->_distmetricfn, _parameters->_fStepLength, fmaxdistance);
+            _vpublishednodes[0].resize(0);
+            _vpublishednodes[1].resize(0);
+            FOREACH(itnode, _vecInitialNodes) {
+                _Publish(*itnode, 0);
+            }
+            FOREACH(itnode, _vecGoalNodes) {
+                if( !!*itnode ) {
+                    _Publish(*itnode, 1);
+                }
+            }
+            return true;
+        }
+
+        /// \brief the planning loop of the thread, stops when the parallel planner says so or the iterations are exhausted
+        void Run()
+        {
+            try {
+                EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+                PlannerParameters::StateSaver savestate(_parameters);
+                CollisionOptionsStateSaver optionstate(GetEnv()->GetCollisionChecker(),GetEnv()->GetCollisionChecker()->GetCollisionOptions()|CO_ActiveDOFs,false);
+                const int constraintFilterOptions = 0xffff|CFO_FillCheckedConfiguration;
+                const int dof = _parameters->GetDOF();
+
+                SpatialTree<SimpleNode>* TreeA = &_treeForward;
+                SpatialTree<SimpleNode>* TreeB = &_treeBackward;
+                NodeBase* iConnectedA=NULL, *iConnectedB=NULL;
+                std::vector<dReal> vnewconfig(dof), vforeignconfig(dof);
+                bool bSampleGoal = true;
+                for(int iter = 0; iter < _parameters->_nMaxIterations; ++iter) {
+                    if( !_planner._ContinueWorker() ) {
+                        break;
+                    }
+
+                    _sampleConfig.resize(0);
+                    if( (bSampleGoal || _uniformsampler->SampleSequenceOneReal() < _fGoalBiasProb) && _nValidGoals > 0 ) {
+                        bSampleGoal = false;
+                        uint32_t goalindex = _uniformsampler->SampleSequenceOneUInt32()%_vecGoalNodes.size();
+                        if( !!_vecGoalNodes.at(goalindex) ) {
+                            _treeBackward.GetVectorConfig(_vecGoalNodes.at(goalindex), _sampleConfig);
+                        }
+                    }
+                    if( _sampleConfig.size() == 0 ) {
+                        if( !_parameters->_samplefn(_sampleConfig) ) {
+                            continue;
+                        }
+                    }
+
+                    // extend A
+                    ExtendType et = TreeA->Extend(_sampleConfig, iConnectedA, false, constraintFilterOptions);
+                    if( et == ET_Failed ) {
+                        continue;
+                    }
+                    int fromgoalA = TreeA == &_treeBackward;
+                    _Publish(iConnectedA, fromgoalA);
+                    TreeA->GetVectorConfig(iConnectedA, vnewconfig);
+
+                    // if the opposite tree of another worker is closer than our own, extend A towards it instead of extending B towards A
+                    int foreignworkerindex = -1;
+                    SimpleNode* pforeignnode = NULL;
+                    dReal fforeigndist = std::numeric_limits<dReal>::infinity();
+                    _planner._FindNearestForeignNode(_workerindex, vnewconfig, !fromgoalA, foreignworkerindex, pforeignnode, fforeigndist);
+                    if( !!pforeignnode && fforeigndist < TreeB->FindNearestNode(vnewconfig).second ) {
+                        vforeignconfig.assign(pforeignnode->q, pforeignnode->q+dof);
+                        NodeBase* iConnected = NULL;
+                        et = TreeA->Extend(vforeignconfig, iConnected, false, constraintFilterOptions);
+                        if( et != ET_Failed ) {
+                            _Publish(iConnected, fromgoalA);
+                        }
+                        if( et == ET_Connected ) {
+                            GOALPATH goalpath;
+                            if( fromgoalA ) {
+                                _ExtractConnectedPath(goalpath, pforeignnode, *_planner._vworkers.at(foreignworkerindex), (SimpleNode*)iConnected, *this);
+                            }
+                            else {
+                                _ExtractConnectedPath(goalpath, (SimpleNode*)iConnected, *this, pforeignnode, *_planner._vworkers.at(foreignworkerindex));
+                            }
+                            RAVELOG_DEBUG_FORMAT("env=%d, worker %d connected to the trees of worker %d, start index=%d, goal index=%d, path length=%f", GetEnv()->GetId()%_workerindex%foreignworkerindex%goalpath.startindex%goalpath.goalindex%goalpath.length);
+                            _planner._AddGoalPath(goalpath);
+                            bSampleGoal = true;
+                        }
+                    }
+                    else {
+                        // extend B toward A
+                        et = TreeB->Extend(vnewconfig, iConnectedB, false, constraintFilterOptions);
+                        if( et != ET_Failed ) {
+                            _Publish(iConnectedB, !fromgoalA);
+                        }
+                        if( et == ET_Connected ) {
+                            GOALPATH goalpath;
+                            _ExtractConnectedPath(goalpath, (SimpleNode*)(fromgoalA ? iConnectedB : iConnectedA), *this, (SimpleNode*)(fromgoalA ? iConnectedA : iConnectedB), *this);
+                            RAVELOG_DEBUG_FORMAT("env=%d, worker %d found a goal, start index=%d, goal index=%d, path length=%f", GetEnv()->GetId()%_workerindex%goalpath.startindex%goalpath.goalindex%goalpath.length);
+                            _planner._AddGoalPath(goalpath);
+                            bSampleGoal = true;
+                        }
+                    }
+                    swap(TreeA, TreeB);
+                }
+            }
+            catch(const std::exception& ex) {
+                RAVELOG_WARN_FORMAT("env=%d, worker %d failed: %s", GetEnv()->GetId()%_workerindex%ex.what());
+            }
+            _planner._WorkerFinished();
+        }
+
+        /// \brief nearest node that this worker has published for the forward (fromgoal=0) or backward (fromgoal=1) tree. Can be called from any thread.
+        SimpleNode* FindNearestPublishedNode(const std::vector<dReal>& vconfig, int fromgoal, dReal& fdist)
+        {
+            boost::mutex::scoped_lock lock(_mutexPublished);
+            std::pair<NodeBasePtr, dReal> nn = (fromgoal ? _publishedBackward : _publishedForward).FindNearestNode(vconfig);
+            if( !nn.first ) {
+                return NULL;
+            }
+            fdist = nn.second;
+            return _vpublishednodes[fromgoal].at(((SimpleNode*)nn.first)->_userdata);
+        }
+
+        /// \brief number of goals of this worker that passed the constraints, as their indices in the parallel planner
+        void GetValidGoalIndices(std::set<int>& setgoalindices) const
+        {
+            for(size_t igoal = 0; igoal < _vecGoalNodes.size(); ++igoal) {
+                if( !!_vecGoalNodes[igoal] ) {
+                    setgoalindices.insert(_vglobalgoalindices.at(igoal));
+                }
+            }
+        }
+
+protected:
+        /// \brief adds a node of the forward or backward tree to the published trees
+        void _Publish(NodeBase* pnode, int fromgoal)
+        {
+            if( !pnode ) {
+                return;
+            }
+            SimpleNode* psimplenode = (SimpleNode*)pnode;
+            _vpublishconfig.assign(psimplenode->q, psimplenode->q+_parameters->GetDOF());
+            boost::mutex::scoped_lock lock(_mutexPublished);
+            std::vector<SimpleNode*>& vpublishednodes = _vpublishednodes[fromgoal];
+            try {
+                if( !!(fromgoal ? _publishedBackward : _publishedForward).InsertNode(NULL, _vpublishconfig, vpublishednodes.size()) ) {
+                    vpublishednodes.push_back(psimplenode);
+                }
+            }
+            catch(const std::exception& ex) {
+                RAVELOG_VERBOSE_FORMAT("env=%d, failed to publish node: %s", GetEnv()->GetId()%ex.what());
+            }
+        }
+
+        /// \brief extracts the path between pforward of the forward tree of forwardworker and pbackward of the backward tree of backwardworker
+        ///
+        /// The nodes are never modified once they are inserted, so it is safe to walk the trees of other workers while they are growing.
+        void _ExtractConnectedPath(GOALPATH& goalpath, SimpleNode* pforward, const Worker& forwardworker, SimpleNode* pbackward, const Worker& backwardworker)
+        {
+            const int dof = _parameters->GetDOF();
+            _cachedpath.resize(0);
+            goalpath.startindex = -1;
+            while(1) {
+                _cachedpath.insert(_cachedpath.begin(), pforward->q, pforward->q+dof);
+                if(!pforward->rrtparent) {
+                    goalpath.startindex = pforward->_userdata;
+                    break;
+                }
+                pforward = pforward->rrtparent;
+            }
+            goalpath.goalindex = -1;
+            while(1) {
+                _cachedpath.insert(_cachedpath.end(), pbackward->q, pbackward->q+dof);
+                if(!pbackward->rrtparent) {
+                    goalpath.goalindex = backwardworker._vglobalgoalindices.at(pbackward->_userdata);
+                    break;
+                }
+                pbackward = pbackward->rrtparent;
+            }
+
+            _SimpleOptimizePath(_cachedpath,10);
+            goalpath.qall.resize(_cachedpath.size());
+            std::copy(_cachedpath.begin(), _cachedpath.end(), goalpath.qall.begin());
+
+            // same as BirrtPlanner, only the first and last points are used for the length
+            goalpath.length = 0;
+            std::vector<dReal> vdiff(goalpath.qall.begin(), goalpath.qall.begin()+dof);
+            _parameters->_diffstatefn(vdiff, std::vector<dReal>(goalpath.qall.end()-dof, goalpath.qall.end()));
+            for(int i = 0; i < dof; ++i) {
+                dReal fivel = _parameters->_vConfigVelocityLimit.at(i) != 0 ? 1/_parameters->_vConfigVelocityLimit.at(i) : dReal(1.0);
+                goalpath.length += RaveFabs(vdiff.at(i))*fivel;
+            }
+        }
+
+        ParallelBirrtPlanner& _planner;
+        int _workerindex;
+        std::vector<int> _vglobalgoalindices;
+
+        boost::mutex _mutexPublished; ///< protects the published trees
+        SpatialTree<SimpleNode> _publishedForward, _publishedBackward; ///< copies of the nodes for nearest neighbor queries from other threads
+        std::vector<SimpleNode*> _vpublishednodes[2]; ///< maps the userdata of the published nodes to the nodes of _treeForward and _treeBackward
+        std::vector<dReal> _vpublishconfig;
+    };
+    typedef boost::shared_ptr<Worker> WorkerPtr;
+
+public:
+    ParallelBirrtPlanner(EnvironmentBasePtr penv) : RrtPlanner<SimpleNode>(penv)
+    {
+        __description += "Bi-directional RRT-Connect that grows several pairs of trees in parallel. Every thread works on its own environment clone with its own collision checker, the goals are distributed among the threads, and each thread also extends towards the nodes of the trees of the other threads. Planning stops once _minimumgoalpaths goals are connected and the shortest path is returned.\n\n\
+The threads set up their constraints from the configuration specification, so custom constraint functions of the parameters are not used while growing the trees. Instead every connected path is checked with them in the original environment, and the shortest one that passes is returned.";
+        RegisterCommand("SetNumThreads", boost::bind(&ParallelBirrtPlanner::_SetNumThreadsCommand,this,_1,_2),
+                        "sets the number of threads to grow trees with. 0 (default) uses all the cores");
+        _nNumThreads = 0;
+        _bStopWorkers = false;
+        _nRunningWorkers = 0;
+        _nIterations = 0;
+        _nValidGoals = 0;
+    }
+    virtual ~ParallelBirrtPlanner() {
+        _vworkers.clear();
+        FOREACH(itclone, _vclones) {
+            (*itclone)->Destroy();
+        }
+        _vclones.clear();
+    }
+
+    virtual bool InitPlan(RobotBasePtr pbase, PlannerParametersConstPtr pparams)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        _vworkers.clear();
+        _parameters.reset(new RRTParameters());
+        _parameters->copy(pparams);
+        if( !RrtPlanner<SimpleNode>::_InitPlan(pbase,_parameters) ) {
+            _parameters.reset();
+            return false;
+        }
+        if( _parameters->_nMaxIterations <= 0 ) {
+            _parameters->_nMaxIterations = 10000;
+        }
+
+        const int dof = _parameters->GetDOF();
+        if( (_parameters->vgoalconfig.size() % dof) != 0 || _parameters->vgoalconfig.size() == 0 ) {
+            RAVELOG_WARN_FORMAT("env=%d, goals are improperly specified, goal samplers are not supported", GetEnv()->GetId());
+            _parameters.reset();
+            return false;
+        }
+        int numgoals = _parameters->vgoalconfig.size()/dof;
+
+        int numthreads = _nNumThreads > 0 ? _nNumThreads : std::max(1, (int)boost::thread::hardware_concurrency());
+        while( (int)_vclones.size() > numthreads ) {
+            _vclones.back()->Destroy();
+            _vclones.pop_back();
+        }
+        _vclones.reserve(numthreads);
+        std::set<int> setvalidgoals;
+        for(int iworker = 0; iworker < numthreads; ++iworker) {
+            if( iworker < (int)_vclones.size() ) {
+                _vclones[iworker]->Clone(GetEnv(), Clone_Bodies);
+            }
+            else {
+                _vclones.push_back(GetEnv()->CloneSelf(Clone_Bodies));
+            }
+            EnvironmentBasePtr pclone = _vclones[iworker];
+            RobotBasePtr pclonerobot;
+            if( !!pbase ) {
+                pclonerobot = pclone->GetRobot(pbase->GetName());
+            }
+
+            // rebind the state functions to the clone while keeping the user specified limits
+            RRTParametersPtr params(new RRTParameters());
+            params->copy(_parameters);
+            {
+                EnvironmentMutex::scoped_lock clonelock(pclone->GetMutex());
+                params->SetConfigurationSpecification(pclone, _parameters->_configurationspecification);
+            }
+            params->vinitialconfig = _parameters->vinitialconfig;
+            params->_vConfigLowerLimit = _parameters->_vConfigLowerLimit;
+            params->_vConfigUpperLimit = _parameters->_vConfigUpperLimit;
+            params->_vConfigVelocityLimit = _parameters->_vConfigVelocityLimit;
+            params->_vConfigAccelerationLimit = _parameters->_vConfigAccelerationLimit;
+            params->_vConfigResolution = _parameters->_vConfigResolution;
+            params->_samplegoalfn.clear();
+            params->_sampleinitialfn.clear();
+            params->_nRandomGeneratorSeed = _parameters->_nRandomGeneratorSeed + 7919*iworker;
+
+            // distribute the goals so that every worker has at least one
+            std::vector<int> vglobalgoalindices;
+            params->vgoalconfig.resize(0);
+            for(int igoal = 0; igoal < numgoals; ++igoal) {
+                if( numgoals < numthreads || (igoal % numthreads) == iworker ) {
+                    vglobalgoalindices.push_back(igoal);
+                    params->vgoalconfig.insert(params->vgoalconfig.end(), _parameters->vgoalconfig.begin()+igoal*dof, _parameters->vgoalconfig.begin()+(igoal+1)*dof);
+                }
+            }
+
+            WorkerPtr worker(new Worker(pclone, *this, iworker));
+            if( !worker->InitWorker(pclonerobot, params, vglobalgoalindices) ) {
+                RAVELOG_WARN_FORMAT("env=%d, failed to initialize worker %d", GetEnv()->GetId()%iworker);
+                _vworkers.clear();
+                _parameters.reset();
+                return false;
+            }
+            worker->GetValidGoalIndices(setvalidgoals);
+            _vworkers.push_back(worker);
+        }
+        _nValidGoals = setvalidgoals.size();
+        RAVELOG_DEBUG_FORMAT("env=%d, parallel BiRRT Planner Initialized, threads=%d, initial=%d, goal=%d, step=%f", GetEnv()->GetId()%numthreads%_vecInitialNodes.size()%_nValidGoals%_parameters->_fStepLength);
+        return true;
+    }
+
+    virtual PlannerStatus PlanPath(TrajectoryBasePtr ptraj, int planningoptions) override
+    {
+        _goalindex = -1;
+        _startindex = -1;
+        if(!_parameters) {
+            return OPENRAVE_PLANNER_STATUS(str(boost::format("env=%d, ParallelBirrtPlanner::PlanPath - Error, planner not initialized")%GetEnv()->GetId()), PS_Failed);
+        }
+
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        uint64_t basetimeus = utils::GetMonotonicTime();
+        {
+            boost::mutex::scoped_lock workerlock(_mutexWorkers);
+            _vgoalpaths.resize(0);
+            _bStopWorkers = false;
+            _nRunningWorkers = _vworkers.size();
+            _nIterations = 0;
+        }
+        std::vector<boost::shared_ptr<boost::thread> > vthreads(_vworkers.size());
+        for(size_t iworker = 0; iworker < _vworkers.size(); ++iworker) {
+            vthreads[iworker].reset(new boost::thread(boost::bind(&Worker::Run, _vworkers[iworker])));
+        }
+
+        PlannerProgress progress;
+        PlannerStatus interruptstatus;
+        bool bInterrupted = false;
+        while(1) {
+            {
+                boost::mutex::scoped_lock workerlock(_mutexWorkers);
+                if( _nRunningWorkers == 0 || _bStopWorkers ) {
+                    break;
+                }
+                _condWorkers.timed_wait(workerlock, boost::posix_time::milliseconds(10));
+                progress._iteration = _nIterations;
+            }
+
+            PlannerAction callbackaction = _CallCallbacks(progress);
+            bool bStop = false;
+            if( callbackaction == PA_Interrupt ) {
+                bInterrupted = true;
+                bStop = true;
+            }
+            else if( callbackaction == PA_ReturnWithAnySolution ) {
+                boost::mutex::scoped_lock workerlock(_mutexWorkers);
+                bStop = _vgoalpaths.size() > 0;
+            }
+            if( _parameters->_nMaxPlanningTime > 0 ) {
+                uint64_t elapsedtime = utils::GetMonotonicTime()-basetimeus;
+                if( elapsedtime >= 1000*_parameters->_nMaxPlanningTime ) {
+                    RAVELOG_DEBUG_FORMAT("env=%d, time exceeded (%d[us] > %d[us]) so breaking", GetEnv()->GetId()%elapsedtime%(1000*_parameters->_nMaxPlanningTime));
+                    bStop = true;
+                }
+            }
+            if( bStop ) {
+                boost::mutex::scoped_lock workerlock(_mutexWorkers);
+                _bStopWorkers = true;
+            }
+        }
+        {
+            boost::mutex::scoped_lock workerlock(_mutexWorkers);
+            _bStopWorkers = true;
+        }
+        FOREACH(itthread, vthreads) {
+            (*itthread)->join();
+        }
+        if( bInterrupted ) {
+            return OPENRAVE_PLANNER_STATUS(str(boost::format("env=%d, Planning was interrupted")%GetEnv()->GetId()), PS_Interrupted);
+        }
+
+        if( _vgoalpaths.size() == 0 ) {
+            uint64_t elapsedtimeus = utils::GetMonotonicTime()-basetimeus;
+            std::string description = str(boost::format(_("env=%d, plan failed in %u[us], iter=%d, threads=%d, nMaxIterations=%d"))%GetEnv()->GetId()%(elapsedtimeus)%_nIterations%_vworkers.size()%_parameters->_nMaxIterations);
+            RAVELOG_WARN(description);
+            return OPENRAVE_PLANNER_STATUS(description, PS_Failed);
+        }
+
+        // the workers grew the trees without the custom constraint functions of the parameters, so validate the paths with them starting from the shortest
+        std::sort(_vgoalpaths.begin(), _vgoalpaths.end(), _CompareGoalPathLength);
+        std::vector<GOALPATH>::iterator itbest = _vgoalpaths.end();
+        {
+            PlannerParameters::StateSaver savestate(_parameters);
+            CollisionOptionsStateSaver optionstate(GetEnv()->GetCollisionChecker(),GetEnv()->GetCollisionChecker()->GetCollisionOptions()|CO_ActiveDOFs,false);
+            FOREACH(itpath,_vgoalpaths) {
+                if( _CheckGoalPath(*itpath) ) {
+                    itbest = itpath;
+                    break;
+                }
+                RAVELOG_DEBUG_FORMAT("env=%d, path to goal %d fails the constraints of the parameters, trying the next path", GetEnv()->GetId()%itpath->goalindex);
+            }
+        }
+        if( itbest == _vgoalpaths.end() ) {
+            std::string description = str(boost::format("env=%d, none of the %d goal paths satisfy the constraints of the parameters")%GetEnv()->GetId()%_vgoalpaths.size());
+            RAVELOG_WARN(description);
+            return OPENRAVE_PLANNER_STATUS(description, PS_Failed);
+        }
+        _goalindex = itbest->goalindex;
+        _startindex = itbest->startindex;
+        if( ptraj->GetConfigurationSpecification().GetDOF() == 0 ) {
+            ptraj->Init(_parameters->_configurationspecification);
+        }
+        ptraj->Insert(ptraj->GetNumWaypoints(), itbest->qall, _parameters->_configurationspecification);
+        uint64_t elapsedtimeus = utils::GetMonotonicTime()-basetimeus;
+        RAVELOG_DEBUG_FORMAT("env=%d, plan success, iters=%d, threads=%d, path=%d points, computation time=%u[us]", GetEnv()->GetId()%_nIterations%_vworkers.size()%ptraj->GetNumWaypoints()%elapsedtimeus);
+        return _ProcessPostPlanners(_robot,ptraj);
+    }
+
+    virtual PlannerParametersConstPtr GetParameters() const {
+        return _parameters;
+    }
+
+protected:
+    /// \brief called by the workers every iteration
+    bool _ContinueWorker()
+    {
+        boost::mutex::scoped_lock lock(_mutexWorkers);
+        ++_nIterations;
+        return !_bStopWorkers;
+    }
+
+    void _WorkerFinished()
+    {
+        boost::mutex::scoped_lock lock(_mutexWorkers);
+        --_nRunningWorkers;
+        _condWorkers.notify_all();
+    }
+
+    /// \brief keeps the shortest path for every goal and stops the workers once enough goals are connected
+    void _AddGoalPath(const GOALPATH& goalpath)
+    {
+        boost::mutex::scoped_lock lock(_mutexWorkers);
+        bool bfound = false;
+        FOREACH(itgoalpath, _vgoalpaths) {
+            if( itgoalpath->goalindex == goalpath.goalindex ) {
+                if( goalpath.length < itgoalpath->length ) {
+                    *itgoalpath = goalpath;
+                }
+                bfound = true;
+                break;
+            }
+        }
+        if( !bfound ) {
+            _vgoalpaths.push_back(goalpath);
+        }
+        if( _vgoalpaths.size() >= _parameters->_minimumgoalpaths || _vgoalpaths.size() >= _nValidGoals ) {
+            _bStopWorkers = true;
+        }
+        _condWorkers.notify_all();
+    }
+
+    static bool _CompareGoalPathLength(const GOALPATH& path0, const GOALPATH& path1)
+    {
+        return path0.length < path1.length;
+    }
+
+    /// \brief checks every segment of the path with the constraints of _parameters in the original environment
+    bool _CheckGoalPath(const GOALPATH& goalpath)
+    {
+        const int dof = _parameters->GetDOF();
+        std::vector<dReal> vprev(goalpath.qall.begin(), goalpath.qall.begin()+dof), vnext(dof);
+        for(size_t index = dof; index+dof <= goalpath.qall.size(); index += dof) {
+            std::copy(goalpath.qall.begin()+index, goalpath.qall.begin()+index+dof, vnext.begin());
+            if( _parameters->CheckPathAllConstraints(vprev, vnext, std::vector<dReal>(), std::vector<dReal>(), 0, IT_OpenStart) != 0 ) {
+                return false;
+            }
+            vprev.swap(vnext);
+        }
+        return true;
+    }
+
+    /// \brief nearest published node of the forward (fromgoal=0) or backward (fromgoal=1) trees of all workers except workerindex
+    void _FindNearestForeignNode(int workerindex, const std::vector<dReal>& vconfig, int fromgoal, int& foreignworkerindex, SimpleNode*& pforeignnode, dReal& fforeigndist)
+    {
+        for(size_t iworker = 0; iworker < _vworkers.size(); ++iworker) {
+            if( (int)iworker == workerindex ) {
+                continue;
+            }
+            dReal fdist = std::numeric_limits<dReal>::infinity();
+            SimpleNode* pnode = _vworkers[iworker]->FindNearestPublishedNode(vconfig, fromgoal, fdist);
+            if( !!pnode && fdist < fforeigndist ) {
+                foreignworkerindex = iworker;
+                pforeignnode = pnode;
+                fforeigndist = fdist;
+            }
+        }
+    }
+
+    bool _SetNumThreadsCommand(std::ostream& sout, std::istream& sinput)
+    {
+        sinput >> _nNumThreads;
+        return !!sinput;
+    }
+
+    RRTParametersPtr _parameters;
+    int _nNumThreads;
+    std::vector<EnvironmentBasePtr> _vclones; ///< reused across InitPlan calls
+    std::vector<WorkerPtr> _vworkers;
+    size_t _nValidGoals;
+
+    boost::mutex _mutexWorkers; ///< protects the members below
+    boost::condition _condWorkers;
+    std::vector<GOALPATH> _vgoalpaths;
+    bool _bStopWorkers;
+    int _nRunningWorkers;
+    int _nIterations;
+};
+
+#endif
@@ -14,6 +14,7 @@
 #include "openraveplugindefs.h"
 #include "feasibilitychecker.h"
 #include <algorithm>
+#include <openrave/planningutils.h>
 
 namespace OpenRAVE {
 
@@ -54,8 +55,47 @@ int CheckRampNDFeasibility(const std::vector<RampND>& rampndVect, FeasibilityChe
 
 int CheckRampNDFeasibility(const std::vector<RampND>& rampndVect, FeasibilityCheckerBase* feas, const std::vector<dReal>& tol, int options)
 {
-    BOOST_ASSERT(0);
-    return 0xffff;
+    if( rampndVect.size() == 0 ) {
+        return 0;
+    }
+    // tol is only validated: the segments are discretized by SegmentFeasible2 using the resolutions of the planner parameters
+    OPENRAVE_ASSERT_OP(tol.size(), ==, rampndVect[0].GetDOF());
+
+    // Check the switch points first since they are cheap compared to the segments. Both are
+    // checked in bisection order so that an infeasible trajectory is rejected as early as possible.
+    std::vector<dReal> q0, q1, dq0, dq1;
+    rampndVect[0].GetX0Vect(q0);
+    rampndVect[0].GetV0Vect(dq0);
+    CheckReturn ret = feas->ConfigFeasible2(q0, dq0, options);
+    if( ret.retcode != 0 ) {
+        return ret.retcode;
+    }
+
+    std::vector<size_t> vorder;
+    planningutils::ComputeBisectionOrder(rampndVect.size(), vorder);
+    FOREACHC(itindex, vorder) {
+        rampndVect[*itindex].GetX1Vect(q1);
+        rampndVect[*itindex].GetV1Vect(dq1);
+        ret = feas->ConfigFeasible2(q1, dq1, options);
+        if( ret.retcode != 0 ) {
+            return ret.retcode;
+        }
+    }
+
+    std::vector<RampND> rampndVectOut;
+    std::vector<dReal> vIntermediateConfigurations;
+    FOREACHC(itindex, vorder) {
+        const RampND& rampnd = rampndVect[*itindex];
+        rampnd.GetX0Vect(q0);
+        rampnd.GetX1Vect(q1);
+        rampnd.GetV0Vect(dq0);
+        rampnd.GetV1Vect(dq1);
+        ret = feas->SegmentFeasible2(q0, q1, dq0, dq1, rampnd.GetDuration(), options, rampndVectOut, vIntermediateConfigurations);
+        if( ret.retcode != 0 ) {
+            return ret.retcode;
+        }
+    }
+    return 0;
 }
 
 RampNDFeasibilityChecker::RampNDFeasibilityChecker(FeasibilityCheckerBase* _feas) : feas(_feas), tol(0), distance(NULL), maxiter(0), constraintmask(0) {
@@ -0,0 +1,750 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2006-2010 Rosen Diankov (rosen.diankov@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include "rplanners.h"
+
+#include <queue>
+#include <fstream>
+#include <boost/algorithm/string.hpp>
+
+/** \brief multi-query probabilistic roadmap that keeps its graph across PlanPath calls.
+
+    Nodes are validated when they are inserted, edges are only validated when they are part of a shortest path (lazy PRM). Every
+    validation is tagged with an epoch that is incremented on every InitPlan (the constraint functions of the new parameters can
+    differ) and whenever the update stamps of the other bodies in the environment change, so only the parts of the roadmap that
+    are actually used are re-validated. The initial and goal nodes of a query are removed again once the query is done.
+ */
+class PersistentRoadmapPlanner : public PlannerBase
+{
+    struct RoadmapNode
+    {
+        RoadmapNode() : pnode(NULL), checkedepoch(-1), bvalid(false) {
+        }
+        SimpleNode* pnode; ///< the configuration inside the cover tree
+        std::vector<int> vedges;
+        int checkedepoch; ///< epoch bvalid was computed at
+        bool bvalid;
+    };
+
+    struct RoadmapEdge
+    {
+        RoadmapEdge() : inode0(-1), inode1(-1), cost(0), checkedepoch(-1), bvalid(false) {
+        }
+        int inode0, inode1;
+        dReal cost;
+        int checkedepoch;
+        bool bvalid;
+    };
+
+    /// \brief state of the environment that the roadmap validity depends on
+    struct EnvironmentStamp
+    {
+        bool operator==(const EnvironmentStamp& r) const {
+            return vbodynames == r.vbodynames && vstamps == r.vstamps && vvalues == r.vvalues;
+        }
+        bool operator!=(const EnvironmentStamp& r) const {
+            return !(*this == r);
+        }
+        std::vector<std::string> vbodynames;
+        std::vector<int> vstamps;
+        std::vector<dReal> vvalues;
+    };
+
+public:
+    PersistentRoadmapPlanner(EnvironmentBasePtr penv, std::istream& sinput) : PlannerBase(penv), _tree(0)
+    {
+        __description = "\
+:Interface Author:  Rosen Diankov\n\n\
+Multi-query probabilistic roadmap (PRM) that keeps its graph across PlanPath calls. The initial and goal configurations are added to the roadmap and connected to their nearest neighbors, the shortest path is found with A*, and only the edges on it are collision checked (lazy PRM). If no path exists, the roadmap is expanded with _nMaxIterations random samples at most.\n\n\
+Edges are re-validated lazily when InitPlan changes the resolutions, step length, limits, constraint functions, or collision checker options, and when the update stamps of the other bodies in the environment change. The constraint functions cannot be compared, so they are only trusted when the same parameters object is passed again. The initial and goal configurations are removed from the roadmap after every query. The roadmap is reset when the configuration specification or the robot kinematics change.\n\n\
+- R. Bohlin and L.E. Kavraki. Path planning using lazy PRM. In Proc. IEEE Int'l Conf. on Robotics and Automation (ICRA'2000), pages 521-528, San Francisco, CA, April 2000.";
+        RegisterCommand("SaveRoadmap", boost::bind(&PersistentRoadmapPlanner::_SaveRoadmapCommand,this,_1,_2),
+                        "saves the roadmap to a file. Format: filename");
+        RegisterCommand("LoadRoadmap", boost::bind(&PersistentRoadmapPlanner::_LoadRoadmapCommand,this,_1,_2),
+                        "loads the roadmap from a file, the planner has to be initialized with the same configuration specification and robot. Format: filename");
+        RegisterCommand("ClearRoadmap", boost::bind(&PersistentRoadmapPlanner::_ClearRoadmapCommand,this,_1,_2),
+                        "removes all the nodes and edges of the roadmap");
+        RegisterCommand("GetRoadmapInfo", boost::bind(&PersistentRoadmapPlanner::_GetRoadmapInfoCommand,this,_1,_2),
+                        "returns the number of nodes, number of edges, and the current validation epoch");
+        _nNeighbors = 10;
+        _nExpandSamples = 50;
+        _nEpoch = 0;
+        _nValidityCheckerOptions = 0;
+        _bTreeInitialized = false;
+    }
+    virtual ~PersistentRoadmapPlanner() {
+    }
+
+    virtual bool InitPlan(RobotBasePtr pbase, PlannerParametersConstPtr pparams)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        pparams->Validate();
+        PlannerParametersConstPtr poldparameters = _parameters;
+        _parameters.reset(new PlannerParameters());
+        _parameters->copy(pparams);
+        _robot = pbase;
+        if( !_uniformsampler ) {
+            _uniformsampler = RaveCreateSpaceSampler(GetEnv(),"mt19937");
+        }
+        _uniformsampler->SetSeed(_parameters->_nRandomGeneratorSeed);
+        FOREACH(it, _parameters->_listInternalSamplers) {
+            (*it)->SetSeed(_parameters->_nRandomGeneratorSeed);
+        }
+        if( _parameters->_nMaxIterations <= 0 ) {
+            _parameters->_nMaxIterations = 2000;
+        }
+
+        if( (_parameters->vgoalconfig.size() % _parameters->GetDOF()) != 0 || _parameters->vgoalconfig.size() == 0 ) {
+            RAVELOG_WARN_FORMAT("env=%d, goals are improperly specified", GetEnv()->GetId());
+            _parameters.reset();
+            return false;
+        }
+
+        // the roadmap can only be reused if the space did not change
+        std::string robothash = !!_robot ? _robot->GetKinematicsGeometryHash() : std::string();
+        if( !_bTreeInitialized || _roadmapspec != _parameters->_configurationspecification || _roadmaprobothash != robothash ) {
+            if( _vnodes.size() > 0 ) {
+                RAVELOG_INFO_FORMAT("env=%d, configuration space changed, resetting roadmap with %d nodes", GetEnv()->GetId()%_vnodes.size());
+            }
+            _ResetRoadmap();
+            _roadmapspec = _parameters->_configurationspecification;
+            _roadmaprobothash = robothash;
+        }
+        else if( _HasValidityChanged(poldparameters, pparams) ) {
+            _nEpoch += 1;
+            RAVELOG_VERBOSE_FORMAT("env=%d, validity settings changed, roadmap epoch is now %d", GetEnv()->GetId()%_nEpoch);
+        }
+        _validitysourceparameters = pparams;
+        CollisionCheckerBasePtr pchecker = GetEnv()->GetCollisionChecker();
+        _validitychecker = pchecker;
+        _nValidityCheckerOptions = !!pchecker ? pchecker->GetCollisionOptions() : 0;
+        return true;
+    }
+
+    virtual PlannerStatus PlanPath(TrajectoryBasePtr ptraj, int planningoptions) override
+    {
+        if(!_parameters) {
+            return OPENRAVE_PLANNER_STATUS(str(boost::format("env=%d, PersistentRoadmapPlanner::PlanPath - Error, planner not initialized")%GetEnv()->GetId()), PS_Failed);
+        }
+
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        uint64_t basetimeus = utils::GetMonotonicTime();
+        PlannerParameters::StateSaver savestate(_parameters);
+        CollisionOptionsStateSaver optionstate(GetEnv()->GetCollisionChecker(),GetEnv()->GetCollisionChecker()->GetCollisionOptions()|CO_ActiveDOFs,false);
+        _UpdateEpoch();
+
+        const int dof = _parameters->GetDOF();
+        std::vector<dReal> vconfig(dof);
+        std::vector<int> vstartnodes, vgoalnodes, vquerynodes;
+        std::map<int, int> mapgoalnodeindices; ///< roadmap node -> goal index
+        for(size_t index = 0; index < _parameters->vinitialconfig.size(); index += dof) {
+            std::copy(_parameters->vinitialconfig.begin()+index, _parameters->vinitialconfig.begin()+index+dof, vconfig.begin());
+            if( _parameters->CheckPathAllConstraints(vconfig, vconfig, std::vector<dReal>(), std::vector<dReal>(), 0, IT_OpenStart) != 0 ) {
+                RAVELOG_DEBUG_FORMAT("env=%d, initial configuration %d does not satisfy constraints", GetEnv()->GetId()%(index/dof));
+                continue;
+            }
+            vstartnodes.push_back(_AddQueryNode(vconfig, vquerynodes));
+        }
+        for(size_t index = 0; index < _parameters->vgoalconfig.size(); index += dof) {
+            std::copy(_parameters->vgoalconfig.begin()+index, _parameters->vgoalconfig.begin()+index+dof, vconfig.begin());
+            if( _parameters->CheckPathAllConstraints(vconfig, vconfig, std::vector<dReal>(), std::vector<dReal>(), 0, IT_OpenStart) != 0 ) {
+                RAVELOG_DEBUG_FORMAT("env=%d, goal configuration %d does not satisfy constraints", GetEnv()->GetId()%(index/dof));
+                continue;
+            }
+            int inode = _AddQueryNode(vconfig, vquerynodes);
+            if( mapgoalnodeindices.insert(std::make_pair(inode, index/dof)).second ) {
+                vgoalnodes.push_back(inode);
+            }
+        }
+
+        std::vector<dReal> vpath;
+        PlannerStatus status = _PlanQuery(vstartnodes, vgoalnodes, mapgoalnodeindices, basetimeus, vpath);
+        _RemoveQueryNodes(vquerynodes);
+        if( status.GetStatusCode() != PS_HasSolution ) {
+            return status;
+        }
+
+        if( ptraj->GetConfigurationSpecification().GetDOF() == 0 ) {
+            ptraj->Init(_parameters->_configurationspecification);
+        }
+        ptraj->Insert(ptraj->GetNumWaypoints(), vpath, _parameters->_configurationspecification);
+        return _ProcessPostPlanners(_robot,ptraj);
+    }
+
+    virtual PlannerParametersConstPtr GetParameters() const {
+        return _parameters;
+    }
+
+protected:
+    /// \brief searches the roadmap and expands it until a path from the start nodes to a goal node is found
+    PlannerStatus _PlanQuery(const std::vector<int>& vstartnodes, const std::vector<int>& vgoalnodes, const std::map<int, int>& mapgoalnodeindices, uint64_t basetimeus, std::vector<dReal>& vpath)
+    {
+        if( vstartnodes.size() == 0 || vgoalnodes.size() == 0 ) {
+            std::string description = str(boost::format("env=%d, no valid initial (%d) or goal (%d) configurations")%GetEnv()->GetId()%vstartnodes.size()%vgoalnodes.size());
+            RAVELOG_WARN(description);
+            return OPENRAVE_PLANNER_STATUS(description, PS_Failed);
+        }
+
+        PlannerProgress progress;
+        int numsamples = 0, numsearches = 0;
+        std::vector<int> vpathnodes;
+        while(1) {
+            if( _parameters->_nMaxPlanningTime > 0 ) {
+                uint64_t elapsedtime = utils::GetMonotonicTime()-basetimeus;
+                if( elapsedtime >= 1000*_parameters->_nMaxPlanningTime ) {
+                    std::string description = str(boost::format("env=%d, time exceeded (%d[us] > %d[us]), roadmap has %d nodes")%GetEnv()->GetId()%elapsedtime%(1000*_parameters->_nMaxPlanningTime)%_vnodes.size());
+                    RAVELOG_WARN(description);
+                    return OPENRAVE_PLANNER_STATUS(description, PS_Failed);
+                }
+            }
+            progress._iteration = numsamples;
+            if( _CallCallbacks(progress) == PA_Interrupt ) {
+                return OPENRAVE_PLANNER_STATUS(str(boost::format("env=%d, Planning was interrupted")%GetEnv()->GetId()), PS_Interrupted);
+            }
+
+            ++numsearches;
+            if( _SearchPath(vstartnodes, mapgoalnodeindices, vpathnodes) ) {
+                if( _ValidatePath(vpathnodes) ) {
+                    break;
+                }
+                // some node or edge was invalid, search again without it
+                continue;
+            }
+
+            if( numsamples >= _parameters->_nMaxIterations ) {
+                std::string description = str(boost::format(_("env=%d, plan failed in %u[us], samples=%d, roadmap has %d nodes"))%GetEnv()->GetId()%(utils::GetMonotonicTime()-basetimeus)%numsamples%_vnodes.size());
+                RAVELOG_WARN(description);
+                return OPENRAVE_PLANNER_STATUS(description, PS_Failed);
+            }
+            numsamples += _ExpandRoadmap(std::min(_nExpandSamples, _parameters->_nMaxIterations-numsamples));
+        }
+
+        const int dof = _parameters->GetDOF();
+        _goalindex = mapgoalnodeindices.find(vpathnodes.back())->second;
+        vpath.resize(vpathnodes.size()*dof);
+        for(size_t i = 0; i < vpathnodes.size(); ++i) {
+            std::copy(_vnodes[vpathnodes[i]].pnode->q, _vnodes[vpathnodes[i]].pnode->q+dof, vpath.begin()+i*dof);
+        }
+        RAVELOG_DEBUG_FORMAT("env=%d, plan success, samples=%d, searches=%d, path=%d points, roadmap=%d nodes, computation time=%u[us]", GetEnv()->GetId()%numsamples%numsearches%vpathnodes.size()%_vnodes.size()%(utils::GetMonotonicTime()-basetimeus));
+        return OPENRAVE_PLANNER_STATUS(PS_HasSolution);
+    }
+
+    /// \brief adds an initial or goal configuration, vquerynodes receives the node if it was created for the query
+    int _AddQueryNode(const std::vector<dReal>& vconfig, std::vector<int>& vquerynodes)
+    {
+        int numnodes = _vnodes.size();
+        int inode = _AddNode(vconfig);
+        if( inode == numnodes ) {
+            vquerynodes.push_back(inode);
+        }
+        return inode;
+    }
+
+    /// \brief removes the nodes created for the initial and goal configurations so that the roadmap does not grow with every query
+    void _RemoveQueryNodes(std::vector<int>& vquerynodes)
+    {
+        // every removal moves the last node, so go from the highest index down
+        std::sort(vquerynodes.begin(), vquerynodes.end(), std::greater<int>());
+        FOREACHC(itnode, vquerynodes) {
+            _RemoveNode(*itnode);
+        }
+    }
+
+    /// \brief removes the node and its edges from the roadmap, the last node takes over its index
+    void _RemoveNode(int inode)
+    {
+        std::vector<int> vedges = _vnodes[inode].vedges;
+        std::sort(vedges.begin(), vedges.end(), std::greater<int>());
+        FOREACHC(itedge, vedges) {
+            _RemoveEdge(*itedge);
+        }
+        _tree.RemoveNode(_vnodes[inode].pnode);
+        int ilast = (int)_vnodes.size()-1;
+        if( inode != ilast ) {
+            _vnodes[inode] = _vnodes[ilast];
+            _vnodes[inode].pnode->_userdata = inode;
+            FOREACHC(itedge, _vnodes[inode].vedges) {
+                RoadmapEdge& edge = _vedges[*itedge];
+                if( edge.inode0 == ilast ) {
+                    edge.inode0 = inode;
+                }
+                if( edge.inode1 == ilast ) {
+                    edge.inode1 = inode;
+                }
+            }
+        }
+        _vnodes.pop_back();
+    }
+
+    /// \brief removes the edge from the roadmap, the last edge takes over its index
+    void _RemoveEdge(int iedge)
+    {
+        int inodes[2] = { _vedges[iedge].inode0, _vedges[iedge].inode1 };
+        for(int i = 0; i < 2; ++i) {
+            std::vector<int>& vedges = _vnodes[inodes[i]].vedges;
+            vedges.erase(std::remove(vedges.begin(), vedges.end(), iedge), vedges.end());
+        }
+        int ilast = (int)_vedges.size()-1;
+        if( iedge != ilast ) {
+            _vedges[iedge] = _vedges[ilast];
+            int inodesmoved[2] = { _vedges[iedge].inode0, _vedges[iedge].inode1 };
+            for(int i = 0; i < 2; ++i) {
+                std::replace(_vnodes[inodesmoved[i]].vedges.begin(), _vnodes[inodesmoved[i]].vedges.end(), ilast, iedge);
+            }
+        }
+        _vedges.pop_back();
+    }
+
+    void _ResetRoadmap()
+    {
+        _vnodes.resize(0);
+        _vedges.resize(0);
+        _tree.Init(shared_planner(), _parameters->GetDOF(), _parameters->_distmetricfn, _parameters->_fStepLength, _parameters->_distmetricfn(_parameters->_vConfigLowerLimit, _parameters->_vConfigUpperLimit));
+        _bTreeInitialized = true;
+        _nEpoch += 1;
+    }
+
+    /// \brief returns true if the new parameters can give different validation results than the ones the roadmap was last checked with
+    bool _HasValidityChanged(PlannerParametersConstPtr poldparameters, PlannerParametersConstPtr pparams) const
+    {
+        // the constraint functions cannot be compared, so only the same parameters object is trusted to have the same ones
+        if( !poldparameters || _validitysourceparameters.lock() != pparams ) {
+            return true;
+        }
+        if( poldparameters->_vConfigResolution != _parameters->_vConfigResolution || poldparameters->_fStepLength != _parameters->_fStepLength ) {
+            return true;
+        }
+        if( poldparameters->_vConfigLowerLimit != _parameters->_vConfigLowerLimit || poldparameters->_vConfigUpperLimit != _parameters->_vConfigUpperLimit ) {
+            return true;
+        }
+        CollisionCheckerBasePtr pchecker = GetEnv()->GetCollisionChecker();
+        if( pchecker != _validitychecker.lock() || (!!pchecker && pchecker->GetCollisionOptions() != _nValidityCheckerOptions) ) {
+            return true;
+        }
+        return false;
+    }
+
+    /// \brief increments the epoch if any body that is not being planned for changed since the last query
+    void _UpdateEpoch()
+    {
+        std::vector<KinBodyPtr> vusedbodies, vbodies;
+        _parameters->_configurationspecification.ExtractUsedBodies(GetEnv(), vusedbodies);
+        GetEnv()->GetBodies(vbodies);
+        EnvironmentStamp stamp;
+        std::vector<dReal> vvalues;
+        std::vector<int> vuseddofindices, vusedconfigindices;
+        FOREACHC(itbody, vbodies) {
+            bool bused = find(vusedbodies.begin(), vusedbodies.end(), *itbody) != vusedbodies.end();
+            bool bgrabbed = false;
+            FOREACHC(itusedbody, vusedbodies) {
+                if( !!(*itusedbody)->IsGrabbing(**itbody) ) {
+                    bgrabbed = true;
+                    break;
+                }
+            }
+            if( bgrabbed ) {
+                // moves with the planned body, the grab itself changes the info stamp of the planned body
+                continue;
+            }
+            stamp.vbodynames.push_back((*itbody)->GetName());
+            if( bused ) {
+                // the planned values always change, so use the info stamp and the values that are not planned
+                stamp.vstamps.push_back((*itbody)->GetInfoUpdateStamp());
+                (*itbody)->GetDOFValues(vvalues);
+                _parameters->_configurationspecification.ExtractUsedIndices(*itbody, vuseddofindices, vusedconfigindices);
+                for(size_t idof = 0; idof < vvalues.size(); ++idof) {
+                    if( find(vuseddofindices.begin(), vuseddofindices.end(), (int)idof) == vuseddofindices.end() ) {
+                        stamp.vvalues.push_back(vvalues[idof]);
+                    }
+                }
+                Transform t = (*itbody)->GetTransform();
+                stamp.vvalues.push_back(t.rot.x); stamp.vvalues.push_back(t.rot.y); stamp.vvalues.push_back(t.rot.z); stamp.vvalues.push_back(t.rot.w);
+                stamp.vvalues.push_back(t.trans.x); stamp.vvalues.push_back(t.trans.y); stamp.vvalues.push_back(t.trans.z);
+            }
+            else {
+                stamp.vstamps.push_back((*itbody)->GetUpdateStamp());
+                stamp.vstamps.push_back((*itbody)->IsEnabled());
+            }
+        }
+        if( stamp != _environmentstamp ) {
+            _environmentstamp = stamp;
+            _nEpoch += 1;
+            RAVELOG_VERBOSE_FORMAT("env=%d, environment changed, roadmap epoch is now %d", GetEnv()->GetId()%_nEpoch);
+        }
+    }
+
+    /// \brief adds a valid configuration to the roadmap and connects it to its nearest neighbors. If a node already exists at the configuration, returns it.
+    int _AddNode(const std::vector<dReal>& vconfig)
+    {
+        int inode = _vnodes.size();
+        SimpleNode* pnode = (SimpleNode*)_tree.InsertNode(NULL, vconfig, inode);
+        if( !pnode ) {
+            std::pair<NodeBasePtr, dReal> nn = _tree.FindNearestNode(vconfig);
+            if( !nn.first ) {
+                throw OPENRAVE_EXCEPTION_FORMAT0("failed to insert configuration into the roadmap", ORE_Assert);
+            }
+            return ((SimpleNode*)nn.first)->_userdata;
+        }
+        _vnodes.push_back(RoadmapNode());
+        _vnodes[inode].pnode = pnode;
+        _vnodes[inode].checkedepoch = _nEpoch;
+        _vnodes[inode].bvalid = true;
+
+        _tree.FindNearestNodes(vconfig, _nNeighbors+1, _vnearest);
+        FOREACHC(itnearest, _vnearest) {
+            int ineighbor = ((SimpleNode*)itnearest->first)->_userdata;
+            if( ineighbor != inode ) {
+                _AddEdge(inode, ineighbor, itnearest->second);
+            }
+        }
+        return inode;
+    }
+
+    void _AddEdge(int inode0, int inode1, dReal cost)
+    {
+        FOREACHC(itedge, _vnodes[inode0].vedges) {
+            const RoadmapEdge& edge = _vedges[*itedge];
+            if( (edge.inode0 == inode0 && edge.inode1 == inode1) || (edge.inode0 == inode1 && edge.inode1 == inode0) ) {
+                return;
+            }
+        }
+        int iedge = _vedges.size();
+        _vedges.push_back(RoadmapEdge());
+        _vedges[iedge].inode0 = inode0;
+        _vedges[iedge].inode1 = inode1;
+        _vedges[iedge].cost = cost;
+        _vnodes[inode0].vedges.push_back(iedge);
+        _vnodes[inode1].vedges.push_back(iedge);
+    }
+
+    /// \brief adds up to numsamples valid random configurations
+    /// \return the number of samples drawn
+    int _ExpandRoadmap(int numsamples)
+    {
+        const int dof = _parameters->GetDOF();
+        std::vector<dReal> vsample(dof);
+        for(int isample = 0; isample < numsamples; ++isample) {
+            if( !_parameters->_samplefn(vsample) ) {
+                continue;
+            }
+            if( _parameters->CheckPathAllConstraints(vsample, vsample, std::vector<dReal>(), std::vector<dReal>(), 0, IT_OpenStart) != 0 ) {
+                continue;
+            }
+            _AddNode(vsample);
+        }
+        return numsamples;
+    }
+
+    /// \brief true if the node/edge is not known to be invalid in the current epoch
+    inline bool _IsNodeUsable(int inode) const {
+        return _vnodes[inode].checkedepoch != _nEpoch || _vnodes[inode].bvalid;
+    }
+    inline bool _IsEdgeUsable(int iedge) const {
+        return _vedges[iedge].checkedepoch != _nEpoch || _vedges[iedge].bvalid;
+    }
+
+    /// \brief A* from all the start nodes to the closest goal node, skipping everything known to be invalid
+    bool _SearchPath(const std::vector<int>& vstartnodes, const std::map<int, int>& mapgoalnodeindices, std::vector<int>& vpathnodes)
+    {
+        size_t numnodes = _vnodes.size();
+        _vcostfromstart.assign(numnodes, std::numeric_limits<dReal>::infinity());
+        _vheuristic.assign(numnodes, -1);
+        _vparentnodes.assign(numnodes, -1);
+        _vclosed.assign(numnodes, 0);
+
+        typedef std::pair<dReal, int> QueueEntry;
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry> > queue;
+        FOREACHC(itstart, vstartnodes) {
+            if( _IsNodeUsable(*itstart) ) {
+                _vcostfromstart[*itstart] = 0;
+                queue.push(std::make_pair(_ComputeHeuristic(*itstart, mapgoalnodeindices), *itstart));
+            }
+        }
+        while(!queue.empty()) {
+            int inode = queue.top().second;
+            queue.pop();
+            if( _vclosed[inode] ) {
+                continue;
+            }
+            _vclosed[inode] = 1;
+            if( mapgoalnodeindices.find(inode) != mapgoalnodeindices.end() ) {
+                vpathnodes.resize(0);
+                for(int icurnode = inode; icurnode >= 0; icurnode = _vparentnodes[icurnode]) {
+                    vpathnodes.push_back(icurnode);
+                }
+                std::reverse(vpathnodes.begin(), vpathnodes.end());
+                return true;
+            }
+            FOREACHC(itedge, _vnodes[inode].vedges) {
+                const RoadmapEdge& edge = _vedges[*itedge];
+                int ineighbor = edge.inode0 == inode ? edge.inode1 : edge.inode0;
+                if( _vclosed[ineighbor] || !_IsEdgeUsable(*itedge) || !_IsNodeUsable(ineighbor) ) {
+                    continue;
+                }
+                dReal cost = _vcostfromstart[inode] + edge.cost;
+                if( cost < _vcostfromstart[ineighbor] ) {
+                    _vcostfromstart[ineighbor] = cost;
+                    _vparentnodes[ineighbor] = inode;
+                    queue.push(std::make_pair(cost + _ComputeHeuristic(ineighbor, mapgoalnodeindices), ineighbor));
+                }
+            }
+        }
+        return false;
+    }
+
+    /// \brief distance to the closest goal node, cached per search
+    dReal _ComputeHeuristic(int inode, const std::map<int, int>& mapgoalnodeindices)
+    {
+        if( _vheuristic[inode] < 0 ) {
+            const int dof = _parameters->GetDOF();
+            _vtempconfig0.assign(_vnodes[inode].pnode->q, _vnodes[inode].pnode->q+dof);
+            dReal fbest = std::numeric_limits<dReal>::infinity();
+            FOREACHC(itgoal, mapgoalnodeindices) {
+                _vtempconfig1.assign(_vnodes[itgoal->first].pnode->q, _vnodes[itgoal->first].pnode->q+dof);
+                fbest = std::min(fbest, _parameters->_distmetricfn(_vtempconfig0, _vtempconfig1));
+            }
+            _vheuristic[inode] = fbest;
+        }
+        return _vheuristic[inode];
+    }
+
+    /// \brief validates the nodes and edges of the path that were not checked in the current epoch
+    /// \return true if the whole path is valid
+    bool _ValidatePath(const std::vector<int>& vpathnodes)
+    {
+        const int dof = _parameters->GetDOF();
+        bool bvalid = true;
+        FOREACHC(itnode, vpathnodes) {
+            RoadmapNode& node = _vnodes[*itnode];
+            if( node.checkedepoch != _nEpoch ) {
+                _vtempconfig0.assign(node.pnode->q, node.pnode->q+dof);
+                node.bvalid = _parameters->CheckPathAllConstraints(_vtempconfig0, _vtempconfig0, std::vector<dReal>(), std::vector<dReal>(), 0, IT_OpenStart) == 0;
+                node.checkedepoch = _nEpoch;
+            }
+            if( !node.bvalid ) {
+                bvalid = false;
+            }
+        }
+        if( !bvalid ) {
+            return false;
+        }
+        for(size_t i = 0; i+1 < vpathnodes.size(); ++i) {
+            int iedge = _FindEdge(vpathnodes[i], vpathnodes[i+1]);
+            RoadmapEdge& edge = _vedges.at(iedge);
+            if( edge.checkedepoch != _nEpoch ) {
+                _vtempconfig0.assign(_vnodes[vpathnodes[i]].pnode->q, _vnodes[vpathnodes[i]].pnode->q+dof);
+                _vtempconfig1.assign(_vnodes[vpathnodes[i+1]].pnode->q, _vnodes[vpathnodes[i+1]].pnode->q+dof);
+                edge.bvalid = _parameters->CheckPathAllConstraints(_vtempconfig0, _vtempconfig1, std::vector<dReal>(), std::vector<dReal>(), 0, IT_Open) == 0;
+                edge.checkedepoch = _nEpoch;
+            }
+            if( !edge.bvalid ) {
+                // stop at the first invalid edge since the next search will avoid it anyway
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int _FindEdge(int inode0, int inode1) const
+    {
+        FOREACHC(itedge, _vnodes[inode0].vedges) {
+            const RoadmapEdge& edge = _vedges[*itedge];
+            if( (edge.inode0 == inode0 && edge.inode1 == inode1) || (edge.inode0 == inode1 && edge.inode1 == inode0) ) {
+                return *itedge;
+            }
+        }
+        return -1;
+    }
+
+    bool _SaveRoadmapCommand(std::ostream& sout, std::istream& sinput)
+    {
+        std::string filename;
+        getline(sinput, filename);
+        boost::trim(filename);
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        if( !_parameters ) {
+            RAVELOG_WARN_FORMAT("env=%d, planner has to be initialized before saving the roadmap", GetEnv()->GetId());
+            return false;
+        }
+        std::ofstream f(filename.c_str(), std::ios::binary);
+        if( !f ) {
+            RAVELOG_WARN_FORMAT("env=%d, failed to open %s for writing", GetEnv()->GetId()%filename);
+            return false;
+        }
+        std::stringstream ssspec;
+        ssspec << _roadmapspec;
+        std::string spec = ssspec.str();
+        const int dof = _parameters->GetDOF();
+        f.write(s_header, sizeof(s_header));
+        _WriteString(f, spec);
+        _WriteString(f, _roadmaprobothash);
+        uint32_t header[2] = { (uint32_t)dof, (uint32_t)_vnodes.size() };
+        f.write(reinterpret_cast<const char*>(header), sizeof(header));
+        std::vector<double> vconfig(dof);
+        FOREACHC(itnode, _vnodes) {
+            std::copy(itnode->pnode->q, itnode->pnode->q+dof, vconfig.begin());
+            f.write(reinterpret_cast<const char*>(&vconfig[0]), dof*sizeof(double));
+        }
+        uint32_t numedges = _vedges.size();
+        f.write(reinterpret_cast<const char*>(&numedges), sizeof(numedges));
+        FOREACHC(itedge, _vedges) {
+            int32_t indices[2] = { itedge->inode0, itedge->inode1 };
+            f.write(reinterpret_cast<const char*>(indices), sizeof(indices));
+        }
+        return !!f;
+    }
+
+    bool _LoadRoadmapCommand(std::ostream& sout, std::istream& sinput)
+    {
+        std::string filename;
+        getline(sinput, filename);
+        boost::trim(filename);
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        if( !_parameters ) {
+            RAVELOG_WARN_FORMAT("env=%d, planner has to be initialized before loading the roadmap", GetEnv()->GetId());
+            return false;
+        }
+        std::ifstream f(filename.c_str(), std::ios::binary);
+        char header[16];
+        std::string spec, robothash;
+        uint32_t sizes[2] = {0, 0};
+        if( !f.read(header, sizeof(header)) || memcmp(header, s_header, sizeof(header)) != 0 || !_ReadString(f, spec) || !_ReadString(f, robothash) || !f.read(reinterpret_cast<char*>(sizes), sizeof(sizes)) ) {
+            RAVELOG_WARN_FORMAT("env=%d, %s is not a roadmap file", GetEnv()->GetId()%filename);
+            return false;
+        }
+        std::stringstream ssspec;
+        ssspec << _roadmapspec;
+        const int dof = _parameters->GetDOF();
+        if( spec != ssspec.str() || robothash != _roadmaprobothash || (int)sizes[0] != dof ) {
+            RAVELOG_WARN_FORMAT("env=%d, roadmap %s was computed for a different configuration space or robot", GetEnv()->GetId()%filename);
+            return false;
+        }
+
+        _ResetRoadmap();
+        std::vector<double> vfileconfig(dof);
+        std::vector<dReal> vconfig(dof);
+        std::vector<int> vfileindices(sizes[1], -1); ///< file node -> roadmap node, nodes can merge if they are closer than the tree resolution
+        for(uint32_t inode = 0; inode < sizes[1]; ++inode) {
+            if( !f.read(reinterpret_cast<char*>(&vfileconfig[0]), dof*sizeof(double)) ) {
+                RAVELOG_WARN_FORMAT("env=%d, %s is truncated", GetEnv()->GetId()%filename);
+                _ResetRoadmap();
+                return false;
+            }
+            std::copy(vfileconfig.begin(), vfileconfig.end(), vconfig.begin());
+            SimpleNode* pnode = (SimpleNode*)_tree.InsertNode(NULL, vconfig, _vnodes.size());
+            if( !pnode ) {
+                vfileindices[inode] = ((SimpleNode*)_tree.FindNearestNode(vconfig).first)->_userdata;
+                continue;
+            }
+            vfileindices[inode] = _vnodes.size();
+            _vnodes.push_back(RoadmapNode());
+            _vnodes.back().pnode = pnode;
+        }
+        uint32_t numedges = 0;
+        f.read(reinterpret_cast<char*>(&numedges), sizeof(numedges));
+        std::vector<dReal> vconfig0(dof), vconfig1(dof);
+        for(uint32_t iedge = 0; iedge < numedges; ++iedge) {
+            int32_t indices[2];
+            if( !f.read(reinterpret_cast<char*>(indices), sizeof(indices)) || indices[0] < 0 || indices[1] < 0 || indices[0] >= (int)sizes[1] || indices[1] >= (int)sizes[1] ) {
+                RAVELOG_WARN_FORMAT("env=%d, %s has invalid edges", GetEnv()->GetId()%filename);
+                _ResetRoadmap();
+                return false;
+            }
+            int inode0 = vfileindices[indices[0]], inode1 = vfileindices[indices[1]];
+            if( inode0 != inode1 ) {
+                vconfig0.assign(_vnodes[inode0].pnode->q, _vnodes[inode0].pnode->q+dof);
+                vconfig1.assign(_vnodes[inode1].pnode->q, _vnodes[inode1].pnode->q+dof);
+                _AddEdge(inode0, inode1, _parameters->_distmetricfn(vconfig0, vconfig1));
+            }
+        }
+        RAVELOG_DEBUG_FORMAT("env=%d, loaded roadmap %s with %d nodes and %d edges", GetEnv()->GetId()%filename%_vnodes.size()%_vedges.size());
+        return true;
+    }
+
+    bool _ClearRoadmapCommand(std::ostream& sout, std::istream& sinput)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        if( !_bTreeInitialized ) {
+            return true;
+        }
+        _ResetRoadmap();
+        return true;
+    }
+
+    bool _GetRoadmapInfoCommand(std::ostream& sout, std::istream& sinput)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        sout << _vnodes.size() << " " << _vedges.size() << " " << _nEpoch;
+        return true;
+    }
+
+    static void _WriteString(std::ostream& f, const std::string& s)
+    {
+        uint32_t size = s.size();
+        f.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        f.write(s.c_str(), size);
+    }
+
+    static bool _ReadString(std::istream& f, std::string& s)
+    {
+        uint32_t size = 0;
+        if( !f.read(reinterpret_cast<char*>(&size), sizeof(size)) ) {
+            return false;
+        }
+        s.resize(size);
+        return size == 0 || !!f.read(&s[0], size);
+    }
+
+    inline boost::shared_ptr<PersistentRoadmapPlanner> shared_planner() {
+        return boost::static_pointer_cast<PersistentRoadmapPlanner>(shared_from_this());
+    }
+
+    PlannerParametersPtr _parameters;
+    RobotBasePtr _robot;
+    SpaceSamplerBasePtr _uniformsampler;
+    int _goalindex;
+    int _nNeighbors; ///< number of nearest neighbors every new node is connected to
+    int _nExpandSamples; ///< number of samples to add every time the search fails
+
+    // the roadmap, persists across queries
+    SpatialTree<SimpleNode> _tree; ///< nearest neighbor structure, the userdata of the nodes is the index into _vnodes
+    bool _bTreeInitialized;
+    std::vector<RoadmapNode> _vnodes;
+    std::vector<RoadmapEdge> _vedges;
+    ConfigurationSpecification _roadmapspec;
+    std::string _roadmaprobothash;
+    EnvironmentStamp _environmentstamp;
+    int _nEpoch; ///< incremented when the validity settings of InitPlan or the environment change, invalidates all the validation results
+
+    // what the validation results of the current epoch depend on, see _HasValidityChanged
+    boost::weak_ptr<PlannerParameters const> _validitysourceparameters;
+    boost::weak_ptr<CollisionCheckerBase> _validitychecker;
+    int _nValidityCheckerOptions;
+
+    // cache
+    std::vector< std::pair<NodeBasePtr, dReal> > _vnearest;
+    std::vector<dReal> _vcostfromstart, _vheuristic;
+    std::vector<int> _vparentnodes;
+    std::vector<uint8_t> _vclosed;
+    std::vector<dReal> _vtempconfig0, _vtempconfig1;
+
+    static const char s_header[16];
+};
+
+const char PersistentRoadmapPlanner::s_header[16] = "OPENRAVEROADMP1";
+
+PlannerBasePtr CreatePersistentRoadmapPlanner(EnvironmentBasePtr penv, std::istream& sinput) {
+    return PlannerBasePtr(new PersistentRoadmapPlanner(penv, sinput));
+}
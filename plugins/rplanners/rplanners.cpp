@@ -16,12 +16,14 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "openraveplugindefs.h"
 #include "rrt.h"
+#include "parallelrrt.h"
 
 #include <openrave/plugin.h>
 
 PlannerBasePtr CreateShortcutLinearPlanner(EnvironmentBasePtr penv, std::istream& sinput);
 PlannerBasePtr CreateGraspGradientPlanner(EnvironmentBasePtr penv, std::istream& sinput);
 PlannerBasePtr CreateRandomizedAStarPlanner(EnvironmentBasePtr penv, std::istream& sinput);
+PlannerBasePtr CreatePersistentRoadmapPlanner(EnvironmentBasePtr penv, std::istream& sinput);
 PlannerBasePtr CreateWorkspaceTrajectoryTracker(EnvironmentBasePtr penv, std::istream& sinput);
 PlannerBasePtr CreateLinearSmoother(EnvironmentBasePtr penv, std::istream& sinput);
 PlannerBasePtr CreateConstraintParabolicSmoother(EnvironmentBasePtr penv, std::istream& sinput);
@@ -33,6 +35,7 @@ PlannerBasePtr CreateLinearTrajectoryRetimer(EnvironmentBasePtr penv, std::istre
 PlannerBasePtr CreateParabolicTrajectoryRetimer(EnvironmentBasePtr penv, std::istream& sinput);
 PlannerBasePtr CreateParabolicTrajectoryRetimer2(EnvironmentBasePtr penv, std::istream& sinput);
 PlannerBasePtr CreateCubicTrajectoryRetimer(EnvironmentBasePtr penv, std::istream& sinput);
+PlannerBasePtr CreateTimeOptimalTrajectoryRetimer(EnvironmentBasePtr penv, std::istream& sinput);
 }
 
 InterfaceBasePtr CreateInterfaceValidated(InterfaceType type, const std::string& interfacename, std::istream& sinput, EnvironmentBasePtr penv)
@@ -49,6 +52,12 @@ InterfaceBasePtr CreateInterfaceValidated(InterfaceType type, const std::string&
             RAVELOG_WARN("rBiRRT is deprecated, use BiRRT\n");
             return InterfaceBasePtr(new BirrtPlanner(penv));
         }
+        else if( interfacename == "parallelbirrt") {
+            return InterfaceBasePtr(new ParallelBirrtPlanner(penv));
+        }
+        else if( interfacename == "persistentprm") {
+            return CreatePersistentRoadmapPlanner(penv,sinput);
+        }
         else if( interfacename == "basicrrt") {
             return InterfaceBasePtr(new BasicRrtPlanner(penv));
         }
@@ -73,6 +82,9 @@ InterfaceBasePtr CreateInterfaceValidated(InterfaceType type, const std::string&
         else if( interfacename == "cubictrajectoryretimer" ) {
             return rplanners::CreateCubicTrajectoryRetimer(penv,sinput);
         }
+        else if( interfacename == "timeoptimaltrajectoryretimer" ) {
+            return rplanners::CreateTimeOptimalTrajectoryRetimer(penv,sinput);
+        }
         else if( interfacename == "workspacetrajectorytracker" ) {
             return CreateWorkspaceTrajectoryTracker(penv,sinput);
         }
@@ -99,6 +111,8 @@ void GetPluginAttributesValidated(PLUGININFO& info)
 {
     info.interfacenames[PT_Planner].push_back("RAStar");
     info.interfacenames[PT_Planner].push_back("BiRRT");
+    info.interfacenames[PT_Planner].push_back("ParallelBiRRT");
+    info.interfacenames[PT_Planner].push_back("PersistentPRM");
     info.interfacenames[PT_Planner].push_back("BasicRRT");
     info.interfacenames[PT_Planner].push_back("ExplorationRRT");
     info.interfacenames[PT_Planner].push_back("GraspGradient");
@@ -107,6 +121,7 @@ void GetPluginAttributesValidated(PLUGININFO& info)
     info.interfacenames[PT_Planner].push_back("ParabolicTrajectoryRetimer");
     info.interfacenames[PT_Planner].push_back("ParabolicTrajectoryRetimer2");
     info.interfacenames[PT_Planner].push_back("CubicTrajectoryRetimer");
+    info.interfacenames[PT_Planner].push_back("TimeOptimalTrajectoryRetimer");
     info.interfacenames[PT_Planner].push_back("WorkspaceTrajectoryTracker");
     info.interfacenames[PT_Planner].push_back("LinearSmoother");
     info.interfacenames[PT_Planner].push_back("ParabolicSmoother");
@@ -119,6 +119,9 @@ public:
     /// returns the nearest neighbor
     virtual std::pair<NodeBasePtr, dReal> FindNearestNode(const vector<dReal>& q) const = 0;
 
+    /// \brief returns up to k nearest neighbors sorted by increasing distance
+    virtual void FindNearestNodes(const vector<dReal>& q, size_t k, std::vector< std::pair<NodeBasePtr, dReal> >& vnearest) const = 0;
+
     /// \brief returns a temporary config stored on the local class. Next time this function is called, it will overwrite the config
     virtual const vector<dReal>& GetVectorConfig(NodeBasePtr node) const = 0;
 
@@ -234,11 +237,22 @@ public:
         return _FindNearestNode(vquerystate);
     }
 
+    void FindNearestNodes(const std::vector<dReal>& vquerystate, size_t k, std::vector< std::pair<NodeBasePtr, dReal> >& vnearest) const
+    {
+        _FindNearestNodes(vquerystate, k, vnearest);
+    }
+
     virtual NodeBasePtr InsertNode(NodeBasePtr parent, const vector<dReal>& config, uint32_t userdata)
     {
         return _InsertNode((NodePtr)parent, config, userdata);
     }
 
+    /// \brief removes the node from the tree and deletes it
+    bool RemoveNode(NodeBasePtr nodebase)
+    {
+        return _RemoveNode((NodePtr)nodebase);
+    }
+
     virtual void InvalidateNodesWithParent(NodeBasePtr parentbase)
     {
         //BOOST_ASSERT(Validate());
@@ -709,6 +723,67 @@ private:
         return bestnode;
     }
 
+    /// \brief same traversal as _FindNearestNode, except the children are pruned with the distance of the k-th best node
+    void _FindNearestNodes(const std::vector<dReal>& vquerystate, size_t k, std::vector< std::pair<NodeBasePtr, dReal> >& vnearest) const
+    {
+        vnearest.resize(0);
+        if( _numnodes == 0 || k == 0 ) {
+            return;
+        }
+        OPENRAVE_ASSERT_OP((int)vquerystate.size(),==,_dof);
+
+        dReal fLevelBound = _fMaxLevelBound;
+        _vCurrentLevelNodes.resize(1);
+        _vCurrentLevelNodes[0].first = *_vsetLevelNodes.at(_EncodeLevel(_maxlevel)).begin();
+        _vCurrentLevelNodes[0].second = _ComputeDistance(_vCurrentLevelNodes[0].first->q, vquerystate);
+        if( _vCurrentLevelNodes[0].first->_usenn ) {
+            _AddNearestNode(_vCurrentLevelNodes[0].first, _vCurrentLevelNodes[0].second, k, vnearest);
+        }
+        while(_vCurrentLevelNodes.size() > 0 ) {
+            _vNextLevelNodes.resize(0);
+            FOREACH(itcurrentnode, _vCurrentLevelNodes) {
+                FOREACHC(itchild, itcurrentnode->first->_vchildren) {
+                    dReal curdist = _ComputeDistance((*itchild)->q, vquerystate);
+                    if( (*itchild)->_usenn ) {
+                        _AddNearestNode(*itchild, curdist, k, vnearest);
+                    }
+                    _vNextLevelNodes.emplace_back(*itchild,  curdist);
+                }
+            }
+
+            _vCurrentLevelNodes.resize(0);
+            dReal ftestbound = vnearest.size() < k ? std::numeric_limits<dReal>::infinity() : vnearest.back().second + fLevelBound;
+            FOREACH(itnode, _vNextLevelNodes) {
+                if( itnode->second < ftestbound ) {
+                    _vCurrentLevelNodes.push_back(*itnode);
+                }
+            }
+            fLevelBound *= _fBaseInv;
+        }
+    }
+
+    /// \brief inserts node into the sorted vnearest and keeps at most k entries. The clones of a node in the lower levels are skipped.
+    inline void _AddNearestNode(NodePtr node, dReal fdist, size_t k, std::vector< std::pair<NodeBasePtr, dReal> >& vnearest) const
+    {
+        if( vnearest.size() >= k && fdist >= vnearest.back().second ) {
+            return;
+        }
+        std::vector< std::pair<NodeBasePtr, dReal> >::iterator itinsert = vnearest.begin();
+        while(itinsert != vnearest.end() && itinsert->second <= fdist ) {
+            if( itinsert->second == fdist ) {
+                NodePtr testnode = (NodePtr)itinsert->first;
+                if( testnode->_userdata == node->_userdata && testnode->rrtparent == node->rrtparent ) {
+                    return;
+                }
+            }
+            ++itinsert;
+        }
+        vnearest.insert(itinsert, std::make_pair((NodeBasePtr)node, fdist));
+        if( vnearest.size() > k ) {
+            vnearest.pop_back();
+        }
+    }
+
     NodePtr _InsertNode(NodePtr parent, const vector<dReal>& config, uint32_t userdata)
     {
         NodePtr newnode = _CreateNode(parent, config, userdata);
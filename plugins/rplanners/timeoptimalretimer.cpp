@@ -0,0 +1,701 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2016 Rosen Diankov
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU Lesser General Public License as published by the Free Software Foundation, either version 3
+// of the License, or at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+#include "openraveplugindefs.h"
+
+namespace rplanners {
+
+/** \brief time-optimal path parameterization based on reachability analysis (TOPP-RA).
+
+   The geometric path q(s) is discretized into a grid s_0 < s_1 < ... < s_N. With x = sdot^2 and u = sddot as the
+   state and control, every velocity, acceleration and torque limit becomes linear in (u,x) at a grid point:
+
+     |q'(s) u + q''(s) x| <= amax
+     q'(s)^2 x <= vmax^2
+     |A(s) u + B(s) x + C(s)| <= taumax
+
+   and x_{i+1} = x_i + 2 (s_{i+1}-s_i) u_i. A backward pass computes the controllable set K_i (the interval of x_i
+   from which the end can still be reached) and a forward pass greedily picks the largest u_i that keeps x_{i+1}
+   inside K_{i+1}. Each stage is a two-variable LP, which is solved exactly by eliminating u.
+ */
+class TimeOptimalTrajectoryRetimer : public PlannerBase
+{
+    /// \brief a*u + b*x <= c
+    struct LinearConstraint
+    {
+        LinearConstraint() : a(0), b(0), c(0) {
+        }
+        LinearConstraint(dReal a, dReal b, dReal c) : a(a), b(b), c(c) {
+        }
+        dReal a, b, c;
+    };
+
+public:
+    TimeOptimalTrajectoryRetimer(EnvironmentBasePtr penv, std::istream& sinput) : PlannerBase(penv)
+    {
+        __description = ":Interface Author: Rosen Diankov\n\nTime-optimal re-timing along the geometric path of the trajectory using reachability analysis (TOPP-RA). The path is discretized into a grid and a single backward/forward pass computes the fastest velocity profile that respects the velocity, acceleration, and (if the robot has them) torque limits.\n\nIf the incoming trajectory has timestamps, its interpolated path is retimed and the grid includes every waypoint time; with linear interpolation the robot stops at every corner. Otherwise the waypoints are connected linearly and the robot stops at every corner.\n\nIf the parameters have a step length, the velocity profile is uniformly slowed down until its duration is a multiple of it.\n\nThe output interpolation is quadratic (default) or cubic. A quadratic trajectory only stores positions and velocities, so a point is inserted in the middle of every grid interval to keep the positions continuous. A cubic trajectory interpolates the positions and velocities of the grid points directly.";
+        RegisterCommand("SetGridSize", boost::bind(&TimeOptimalTrajectoryRetimer::_SetGridSizeCommand,this,_1,_2),
+                        "sets the number of intervals the path is discretized into, default is 1000. Every waypoint interval gets at least two.");
+        _nMaxGridIntervals = 1000;
+        _fMaxPathVelocity = 1000;
+    }
+
+    virtual bool InitPlan(RobotBasePtr pbase, PlannerParametersConstPtr params)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        params->Validate();
+        _parameters.reset(new ConstraintTrajectoryTimingParameters());
+        _parameters->copy(params);
+        return _InitPlan();
+    }
+
+    virtual bool InitPlan(RobotBasePtr pbase, std::istream& isParameters)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        _parameters.reset(new ConstraintTrajectoryTimingParameters());
+        isParameters >> *_parameters;
+        _parameters->Validate();
+        return _InitPlan();
+    }
+
+    virtual bool _InitPlan()
+    {
+        int dof = _parameters->GetDOF();
+        if( (int)_parameters->_vConfigVelocityLimit.size() != dof || (int)_parameters->_vConfigAccelerationLimit.size() != dof ) {
+            return false;
+        }
+        for(int j = 0; j < dof; ++j) {
+            if( _parameters->_vConfigVelocityLimit[j] <= 0 || _parameters->_vConfigAccelerationLimit[j] <= 0 ) {
+                RAVELOG_WARN_FORMAT("env=%d, dof %d has non-positive velocity or acceleration limits", GetEnv()->GetId()%j);
+                return false;
+            }
+        }
+        _vimaxvel.resize(dof);
+        for(int j = 0; j < dof; ++j) {
+            _vimaxvel[j] = 1/_parameters->_vConfigVelocityLimit[j];
+        }
+
+        // torque limits are only used when the configuration is the joint values of a single body
+        _torquebody.reset();
+        _vtorquedofindices.resize(0);
+        _vtorquelimits.resize(0);
+        if( _parameters->_configurationspecification._vgroups.size() == 1 ) {
+            const ConfigurationSpecification::Group& g = _parameters->_configurationspecification._vgroups[0];
+            stringstream ss(g.name);
+            std::string grouptype, bodyname;
+            ss >> grouptype >> bodyname;
+            if( grouptype == "joint_values" ) {
+                KinBodyPtr pbody = GetEnv()->GetKinBody(bodyname);
+                if( !!pbody && pbody->IsRobot() ) {
+                    std::vector<int> vdofindices((std::istream_iterator<int>(ss)), std::istream_iterator<int>());
+                    std::vector<dReal> vmaxtorque;
+                    pbody->GetDOFMaxTorque(vmaxtorque);
+                    bool bhastorque = (int)vdofindices.size() == dof;
+                    for(size_t j = 0; j < vdofindices.size() && bhastorque; ++j) {
+                        bhastorque = vdofindices[j] >= 0 && vdofindices[j] < (int)vmaxtorque.size() && vmaxtorque[vdofindices[j]] > 0;
+                    }
+                    if( bhastorque ) {
+                        _torquebody = pbody;
+                        _vtorquedofindices = vdofindices;
+                        _vtorquelimits.resize(dof);
+                        for(int j = 0; j < dof; ++j) {
+                            _vtorquelimits[j] = vmaxtorque[vdofindices[j]];
+                        }
+                    }
+                }
+            }
+        }
+
+        if( _parameters->_interpolation.size() == 0 ) {
+            _parameters->_interpolation = "quadratic";
+        }
+        return _parameters->_interpolation == "quadratic" || _parameters->_interpolation == "cubic";
+    }
+
+    virtual PlannerParametersConstPtr GetParameters() const {
+        return _parameters;
+    }
+
+    virtual PlannerStatus PlanPath(TrajectoryBasePtr ptraj, int planningoptions) override
+    {
+        BOOST_ASSERT(!!_parameters && !!ptraj && ptraj->GetEnv()==GetEnv());
+        BOOST_ASSERT(_parameters->GetDOF() == _parameters->_configurationspecification.GetDOF());
+        std::vector<ConfigurationSpecification::Group>::const_iterator itoldgrouptime = ptraj->GetConfigurationSpecification().FindCompatibleGroup("deltatime",false);
+        if( _parameters->_hastimestamps && itoldgrouptime == ptraj->GetConfigurationSpecification()._vgroups.end() ) {
+            std::string description = str(boost::format("env=%d, trajectory does not have timestamps, even though parameters say timestamps are needed")%GetEnv()->GetId());
+            RAVELOG_WARN(description);
+            return OPENRAVE_PLANNER_STATUS(description, PS_Failed);
+        }
+        size_t numpoints = ptraj->GetNumWaypoints();
+        if( numpoints == 0 ) {
+            std::string description = str(boost::format("env=%d, there's nothing to retime")%GetEnv()->GetId());
+            return OPENRAVE_PLANNER_STATUS(description, PS_Failed);
+        }
+
+        uint32_t basetime = utils::GetMilliTime();
+        int dof = _parameters->GetDOF();
+        ConfigurationSpecification newspec = _parameters->_configurationspecification;
+        newspec.AddDerivativeGroups(1,false);
+        newspec.AddDeltaTimeGroup();
+        ConfigurationSpecification velspec = _parameters->_configurationspecification.ConvertToVelocitySpecification();
+        string velinterpolation = ConfigurationSpecification::GetInterpolationDerivative(_parameters->_interpolation);
+        FOREACHC(itgroup, _parameters->_configurationspecification._vgroups) {
+            std::vector<ConfigurationSpecification::Group>::const_iterator itposgroup = newspec.FindCompatibleGroup(*itgroup, true);
+            BOOST_ASSERT(itposgroup != newspec._vgroups.end());
+            std::vector<ConfigurationSpecification::Group>::const_iterator itvelgroup = newspec.FindTimeDerivativeGroup(*itposgroup);
+            newspec._vgroups.at(itposgroup-newspec._vgroups.begin()).interpolation = _parameters->_interpolation;
+            if( itvelgroup != newspec._vgroups.end() ) {
+                newspec._vgroups.at(itvelgroup-newspec._vgroups.begin()).interpolation = velinterpolation;
+            }
+        }
+        int timeoffset = newspec.FindCompatibleGroup("deltatime", true)->offset;
+
+        // discretize the path
+        std::string description;
+        if( ptraj->GetDuration() > 0 && itoldgrouptime != ptraj->GetConfigurationSpecification()._vgroups.end() ) {
+            if( !_DiscretizeTimedPath(ptraj, description) ) {
+                return OPENRAVE_PLANNER_STATUS(description, PS_Failed);
+            }
+        }
+        else if( !_DiscretizeLinearPath(ptraj, description) ) {
+            return OPENRAVE_PLANNER_STATUS(description, PS_Failed);
+        }
+
+        size_t numgrid = _vs.size();
+        if( numgrid <= 1 ) {
+            // the path has no length, so write one stationary point
+            std::vector<dReal> vnewdata(newspec.GetDOF(), 0);
+            ConfigurationSpecification::ConvertData(vnewdata.begin(), newspec, _vpos.begin(), _parameters->_configurationspecification, 1, GetEnv(), true);
+            vnewdata.at(timeoffset) = 0;
+            ptraj->Init(newspec);
+            ptraj->Insert(0,vnewdata);
+            return OPENRAVE_PLANNER_STATUS(PS_HasSolution);
+        }
+
+        if( !_ComputeStageConstraints(description) ) {
+            return OPENRAVE_PLANNER_STATUS(description, PS_Failed);
+        }
+
+        // backward pass, compute the controllable sets K_i
+        _vxmin.resize(numgrid);
+        _vxmax.resize(numgrid);
+        _vxmin[numgrid-1] = 0;
+        _vxmax[numgrid-1] = 0;
+        std::vector<LinearConstraint>& vconstraints = _vtempconstraints;
+        for(int i = (int)numgrid-2; i >= 0; --i) {
+            dReal delta2 = 2*(_vs[i+1]-_vs[i]);
+            vconstraints = _vstageconstraints[i];
+            vconstraints.push_back(LinearConstraint(delta2, 1, _vxmax[i+1]));
+            vconstraints.push_back(LinearConstraint(-delta2, -1, -_vxmin[i+1]));
+            _vxmin[i] = 0;
+            _vxmax[i] = _vpathvelocitylimit[i];
+            if( !_ProjectToStateInterval(vconstraints, _vxmin[i], _vxmax[i]) ) {
+                description = str(boost::format("env=%d, path is not controllable at grid point %d/%d (s=%.15e)")%GetEnv()->GetId()%i%numgrid%_vs[i]);
+                RAVELOG_WARN(description);
+                return OPENRAVE_PLANNER_STATUS(description, PS_Failed);
+            }
+        }
+        if( _vxmin[0] > _fTolerance ) {
+            description = str(boost::format("env=%d, cannot start the path from rest, minimum sdot^2 is %.15e")%GetEnv()->GetId()%_vxmin[0]);
+            RAVELOG_WARN(description);
+            return OPENRAVE_PLANNER_STATUS(description, PS_Failed);
+        }
+
+        // forward pass, greedily take the largest control that stays inside the next controllable set
+        _vx.resize(numgrid);
+        _vx[0] = 0;
+        for(size_t i = 0; i+1 < numgrid; ++i) {
+            dReal delta2 = 2*(_vs[i+1]-_vs[i]);
+            vconstraints = _vstageconstraints[i];
+            vconstraints.push_back(LinearConstraint(delta2, 0, _vxmax[i+1]-_vx[i]));
+            vconstraints.push_back(LinearConstraint(-delta2, 0, _vx[i]-_vxmin[i+1]));
+            dReal umin, umax;
+            _ComputeControlInterval(vconstraints, _vx[i], umin, umax);
+            if( umin > umax ) {
+                // numerical errors, the backward pass guarantees that there is a solution so stay close to the lower bound of the next set
+                RAVELOG_VERBOSE_FORMAT("env=%d, grid point %d has empty control interval [%.15e, %.15e]", GetEnv()->GetId()%i%umin%umax);
+                umax = (_vxmin[i+1]-_vx[i])/delta2;
+            }
+            _vx[i+1] = max(dReal(0), min(_vxmax[i+1], _vx[i] + delta2*umax));
+        }
+
+        // convert to the time domain
+        std::vector<dReal>& vvelocities = _vtempdata; vvelocities.resize(numgrid*dof);
+        std::vector<dReal> vdeltatimes(numgrid, 0);
+        dReal ftotaltime = 0;
+        for(size_t i = 0; i < numgrid; ++i) {
+            dReal sd = RaveSqrt(max(dReal(0),_vx[i]));
+            for(int j = 0; j < dof; ++j) {
+                vvelocities[i*dof+j] = _vvelocitybefore[i*dof+j]*sd;
+            }
+            if( i > 0 ) {
+                dReal sdsum = RaveSqrt(max(dReal(0),_vx[i-1])) + sd;
+                if( sdsum <= g_fEpsilon ) {
+                    description = str(boost::format("env=%d, path velocity is zero on interval %d/%d")%GetEnv()->GetId()%i%numgrid);
+                    RAVELOG_WARN(description);
+                    return OPENRAVE_PLANNER_STATUS(description, PS_Failed);
+                }
+                vdeltatimes[i] = 2*(_vs[i]-_vs[i-1])/sdsum;
+            }
+            ftotaltime += vdeltatimes[i];
+        }
+        if( _parameters->_fStepLength > 0 && ftotaltime > 0 ) {
+            // slowing down by k scales the velocities by 1/k and the accelerations by 1/k^2, so the limits stay satisfied
+            dReal fsteptime = ftotaltime < _parameters->_fStepLength ? _parameters->_fStepLength : std::ceil(ftotaltime/_parameters->_fStepLength-g_fEpsilonJointLimit)*_parameters->_fStepLength;
+            dReal fscale = fsteptime/ftotaltime;
+            for(size_t i = 0; i < numgrid; ++i) {
+                vdeltatimes[i] *= fscale;
+            }
+            for(size_t i = 0; i < vvelocities.size(); ++i) {
+                vvelocities[i] /= fscale;
+            }
+            ftotaltime = fsteptime;
+        }
+
+        std::vector<dReal>& vpositions = _vpos;
+        size_t numnewpoints = numgrid;
+        if( _parameters->_interpolation == "quadratic" ) {
+            _InsertMidPoints(vpositions, vvelocities, vdeltatimes);
+            numnewpoints = vdeltatimes.size();
+        }
+        std::vector<dReal> vnewdata(numnewpoints*newspec.GetDOF(), 0);
+        ConfigurationSpecification::ConvertData(vnewdata.begin(), newspec, vpositions.begin(), _parameters->_configurationspecification, numnewpoints, GetEnv(), true);
+        ConfigurationSpecification::ConvertData(vnewdata.begin(), newspec, vvelocities.begin(), velspec, numnewpoints, GetEnv(), false);
+        for(size_t i = 0; i < numnewpoints; ++i) {
+            vnewdata[i*newspec.GetDOF()+timeoffset] = vdeltatimes[i];
+        }
+
+        ptraj->Init(newspec);
+        ptraj->Insert(0,vnewdata);
+        RAVELOG_DEBUG_FORMAT("env=%d, retimed %d waypoints with %d grid points into %d points, duration=%.15e, time=%dms", GetEnv()->GetId()%numpoints%numgrid%numnewpoints%ftotaltime%(utils::GetMilliTime()-basetime));
+        return OPENRAVE_PLANNER_STATUS(PS_HasSolution);
+    }
+
+protected:
+    /// \brief inserts a point in the middle of every grid interval so that the quadratic interpolation reaches the next grid point.
+    ///
+    /// The quadratic interpolation of a trajectory only uses the velocities at both ends of an interval, so on curved paths
+    /// (v_i+v_{i+1})/2*dt differs from q_{i+1}-q_i and the position would jump at the grid points. The velocity of the
+    /// midpoint is chosen so that both halves together cover q_{i+1}-q_i exactly. It differs from (v_i+v_{i+1})/2 by a
+    /// second order term of the grid spacing, which does not accumulate along the path.
+    void _InsertMidPoints(std::vector<dReal>& vpositions, std::vector<dReal>& vvelocities, std::vector<dReal>& vdeltatimes)
+    {
+        int dof = _parameters->GetDOF();
+        size_t numgrid = vdeltatimes.size();
+        std::vector<dReal> vnewpositions, vnewvelocities, vnewdeltatimes, vdiff(dof), vprev(dof);
+        vnewpositions.reserve((2*numgrid-1)*dof);
+        vnewvelocities.reserve((2*numgrid-1)*dof);
+        vnewdeltatimes.reserve(2*numgrid-1);
+        vnewpositions.insert(vnewpositions.end(), vpositions.begin(), vpositions.begin()+dof);
+        vnewvelocities.insert(vnewvelocities.end(), vvelocities.begin(), vvelocities.begin()+dof);
+        vnewdeltatimes.push_back(vdeltatimes[0]);
+        for(size_t i = 1; i < numgrid; ++i) {
+            vdiff.assign(vpositions.begin()+i*dof, vpositions.begin()+(i+1)*dof);
+            vprev.assign(vpositions.begin()+(i-1)*dof, vpositions.begin()+i*dof);
+            _parameters->_diffstatefn(vdiff, vprev);
+            dReal deltatime = vdeltatimes[i];
+            for(int j = 0; j < dof; ++j) {
+                dReal v0 = vvelocities[(i-1)*dof+j], v1 = vvelocities[i*dof+j];
+                dReal vmid = 2*vdiff[j]/deltatime - 0.5*(v0+v1);
+                vnewpositions.push_back(vprev[j] + 0.25*(v0+vmid)*deltatime);
+                vnewvelocities.push_back(vmid);
+            }
+            vnewdeltatimes.push_back(0.5*deltatime);
+            vnewpositions.insert(vnewpositions.end(), vpositions.begin()+i*dof, vpositions.begin()+(i+1)*dof);
+            vnewvelocities.insert(vnewvelocities.end(), vvelocities.begin()+i*dof, vvelocities.begin()+(i+1)*dof);
+            vnewdeltatimes.push_back(0.5*deltatime);
+        }
+        vpositions.swap(vnewpositions);
+        vvelocities.swap(vnewvelocities);
+        vdeltatimes.swap(vnewdeltatimes);
+    }
+
+    /// \brief samples the interpolated trajectory in its original time. Every waypoint time is a grid point and the waypoint intervals are subdivided proportionally to their duration. The path derivatives are computed with finite differences inside every waypoint interval.
+    bool _DiscretizeTimedPath(TrajectoryBasePtr ptraj, std::string& description)
+    {
+        int dof = _parameters->GetDOF();
+        size_t numpoints = ptraj->GetNumWaypoints();
+        dReal fduration = ptraj->GetDuration();
+        ConfigurationSpecification timespec;
+        timespec.AddDeltaTimeGroup();
+        std::vector<dReal> vdeltatimes;
+        ptraj->GetWaypoints(0, numpoints, vdeltatimes, timespec);
+
+        // with linear interpolation q' jumps at the waypoints
+        bool bcheckcorners = false;
+        FOREACHC(itgroup, _parameters->_configurationspecification._vgroups) {
+            std::vector<ConfigurationSpecification::Group>::const_iterator ittrajgroup = ptraj->GetConfigurationSpecification().FindCompatibleGroup(*itgroup, false);
+            if( ittrajgroup != ptraj->GetConfigurationSpecification()._vgroups.end() && (ittrajgroup->interpolation.size() == 0 || ittrajgroup->interpolation == "linear") ) {
+                bcheckcorners = true;
+            }
+        }
+
+        std::vector<uint8_t> vwaypoint; ///< 1 if the grid point is at a waypoint time
+        _vs.assign(1, 0);
+        vwaypoint.assign(1, 1);
+        dReal ftime = 0;
+        for(size_t ipoint = 1; ipoint < numpoints; ++ipoint) {
+            ftime += vdeltatimes[ipoint];
+            dReal fstart = _vs.back(), finterval = ftime - fstart;
+            if( finterval <= g_fEpsilonLinear ) {
+                continue;
+            }
+            int nsteps = max(2, (int)ceil(_nMaxGridIntervals*finterval/fduration));
+            for(int istep = 1; istep <= nsteps; ++istep) {
+                _vs.push_back(istep < nsteps ? fstart + finterval*istep/nsteps : ftime);
+                vwaypoint.push_back(istep == nsteps);
+            }
+        }
+
+        size_t numgrid = _vs.size();
+        _vpos.resize(numgrid*dof);
+        std::vector<dReal> vsample;
+        for(size_t i = 0; i < numgrid; ++i) {
+            ptraj->Sample(vsample, _vs[i], _parameters->_configurationspecification, true);
+            std::copy(vsample.begin(), vsample.end(), _vpos.begin()+i*dof);
+        }
+        if( !_ClampToLimits(description) ) {
+            return false;
+        }
+        if( numgrid <= 1 ) {
+            return true;
+        }
+
+        // differences between neighboring points, respecting circular joints
+        size_t numintervals = numgrid-1;
+        std::vector<dReal> vdiff(numintervals*dof), vtemp, vprev;
+        for(size_t i = 0; i < numintervals; ++i) {
+            vtemp.assign(_vpos.begin()+(i+1)*dof, _vpos.begin()+(i+2)*dof);
+            vprev.assign(_vpos.begin()+i*dof, _vpos.begin()+(i+1)*dof);
+            _parameters->_diffstatefn(vtemp, vprev);
+            std::copy(vtemp.begin(), vtemp.end(), vdiff.begin()+i*dof);
+        }
+
+        _vvelocitybefore.resize(numgrid*dof);
+        _vvelocity.resize(numgrid*dof);
+        _vcurvature.resize(numgrid*dof);
+        std::vector<uint8_t> vstopped(numgrid, 0);
+        for(size_t i = 0; i < numgrid; ++i) {
+            dReal hprev = i > 0 ? _vs[i]-_vs[i-1] : 0;
+            dReal hnext = i < numintervals ? _vs[i+1]-_vs[i] : 0;
+            bool bcorner = bcheckcorners && vwaypoint[i] && i > 0 && i < numintervals;
+            // the stage constraints of a point hold for the interval after it, so take q'' from three points of the same waypoint interval. every waypoint interval has at least two grid intervals
+            size_t k = i == numintervals ? i-1 : (vwaypoint[i] ? i+1 : i);
+            dReal h1 = _vs[k]-_vs[k-1], h2 = _vs[k+1]-_vs[k];
+            for(int j = 0; j < dof; ++j) {
+                dReal velprev = i > 0 ? vdiff[(i-1)*dof+j]/hprev : 0;
+                dReal velnext = i < numintervals ? vdiff[i*dof+j]/hnext : 0;
+                if( i == 0 ) {
+                    _vvelocitybefore[i*dof+j] = _vvelocity[i*dof+j] = velnext;
+                }
+                else if( i == numintervals ) {
+                    _vvelocitybefore[i*dof+j] = _vvelocity[i*dof+j] = velprev;
+                }
+                else if( bcorner ) {
+                    _vvelocitybefore[i*dof+j] = velprev;
+                    _vvelocity[i*dof+j] = velnext;
+                    if( RaveFabs(velnext-velprev) > g_fEpsilonLinear*max(dReal(1), max(RaveFabs(velnext), RaveFabs(velprev))) ) {
+                        vstopped[i] = 1;
+                    }
+                }
+                else {
+                    _vvelocitybefore[i*dof+j] = _vvelocity[i*dof+j] = (vdiff[(i-1)*dof+j]+vdiff[i*dof+j])/(hprev+hnext);
+                }
+                _vcurvature[i*dof+j] = 2*(vdiff[k*dof+j]/h2 - vdiff[(k-1)*dof+j]/h1)/(h1+h2);
+            }
+        }
+        _ComputePathVelocityLimits(vstopped);
+        return true;
+    }
+
+    /// \brief connects the waypoints with straight lines parameterized by the time they take at maximum velocity. The robot has to stop at every corner.
+    bool _DiscretizeLinearPath(TrajectoryBasePtr ptraj, std::string& description)
+    {
+        int dof = _parameters->GetDOF();
+        size_t numpoints = ptraj->GetNumWaypoints();
+        std::vector<dReal> vwaypoints;
+        ptraj->GetWaypoints(0, numpoints, vwaypoints, _parameters->_configurationspecification);
+
+        // remove duplicate points and compute the segment directions
+        std::vector<dReal> vpoints(vwaypoints.begin(), vwaypoints.begin()+dof), vdirs, vlengths, vdiff, vprev;
+        for(size_t ipoint = 1; ipoint < numpoints; ++ipoint) {
+            vdiff.assign(vwaypoints.begin()+ipoint*dof, vwaypoints.begin()+(ipoint+1)*dof);
+            vprev.assign(vpoints.end()-dof, vpoints.end());
+            _parameters->_diffstatefn(vdiff, vprev);
+            dReal flength = 0;
+            for(int j = 0; j < dof; ++j) {
+                flength = max(flength, RaveFabs(vdiff[j])*_vimaxvel[j]);
+            }
+            if( flength <= g_fEpsilonLinear ) {
+                continue;
+            }
+            vpoints.insert(vpoints.end(), vwaypoints.begin()+ipoint*dof, vwaypoints.begin()+(ipoint+1)*dof);
+            for(int j = 0; j < dof; ++j) {
+                vdirs.push_back(vdiff[j]/flength);
+            }
+            vlengths.push_back(flength);
+        }
+
+        size_t numsegments = vlengths.size();
+        if( numsegments == 0 ) {
+            _vs.assign(1, 0);
+            _vpos.assign(vpoints.begin(), vpoints.begin()+dof);
+            return _ClampToLimits(description);
+        }
+
+        // distribute the grid proportionally to the segment lengths
+        dReal ftotallength = 0;
+        for(size_t iseg = 0; iseg < numsegments; ++iseg) {
+            ftotallength += vlengths[iseg];
+        }
+        size_t numintervals = max(size_t(100), min(size_t(_nMaxGridIntervals), 20*numsegments));
+        _vs.resize(0);
+        _vpos.resize(0);
+        _vvelocity.resize(0);
+        _vvelocitybefore.resize(0);
+        std::vector<uint8_t> vstopped;
+        dReal s = 0;
+        for(size_t iseg = 0; iseg < numsegments; ++iseg) {
+            int nsteps = max(2, (int)ceil(numintervals*vlengths[iseg]/ftotallength));
+            std::vector<dReal>::const_iterator itdir = vdirs.begin()+iseg*dof;
+            // must stop at the start of a segment if the direction changes
+            bool bstop = true;
+            if( iseg > 0 ) {
+                bstop = false;
+                std::vector<dReal>::const_iterator itprevdir = vdirs.begin()+(iseg-1)*dof;
+                for(int j = 0; j < dof; ++j) {
+                    if( RaveFabs(*(itdir+j) - *(itprevdir+j)) > g_fEpsilonLinear ) {
+                        bstop = true;
+                        break;
+                    }
+                }
+            }
+            for(int istep = 0; istep < nsteps; ++istep) {
+                dReal frac = dReal(istep)/dReal(nsteps);
+                _vs.push_back(s + frac*vlengths[iseg]);
+                for(int j = 0; j < dof; ++j) {
+                    _vpos.push_back(vpoints[iseg*dof+j] + frac*vlengths[iseg]*(*(itdir+j)));
+                    _vvelocity.push_back(*(itdir+j));
+                    _vvelocitybefore.push_back(istep == 0 && iseg > 0 ? *(itdir-dof+j) : *(itdir+j));
+                }
+                vstopped.push_back(istep == 0 && bstop);
+            }
+            s += vlengths[iseg];
+        }
+        _vs.push_back(s);
+        _vpos.insert(_vpos.end(), vpoints.end()-dof, vpoints.end());
+        _vvelocity.insert(_vvelocity.end(), vdirs.end()-dof, vdirs.end());
+        _vvelocitybefore.insert(_vvelocitybefore.end(), vdirs.end()-dof, vdirs.end());
+        vstopped.push_back(1);
+        _vcurvature.resize(_vvelocity.size());
+        std::fill(_vcurvature.begin(), _vcurvature.end(), 0);
+        if( !_ClampToLimits(description) ) {
+            return false;
+        }
+        _ComputePathVelocityLimits(vstopped);
+        return true;
+    }
+
+    /// \brief clamps the grid positions that are numerically outside the limits
+    bool _ClampToLimits(std::string& description)
+    {
+        int dof = _parameters->GetDOF();
+        for(size_t i = 0; i < _vpos.size(); i += dof) {
+            for(int j = 0; j < dof; ++j) {
+                dReal lower = _parameters->_vConfigLowerLimit.at(j), upper = _parameters->_vConfigUpperLimit.at(j);
+                if( _vpos[i+j] < lower ) {
+                    if( _vpos[i+j] < lower-g_fEpsilonJointLimit ) {
+                        description = str(boost::format("env=%d, lower limit for grid point %d dof %d is not followed (%.15e < %.15e)")%GetEnv()->GetId()%(i/dof)%j%_vpos[i+j]%lower);
+                        RAVELOG_WARN(description);
+                        return false;
+                    }
+                    _vpos[i+j] = lower;
+                }
+                else if( _vpos[i+j] > upper ) {
+                    if( _vpos[i+j] > upper+g_fEpsilonJointLimit ) {
+                        description = str(boost::format("env=%d, upper limit for grid point %d dof %d is not followed (%.15e > %.15e)")%GetEnv()->GetId()%(i/dof)%j%_vpos[i+j]%upper);
+                        RAVELOG_WARN(description);
+                        return false;
+                    }
+                    _vpos[i+j] = upper;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// \brief computes the upper bound on sdot^2 from the velocity limits at every grid point. vstopped marks points where the path has to stop
+    void _ComputePathVelocityLimits(const std::vector<uint8_t>& vstopped)
+    {
+        int dof = _parameters->GetDOF();
+        size_t numgrid = _vs.size();
+        _vpathvelocitylimit.resize(numgrid);
+        for(size_t i = 0; i < numgrid; ++i) {
+            dReal sdmax = _fMaxPathVelocity;
+            for(int j = 0; j < dof; ++j) {
+                dReal fvel = max(RaveFabs(_vvelocity[i*dof+j]), RaveFabs(_vvelocitybefore[i*dof+j]));
+                if( fvel*sdmax > _parameters->_vConfigVelocityLimit[j] ) {
+                    sdmax = _parameters->_vConfigVelocityLimit[j]/fvel;
+                }
+            }
+            _vpathvelocitylimit[i] = i < vstopped.size() && vstopped[i] ? 0 : sdmax*sdmax;
+        }
+    }
+
+    /// \brief fills the (u,x) constraints of the acceleration and torque limits for every grid interval
+    bool _ComputeStageConstraints(std::string& description)
+    {
+        int dof = _parameters->GetDOF();
+        size_t numgrid = _vs.size();
+        _vstageconstraints.resize(numgrid);
+        for(size_t i = 0; i < numgrid; ++i) {
+            std::vector<LinearConstraint>& vconstraints = _vstageconstraints[i];
+            vconstraints.resize(0);
+            for(int j = 0; j < dof; ++j) {
+                dReal a = _vvelocity[i*dof+j], b = _vcurvature[i*dof+j], amax = _parameters->_vConfigAccelerationLimit[j];
+                vconstraints.push_back(LinearConstraint(a, b, amax));
+                vconstraints.push_back(LinearConstraint(-a, -b, amax));
+            }
+        }
+
+        if( !!_torquebody ) {
+            // tau = M(q) q' u + (M(q) q'' + C(q,q')) x + g(q)
+            KinBody::KinBodyStateSaver saver(_torquebody, KinBody::Save_LinkTransformation|KinBody::Save_LinkVelocities);
+            std::vector<dReal> vvalues(dof), vvelocities(dof), vaccelerations(_torquebody->GetDOF(), 0);
+            boost::array< std::vector<dReal>, 3> vcurvaturecomponents, vvelocitycomponents;
+            std::vector<dReal> vzero(_torquebody->GetDOF(), 0);
+            _torquebody->SetDOFVelocities(vzero, KinBody::CLA_Nothing);
+            for(size_t i = 0; i < numgrid; ++i) {
+                std::copy(_vpos.begin()+i*dof, _vpos.begin()+(i+1)*dof, vvalues.begin());
+                std::copy(_vvelocity.begin()+i*dof, _vvelocity.begin()+(i+1)*dof, vvelocities.begin());
+                _torquebody->SetDOFValues(vvalues, KinBody::CLA_Nothing, _vtorquedofindices);
+                _torquebody->SetDOFVelocities(vvelocities, KinBody::CLA_Nothing, _vtorquedofindices);
+                for(int j = 0; j < dof; ++j) {
+                    vaccelerations.at(_vtorquedofindices[j]) = _vcurvature[i*dof+j];
+                }
+                _torquebody->ComputeInverseDynamics(vcurvaturecomponents, vaccelerations);
+                for(int j = 0; j < dof; ++j) {
+                    vaccelerations.at(_vtorquedofindices[j]) = _vvelocity[i*dof+j];
+                }
+                _torquebody->ComputeInverseDynamics(vvelocitycomponents, vaccelerations);
+                std::vector<LinearConstraint>& vconstraints = _vstageconstraints[i];
+                for(int j = 0; j < dof; ++j) {
+                    int index = _vtorquedofindices[j];
+                    dReal a = vvelocitycomponents[0].at(index);
+                    dReal b = vcurvaturecomponents[0].at(index) + vcurvaturecomponents[1].at(index);
+                    dReal c = vcurvaturecomponents[2].at(index);
+                    vconstraints.push_back(LinearConstraint(a, b, _vtorquelimits[j]-c));
+                    vconstraints.push_back(LinearConstraint(-a, -b, _vtorquelimits[j]+c));
+                }
+            }
+        }
+        return true;
+    }
+
+    /// \brief eliminates u from the constraints and intersects the resulting interval of x with [xmin, xmax]
+    ///
+    /// Every pair of a lower and an upper bound on u gives one linear constraint on x, so no division by small coefficients is necessary.
+    bool _ProjectToStateInterval(const std::vector<LinearConstraint>& vconstraints, dReal& xmin, dReal& xmax) const
+    {
+        for(size_t i = 0; i < vconstraints.size(); ++i) {
+            const LinearConstraint& ci = vconstraints[i];
+            if( ci.a == 0 ) {
+                _IntersectStateInterval(ci.b, ci.c, xmin, xmax);
+            }
+            else if( ci.a < 0 ) {
+                for(size_t k = 0; k < vconstraints.size(); ++k) {
+                    const LinearConstraint& ck = vconstraints[k];
+                    if( ck.a > 0 ) {
+                        // (c_i - b_i x)/a_i <= u <= (c_k - b_k x)/a_k
+                        _IntersectStateInterval(ck.a*ci.b - ci.a*ck.b, ck.a*ci.c - ci.a*ck.c, xmin, xmax);
+                    }
+                }
+            }
+        }
+        if( xmin > xmax ) {
+            if( xmin > xmax + _fTolerance*max(dReal(1),RaveFabs(xmax)) ) {
+                return false;
+            }
+            xmin = xmax;
+        }
+        return true;
+    }
+
+    /// \brief intersects [xmin, xmax] with b*x <= c
+    inline void _IntersectStateInterval(dReal b, dReal c, dReal& xmin, dReal& xmax) const
+    {
+        if( b > 0 ) {
+            xmax = min(xmax, c/b);
+        }
+        else if( b < 0 ) {
+            xmin = max(xmin, c/b);
+        }
+        else if( c < -_fTolerance ) {
+            xmin = 1;
+            xmax = 0;
+        }
+    }
+
+    /// \brief computes the interval of u that satisfies all constraints for a fixed x
+    void _ComputeControlInterval(const std::vector<LinearConstraint>& vconstraints, dReal x, dReal& umin, dReal& umax) const
+    {
+        umin = -std::numeric_limits<dReal>::infinity();
+        umax = std::numeric_limits<dReal>::infinity();
+        FOREACHC(itconstraint, vconstraints) {
+            if( itconstraint->a > 0 ) {
+                umax = min(umax, (itconstraint->c - itconstraint->b*x)/itconstraint->a);
+            }
+            else if( itconstraint->a < 0 ) {
+                umin = max(umin, (itconstraint->c - itconstraint->b*x)/itconstraint->a);
+            }
+        }
+    }
+
+    bool _SetGridSizeCommand(std::ostream& sout, std::istream& sinput)
+    {
+        int ngridintervals = 0;
+        sinput >> ngridintervals;
+        if( !sinput || ngridintervals <= 0 ) {
+            return false;
+        }
+        _nMaxGridIntervals = ngridintervals;
+        return true;
+    }
+
+    ConstraintTrajectoryTimingParametersPtr _parameters;
+    int _nMaxGridIntervals; ///< number of intervals the path is discretized into, each segment gets at least two
+    dReal _fMaxPathVelocity; ///< bound on sdot for the parts of the path where no dof moves
+    static const dReal _fTolerance;
+
+    KinBodyPtr _torquebody; ///< if set, body whose torque limits are enforced
+    std::vector<int> _vtorquedofindices;
+    std::vector<dReal> _vtorquelimits;
+
+    std::vector<dReal> _vimaxvel;
+    std::vector<dReal> _vs; ///< path parameter at the grid points
+    std::vector<dReal> _vpos, _vvelocity, _vvelocitybefore, _vcurvature; ///< q(s), q'(s) for the interval after and before the point, q''(s) at every grid point
+    std::vector<dReal> _vpathvelocitylimit; ///< upper bound on sdot^2
+    std::vector< std::vector<LinearConstraint> > _vstageconstraints;
+    std::vector<LinearConstraint> _vtempconstraints;
+    std::vector<dReal> _vtempdata;
+    std::vector<dReal> _vxmin, _vxmax; ///< controllable sets
+    std::vector<dReal> _vx; ///< sdot^2 along the grid
+};
+
+const dReal TimeOptimalTrajectoryRetimer::_fTolerance = 1e-8;
+
+PlannerBasePtr CreateTimeOptimalTrajectoryRetimer(EnvironmentBasePtr penv, std::istream& sinput) {
+    return PlannerBasePtr(new TimeOptimalTrajectoryRetimer(penv, sinput));
+}
+
+} // end namespace rplanners
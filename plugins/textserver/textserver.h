@@ -56,6 +56,8 @@ public:
         Socket() {
             bInit = false;
             client_sockfd = 0;
+            _nPendingWorkers = 0;
+            _bBinaryFraming = false;
         }
         ~Socket() {
             if( bInit )
@@ -170,71 +172,106 @@ public:
         }
 
 
-        bool ReadLine(string& s)
+        /// \brief reads the next request, either a text line or a binary frame depending on the framing of the connection
+        ///
+        /// Data is read from the socket in blocks, so requests pipelined by the client are returned without waiting for the socket again.
+        /// \param timeoutus time to wait for data if no full request is buffered
+        /// \return true if a request was read
+        bool ReadRequest(string& s, int timeoutus)
         {
-            struct timeval tv;
-            fd_set readfds, exfds;
             s.resize(0);
+            while(1) {
+                if( _bBinaryFraming ) {
+                    // protocol: 4 byte size in network byte order followed by the request data
+                    if( _readbuffer.size() >= 4 ) {
+                        uint32_t size = 0;
+                        memcpy(&size, _readbuffer.c_str(), 4);
+                        size = ntohl(size);
+                        if( size > s_nMaxRequestSize ) {
+                            RAVELOG_ERROR("request of %u bytes exceeds the maximum of %u bytes, closing connection\n", size, s_nMaxRequestSize);
+                            _readbuffer.clear();
+                            Close();
+                            return false;
+                        }
+                        if( _readbuffer.size() >= 4+(size_t)size ) {
+                            s = _readbuffer.substr(4, size);
+                            _readbuffer.erase(0, 4+size);
+                            return true;
+                        }
+                    }
+                }
+                else {
+                    size_t pos = _readbuffer.find_first_of("\n\r");
+                    if( pos != string::npos ) {
+                        s = _readbuffer.substr(0, pos);
+                        _readbuffer.erase(0, pos+1);
+                        return true;
+                    }
+                }
+                if( !_FillBuffer(timeoutus) ) {
+                    return false;
+                }
+            }
+        }
 
-            tv.tv_sec = 0;
-            tv.tv_usec = 0;
-
+        /// \brief if true, requests are a 4 byte size in network byte order followed by the data, otherwise they are separated by newlines. Responses are always sized.
+        void SetBinaryFraming(bool bBinaryFraming) {
+            _bBinaryFraming = bBinaryFraming;
+        }
 
-            FD_ZERO(&exfds);
-            FD_SET(client_sockfd, &exfds);
+        /// \brief number of worker functions scheduled from this connection that have not been processed yet, protected by SimpleTextServer::_mutexWorker
+        int& GetNumPendingWorkers() {
+            return _nPendingWorkers;
+        }
 
-            // don't care about writefds and exceptfds:
-            int num = select(client_sockfd+1, NULL, NULL, &exfds, &tv);
+        static const uint32_t s_nMaxRequestSize = 64*1024*1024; ///< maximum size of a binary framed request, larger requests close the connection
 
-            if (( num > 0) && FD_ISSET(client_sockfd, &exfds) ) {
-                RAVELOG_ERROR("socket exception detected\n");
-                Close();
+private:
+        /// \brief waits for data on the socket and appends it to _readbuffer
+        bool _FillBuffer(int timeoutus)
+        {
+            if( client_sockfd == 0 ) {
                 return false;
             }
+            struct timeval tv;
+            fd_set readfds, exfds;
+            tv.tv_sec = timeoutus/1000000;
+            tv.tv_usec = timeoutus%1000000;
 
             FD_ZERO(&readfds);
+            FD_ZERO(&exfds);
             FD_SET(client_sockfd, &readfds);
-
-            // don't care about writefds and exceptfds:
-            num = select(client_sockfd+1, &readfds, NULL, NULL, &tv);
-
-            if (( num == 0) || !FD_ISSET(client_sockfd, &readfds) ) {
+            FD_SET(client_sockfd, &exfds);
+            int num = select(client_sockfd+1, &readfds, NULL, &exfds, &tv);
+            if( num <= 0 ) {
                 return false;
             }
-
-            // protocol: size1 size2 "size1 bytes" "size2 bytes"
-            long nBytesReceived;
-            char c;
-            int failed = 0;
-
-            while(1) {
-                if( (nBytesReceived = recv(client_sockfd, &c, sizeof(char), 0)) > 0 ) {
-                    if(( c == '\n') ||( c == '\r') ) {
-                        break;
-                    }
-                    s.push_back(c);
-                }
-                else if( nBytesReceived == 0 ) {
-                    //RAVELOG_DEBUG("closing connection\n");
-                    //  Close();
-                    return false;
-                }
-                else {
-                    if( failed < 10 ) {
-                        failed++;
-                        usleep(1000);
-                        continue;
-                    }
-                    perror("failed to read line");
-                    Close();
-                    return false;
-                }
+            if( FD_ISSET(client_sockfd, &exfds) ) {
+                RAVELOG_ERROR("socket exception detected\n");
+                Close();
+                return false;
             }
 
+            char buf[4096];
+            long nBytesReceived = recv(client_sockfd, buf, sizeof(buf), 0);
+            if( nBytesReceived == 0 ) {
+                RAVELOG_VERBOSE("connection closed by client\n");
+                Close();
+                return false;
+            }
+            else if( nBytesReceived < 0 ) {
+                perror("failed to read request");
+                Close();
+                return false;
+            }
+            _readbuffer.append(buf, nBytesReceived);
             return true;
         }
 
-private:
+        string _readbuffer; ///< data received but not returned by ReadRequest yet
+        int _nPendingWorkers; ///< protected by SimpleTextServer::_mutexWorker
+        bool _bBinaryFraming;
+
         int client_sockfd;
         int client_len;
 
@@ -254,14 +291,15 @@ private:
     /// and one that is executed on the main worker thread to avoid multithreading data synchronization issues
     struct RAVENETWORKFN
     {
-        RAVENETWORKFN() : bReturnResult(false) {
+        RAVENETWORKFN() : bReturnResult(false), bReadOnly(false) {
         }
-        RAVENETWORKFN(const OpenRaveNetworkFn& socket, const OpenRaveWorkerFn& worker, bool bReturnResult) : fnSocketThread(socket), fnWorker(worker), bReturnResult(bReturnResult) {
+        RAVENETWORKFN(const OpenRaveNetworkFn& socket, const OpenRaveWorkerFn& worker, bool bReturnResult, bool bReadOnly=false) : fnSocketThread(socket), fnWorker(worker), bReturnResult(bReturnResult), bReadOnly(bReadOnly) {
         }
 
         OpenRaveNetworkFn fnSocketThread;
         OpenRaveWorkerFn fnWorker;
         bool bReturnResult;     // if true, function is expected to return a result
+        bool bReadOnly; // if true, fnSocketThread only reads the environment and waits only for the worker functions scheduled by its own connection instead of all of them
     };
 
 public:
@@ -272,11 +310,11 @@ public:
         bDestroying = false;
         __description=":Interface Author: Rosen Diankov\n\nSimple text-based server using sockets.";
         mapNetworkFns["body_checkcollision"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orEnvCheckCollision, this, _1, _2, _3), OpenRaveWorkerFn(), true);
-        mapNetworkFns["body_getjoints"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orBodyGetJointValues, this,_1, _2, _3), OpenRaveWorkerFn(), true);
+        mapNetworkFns["body_getjoints"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orBodyGetJointValues, this,_1, _2, _3), OpenRaveWorkerFn(), true, true);
         mapNetworkFns["body_destroy"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orBodyDestroy,this,_1,_2,_3), OpenRaveWorkerFn(), false);
         mapNetworkFns["body_enable"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orBodyEnable,this,_1,_2,_3), OpenRaveWorkerFn(), false);
         mapNetworkFns["body_getaabb"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orBodyGetAABB,this,_1,_2,_3), OpenRaveWorkerFn(), true);
-        mapNetworkFns["body_getaabbs"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orBodyGetAABBs,this,_1,_2,_3), OpenRaveWorkerFn(), true);
+        mapNetworkFns["body_getaabbs"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orBodyGetAABBs,this,_1,_2,_3), OpenRaveWorkerFn(), true, true);
         mapNetworkFns["body_getlinks"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orBodyGetLinks,this,_1,_2,_3),OpenRaveWorkerFn(), true);
         mapNetworkFns["body_getdof"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orBodyGetDOF,this,_1,_2,_3),OpenRaveWorkerFn(), true);
         mapNetworkFns["body_settransform"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orKinBodySetTransform,this,_1,_2,_3),OpenRaveWorkerFn(), false);
@@ -287,11 +325,11 @@ public:
         mapNetworkFns["createbody"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orEnvCreateKinBody,this,_1,_2,_3), OpenRaveWorkerFn(), true);
         mapNetworkFns["createmodule"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orEnvCreateModule,this,_1,_2,_3), boost::bind(&SimpleTextServer::worEnvCreateModule,this,_1,_2), true);
         mapNetworkFns["env_dstrprob"] = RAVENETWORKFN(OpenRaveNetworkFn(), boost::bind(&SimpleTextServer::worEnvDestroyProblem,this,_1,_2), false);
-        mapNetworkFns["env_getbodies"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orEnvGetBodies,this,_1,_2,_3), OpenRaveWorkerFn(), true);
+        mapNetworkFns["env_getbodies"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orEnvGetBodies,this,_1,_2,_3), OpenRaveWorkerFn(), true, true);
         mapNetworkFns["env_getrobots"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orEnvGetRobots,this,_1,_2,_3), OpenRaveWorkerFn(), true);
         mapNetworkFns["env_getbody"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orEnvGetBody,this,_1,_2,_3), OpenRaveWorkerFn(), true);
         mapNetworkFns["env_loadplugin"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orEnvLoadPlugin,this,_1,_2,_3), OpenRaveWorkerFn(), true);
-        mapNetworkFns["env_raycollision"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orEnvRayCollision,this,_1,_2,_3), OpenRaveWorkerFn(), true);
+        mapNetworkFns["env_raycollision"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orEnvRayCollision,this,_1,_2,_3), OpenRaveWorkerFn(), true, true);
         mapNetworkFns["env_stepsimulation"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orEnvStepSimulation,this,_1,_2,_3), boost::bind(&SimpleTextServer::worEnvStepSimulation,this,_1,_2), false);
         mapNetworkFns["env_triangulate"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orEnvTriangulate,this,_1,_2,_3), OpenRaveWorkerFn(), true);
         mapNetworkFns["loadscene"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orEnvLoadScene,this,_1,_2,_3), OpenRaveWorkerFn(), true);
@@ -422,8 +460,13 @@ public:
         }
 
         if( bInitThread ) {
-            bCloseThread = true;
-            _condWorker.notify_all();
+            {
+                // set under the lock so that the threads waiting on the conditions cannot miss it
+                boost::mutex::scoped_lock lock(_mutexWorker);
+                bCloseThread = true;
+                _condWorker.notify_all();
+                _condHasWork.notify_all();
+            }
             if( !!_servthread ) {
                 _servthread->join();
             }
@@ -440,7 +483,10 @@ public:
             }
             _workerthread.reset();
 
-            bCloseThread = false;
+            {
+                boost::mutex::scoped_lock lock(_mutexWorker);
+                bCloseThread = false;
+            }
             bInitThread = false;
 
             CLOSESOCKET(server_sockfd); server_sockfd = 0;
@@ -451,11 +497,14 @@ public:
 
     virtual void Reset()
     {
+        list<boost::function<void()> > listlocalworkers;
         {
             boost::mutex::scoped_lock lock(_mutexWorker);
-            listWorkers.clear();
+            // destroying the workers releases their pending connection handles, which lock _mutexWorker
+            listlocalworkers.swap(listWorkers);
             _mapFigureIds.clear();
         }
+        listlocalworkers.clear();
 
         // wait for worker thread to stop
         while(_bWorking) {
@@ -488,6 +537,37 @@ private:
         }
     }
 
+    /// \brief called from the socket threads to wait until the worker functions scheduled from the connection are processed
+    void _SyncWithConnectionWorkers(SocketPtr psocket)
+    {
+        boost::mutex::scoped_lock lock(_mutexWorker);
+        while(psocket->GetNumPendingWorkers() > 0 && !bCloseThread) {
+            _condHasWork.notify_all();
+            _condWorker.wait(lock);
+        }
+    }
+
+    /// \brief returns a handle that marks the connection as having work scheduled on the worker thread until it is destroyed.
+    ///
+    /// The handle must not be destroyed while _mutexWorker is locked.
+    boost::shared_ptr<void> _AddPendingWorker(SocketPtr psocket)
+    {
+        boost::mutex::scoped_lock lock(_mutexWorker);
+        psocket->GetNumPendingWorkers()++;
+        return boost::shared_ptr<void>(static_cast<void*>(NULL), boost::bind(&SimpleTextServer::_ReleasePendingWorker, boost::weak_ptr<SimpleTextServer>(shared_server()), psocket));
+    }
+
+    static void _ReleasePendingWorker(boost::weak_ptr<SimpleTextServer> pweakserver, SocketPtr psocket)
+    {
+        boost::shared_ptr<SimpleTextServer> pserver = pweakserver.lock();
+        if( !pserver ) {
+            return;
+        }
+        boost::mutex::scoped_lock lock(pserver->_mutexWorker);
+        psocket->GetNumPendingWorkers()--;
+        pserver->_condWorker.notify_all();
+    }
+
     void ScheduleWorker(const boost::function<void()>& fn)
     {
         boost::mutex::scoped_lock lock(_mutexWorker);
@@ -501,14 +581,13 @@ private:
         while(!bCloseThread) {
             {
                 boost::mutex::scoped_lock lock(_mutexWorker);
-                _condHasWork.wait(lock);
+                // check the predicate since notifications sent while the workers were running are not queued
+                while( listWorkers.size() == 0 && !bCloseThread ) {
+                    _condHasWork.wait(lock);
+                }
                 if( bCloseThread ) {
                     break;
                 }
-                if( listWorkers.size() == 0 ) {
-                    _condWorker.notify_all();
-                    continue;
-                }
 
                 *(volatile bool*)&_bWorking = true;
                 listlocalworkers.swap(listWorkers);
@@ -528,11 +607,20 @@ private:
             }
             listlocalworkers.clear();
 
-            *(volatile bool*)&_bWorking = false;
-            _condWorker.notify_all();
+            {
+                boost::mutex::scoped_lock lock(_mutexWorker);
+                *(volatile bool*)&_bWorking = false;
+                _condWorker.notify_all();
+            }
         }
     }
 
+    /// \param ppending keeps the connection marked as having pending work until the worker function is processed or discarded
+    static void _CallConnectionWorker(const OpenRaveWorkerFn& fnWorker, boost::shared_ptr<istream> is, boost::shared_ptr<void> pdata, boost::shared_ptr<void> ppending)
+    {
+        fnWorker(is, pdata);
+    }
+
     void _listen_threadcb()
     {
         SocketPtr psocket(new Socket());
@@ -559,7 +647,8 @@ private:
         string cmd, line;
         stringstream sout;
         while(!bCloseThread) {
-            if( psocket->ReadLine(line) && line.length() ) {
+            // wait on the socket with a timeout so that bCloseThread is checked periodically
+            if( psocket->ReadRequest(line, 100000) && line.length() ) {
 
                 if( !!flog &&( GetEnv()->GetDebugLevel()>0) ) {
                     static int index=0;
@@ -576,6 +665,23 @@ private:
                 std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::tolower);
                 stringstream::streampos inputpos = is->tellg();
 
+                if( cmd == "framing" ) {
+                    // framing binary|text - sets how the following requests of this connection are delimited
+                    string framing;
+                    *is >> framing;
+                    std::transform(framing.begin(), framing.end(), framing.begin(), ::tolower);
+                    if( framing == "binary" ) {
+                        psocket->SetBinaryFraming(true);
+                    }
+                    else if( framing == "text" ) {
+                        psocket->SetBinaryFraming(false);
+                    }
+                    else {
+                        RAVELOG_ERROR("unknown framing: %s\n", framing.c_str());
+                    }
+                    continue;
+                }
+
                 map<string, RAVENETWORKFN>::iterator itfn = mapNetworkFns.find(cmd);
                 if( itfn != mapNetworkFns.end() ) {
                     bool bCallWorker = true;
@@ -584,6 +690,9 @@ private:
                     // need to set w.args before pcmdend is modified
                     sout.str(""); sout.clear();
                     if( !!itfn->second.fnSocketThread ) {
+                        if( itfn->second.bReadOnly ) {
+                            _SyncWithConnectionWorkers(psocket);
+                        }
                         bool bSuccess = false;
                         try {
                             bSuccess = itfn->second.fnSocketThread(*is, sout, pdata);
@@ -624,7 +733,7 @@ private:
                         BOOST_ASSERT(!!itfn->second.fnWorker);
                         is->clear();
                         is->seekg(inputpos);
-                        ScheduleWorker(boost::bind(itfn->second.fnWorker,is,pdata));
+                        ScheduleWorker(boost::bind(&SimpleTextServer::_CallConnectionWorker,itfn->second.fnWorker,is,pdata,_AddPendingWorker(psocket)));
                     }
                 }
                 else {
@@ -635,7 +744,6 @@ private:
             else if( !psocket->IsInit() ) {
                 break;
             }
-            usleep(1000);
         }
 
         RAVELOG_VERBOSE("Closing socket connection\n");
@@ -1017,7 +1125,6 @@ protected:
 
     bool orEnvGetBodies(istream& is, ostream& os, boost::shared_ptr<void>& pdata)
     {
-        _SyncWithWorkerThread();
         EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
 
         vector<KinBodyPtr> vbodies;
@@ -1570,7 +1677,6 @@ protected:
     /// values = orBodyGetLinks(body) - returns the dof values of a kinbody
     bool orBodyGetAABBs(istream& is, ostream& os, boost::shared_ptr<void>& pdata)
     {
-        _SyncWithWorkerThread();
         EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
         KinBodyPtr pbody = orMacroGetBody(is);
         if( !pbody ) {
@@ -1600,7 +1706,6 @@ protected:
     /// values = orBodyGetDOFValues(body, indices) - returns the dof values of a kinbody
     bool orBodyGetJointValues(istream& is, ostream& os, boost::shared_ptr<void>& pdata)
     {
-        _SyncWithWorkerThread();
         EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
         KinBodyPtr pbody = orMacroGetBody(is);
         if( !pbody ) {
@@ -2103,7 +2208,6 @@ protected:
     /// info is a Nx6 vector where the first 3 columns are position and last 3 are normals
     bool orEnvRayCollision(istream& is, ostream& os, boost::shared_ptr<void>& pdata)
     {
-        _SyncWithWorkerThread();
         EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
         KinBodyPtr pbody = orMacroGetBody(is);
 
@@ -66,6 +66,7 @@
 
 #include <complex>
 #include <algorithm>
+#include <type_traits>
 // openrave
 #include <openrave/config.h>
 #include <openrave/logging.h>
@@ -257,12 +258,52 @@ inline std::vector<int8_t> ExtractArrayInt8(const py::object& o)
     return v;
 }
 
+template <typename T, typename Enable = void>
+struct has_npy_type : std::false_type
+{};
+
+template <typename T>
+struct has_npy_type<T, typename std::enable_if<sizeof(select_npy_type<T>::type) != 0>::type> : std::true_type
+{};
+
+/// \brief returns the data of o if it is an aligned C-contiguous numpy array of type T, otherwise nullptr. The data is valid as long as o is referenced.
+///
+/// \param[out] nelements total number of elements of the array, regardless of its shape
+template <typename T>
+inline const T* GetContiguousArrayData(const py::object& o, size_t& nelements, typename std::enable_if<has_npy_type<T>::value>::type* = nullptr)
+{
+    PyObject* pyo = o.ptr();
+    if( pyo == nullptr || !PyArray_Check(pyo) ) {
+        return nullptr;
+    }
+    PyArrayObject* pyarray = reinterpret_cast<PyArrayObject*>(pyo);
+    if( PyArray_NDIM(pyarray) == 0 || !PyArray_EquivTypenums(PyArray_TYPE(pyarray), select_npy_type<T>::type) || !PyArray_ISCARRAY_RO(pyarray) || !PyArray_ISNOTSWAPPED(pyarray) ) {
+        return nullptr;
+    }
+    nelements = PyArray_SIZE(pyarray);
+    return static_cast<const T*>(PyArray_DATA(pyarray));
+}
+
+template <typename T>
+inline const T* GetContiguousArrayData(const py::object& o, size_t& nelements, typename std::enable_if<!has_npy_type<T>::value>::type* = nullptr)
+{
+    return nullptr;
+}
+
 template <typename T>
 inline std::vector<T> ExtractArray(const py::object& o)
 {
     if( IS_PYTHONOBJECT_NONE(o) ) {
         return {};
     }
+    // 1-D numpy arrays of the right type are copied in one go. other shapes go through the per-element conversion, which rejects them
+    if( PyArray_Check(o.ptr()) && PyArray_NDIM(reinterpret_cast<PyArrayObject*>(o.ptr())) == 1 ) {
+        size_t nelements = 0;
+        const T* pdata = GetContiguousArrayData<T>(o, nelements);
+        if( pdata != nullptr ) {
+            return std::vector<T>(pdata, pdata + nelements);
+        }
+    }
     std::vector<T> v;
     try {
         const size_t n = len(o);
@@ -113,6 +113,39 @@ inline py::numeric::array toPyArray(const std::vector<T>& v, std::vector<npy_int
     return toPyArrayN(v.data(), dims);
 }
 
+template <typename T>
+inline void _DestroyMovedVector(PyObject* pycapsule)
+{
+    delete static_cast<std::vector<T>*>(PyCapsule_GetPointer(pycapsule, nullptr));
+}
+
+/// \brief returns an array of shape dims viewing the data of v without copying it, the array owns the moved vector
+template <typename T>
+inline py::numeric::array toPyArrayMove(std::vector<T>&& v, std::vector<npy_intp>& dims)
+{
+    if( v.empty() ) {
+        return toPyArrayN((T*)nullptr, dims);
+    }
+    size_t numel = 1;
+    for(npy_intp dim : dims) {
+        numel *= dim;
+    }
+    BOOST_ASSERT(numel == v.size());
+    std::vector<T>* pvalues = new std::vector<T>(std::move(v));
+    PyObject* pycapsule = PyCapsule_New(pvalues, nullptr, &_DestroyMovedVector<T>);
+    if( pycapsule == nullptr ) {
+        delete pvalues;
+        py::throw_error_already_set();
+    }
+    PyObject *pyvalues = PyArray_SimpleNewFromData(dims.size(), dims.data(), select_npy_type<T>::type, pvalues->data());
+    if( pyvalues == nullptr ) {
+        Py_DECREF(pycapsule);
+        py::throw_error_already_set();
+    }
+    PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(pyvalues), pycapsule); // steals pycapsule
+    return static_cast<py::numeric::array>(py::handle<>(pyvalues));
+}
+
 template <typename T, long unsigned int N>
 inline py::numeric::array toPyArray(const std::array<T, N>& v)
 {
@@ -66,9 +66,9 @@ protected:
 
     PyInterfaceBasePtr _toPyInterface(InterfaceBasePtr pinterface);
 
-    void _BodyCallback(object fncallback, KinBodyPtr pbody, int action);
+    void _BodyCallback(const object& fncallback, KinBodyPtr pbody, int action);
 
-    CollisionAction _CollisionCallback(object fncallback, CollisionReportPtr preport, bool bFromPhysics);
+    CollisionAction _CollisionCallback(const object& fncallback, CollisionReportPtr preport, bool bFromPhysics);
 
 public:
     PyEnvironmentBase(int options=ECO_StartSimulationThread);
@@ -208,6 +208,12 @@ public:
 
     bool Lock(float timeout);
 
+    void SetMutexTracing(bool bTracing);
+
+    void ResetMutexTracingStatistics();
+
+    object GetMutexTracingStatistics();
+
     void __enter__();
 
     void __exit__(object type, object value, object traceback);
@@ -277,6 +283,8 @@ public:
 
     object ExtractInfo() const;
     object UpdateFromInfo(PyEnvironmentBaseInfoPtr info);
+    object ExtractInfoDelta(int sinceStamp);
+    object UpdateFromInfoDelta(py::object odelta);
 
     int _revision = 0;
     py::list _keywords;
@@ -238,6 +238,7 @@ public:
     py::object GetTransform() const;
     py::object GetTransformPose() const;
     py::object GetLinkTransformations(bool returndoflastvlaues=false) const;
+    py::object GetLinkTransformationsArray(bool returndoflastvlaues=false) const;
     void SetLinkTransformations(py::object transforms, py::object odoflastvalues=py::none_());
     void SetLinkVelocities(py::object ovelocities);
     py::object GetLinkEnableStates() const;
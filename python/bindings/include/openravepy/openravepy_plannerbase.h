@@ -118,7 +118,7 @@ public:
 
     PyPlannerParametersPtr GetParameters() const;
 
-    static PlannerAction _PlanCallback(object fncallback, PyEnvironmentBasePtr pyenv, const PlannerBase::PlannerProgress& progress);
+    static PlannerAction _PlanCallback(const object& fncallback, PyEnvironmentBasePtr pyenv, const PlannerBase::PlannerProgress& progress);
 
     object RegisterPlanCallback(object fncallback);
 
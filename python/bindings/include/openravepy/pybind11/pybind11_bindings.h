@@ -161,6 +161,25 @@ inline py::array_t<T> toPyArray(const std::vector<T>& v, std::vector<npy_intp>&
     return toPyArrayN(v.data(), dims);
 }
 
+/// \brief returns an array of shape dims viewing the data of v without copying it, the array owns the moved vector
+template <typename T>
+inline py::array_t<T> toPyArrayMove(std::vector<T>&& v, std::vector<npy_intp>& dims)
+{
+    if( v.empty() ) {
+        return toPyArrayN((T*)nullptr, dims);
+    }
+    size_t numel = 1;
+    for(npy_intp dim : dims) {
+        numel *= dim;
+    }
+    BOOST_ASSERT(numel == v.size());
+    std::vector<T>* pvalues = new std::vector<T>(std::move(v));
+    py::capsule owner(pvalues, [](void* p) {
+        delete static_cast<std::vector<T>*>(p);
+    });
+    return py::array_t<T>(dims, pvalues->data(), owner);
+}
+
 template <typename T, long unsigned int N>
 inline py::array_t<T> toPyArray(const std::array<T, N>& v)
 {
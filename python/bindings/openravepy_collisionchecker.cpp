@@ -175,12 +175,17 @@ void PyCollisionCheckerBase::RemoveKinBody(PyKinBodyPtr pbody)
 bool PyCollisionCheckerBase::CheckCollision(PyKinBodyPtr pbody1)
 {
     CHECK_POINTER(pbody1);
+    openravepy::PythonThreadSaver threadsaver;
     return _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)));
 }
 bool PyCollisionCheckerBase::CheckCollision(PyKinBodyPtr pbody1, PyCollisionReportPtr pReport)
 {
     CHECK_POINTER(pbody1);
-    bool bCollision = _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), openravepy::GetCollisionReport(pReport));
+    bool bCollision;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        bCollision = _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), openravepy::GetCollisionReport(pReport));
+    }
     openravepy::UpdateCollisionReport(pReport,_pyenv);
     return bCollision;
 }
@@ -189,6 +194,7 @@ bool PyCollisionCheckerBase::CheckCollision(PyKinBodyPtr pbody1, PyKinBodyPtr pb
 {
     CHECK_POINTER(pbody1);
     CHECK_POINTER(pbody2);
+    openravepy::PythonThreadSaver threadsaver;
     return _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), KinBodyConstPtr(openravepy::GetKinBody(pbody2)));
 }
 
@@ -196,7 +202,11 @@ bool PyCollisionCheckerBase::CheckCollision(PyKinBodyPtr pbody1, PyKinBodyPtr pb
 {
     CHECK_POINTER(pbody1);
     CHECK_POINTER(pbody2);
-    bool bCollision = _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), KinBodyConstPtr(openravepy::GetKinBody(pbody2)), openravepy::GetCollisionReport(pReport));
+    bool bCollision;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        bCollision = _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), KinBodyConstPtr(openravepy::GetKinBody(pbody2)), openravepy::GetCollisionReport(pReport));
+    }
     openravepy::UpdateCollisionReport(pReport,_pyenv);
     return bCollision;
 }
@@ -206,10 +216,12 @@ bool PyCollisionCheckerBase::CheckCollision(object o1)
     CHECK_POINTER(o1);
     KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
     if( !!plink ) {
+        openravepy::PythonThreadSaver threadsaver;
         return _pCollisionChecker->CheckCollision(plink);
     }
     KinBodyConstPtr pbody = openravepy::GetKinBody(o1);
     if( !!pbody ) {
+        openravepy::PythonThreadSaver threadsaver;
         return _pCollisionChecker->CheckCollision(pbody);
     }
     throw OPENRAVE_EXCEPTION_FORMAT0(_("CheckCollision(object) invalid argument"),ORE_InvalidArguments);
@@ -221,11 +233,13 @@ bool PyCollisionCheckerBase::CheckCollision(object o1, PyCollisionReportPtr pRep
     KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
     bool bCollision;
     if( !!plink ) {
+        openravepy::PythonThreadSaver threadsaver;
         bCollision = _pCollisionChecker->CheckCollision(plink,openravepy::GetCollisionReport(pReport));
     }
     else {
         KinBodyConstPtr pbody = openravepy::GetKinBody(o1);
         if( !!pbody ) {
+            openravepy::PythonThreadSaver threadsaver;
             bCollision = _pCollisionChecker->CheckCollision(pbody,openravepy::GetCollisionReport(pReport));
         }
         else {
@@ -244,15 +258,21 @@ bool PyCollisionCheckerBase::CheckCollision(object o1, object o2)
     if( !!plink ) {
         KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
         if( !!plink2 ) {
+            openravepy::PythonThreadSaver threadsaver;
             return _pCollisionChecker->CheckCollision(plink,plink2);
         }
         KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
         if( !!pbody2 ) {
+            openravepy::PythonThreadSaver threadsaver;
             return _pCollisionChecker->CheckCollision(plink,pbody2);
         }
         CollisionReportPtr preport2 = openravepy::GetCollisionReport(o2);
         if( !!preport2 ) {
-            bool bCollision = _pCollisionChecker->CheckCollision(plink,preport2);
+            bool bCollision;
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                bCollision = _pCollisionChecker->CheckCollision(plink,preport2);
+            }
             openravepy::UpdateCollisionReport(o2,_pyenv);
             return bCollision;
         }
@@ -262,15 +282,21 @@ bool PyCollisionCheckerBase::CheckCollision(object o1, object o2)
     if( !!pbody ) {
         KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
         if( !!plink2 ) {
+            openravepy::PythonThreadSaver threadsaver;
             return _pCollisionChecker->CheckCollision(plink2,pbody);
         }
         KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
         if( !!pbody2 ) {
+            openravepy::PythonThreadSaver threadsaver;
             return _pCollisionChecker->CheckCollision(pbody,pbody2);
         }
         CollisionReportPtr preport2 = openravepy::GetCollisionReport(o2);
         if( !!preport2 ) {
-            bool bCollision = _pCollisionChecker->CheckCollision(pbody,preport2);
+            bool bCollision;
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                bCollision = _pCollisionChecker->CheckCollision(pbody,preport2);
+            }
             openravepy::UpdateCollisionReport(o2,_pyenv);
             return bCollision;
         }
@@ -287,11 +313,13 @@ bool PyCollisionCheckerBase::CheckCollision(object o1, object o2, PyCollisionRep
     if( !!plink ) {
         KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
         if( !!plink2 ) {
+            openravepy::PythonThreadSaver threadsaver;
             bCollision = _pCollisionChecker->CheckCollision(plink,plink2, openravepy::GetCollisionReport(pReport));
         }
         else {
             KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
             if( !!pbody2 ) {
+                openravepy::PythonThreadSaver threadsaver;
                 bCollision = _pCollisionChecker->CheckCollision(plink,pbody2, openravepy::GetCollisionReport(pReport));
             }
             else {
@@ -304,11 +332,13 @@ bool PyCollisionCheckerBase::CheckCollision(object o1, object o2, PyCollisionRep
         if( !!pbody ) {
             KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
             if( !!plink2 ) {
+                openravepy::PythonThreadSaver threadsaver;
                 bCollision = _pCollisionChecker->CheckCollision(plink2,pbody, openravepy::GetCollisionReport(pReport));
             }
             else {
                 KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
                 if( !!pbody2 ) {
+                    openravepy::PythonThreadSaver threadsaver;
                     bCollision = _pCollisionChecker->CheckCollision(pbody,pbody2, openravepy::GetCollisionReport(pReport));
                 }
                 else {
@@ -331,10 +361,12 @@ bool PyCollisionCheckerBase::CheckCollision(object o1, PyKinBodyPtr pybody2)
     KinBodyConstPtr pbody2 = openravepy::GetKinBody(pybody2);
     KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
     if( !!plink ) {
+        openravepy::PythonThreadSaver threadsaver;
         return _pCollisionChecker->CheckCollision(plink,pbody2);
     }
     KinBodyConstPtr pbody1 = openravepy::GetKinBody(o1);
     if( !!pbody1 ) {
+        openravepy::PythonThreadSaver threadsaver;
         return _pCollisionChecker->CheckCollision(pbody1,pbody2);
     }
     throw OPENRAVE_EXCEPTION_FORMAT0(_("CheckCollision(object) invalid argument"),ORE_InvalidArguments);
@@ -348,11 +380,13 @@ bool PyCollisionCheckerBase::CheckCollision(object o1, PyKinBodyPtr pybody2, PyC
     KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
     bool bCollision = false;
     if( !!plink ) {
+        openravepy::PythonThreadSaver threadsaver;
         bCollision = _pCollisionChecker->CheckCollision(plink,pbody2,openravepy::GetCollisionReport(pReport));
     }
     else {
         KinBodyConstPtr pbody1 = openravepy::GetKinBody(o1);
         if( !!pbody1 ) {
+            openravepy::PythonThreadSaver threadsaver;
             bCollision = _pCollisionChecker->CheckCollision(pbody1,pbody2,openravepy::GetCollisionReport(pReport));
         }
         else {
@@ -394,9 +428,11 @@ bool PyCollisionCheckerBase::CheckCollision(object o1, object bodyexcluded, obje
         }
     }
     if( !!plink1 ) {
+        openravepy::PythonThreadSaver threadsaver;
         return _pCollisionChecker->CheckCollision(plink1,vbodyexcluded,vlinkexcluded);
     }
     else if( !!pbody1 ) {
+        openravepy::PythonThreadSaver threadsaver;
         return _pCollisionChecker->CheckCollision(pbody1,vbodyexcluded,vlinkexcluded);
     }
     else {
@@ -432,9 +468,11 @@ bool PyCollisionCheckerBase::CheckCollision(object o1, object bodyexcluded, obje
 
     bool bCollision=false;
     if( !!plink1 ) {
+        openravepy::PythonThreadSaver threadsaver;
         bCollision = _pCollisionChecker->CheckCollision(plink1, vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
     }
     else if( !!pbody1 ) {
+        openravepy::PythonThreadSaver threadsaver;
         bCollision = _pCollisionChecker->CheckCollision(pbody1, vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
     }
     else {
@@ -467,6 +505,7 @@ bool PyCollisionCheckerBase::CheckCollision(PyKinBodyPtr pbody, object bodyexclu
             RAVELOG_ERROR("failed to get excluded link\n");
         }
     }
+    openravepy::PythonThreadSaver threadsaver;
     return _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody)),vbodyexcluded,vlinkexcluded);
 }
 
@@ -493,19 +532,28 @@ bool PyCollisionCheckerBase::CheckCollision(PyKinBodyPtr pbody, object bodyexclu
         }
     }
 
-    bool bCollision = _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody)), vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+    bool bCollision;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        bCollision = _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody)), vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+    }
     openravepy::UpdateCollisionReport(pReport,_pyenv);
     return bCollision;
 }
 
 bool PyCollisionCheckerBase::CheckCollision(OPENRAVE_SHARED_PTR<PyRay> pyray, PyKinBodyPtr pbody)
 {
+    openravepy::PythonThreadSaver threadsaver;
     return _pCollisionChecker->CheckCollision(pyray->r,KinBodyConstPtr(openravepy::GetKinBody(pbody)));
 }
 
 bool PyCollisionCheckerBase::CheckCollision(OPENRAVE_SHARED_PTR<PyRay> pyray, PyKinBodyPtr pbody, PyCollisionReportPtr pReport)
 {
-    bool bCollision = _pCollisionChecker->CheckCollision(pyray->r, KinBodyConstPtr(openravepy::GetKinBody(pbody)), openravepy::GetCollisionReport(pReport));
+    bool bCollision;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        bCollision = _pCollisionChecker->CheckCollision(pyray->r, KinBodyConstPtr(openravepy::GetKinBody(pbody)), openravepy::GetCollisionReport(pReport));
+    }
     openravepy::UpdateCollisionReport(pReport,_pyenv);
     return bCollision;
 }
@@ -577,12 +625,17 @@ object PyCollisionCheckerBase::CheckCollisionRays(object rays, PyKinBodyPtr pbod
 
 bool PyCollisionCheckerBase::CheckCollision(OPENRAVE_SHARED_PTR<PyRay> pyray)
 {
+    openravepy::PythonThreadSaver threadsaver;
     return _pCollisionChecker->CheckCollision(pyray->r);
 }
 
 bool PyCollisionCheckerBase::CheckCollision(OPENRAVE_SHARED_PTR<PyRay> pyray, PyCollisionReportPtr pReport)
 {
-    bool bCollision = _pCollisionChecker->CheckCollision(pyray->r, openravepy::GetCollisionReport(pReport));
+    bool bCollision;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        bCollision = _pCollisionChecker->CheckCollision(pyray->r, openravepy::GetCollisionReport(pReport));
+    }
     openravepy::UpdateCollisionReport(pReport,_pyenv);
     return bCollision;
 }
@@ -594,7 +647,11 @@ bool PyCollisionCheckerBase::CheckCollisionTriMesh(object otrimesh, PyKinBodyPtr
         throw openrave_exception(_("bad trimesh"));
     }
     KinBodyConstPtr pbody(openravepy::GetKinBody(pybody));
-    bool bCollision = _pCollisionChecker->CheckCollision(trimesh, pbody, openravepy::GetCollisionReport(pReport));
+    bool bCollision;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        bCollision = _pCollisionChecker->CheckCollision(trimesh, pbody, openravepy::GetCollisionReport(pReport));
+    }
     openravepy::UpdateCollisionReport(pReport,_pyenv);
     return bCollision;
 }
@@ -605,7 +662,11 @@ bool PyCollisionCheckerBase::CheckCollisionTriMesh(object otrimesh, PyCollisionR
     if( !ExtractTriMesh(otrimesh,trimesh) ) {
         throw openrave_exception(_("bad trimesh"));
     }
-    bool bCollision = _pCollisionChecker->CheckCollision(trimesh, openravepy::GetCollisionReport(pReport));
+    bool bCollision;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        bCollision = _pCollisionChecker->CheckCollision(trimesh, openravepy::GetCollisionReport(pReport));
+    }
     openravepy::UpdateCollisionReport(pReport,_pyenv);
     return bCollision;
 }
@@ -614,7 +675,11 @@ bool PyCollisionCheckerBase::CheckCollisionOBB(object oaabb, object otransform,
 {
     AABB aabb = ExtractAABB(oaabb);
     Transform t = ExtractTransform(otransform);
-    bool bCollision = _pCollisionChecker->CheckCollision(aabb, t, openravepy::GetCollisionReport(pReport));
+    bool bCollision;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        bCollision = _pCollisionChecker->CheckCollision(aabb, t, openravepy::GetCollisionReport(pReport));
+    }
     openravepy::UpdateCollisionReport(pReport,_pyenv);
     return bCollision;
 }
@@ -625,9 +690,11 @@ bool PyCollisionCheckerBase::CheckSelfCollision(object o1, PyCollisionReportPtr
     KinBodyConstPtr pbody1 = openravepy::GetKinBody(o1);
     bool bCollision;
     if( !!plink1 ) {
+        openravepy::PythonThreadSaver threadsaver;
         bCollision = _pCollisionChecker->CheckSelfCollision(plink1, openravepy::GetCollisionReport(pReport));
     }
     else if( !!pbody1 ) {
+        openravepy::PythonThreadSaver threadsaver;
         bCollision = _pCollisionChecker->CheckSelfCollision(pbody1, openravepy::GetCollisionReport(pReport));
     }
     else {
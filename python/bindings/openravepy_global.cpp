@@ -938,6 +938,33 @@ void pyRaveSetDataAccess(object oaccess)
     OpenRAVE::RaveSetDataAccess(pyGetIntFromPy(oaccess, Level_Info));
 }
 
+/// \brief calls a python job of pyRaveRunParallelJobs with the GIL. python errors are converted to openrave_exception so that RaveRunParallelJobs can rethrow them
+static void _CallParallelJob(const object& fn, int jobindex, int threadindex)
+{
+    bool bFailed = false;
+    std::string errmsg;
+    PyGILState_STATE gstate = PyGILState_Ensure();
+    try {
+        fn(jobindex, threadindex);
+    }
+    catch(...) {
+        bFailed = true;
+        errmsg = GetPyErrorString();
+    }
+    PyGILState_Release(gstate);
+    if( bFailed ) {
+        throw OPENRAVE_EXCEPTION_FORMAT("exception occured in python job %d: %s", jobindex%errmsg, ORE_Failed);
+    }
+}
+
+void pyRaveRunParallelJobs(object fn, int numjobs, int maxthreads=0)
+{
+    // fn is only referenced so that no python object is copied without the GIL
+    ParallelJobFn jobfn = boost::bind(_CallParallelJob, boost::cref(fn), _1, _2);
+    openravepy::PythonThreadSaver threadsaver;
+    OpenRAVE::RaveRunParallelJobs(jobfn, numjobs, maxthreads);
+}
+
 // return None if nothing found
 object pyRaveInvertFileLookup(const std::string& filename)
 {
@@ -1283,6 +1310,7 @@ BOOST_PYTHON_FUNCTION_OVERLOADS(ComputePoseDistSqr_overloads, openravepy::Comput
 BOOST_PYTHON_FUNCTION_OVERLOADS(pyRaveGetAffineConfigurationSpecification_overloads, openravepy::pyRaveGetAffineConfigurationSpecification, 1, 3)
 BOOST_PYTHON_FUNCTION_OVERLOADS(pyRaveGetAffineDOFValuesFromTransform_overloads, openravepy::pyRaveGetAffineDOFValuesFromTransform, 2, 3)
 BOOST_PYTHON_FUNCTION_OVERLOADS(RaveClone_overloads, pyRaveClone, 2, 3)
+BOOST_PYTHON_FUNCTION_OVERLOADS(RaveRunParallelJobs_overloads, pyRaveRunParallelJobs, 2, 3)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(ExtractTransform_overloads, PyConfigurationSpecification::ExtractTransform, 3, 4)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(ExtractIkParameterization_overloads, PyConfigurationSpecification::ExtractIkParameterization, 1, 4)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(ExtractAffineValues_overloads, PyConfigurationSpecification::ExtractAffineValues, 3, 4)
@@ -1866,6 +1894,21 @@ void init_openravepy_global()
 #else
     def("RaveFindLocalFile",OpenRAVE::RaveFindLocalFile,RaveFindLocalFile_overloads(PY_ARGS("filename","curdir") DOXY_FN1(RaveFindLocalFile)));
 #endif
+#ifdef USE_PYBIND11_PYTHON_BINDINGS
+    m.def("RaveGetNumParallelJobThreads",OpenRAVE::RaveGetNumParallelJobThreads, DOXY_FN1(RaveGetNumParallelJobThreads));
+#else
+    def("RaveGetNumParallelJobThreads",OpenRAVE::RaveGetNumParallelJobThreads, DOXY_FN1(RaveGetNumParallelJobThreads));
+#endif
+#ifdef USE_PYBIND11_PYTHON_BINDINGS
+    m.def("RaveRunParallelJobs", openravepy::pyRaveRunParallelJobs,
+          "fn"_a,
+          "numjobs"_a,
+          "maxthreads"_a = 0,
+          DOXY_FN1(RaveRunParallelJobs)
+          );
+#else
+    def("RaveRunParallelJobs",openravepy::pyRaveRunParallelJobs,RaveRunParallelJobs_overloads(PY_ARGS("fn","numjobs","maxthreads") DOXY_FN1(RaveRunParallelJobs)));
+#endif
 #ifdef USE_PYBIND11_PYTHON_BINDINGS
     m.def("RaveInvertFileLookup",openravepy::pyRaveInvertFileLookup, PY_ARGS("filename") DOXY_FN1(RaveInvertFileLookup));
 #else
@@ -89,30 +89,33 @@ void PyIkReturn::SetMapKeyValue(const std::string& key, object ovalues) {
 
 typedef OPENRAVE_SHARED_PTR<PyIkReturn> PyIkReturnPtr;
 
-IkReturn PyIkSolverBase::_CallCustomFilter(object fncallback, PyEnvironmentBasePtr pyenv, IkSolverBasePtr pIkSolver, std::vector<dReal>& values, RobotBase::ManipulatorConstPtr pmanip, const IkParameterization& ikparam)
+IkReturn PyIkSolverBase::_CallCustomFilter(const object& fncallback, PyEnvironmentBasePtr pyenv, IkSolverBasePtr pIkSolver, std::vector<dReal>& values, RobotBase::ManipulatorConstPtr pmanip, const IkParameterization& ikparam)
 {
-    object res;
+    // solvers usually run with the GIL released, so all python objects have to be created and destroyed while holding it
     PyGILState_STATE gstate = PyGILState_Ensure();
     std::string errmsg;
-    try {
-        RobotBase::ManipulatorPtr pmanip2 = OPENRAVE_CONST_POINTER_CAST<RobotBase::Manipulator>(pmanip);
-        res = fncallback(toPyArray(values), openravepy::toPyRobotManipulator(pmanip2,pyenv),toPyIkParameterization(ikparam));
-    }
-    catch(...) {
-        errmsg = boost::str(boost::format("exception occured in python custom filter callback of iksolver %s: %s")%pIkSolver->GetXMLId()%GetPyErrorString());
-    }
     IkReturn ikfr(IKRA_Success);
-    if( IS_PYTHONOBJECT_NONE(res) ) {
-        ikfr._action = IKRA_Reject;
-    }
-    else {
-        if( !openravepy::ExtractIkReturn(res,ikfr) ) {
-            extract_<IkReturnAction> ikfra(res);
-            if( ikfra.check() ) {
-                ikfr._action = (IkReturnAction)ikfra;
-            }
-            else {
-                errmsg = "failed to convert return type of filter to IkReturn";
+    {
+        object res;
+        try {
+            RobotBase::ManipulatorPtr pmanip2 = OPENRAVE_CONST_POINTER_CAST<RobotBase::Manipulator>(pmanip);
+            res = fncallback(toPyArray(values), openravepy::toPyRobotManipulator(pmanip2,pyenv),toPyIkParameterization(ikparam));
+        }
+        catch(...) {
+            errmsg = boost::str(boost::format("exception occured in python custom filter callback of iksolver %s: %s")%pIkSolver->GetXMLId()%GetPyErrorString());
+        }
+        if( IS_PYTHONOBJECT_NONE(res) ) {
+            ikfr._action = IKRA_Reject;
+        }
+        else {
+            if( !openravepy::ExtractIkReturn(res,ikfr) ) {
+                extract_<IkReturnAction> ikfra(res);
+                if( ikfra.check() ) {
+                    ikfr._action = (IkReturnAction)ikfra;
+                }
+                else {
+                    errmsg = "failed to convert return type of filter to IkReturn";
+                }
             }
         }
     }
@@ -157,7 +160,10 @@ PyIkReturnPtr PyIkSolverBase::Solve(object oparam, object oq0, int filteroptions
     if( !ExtractIkParameterization(oparam,ikparam) ) {
         throw openrave_exception(_("first argument to IkSolver.Solve needs to be IkParameterization"),ORE_InvalidArguments);
     }
-    _pIkSolver->Solve(ikparam, q0, filteroptions, preturn);
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        _pIkSolver->Solve(ikparam, q0, filteroptions, preturn);
+    }
     return pyreturn;
 }
 
@@ -169,7 +175,10 @@ object PyIkSolverBase::SolveAll(object oparam, int filteroptions)
     if( !ExtractIkParameterization(oparam,ikparam) ) {
         throw openrave_exception(_("first argument to IkSolver.Solve needs to be IkParameterization"),ORE_InvalidArguments);
     }
-    _pIkSolver->SolveAll(ikparam, filteroptions, vikreturns);
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        _pIkSolver->SolveAll(ikparam, filteroptions, vikreturns);
+    }
     FOREACH(itikreturn,vikreturns) {
         pyreturns.append(py::to_object(PyIkReturnPtr(new PyIkReturn(*itikreturn))));
     }
@@ -191,7 +200,10 @@ PyIkReturnPtr PyIkSolverBase::Solve(object oparam, object oq0, object oFreeParam
     if( !ExtractIkParameterization(oparam,ikparam) ) {
         throw openrave_exception(_("first argument to IkSolver.Solve needs to be IkParameterization"),ORE_InvalidArguments);
     }
-    _pIkSolver->Solve(ikparam, q0, vFreeParameters,filteroptions, preturn);
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        _pIkSolver->Solve(ikparam, q0, vFreeParameters,filteroptions, preturn);
+    }
     return pyreturn;
 }
 
@@ -207,7 +219,10 @@ object PyIkSolverBase::SolveAll(object oparam, object oFreeParameters, int filte
     if( !IS_PYTHONOBJECT_NONE(oFreeParameters) ) {
         vFreeParameters = ExtractArray<dReal>(oFreeParameters);
     }
-    _pIkSolver->SolveAll(ikparam, vFreeParameters, filteroptions, vikreturns);
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        _pIkSolver->SolveAll(ikparam, vFreeParameters, filteroptions, vikreturns);
+    }
     FOREACH(itikreturn,vikreturns) {
         pyreturns.append(py::to_object(PyIkReturnPtr(new PyIkReturn(*itikreturn))));
     }
@@ -222,7 +237,10 @@ PyIkReturnPtr PyIkSolverBase::CallFilters(object oparam)
     if( !ExtractIkParameterization(oparam,ikparam) ) {
         throw openrave_exception(_("first argument to IkSolver.Solve needs to be IkParameterization"),ORE_InvalidArguments);
     }
-    _pIkSolver->CallFilters(ikparam, preturn);
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        _pIkSolver->CallFilters(ikparam, preturn);
+    }
     return pyreturn;
 }
 
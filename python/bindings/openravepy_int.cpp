@@ -1038,9 +1038,8 @@ py::object PyEnvironmentBase::PyEnvironmentBaseInfo::__unicode__() {
     return ConvertStringToUnicode(__str__());
 }
 
-void PyEnvironmentBase::_BodyCallback(object fncallback, KinBodyPtr pbody, int action)
+void PyEnvironmentBase::_BodyCallback(const object& fncallback, KinBodyPtr pbody, int action)
 {
-    object res;
     PyGILState_STATE gstate = PyGILState_Ensure();
     try {
         fncallback(openravepy::toPyKinBody(pbody, shared_from_this()), action);
@@ -1052,30 +1051,33 @@ void PyEnvironmentBase::_BodyCallback(object fncallback, KinBodyPtr pbody, int a
     PyGILState_Release(gstate);
 }
 
-CollisionAction PyEnvironmentBase::_CollisionCallback(object fncallback, CollisionReportPtr preport, bool bFromPhysics)
+CollisionAction PyEnvironmentBase::_CollisionCallback(const object& fncallback, CollisionReportPtr preport, bool bFromPhysics)
 {
-    object res;
+    // collision checks are called with the GIL released, so python objects must not outlive gstate
     PyGILState_STATE gstate = PyGILState_Ensure();
-    try {
-        res = fncallback(openravepy::toPyCollisionReport(preport,shared_from_this()),bFromPhysics);
-    }
-    catch(...) {
-        RAVELOG_ERROR("exception occured in python collision callback:\n");
-        PyErr_Print();
-    }
     CollisionAction ret = CA_DefaultAction;
-    if( IS_PYTHONOBJECT_NONE(res) || !res ) {
-        ret = CA_DefaultAction;
-        RAVELOG_WARN("collision callback nothing returning, so executing default action\n");
-    }
-    else {
-        extract_<int> xi(res);
-        if( xi.check() ) {
-            ret = (CollisionAction)(int) xi;
+    {
+        object res;
+        try {
+            res = fncallback(openravepy::toPyCollisionReport(preport,shared_from_this()),bFromPhysics);
         }
-        else {
+        catch(...) {
+            RAVELOG_ERROR("exception occured in python collision callback:\n");
+            PyErr_Print();
+        }
+        if( IS_PYTHONOBJECT_NONE(res) || !res ) {
+            ret = CA_DefaultAction;
             RAVELOG_WARN("collision callback nothing returning, so executing default action\n");
         }
+        else {
+            extract_<int> xi(res);
+            if( xi.check() ) {
+                ret = (CollisionAction)(int) xi;
+            }
+            else {
+                RAVELOG_WARN("collision callback nothing returning, so executing default action\n");
+            }
+        }
     }
     PyGILState_Release(gstate);
     return ret;
@@ -1149,12 +1151,17 @@ object PyEnvironmentBase::GetCollisionChecker()
 bool PyEnvironmentBase::CheckCollision(PyKinBodyPtr pbody1)
 {
     CHECK_POINTER(pbody1);
+    openravepy::PythonThreadSaver threadsaver;
     return _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)));
 }
 bool PyEnvironmentBase::CheckCollision(PyKinBodyPtr pbody1, PyCollisionReportPtr pReport)
 {
     CHECK_POINTER(pbody1);
-    bool bCollision = _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), openravepy::GetCollisionReport(pReport));
+    bool bCollision;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        bCollision = _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), openravepy::GetCollisionReport(pReport));
+    }
     openravepy::UpdateCollisionReport(pReport,shared_from_this());
     return bCollision;
 }
@@ -1163,6 +1170,7 @@ bool PyEnvironmentBase::CheckCollision(PyKinBodyPtr pbody1, PyKinBodyPtr pbody2)
 {
     CHECK_POINTER(pbody1);
     CHECK_POINTER(pbody2);
+    openravepy::PythonThreadSaver threadsaver;
     return _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), KinBodyConstPtr(openravepy::GetKinBody(pbody2)));
 }
 
@@ -1170,7 +1178,11 @@ bool PyEnvironmentBase::CheckCollision(PyKinBodyPtr pbody1, PyKinBodyPtr pbody2,
 {
     CHECK_POINTER(pbody1);
     CHECK_POINTER(pbody2);
-    bool bCollision = _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), KinBodyConstPtr(openravepy::GetKinBody(pbody2)), openravepy::GetCollisionReport(pReport));
+    bool bCollision;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        bCollision = _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), KinBodyConstPtr(openravepy::GetKinBody(pbody2)), openravepy::GetCollisionReport(pReport));
+    }
     openravepy::UpdateCollisionReport(pReport,shared_from_this());
     return bCollision;
 }
@@ -1180,10 +1192,12 @@ bool PyEnvironmentBase::CheckCollision(object o1)
     CHECK_POINTER(o1);
     KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
     if( !!plink ) {
+        openravepy::PythonThreadSaver threadsaver;
         return _penv->CheckCollision(plink);
     }
     KinBodyConstPtr pbody = openravepy::GetKinBody(o1);
     if( !!pbody ) {
+        openravepy::PythonThreadSaver threadsaver;
         return _penv->CheckCollision(pbody);
     }
     throw OPENRAVE_EXCEPTION_FORMAT0(_("CheckCollision(object) invalid argument"),ORE_InvalidArguments);
@@ -1195,11 +1209,13 @@ bool PyEnvironmentBase::CheckCollision(object o1, PyCollisionReportPtr pReport)
     KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
     bool bCollision;
     if( !!plink ) {
+        openravepy::PythonThreadSaver threadsaver;
         bCollision = _penv->CheckCollision(plink,openravepy::GetCollisionReport(pReport));
     }
     else {
         KinBodyConstPtr pbody = openravepy::GetKinBody(o1);
         if( !!pbody ) {
+            openravepy::PythonThreadSaver threadsaver;
             bCollision = _penv->CheckCollision(pbody,openravepy::GetCollisionReport(pReport));
         }
         else {
@@ -1218,15 +1234,21 @@ bool PyEnvironmentBase::CheckCollision(object o1, object o2)
     if( !!plink ) {
         KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
         if( !!plink2 ) {
+            openravepy::PythonThreadSaver threadsaver;
             return _penv->CheckCollision(plink,plink2);
         }
         KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
         if( !!pbody2 ) {
+            openravepy::PythonThreadSaver threadsaver;
             return _penv->CheckCollision(plink,pbody2);
         }
         CollisionReportPtr preport2 = openravepy::GetCollisionReport(o2);
         if( !!preport2 ) {
-            bool bCollision = _penv->CheckCollision(plink,preport2);
+            bool bCollision;
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                bCollision = _penv->CheckCollision(plink,preport2);
+            }
             openravepy::UpdateCollisionReport(o2,shared_from_this());
             return bCollision;
         }
@@ -1236,15 +1258,21 @@ bool PyEnvironmentBase::CheckCollision(object o1, object o2)
     if( !!pbody ) {
         KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
         if( !!plink2 ) {
+            openravepy::PythonThreadSaver threadsaver;
             return _penv->CheckCollision(plink2,pbody);
         }
         KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
         if( !!pbody2 ) {
+            openravepy::PythonThreadSaver threadsaver;
             return _penv->CheckCollision(pbody,pbody2);
         }
         CollisionReportPtr preport2 = openravepy::GetCollisionReport(o2);
         if( !!preport2 ) {
-            bool bCollision = _penv->CheckCollision(pbody,preport2);
+            bool bCollision;
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                bCollision = _penv->CheckCollision(pbody,preport2);
+            }
             openravepy::UpdateCollisionReport(o2,shared_from_this());
             return bCollision;
         }
@@ -1261,11 +1289,13 @@ bool PyEnvironmentBase::CheckCollision(object o1, object o2, PyCollisionReportPt
     if( !!plink ) {
         KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
         if( !!plink2 ) {
+            openravepy::PythonThreadSaver threadsaver;
             bCollision = _penv->CheckCollision(plink,plink2, openravepy::GetCollisionReport(pReport));
         }
         else {
             KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
             if( !!pbody2 ) {
+                openravepy::PythonThreadSaver threadsaver;
                 bCollision = _penv->CheckCollision(plink,pbody2, openravepy::GetCollisionReport(pReport));
             }
             else {
@@ -1278,11 +1308,13 @@ bool PyEnvironmentBase::CheckCollision(object o1, object o2, PyCollisionReportPt
         if( !!pbody ) {
             KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
             if( !!plink2 ) {
+                openravepy::PythonThreadSaver threadsaver;
                 bCollision = _penv->CheckCollision(plink2,pbody, openravepy::GetCollisionReport(pReport));
             }
             else {
                 KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
                 if( !!pbody2 ) {
+                    openravepy::PythonThreadSaver threadsaver;
                     bCollision = _penv->CheckCollision(pbody,pbody2, openravepy::GetCollisionReport(pReport));
                 }
                 else {
@@ -1305,10 +1337,12 @@ bool PyEnvironmentBase::CheckCollision(object o1, PyKinBodyPtr pybody2)
     KinBodyConstPtr pbody2 = openravepy::GetKinBody(pybody2);
     KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
     if( !!plink ) {
+        openravepy::PythonThreadSaver threadsaver;
         return _penv->CheckCollision(plink,pbody2);
     }
     KinBodyConstPtr pbody1 = openravepy::GetKinBody(o1);
     if( !!pbody1 ) {
+        openravepy::PythonThreadSaver threadsaver;
         return _penv->CheckCollision(pbody1,pbody2);
     }
     throw OPENRAVE_EXCEPTION_FORMAT0(_("CheckCollision(object) invalid argument"),ORE_InvalidArguments);
@@ -1322,11 +1356,13 @@ bool PyEnvironmentBase::CheckCollision(object o1, PyKinBodyPtr pybody2, PyCollis
     KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
     bool bCollision = false;
     if( !!plink ) {
+        openravepy::PythonThreadSaver threadsaver;
         bCollision = _penv->CheckCollision(plink,pbody2,openravepy::GetCollisionReport(pReport));
     }
     else {
         KinBodyConstPtr pbody1 = openravepy::GetKinBody(o1);
         if( !!pbody1 ) {
+            openravepy::PythonThreadSaver threadsaver;
             bCollision = _penv->CheckCollision(pbody1,pbody2,openravepy::GetCollisionReport(pReport));
         }
         else {
@@ -1368,9 +1404,11 @@ bool PyEnvironmentBase::CheckCollision(object o1, object bodyexcluded, object li
         }
     }
     if( !!plink1 ) {
+        openravepy::PythonThreadSaver threadsaver;
         return _penv->CheckCollision(plink1,vbodyexcluded,vlinkexcluded);
     }
     else if( !!pbody1 ) {
+        openravepy::PythonThreadSaver threadsaver;
         return _penv->CheckCollision(pbody1,vbodyexcluded,vlinkexcluded);
     }
     else {
@@ -1406,9 +1444,11 @@ bool PyEnvironmentBase::CheckCollision(object o1, object bodyexcluded, object li
 
     bool bCollision=false;
     if( !!plink1 ) {
+        openravepy::PythonThreadSaver threadsaver;
         bCollision = _penv->CheckCollision(plink1, vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
     }
     else if( !!pbody1 ) {
+        openravepy::PythonThreadSaver threadsaver;
         bCollision = _penv->CheckCollision(pbody1, vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
     }
     else {
@@ -1441,6 +1481,7 @@ bool PyEnvironmentBase::CheckCollision(PyKinBodyPtr pbody, object bodyexcluded,
             RAVELOG_ERROR("failed to get excluded link\n");
         }
     }
+    openravepy::PythonThreadSaver threadsaver;
     return _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody)),vbodyexcluded,vlinkexcluded);
 }
 
@@ -1467,19 +1508,28 @@ bool PyEnvironmentBase::CheckCollision(PyKinBodyPtr pbody, object bodyexcluded,
         }
     }
 
-    bool bCollision = _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody)), vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+    bool bCollision;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        bCollision = _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody)), vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+    }
     openravepy::UpdateCollisionReport(pReport,shared_from_this());
     return bCollision;
 }
 
 bool PyEnvironmentBase::CheckCollision(OPENRAVE_SHARED_PTR<PyRay> pyray, PyKinBodyPtr pbody)
 {
+    openravepy::PythonThreadSaver threadsaver;
     return _penv->CheckCollision(pyray->r,KinBodyConstPtr(openravepy::GetKinBody(pbody)));
 }
 
 bool PyEnvironmentBase::CheckCollision(OPENRAVE_SHARED_PTR<PyRay> pyray, PyKinBodyPtr pbody, PyCollisionReportPtr pReport)
 {
-    bool bCollision = _penv->CheckCollision(pyray->r, KinBodyConstPtr(openravepy::GetKinBody(pbody)), openravepy::GetCollisionReport(pReport));
+    bool bCollision;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        bCollision = _penv->CheckCollision(pyray->r, KinBodyConstPtr(openravepy::GetKinBody(pbody)), openravepy::GetCollisionReport(pReport));
+    }
     openravepy::UpdateCollisionReport(pReport,shared_from_this());
     return bCollision;
 }
@@ -1575,12 +1625,17 @@ object PyEnvironmentBase::CheckCollisionRays(py::numeric::array rays, PyKinBodyP
 
 bool PyEnvironmentBase::CheckCollision(OPENRAVE_SHARED_PTR<PyRay> pyray)
 {
+    openravepy::PythonThreadSaver threadsaver;
     return _penv->CheckCollision(pyray->r);
 }
 
 bool PyEnvironmentBase::CheckCollision(OPENRAVE_SHARED_PTR<PyRay> pyray, PyCollisionReportPtr pReport)
 {
-    bool bCollision = _penv->CheckCollision(pyray->r, openravepy::GetCollisionReport(pReport));
+    bool bCollision;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        bCollision = _penv->CheckCollision(pyray->r, openravepy::GetCollisionReport(pReport));
+    }
     openravepy::UpdateCollisionReport(pReport,shared_from_this());
     return bCollision;
 }
@@ -1938,6 +1993,23 @@ void PyEnvironmentBase::Unlock()
 #endif
 }
 
+void PyEnvironmentBase::SetMutexTracing(bool bTracing)
+{
+    _penv->GetMutex().SetTracing(bTracing);
+}
+
+void PyEnvironmentBase::ResetMutexTracingStatistics()
+{
+    _penv->GetMutex().ResetTracingStatistics();
+}
+
+object PyEnvironmentBase::GetMutexTracingStatistics()
+{
+    rapidjson::Document rStatistics;
+    _penv->GetMutex().GetTracingStatistics(rStatistics, rStatistics.GetAllocator());
+    return toPyObject(rStatistics);
+}
+
 /// try locking the environment while releasing the GIL. This can get into a deadlock after env lock is acquired and before gil is re-acquired
 bool PyEnvironmentBase::TryLockReleaseGil()
 {
@@ -2417,6 +2489,49 @@ object PyEnvironmentBase::UpdateFromInfo(PyEnvironmentBaseInfoPtr info) {
     return py::make_tuple(createdBodies, modifiedBodies, removedBodies);
 }
 
+object PyEnvironmentBase::ExtractInfoDelta(int sinceStamp)
+{
+    EnvironmentBase::EnvironmentBaseInfoDelta delta;
+    _penv->ExtractInfoDelta(delta, sinceStamp);
+    rapidjson::Document doc;
+    delta.SerializeJSON(doc, doc.GetAllocator(), 1.0);
+    return toPyObject(doc);
+}
+
+object PyEnvironmentBase::UpdateFromInfoDelta(py::object odelta)
+{
+    rapidjson::Document doc;
+    toRapidJSONValue(odelta, doc, doc.GetAllocator());
+    EnvironmentBase::EnvironmentBaseInfoDelta delta;
+    delta.DeserializeJSON(doc, 1.0, 0);
+    std::vector<KinBodyPtr> vCreatedBodies, vModifiedBodies, vRemovedBodies;
+    _penv->UpdateFromInfoDelta(delta, vCreatedBodies, vModifiedBodies, vRemovedBodies);
+
+    py::list createdBodies, modifiedBodies, removedBodies;
+    FOREACHC(itbody, vCreatedBodies) {
+        if ((*itbody)->IsRobot()) {
+            createdBodies.append(openravepy::toPyRobot(RaveInterfaceCast<RobotBase>(*itbody),shared_from_this()));
+        } else {
+            createdBodies.append(openravepy::toPyKinBody(*itbody,shared_from_this()));
+        }
+    }
+    FOREACHC(itbody, vModifiedBodies) {
+        if ((*itbody)->IsRobot()) {
+            modifiedBodies.append(openravepy::toPyRobot(RaveInterfaceCast<RobotBase>(*itbody),shared_from_this()));
+        } else {
+            modifiedBodies.append(openravepy::toPyKinBody(*itbody,shared_from_this()));
+        }
+    }
+    FOREACHC(itbody, vRemovedBodies) {
+        if ((*itbody)->IsRobot()) {
+            removedBodies.append(openravepy::toPyRobot(RaveInterfaceCast<RobotBase>(*itbody),shared_from_this()));
+        } else {
+            removedBodies.append(openravepy::toPyKinBody(*itbody,shared_from_this()));
+        }
+    }
+    return py::make_tuple(createdBodies, modifiedBodies, removedBodies);
+}
+
 bool PyEnvironmentBase::__eq__(PyEnvironmentBasePtr p) {
     return !!p && _penv==p->_penv;
 }
@@ -3033,6 +3148,9 @@ Because race conditions can pop up when trying to lock the openrave environment
                      .def("Lock",Lock2,PY_ARGS("timeout") "Locks the environment mutex with a timeout.")
                      .def("Unlock",&PyEnvironmentBase::Unlock,"Unlocks the environment mutex.")
                      .def("TryLock",&PyEnvironmentBase::TryLock,"Tries to locks the environment mutex, returns false if it failed.")
+                     .def("SetMutexTracing",&PyEnvironmentBase::SetMutexTracing,PY_ARGS("tracing") DOXY_FN(EnvironmentMutex,SetTracing))
+                     .def("ResetMutexTracingStatistics",&PyEnvironmentBase::ResetMutexTracingStatistics, DOXY_FN(EnvironmentMutex,ResetTracingStatistics))
+                     .def("GetMutexTracingStatistics",&PyEnvironmentBase::GetMutexTracingStatistics, DOXY_FN(EnvironmentMutex,GetTracingStatistics))
                      .def("LockPhysics", Lock1, "Locks the environment mutex.")
                      .def("LockPhysics", Lock2, PY_ARGS("timeout") "Locks the environment mutex with a timeout.")
 #ifdef USE_PYBIND11_PYTHON_BINDINGS
@@ -3160,6 +3278,8 @@ Because race conditions can pop up when trying to lock the openrave environment
                      .def("GetRevision", &PyEnvironmentBase::GetRevision, DOXY_FN(EnvironmentBase, GetRevision))
                      .def("ExtractInfo",&PyEnvironmentBase::ExtractInfo, DOXY_FN(EnvironmentBase,ExtractInfo))
                      .def("UpdateFromInfo",&PyEnvironmentBase::UpdateFromInfo, PY_ARGS("info") DOXY_FN(EnvironmentBase,UpdateFromInfo))
+                     .def("ExtractInfoDelta",&PyEnvironmentBase::ExtractInfoDelta, PY_ARGS("sinceStamp") DOXY_FN(EnvironmentBase,ExtractInfoDelta))
+                     .def("UpdateFromInfoDelta",&PyEnvironmentBase::UpdateFromInfoDelta, PY_ARGS("delta") DOXY_FN(EnvironmentBase,UpdateFromInfoDelta))
                      .def("__enter__",&PyEnvironmentBase::__enter__)
                      .def("__exit__",&PyEnvironmentBase::__exit__)
                      .def("__eq__",&PyEnvironmentBase::__eq__)
@@ -3039,15 +3039,83 @@ object PyKinBody::GetLinkTransformations(bool returndoflastvlaues) const
     return otransforms;
 }
 
+object PyKinBody::GetLinkTransformationsArray(bool returndoflastvlaues) const
+{
+    std::vector<Transform> vtransforms;
+    std::vector<dReal> vdoflastsetvalues;
+    _pbody->GetLinkTransformations(vtransforms, vdoflastsetvalues);
+    std::vector<dReal> values;
+    std::vector<npy_intp> dims;
+    if( GetReturnTransformQuaternions() ) {
+        values.resize(vtransforms.size()*7);
+        dReal* pvalue = values.data();
+        FOREACHC(it, vtransforms) {
+            pvalue[0] = it->rot.x; pvalue[1] = it->rot.y; pvalue[2] = it->rot.z; pvalue[3] = it->rot.w;
+            pvalue[4] = it->trans.x; pvalue[5] = it->trans.y; pvalue[6] = it->trans.z;
+            pvalue += 7;
+        }
+        dims = { npy_intp(vtransforms.size()), 7 };
+    }
+    else {
+        values.resize(vtransforms.size()*16);
+        dReal* pvalue = values.data();
+        FOREACHC(it, vtransforms) {
+            TransformMatrix t(*it);
+            pvalue[0] = t.m[0]; pvalue[1] = t.m[1]; pvalue[2] = t.m[2]; pvalue[3] = t.trans.x;
+            pvalue[4] = t.m[4]; pvalue[5] = t.m[5]; pvalue[6] = t.m[6]; pvalue[7] = t.trans.y;
+            pvalue[8] = t.m[8]; pvalue[9] = t.m[9]; pvalue[10] = t.m[10]; pvalue[11] = t.trans.z;
+            pvalue[12] = 0; pvalue[13] = 0; pvalue[14] = 0; pvalue[15] = 1;
+            pvalue += 16;
+        }
+        dims = { npy_intp(vtransforms.size()), 4, 4 };
+    }
+    object otransforms = toPyArrayMove(std::move(values), dims);
+    if( returndoflastvlaues ) {
+        return py::make_tuple(otransforms, toPyArray(vdoflastsetvalues));
+    }
+    return otransforms;
+}
+
+/// \brief reads the transforms directly from a contiguous numpy array of shape (numlinks,7) poses or (numlinks,4,4) matrices, returns false if transforms is not such an array
+static bool _ExtractContiguousTransforms(const object& transforms, size_t numtransforms, std::vector<Transform>& vtransforms)
+{
+    size_t nelements = 0;
+    const dReal* pvalue = GetContiguousArrayData<dReal>(transforms, nelements);
+    if( pvalue == nullptr || numtransforms == 0 ) {
+        return false;
+    }
+    vtransforms.resize(numtransforms);
+    if( nelements == numtransforms*7 ) {
+        for(size_t i = 0; i < numtransforms; ++i, pvalue += 7) {
+            vtransforms[i] = Transform(Vector(pvalue[0], pvalue[1], pvalue[2], pvalue[3]), Vector(pvalue[4], pvalue[5], pvalue[6]));
+        }
+        return true;
+    }
+    if( nelements == numtransforms*16 ) {
+        TransformMatrix t;
+        for(size_t i = 0; i < numtransforms; ++i, pvalue += 16) {
+            t.m[0] = pvalue[0]; t.m[1] = pvalue[1]; t.m[2] = pvalue[2]; t.trans.x = pvalue[3];
+            t.m[4] = pvalue[4]; t.m[5] = pvalue[5]; t.m[6] = pvalue[6]; t.trans.y = pvalue[7];
+            t.m[8] = pvalue[8]; t.m[9] = pvalue[9]; t.m[10] = pvalue[10]; t.trans.z = pvalue[11];
+            vtransforms[i] = t;
+        }
+        return true;
+    }
+    return false;
+}
+
 void PyKinBody::SetLinkTransformations(object transforms, object odoflastvalues)
 {
     size_t numtransforms = len(transforms);
     if( numtransforms != _pbody->GetLinks().size() ) {
         throw openrave_exception(_("number of input transforms not equal to links"));
     }
-    std::vector<Transform> vtransforms(numtransforms);
-    for(size_t i = 0; i < numtransforms; ++i) {
-        vtransforms[i] = ExtractTransform(transforms[i]);
+    std::vector<Transform> vtransforms;
+    if( !_ExtractContiguousTransforms(transforms, numtransforms, vtransforms) ) {
+        vtransforms.resize(numtransforms);
+        for(size_t i = 0; i < numtransforms; ++i) {
+            vtransforms[i] = ExtractTransform(transforms[i]);
+        }
     }
     if( IS_PYTHONOBJECT_NONE(odoflastvalues) ) {
         _pbody->SetLinkTransformations(vtransforms);
@@ -4319,6 +4387,7 @@ BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(GetInstantaneousTorqueLimits_overloads, G
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(GetNominalTorqueLimits_overloads, GetNominalTorqueLimits, 0, 1)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(GetMaxInertia_overloads, GetMaxInertia, 0, 1)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(GetLinkTransformations_overloads, GetLinkTransformations, 0, 1)
+BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(GetLinkTransformationsArray_overloads, GetLinkTransformationsArray, 0, 1)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SetLinkTransformations_overloads, SetLinkTransformations, 1, 2)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SetDOFLimits_overloads, SetDOFLimits, 2, 3)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SubtractDOFValues_overloads, SubtractDOFValues, 2, 3)
@@ -5084,6 +5153,14 @@ void init_openravepy_kinbody()
                               )
 #else
                          .def("GetLinkTransformations",&PyKinBody::GetLinkTransformations, GetLinkTransformations_overloads(PY_ARGS("returndoflastvlaues") DOXY_FN(KinBody,GetLinkTransformations)))
+#endif
+#ifdef USE_PYBIND11_PYTHON_BINDINGS
+                         .def("GetLinkTransformationsArray", &PyKinBody::GetLinkTransformationsArray,
+                              "returndoflastvlaues"_a = false,
+                              "Returns the link transformations as one array of shape (numlinks,4,4), or (numlinks,7) if returning quaternions."
+                              )
+#else
+                         .def("GetLinkTransformationsArray",&PyKinBody::GetLinkTransformationsArray, GetLinkTransformationsArray_overloads(PY_ARGS("returndoflastvlaues") "Returns the link transformations as one array of shape (numlinks,4,4), or (numlinks,7) if returning quaternions."))
 #endif
                          .def("GetBodyTransformations",&PyKinBody::GetLinkTransformations, DOXY_FN(KinBody,GetLinkTransformations))
 #ifdef USE_PYBIND11_PYTHON_BINDINGS
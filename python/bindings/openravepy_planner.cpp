@@ -240,12 +240,14 @@ bool PyPlannerBase::InitPlan(PyRobotBasePtr pyrobot, PyPlannerParametersPtr ppar
     if( releasegil ) {
         statesaver.reset(new openravepy::PythonThreadSaver());
     }
+    ProfilingScope profilingscope(PC_PlannerInit);
     return _pplanner->InitPlan(probot,parameters);
 }
 
 bool PyPlannerBase::InitPlan(PyRobotBasePtr pbase, const string& params)
 {
     std::stringstream ss(params);
+    ProfilingScope profilingscope(PC_PlannerInit);
     return _pplanner->InitPlan(openravepy::GetRobot(pbase),ss);
 }
 
@@ -256,7 +258,11 @@ object PyPlannerBase::PlanPath(PyTrajectoryBasePtr pytraj, bool releasegil)
     if( releasegil ) {
         statesaver.reset(new openravepy::PythonThreadSaver());
     }
-    PlannerStatus status = _pplanner->PlanPath(ptraj);
+    PlannerStatus status;
+    {
+        ProfilingScope profilingscope(PC_PlannerPlan);
+        status = _pplanner->PlanPath(ptraj);
+    }
     statesaver.reset(); // re-lock GIL
     return openravepy::toPyPlannerStatus(status);
 }
@@ -270,31 +276,34 @@ PyPlannerParametersPtr PyPlannerBase::GetParameters() const
     return PyPlannerParametersPtr(new PyPlannerParameters(params));
 }
 
-PlannerAction PyPlannerBase::_PlanCallback(object fncallback, PyEnvironmentBasePtr pyenv, const PlannerBase::PlannerProgress& progress)
+PlannerAction PyPlannerBase::_PlanCallback(const object& fncallback, PyEnvironmentBasePtr pyenv, const PlannerBase::PlannerProgress& progress)
 {
-    object res;
+    // PlanPath releases the GIL by default, so keep every python object scoped inside the re-acquired state
     PyGILState_STATE gstate = PyGILState_Ensure();
-    try {
-        OPENRAVE_SHARED_PTR<PyPlannerProgress> pyprogress(new PyPlannerProgress(progress));
-        res = fncallback(py::to_object(pyprogress));
-    }
-    catch(...) {
-        RAVELOG_ERROR("exception occured in _PlanCallback:\n");
-        PyErr_Print();
-    }
     PlannerAction ret = PA_None;
-    if( IS_PYTHONOBJECT_NONE(res) || !res ) {
-        ret = PA_None;
-        RAVELOG_WARN("plan callback nothing returning, so executing default action\n");
-    }
-    else {
-        extract_<PlannerAction> xb(res);
-        if( xb.check() ) {
-            ret = (PlannerAction)xb;
+    {
+        object res;
+        try {
+            OPENRAVE_SHARED_PTR<PyPlannerProgress> pyprogress(new PyPlannerProgress(progress));
+            res = fncallback(py::to_object(pyprogress));
         }
-        else {
+        catch(...) {
+            RAVELOG_ERROR("exception occured in _PlanCallback:\n");
+            PyErr_Print();
+        }
+        if( IS_PYTHONOBJECT_NONE(res) || !res ) {
+            ret = PA_None;
             RAVELOG_WARN("plan callback nothing returning, so executing default action\n");
         }
+        else {
+            extract_<PlannerAction> xb(res);
+            if( xb.check() ) {
+                ret = (PlannerAction)xb;
+            }
+            else {
+                RAVELOG_WARN("plan callback nothing returning, so executing default action\n");
+            }
+        }
     }
     PyGILState_Release(gstate);
     return ret;
@@ -90,15 +90,36 @@ object pyGetReverseTrajectory(PyTrajectoryBasePtr pytraj)
     return py::to_object(openravepy::toPyTrajectory(OpenRAVE::planningutils::GetReverseTrajectory(openravepy::GetTrajectory(pytraj)),openravepy::toPyEnvironment(pytraj)));
 }
 
+py::list pyComputeBisectionOrder(size_t numitems)
+{
+    py::list oorder;
+    std::vector<size_t> vorder;
+    OpenRAVE::planningutils::ComputeBisectionOrder(numitems, vorder);
+    FOREACHC(itindex, vorder) {
+        oorder.append(*itindex);
+    }
+    return oorder;
+}
+
 void pyVerifyTrajectory(object pyparameters, PyTrajectoryBasePtr pytraj, dReal samplingstep)
 {
-    OpenRAVE::planningutils::VerifyTrajectory(openravepy::GetPlannerParametersConst(pyparameters), openravepy::GetTrajectory(pytraj),samplingstep);
+    PlannerBase::PlannerParametersConstPtr parameters = openravepy::GetPlannerParametersConst(pyparameters);
+    TrajectoryBasePtr ptraj = openravepy::GetTrajectory(pytraj);
+    openravepy::PythonThreadSaver threadsaver;
+    OpenRAVE::planningutils::VerifyTrajectory(parameters, ptraj, samplingstep);
 }
 
-// GIL is assumed locked
+// GIL is assumed locked, released while the planner runs
 object pySmoothActiveDOFTrajectory(PyTrajectoryBasePtr pytraj, PyRobotBasePtr pyrobot, dReal fmaxvelmult=1.0, dReal fmaxaccelmult=1.0, const std::string& plannername="", const std::string& plannerparameters="")
 {
-    return openravepy::toPyPlannerStatus(OpenRAVE::planningutils::SmoothActiveDOFTrajectory(openravepy::GetTrajectory(pytraj),openravepy::GetRobot(pyrobot),fmaxvelmult,fmaxaccelmult,plannername,plannerparameters));
+    TrajectoryBasePtr ptraj = openravepy::GetTrajectory(pytraj);
+    RobotBasePtr probot = openravepy::GetRobot(pyrobot);
+    PlannerStatus status;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        status = OpenRAVE::planningutils::SmoothActiveDOFTrajectory(ptraj,probot,fmaxvelmult,fmaxaccelmult,plannername,plannerparameters);
+    }
+    return openravepy::toPyPlannerStatus(status);
 }
 
 class PyActiveDOFTrajectorySmoother
@@ -126,22 +147,43 @@ public:
 
 typedef OPENRAVE_SHARED_PTR<PyActiveDOFTrajectorySmoother> PyActiveDOFTrajectorySmootherPtr;
 
-// assume python GIL is locked
+// assume python GIL is locked, released while the planner runs
 object pySmoothAffineTrajectory(PyTrajectoryBasePtr pytraj, object omaxvelocities, object omaxaccelerations, const std::string& plannername="", const std::string& plannerparameters="")
 {
-    return openravepy::toPyPlannerStatus(OpenRAVE::planningutils::SmoothAffineTrajectory(openravepy::GetTrajectory(pytraj),ExtractArray<dReal>(omaxvelocities), ExtractArray<dReal>(omaxaccelerations),plannername,plannerparameters));
+    TrajectoryBasePtr ptraj = openravepy::GetTrajectory(pytraj);
+    std::vector<dReal> vmaxvelocities = ExtractArray<dReal>(omaxvelocities);
+    std::vector<dReal> vmaxaccelerations = ExtractArray<dReal>(omaxaccelerations);
+    PlannerStatus status;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        status = OpenRAVE::planningutils::SmoothAffineTrajectory(ptraj,vmaxvelocities,vmaxaccelerations,plannername,plannerparameters);
+    }
+    return openravepy::toPyPlannerStatus(status);
 }
 
-// assume python GIL is locked
+// assume python GIL is locked, released while the planner runs
 object pySmoothTrajectory(PyTrajectoryBasePtr pytraj, dReal fmaxvelmult=1.0, dReal fmaxaccelmult=1.0, const std::string& plannername="", const std::string& plannerparameters="")
 {
-    return openravepy::toPyPlannerStatus(OpenRAVE::planningutils::SmoothTrajectory(openravepy::GetTrajectory(pytraj),fmaxvelmult,fmaxaccelmult,plannername,plannerparameters));
+    TrajectoryBasePtr ptraj = openravepy::GetTrajectory(pytraj);
+    PlannerStatus status;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        status = OpenRAVE::planningutils::SmoothTrajectory(ptraj,fmaxvelmult,fmaxaccelmult,plannername,plannerparameters);
+    }
+    return openravepy::toPyPlannerStatus(status);
 }
 
-// assume python GIL is locked
+// assume python GIL is locked, released while the planner runs
 object pyRetimeActiveDOFTrajectory(PyTrajectoryBasePtr pytraj, PyRobotBasePtr pyrobot, bool hastimestamps=false, dReal fmaxvelmult=1.0, dReal fmaxaccelmult=1.0, const std::string& plannername="", const std::string& plannerparameters="")
 {
-    return openravepy::toPyPlannerStatus(OpenRAVE::planningutils::RetimeActiveDOFTrajectory(openravepy::GetTrajectory(pytraj),openravepy::GetRobot(pyrobot),hastimestamps,fmaxvelmult,fmaxaccelmult,plannername,plannerparameters));
+    TrajectoryBasePtr ptraj = openravepy::GetTrajectory(pytraj);
+    RobotBasePtr probot = openravepy::GetRobot(pyrobot);
+    PlannerStatus status;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        status = OpenRAVE::planningutils::RetimeActiveDOFTrajectory(ptraj,probot,hastimestamps,fmaxvelmult,fmaxaccelmult,plannername,plannerparameters);
+    }
+    return openravepy::toPyPlannerStatus(status);
 }
 
 class PyActiveDOFTrajectoryRetimer
@@ -263,6 +305,10 @@ public:
         _pconstraints->SetTorqueLimitMode(static_cast<DynamicsConstraintsType>(torquelimitmode));
     }
 
+    void SetAdaptiveStepping(bool bAdaptiveStepping) {
+        _pconstraints->SetAdaptiveStepping(bAdaptiveStepping);
+    }
+
 
     PyEnvironmentBasePtr _pyenv;
     OpenRAVE::planningutils::DynamicsCollisionConstraintPtr _pconstraints;
@@ -272,12 +318,26 @@ typedef OPENRAVE_SHARED_PTR<PyDynamicsCollisionConstraint> PyDynamicsCollisionCo
 
 object pyRetimeAffineTrajectory(PyTrajectoryBasePtr pytraj, object omaxvelocities, object omaxaccelerations, bool hastimestamps=false, const std::string& plannername="", const std::string& plannerparameters="")
 {
-    return openravepy::toPyPlannerStatus(OpenRAVE::planningutils::RetimeAffineTrajectory(openravepy::GetTrajectory(pytraj),ExtractArray<dReal>(omaxvelocities), ExtractArray<dReal>(omaxaccelerations),hastimestamps,plannername,plannerparameters));
+    TrajectoryBasePtr ptraj = openravepy::GetTrajectory(pytraj);
+    std::vector<dReal> vmaxvelocities = ExtractArray<dReal>(omaxvelocities);
+    std::vector<dReal> vmaxaccelerations = ExtractArray<dReal>(omaxaccelerations);
+    PlannerStatus status;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        status = OpenRAVE::planningutils::RetimeAffineTrajectory(ptraj,vmaxvelocities,vmaxaccelerations,hastimestamps,plannername,plannerparameters);
+    }
+    return openravepy::toPyPlannerStatus(status);
 }
 
 object pyRetimeTrajectory(PyTrajectoryBasePtr pytraj, bool hastimestamps=false, dReal fmaxvelmult=1.0, dReal fmaxaccelmult=1.0, const std::string& plannername="", const std::string& plannerparameters="")
 {
-    return openravepy::toPyPlannerStatus(OpenRAVE::planningutils::RetimeTrajectory(openravepy::GetTrajectory(pytraj),hastimestamps,fmaxvelmult,fmaxaccelmult,plannername,plannerparameters));
+    TrajectoryBasePtr ptraj = openravepy::GetTrajectory(pytraj);
+    PlannerStatus status;
+    {
+        openravepy::PythonThreadSaver threadsaver;
+        status = OpenRAVE::planningutils::RetimeTrajectory(ptraj,hastimestamps,fmaxvelmult,fmaxaccelmult,plannername,plannerparameters);
+    }
+    return openravepy::toPyPlannerStatus(status);
 }
 
 size_t pyExtendWaypoint(int index, object odofvalues, object odofvelocities, PyTrajectoryBasePtr pytraj, PyPlannerBasePtr pyplanner)
@@ -537,6 +597,12 @@ void InitPlanningUtils()
                                .def("ReverseTrajectory",planningutils::pyReverseTrajectory, PY_ARGS("trajectory") DOXY_FN1(ReverseTrajectory))
                                .staticmethod("ReverseTrajectory")
 #endif
+#ifdef USE_PYBIND11_PYTHON_BINDINGS
+                               .def_static("ComputeBisectionOrder",planningutils::pyComputeBisectionOrder, PY_ARGS("numitems") DOXY_FN1(ComputeBisectionOrder))
+#else
+                               .def("ComputeBisectionOrder",planningutils::pyComputeBisectionOrder, PY_ARGS("numitems") DOXY_FN1(ComputeBisectionOrder))
+                               .staticmethod("ComputeBisectionOrder")
+#endif
 #ifdef USE_PYBIND11_PYTHON_BINDINGS
                                .def_static("VerifyTrajectory",planningutils::pyVerifyTrajectory, PY_ARGS("parameters","trajectory","samplingstep") DOXY_FN1(VerifyTrajectory))
 #else
@@ -883,6 +949,7 @@ void InitPlanningUtils()
         .def("SetFilterMask", &planningutils::PyDynamicsCollisionConstraint::SetFilterMask, PY_ARGS("filtermask") DOXY_FN(planningutils::DynamicsCollisionConstraint,SetFilterMask))
         .def("SetPerturbation", &planningutils::PyDynamicsCollisionConstraint::SetPerturbation, PY_ARGS("parameters") DOXY_FN(planningutils::DynamicsCollisionConstraint,SetPerturbation))
         .def("SetTorqueLimitMode", &planningutils::PyDynamicsCollisionConstraint::SetTorqueLimitMode, PY_ARGS("torquelimitmode") DOXY_FN(planningutils::DynamicsCollisionConstraint,SetTorqueLimitMode))
+        .def("SetAdaptiveStepping", &planningutils::PyDynamicsCollisionConstraint::SetAdaptiveStepping, PY_ARGS("adaptivestepping") DOXY_FN(planningutils::DynamicsCollisionConstraint,SetAdaptiveStepping))
         ;
     }
 }
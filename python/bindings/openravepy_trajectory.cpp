@@ -52,6 +52,27 @@ using py::def;
 
 namespace numeric = py::numeric;
 
+/// \brief extracts the waypoint data passed to Insert. 2-D arrays hold one waypoint per row and are flattened
+static std::vector<dReal> _ExtractWaypointData(const object& odata)
+{
+    PyObject* pyo = odata.ptr();
+    if( pyo != nullptr && PyArray_Check(pyo) && PyArray_NDIM(reinterpret_cast<PyArrayObject*>(pyo)) == 2 ) {
+        size_t nelements = 0;
+        const dReal* pdata = GetContiguousArrayData<dReal>(odata, nelements);
+        if( pdata != nullptr ) {
+            return std::vector<dReal>(pdata, pdata + nelements);
+        }
+        std::vector<dReal> vdata;
+        const size_t nrows = len(odata);
+        for(size_t irow = 0; irow < nrows; ++irow) {
+            std::vector<dReal> vrow = ExtractArray<dReal>(object(odata[irow]));
+            vdata.insert(vdata.end(), vrow.begin(), vrow.end());
+        }
+        return vdata;
+    }
+    return ExtractArray<dReal>(odata);
+}
+
 PyTrajectoryBase::PyTrajectoryBase(TrajectoryBasePtr pTrajectory, PyEnvironmentBasePtr pyenv) : PyInterfaceBase(pTrajectory, pyenv),_ptrajectory(pTrajectory) {
 }
 PyTrajectoryBase::~PyTrajectoryBase() {
@@ -68,25 +89,25 @@ void PyTrajectoryBase::Init(OPENRAVE_SHARED_PTR<ConfigurationSpecification::Grou
 
 void PyTrajectoryBase::Insert(size_t index, object odata)
 {
-    std::vector<dReal> vdata = ExtractArray<dReal>(odata);
+    std::vector<dReal> vdata = _ExtractWaypointData(odata);
     _ptrajectory->Insert(index,vdata);
 }
 
 void PyTrajectoryBase::Insert(size_t index, object odata, bool bOverwrite)
 {
-    std::vector<dReal> vdata = ExtractArray<dReal>(odata);
+    std::vector<dReal> vdata = _ExtractWaypointData(odata);
     _ptrajectory->Insert(index,vdata,bOverwrite);
 }
 
 void PyTrajectoryBase::Insert(size_t index, object odata, PyConfigurationSpecificationPtr pyspec)
 {
-    std::vector<dReal> vdata = ExtractArray<dReal>(odata);
+    std::vector<dReal> vdata = _ExtractWaypointData(odata);
     _ptrajectory->Insert(index,vdata,openravepy::GetConfigurationSpecification(pyspec));
 }
 
 void PyTrajectoryBase::Insert(size_t index, object odata, PyConfigurationSpecificationPtr pyspec, bool bOverwrite)
 {
-    std::vector<dReal> vdata = ExtractArray<dReal>(odata);
+    std::vector<dReal> vdata = _ExtractWaypointData(odata);
     _ptrajectory->Insert(index,vdata,openravepy::GetConfigurationSpecification(pyspec),bOverwrite);
 }
 
@@ -149,18 +170,8 @@ object PyTrajectoryBase::SamplePoints2D(object otimes) const
     _ptrajectory->SamplePoints(values,vtimes);
 
     const int numdof = _ptrajectory->GetConfigurationSpecification().GetDOF();
-#ifdef USE_PYBIND11_PYTHON_BINDINGS
-    py::array_t<dReal> pypos = toPyArray(values);
-    pypos.resize({(int) values.size()/numdof, numdof});
-    return pypos;
-#else // USE_PYBIND11_PYTHON_BINDINGS
-    npy_intp dims[] = { npy_intp(values.size()/numdof), npy_intp(numdof) };
-    PyObject *pypos = PyArray_SimpleNew(2,dims, sizeof(dReal)==8 ? PyArray_DOUBLE : PyArray_FLOAT);
-    if( !values.empty() ) {
-        memcpy(PyArray_DATA(pypos), values.data(), values.size()*sizeof(values[0]));
-    }
-    return py::to_array_astype<dReal>(pypos);
-#endif // USE_PYBIND11_PYTHON_BINDINGS
+    std::vector<npy_intp> dims { npy_intp(values.size()/numdof), npy_intp(numdof) };
+    return toPyArrayMove(std::move(values), dims);
 }
 
 object PyTrajectoryBase::SamplePoints2D(object otimes, PyConfigurationSpecificationPtr pyspec) const
@@ -171,18 +182,8 @@ object PyTrajectoryBase::SamplePoints2D(object otimes, PyConfigurationSpecificat
     _ptrajectory->SamplePoints(values, vtimes, spec);
 
     const int numdof = spec.GetDOF();
-#ifdef USE_PYBIND11_PYTHON_BINDINGS
-    py::array_t<dReal> pypos = toPyArray(values);
-    pypos.resize({(int) values.size()/numdof, numdof});
-    return pypos;
-#else // USE_PYBIND11_PYTHON_BINDINGS
-    npy_intp dims[] = { npy_intp(values.size()/numdof), npy_intp(numdof) };
-    PyObject *pypos = PyArray_SimpleNew(2,dims, sizeof(dReal)==8 ? PyArray_DOUBLE : PyArray_FLOAT);
-    if( !values.empty() ) {
-        memcpy(PyArray_DATA(pypos), values.data(), values.size()*sizeof(values[0]));
-    }
-    return py::to_array_astype<dReal>(pypos);
-#endif // USE_PYBIND11_PYTHON_BINDINGS
+    std::vector<npy_intp> dims { npy_intp(values.size()/numdof), npy_intp(numdof) };
+    return toPyArrayMove(std::move(values), dims);
 }
 
 object PyTrajectoryBase::SamplePoints2D(object otimes, OPENRAVE_SHARED_PTR<ConfigurationSpecification::Group> pygroup) const
@@ -203,14 +204,16 @@ object PyTrajectoryBase::GetWaypoints(size_t startindex, size_t endindex) const
 {
     std::vector<dReal> values;
     _ptrajectory->GetWaypoints(startindex,endindex,values);
-    return toPyArray(values);
+    std::vector<npy_intp> dims { npy_intp(values.size()) };
+    return toPyArrayMove(std::move(values), dims);
 }
 
 object PyTrajectoryBase::GetWaypoints(size_t startindex, size_t endindex, PyConfigurationSpecificationPtr pyspec) const
 {
     std::vector<dReal> values;
     _ptrajectory->GetWaypoints(startindex,endindex,values,openravepy::GetConfigurationSpecification(pyspec));
-    return toPyArray(values);
+    std::vector<npy_intp> dims { npy_intp(values.size()) };
+    return toPyArrayMove(std::move(values), dims);
 }
 
 object PyTrajectoryBase::GetWaypoints(size_t startindex, size_t endindex, OPENRAVE_SHARED_PTR<ConfigurationSpecification::Group> pygroup) const
@@ -225,19 +228,8 @@ object PyTrajectoryBase::GetWaypoints2D(size_t startindex, size_t endindex) cons
     std::vector<dReal> values;
     _ptrajectory->GetWaypoints(startindex,endindex,values);
     const int numdof = _ptrajectory->GetConfigurationSpecification().GetDOF();
-
-#ifdef USE_PYBIND11_PYTHON_BINDINGS
-    py::array_t<dReal> pypos = toPyArray(values);
-    pypos.resize({(int) values.size()/numdof, numdof});
-    return pypos;
-#else // USE_PYBIND11_PYTHON_BINDINGS
-    npy_intp dims[] = { npy_intp(values.size()/numdof), npy_intp(numdof) };
-    PyObject *pypos = PyArray_SimpleNew(2,dims, sizeof(dReal)==8 ? PyArray_DOUBLE : PyArray_FLOAT);
-    if( !values.empty() ) {
-        memcpy(PyArray_DATA(pypos), values.data(), values.size()*sizeof(values[0]));
-    }
-    return py::to_array_astype<dReal>(pypos);
-#endif // USE_PYBIND11_PYTHON_BINDINGS
+    std::vector<npy_intp> dims { npy_intp(values.size()/numdof), npy_intp(numdof) };
+    return toPyArrayMove(std::move(values), dims);
 }
 
 object PyTrajectoryBase::__getitem__(int index) const
@@ -317,19 +309,8 @@ object PyTrajectoryBase::GetWaypoints2D(size_t startindex, size_t endindex, PyCo
     ConfigurationSpecification spec = openravepy::GetConfigurationSpecification(pyspec);
     _ptrajectory->GetWaypoints(startindex,endindex,values,spec);
     const int numdof = spec.GetDOF();
-    const int nvalues = values.size();
-#ifdef USE_PYBIND11_PYTHON_BINDINGS
-    py::array_t<dReal> pypos = toPyArray(values);
-    pypos.resize({nvalues/numdof, numdof});
-    return pypos;
-#else // USE_PYBIND11_PYTHON_BINDINGS
-    npy_intp dims[] = { npy_intp(nvalues/numdof), npy_intp(numdof) };
-    PyObject *pypos = PyArray_SimpleNew(2,dims, sizeof(dReal)==8 ? PyArray_DOUBLE : PyArray_FLOAT);
-    if( !values.empty() ) {
-        memcpy(PyArray_DATA(pypos), values.data(), nvalues*sizeof(values[0]));
-    }
-    return py::to_array_astype<dReal>(pypos);
-#endif // USE_PYBIND11_PYTHON_BINDINGS
+    std::vector<npy_intp> dims { npy_intp(values.size()/numdof), npy_intp(numdof) };
+    return toPyArrayMove(std::move(values), dims);
 }
 
 object PyTrajectoryBase::GetWaypoints2D(size_t startindex, size_t endindex, OPENRAVE_SHARED_PTR<ConfigurationSpecification::Group> pygroup) const
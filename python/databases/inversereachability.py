@@ -56,7 +56,7 @@ if not __openravepy_build_doc__:
 else:
     from numpy import array
 
-from ..openravepy_int import RaveFindDatabaseFile, RaveCreateRobot, IkParameterization, rotationMatrixFromAxisAngle, poseFromMatrix, matrixFromPose, matrixFromQuat, matrixFromAxisAngle, poseMult, quatFromAxisAngle, IkFilterOptions
+from ..openravepy_int import RaveFindDatabaseFile, RaveCreateRobot, RaveCreateSpaceSampler, IkParameterization, rotationMatrixFromAxisAngle, poseFromMatrix, matrixFromPose, matrixFromQuat, matrixFromAxisAngle, poseMult, quatFromAxisAngle, IkFilterOptions
 from ..openravepy_ext import quatArrayTMult, quatArrayTDist, poseMultArrayT, normalizeZRotation
 from . import DatabaseGenerator
 from .. import pyANN
@@ -121,6 +121,32 @@ class InverseReachabilityModel(DatabaseGenerator):
     def save(self):
         DatabaseGenerator.save(self,(self.equivalenceclasses,self.rotweight,self.xyzdelta,self.quatdelta,self.jointvalues))
 
+    def saveNative(self,filename):
+        """saves the equivalence classes in the binary format read by the InverseReachability space sampler"""
+        jointvalues = array(self.jointvalues if self.jointvalues is not None else [],float64)
+        with open(filename,'wb') as f:
+            f.write(b'ORINVRCH')
+            f.write(array([1,len(self.equivalenceclasses)],uint32).tostring())
+            f.write(array([self.rotweight,self.xyzdelta,self.quatdelta],float64).tostring())
+            f.write(array([len(jointvalues),0],uint32).tostring())
+            f.write(jointvalues.tostring())
+            for mean,std,points in self.equivalenceclasses:
+                f.write(array(r_[mean,std],float64).tostring())
+                f.write(array([len(points),0],uint32).tostring())
+                f.write(array(points[:,0:4],float64).tostring())
+
+    def createNativeSampler(self,filename=None):
+        """returns an InverseReachability space sampler initialized with the equivalence classes.
+
+        Use its SetGrasps and SampleVerified commands instead of sampleBaseDistributionIterator to sample and verify base placements natively.
+        """
+        if filename is None:
+            filename = self.getfilename(False)+'.native'
+        self.saveNative(filename)
+        sampler = RaveCreateSpaceSampler(self.env,'InverseReachability %s %s'%(self.robot.GetName(),self.manip.GetName()))
+        sampler.SendCommand('Load %s'%filename)
+        return sampler
+
     def getfilename(self,read=False):
         if self.id is None:
             basename='invreachability.' + self.manip.GetStructureHash() + '.pp'
@@ -67,7 +67,7 @@ else:
 
 import numpy
 from ..openravepy_ext import transformPoints
-from ..openravepy_int import RaveFindDatabaseFile, RaveDestroy, Environment, KinBody, rotationMatrixFromQuat, quatRotateDirection, rotationMatrixFromAxisAngle, RaveGetDefaultViewerType
+from ..openravepy_int import RaveFindDatabaseFile, RaveDestroy, RaveCreateModule, Environment, KinBody, rotationMatrixFromQuat, quatRotateDirection, rotationMatrixFromAxisAngle, RaveGetDefaultViewerType
 from . import DatabaseGenerator
 from .. import pyANN
 import convexdecomposition
@@ -84,9 +84,12 @@ log = logging.getLogger('openravepy.'+__name__.split('.',2)[-1])
 class LinkStatisticsModel(DatabaseGenerator):
     """Computes the convex decomposition of all of the robot's links"""
     
-    grabbedjointspheres = None # a list of (grabbedinfo, dict) that stores swept spheres of each joint. key is joint index. 
-    def __init__(self,robot):
+    grabbedjointspheres = None # a list of (grabbedinfo, dict) that stores swept spheres of each joint. key is joint index. The native spheres also store the max distance of the geometry from the joint axis.
+    sweptvolumes = None # swept volume of each joint of the last native computation. key is joint index.
+    usenative = True # if True, computes the joint spheres with the LinkStatistics module when it is available, otherwise in python. The spheres are the same, the native ones add the swept volumes and the max axis distances used for the resolutions.
+    def __init__(self,robot,usenative=True):
         DatabaseGenerator.__init__(self,robot=robot)
+        self.usenative = usenative
     
     def has(self):
         return self.grabbedjointspheres is not None and len(self.grabbedjointspheres) > 0
@@ -138,7 +141,10 @@ class LinkStatisticsModel(DatabaseGenerator):
             for ijoint in range(len(self.robot.GetJoints())):
                 if ijoint in jointspheres:
                     dofindex = self.robot.GetJoints()[ijoint].GetDOFIndex()
-                    if abs(jointspheres[ijoint][1]) > 1e-7:
+                    # the native statistics have the max displacement of the geometry per radian, which is tighter than the sphere radius
+                    if len(jointspheres[ijoint]) > 2 and abs(jointspheres[ijoint][2]) > 1e-7:
+                        resolutions[dofindex] = xyzdelta/jointspheres[ijoint][2]
+                    elif abs(jointspheres[ijoint][1]) > 1e-7:
                         # sometimes there are no geometries attached for prototype robots...
                         resolutions[dofindex] = xyzdelta/jointspheres[ijoint][1]
             self.robot.SetDOFResolutions(resolutions)
@@ -212,6 +218,11 @@ class LinkStatisticsModel(DatabaseGenerator):
         return jointspheres
     
     def _ComputeJointSpheres(self):
+        if self.usenative:
+            jointspheres = self._ComputeJointSpheresNative()
+            if jointspheres is not None:
+                return jointspheres
+        
         jointspheres = {}
         for j in self.robot.GetDependencyOrderedJoints()[::-1]:
             if not j.IsRevolute(0):
@@ -250,6 +261,30 @@ class LinkStatisticsModel(DatabaseGenerator):
             jointspheres[j.GetJointIndex()] = (numpy.around(newspherepos, 8), numpy.around(newsphereradius, 8))
         return jointspheres
     
+    def _ComputeJointSpheresNative(self,xyzdelta=None):
+        """computes the joint spheres at the current configuration with the LinkStatistics module, which also voxelizes the collision meshes for the swept volumes and caches the results. The spheres are the same as the python ones, followed by the max distance of the geometry from the joint axis. Returns None if the module is not available.
+        """
+        module = RaveCreateModule(self.env,'LinkStatistics')
+        if module is None:
+            return None
+        if xyzdelta is None:
+            xyzdelta = 0.005/self.env.GetUnit()[1]
+        try:
+            values = [float(s) for s in module.SendCommand('ComputeJointStatistics robot %s xyzdelta %.15e'%(self.robot.GetName(),xyzdelta)).split()]
+        except Exception, e:
+            log.warn(u'failed to compute native link statistics, falling back to python: %s', e)
+            return None
+        
+        jointspheres = {}
+        self.sweptvolumes = {}
+        for i in range(int(values[0])):
+            jointindex,sweptvolume,px,py,pz,sphereradius,maxaxisdist = values[1+7*i:8+7*i]
+            jointindex = int(jointindex)
+            self.sweptvolumes[jointindex] = sweptvolume
+            if self.robot.GetJoints()[jointindex].IsRevolute(0):
+                jointspheres[jointindex] = (numpy.around(array((px,py,pz)), 8), numpy.around(sphereradius, 8), numpy.around(maxaxisdist, 8))
+        return jointspheres
+    
     def show(self,options=None):
         pass
     
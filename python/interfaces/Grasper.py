@@ -119,8 +119,10 @@ class Grasper:
         contacts = reshape(array([float64(s) for s in resvalues],float64),(len(resvalues)/6,6))
         return contacts,finalconfig,mindist,volume
 
-    def GraspThreaded(self,approachrays,standoffs,preshapes,rolls,manipulatordirections=None,target=None,transformrobot=True,onlycontacttarget=True,tightgrasp=False,graspingnoise=None,forceclosurethreshold=None,collisionchecker=None,translationstepmult=None,numthreads=None,startindex=None,maxgrasps=None,finestep=None):
+    def GraspThreaded(self,approachrays,standoffs,preshapes,rolls,manipulatordirections=None,target=None,transformrobot=True,onlycontacttarget=True,tightgrasp=False,graspingnoise=None,forceclosurethreshold=None,collisionchecker=None,translationstepmult=None,numthreads=None,startindex=None,maxgrasps=None,finestep=None,randomseed=None):
         """See :ref:`module-grasper-graspthreaded`
+
+        The grasps are returned in the order of their ids and the grasping noise is seeded from randomseed and the grasp id, so the results do not depend on numthreads.
         """
         cmd = 'GraspThreaded '
         if target is not None:
@@ -142,6 +144,8 @@ class Grasper:
             cmd += 'finestep %.15e '%finestep
         if numthreads is not None:
             cmd += 'numthreads %d '%numthreads
+        if randomseed is not None:
+            cmd += 'randomseed %d '%randomseed
         cmd += 'approachrays %d '%len(approachrays)
         for f in approachrays.flat:
             cmd += str(f) + ' '
@@ -129,6 +129,35 @@ class VisualFeedback:
         
         return int(res)
     
+    def ComputeVisibilityMap(self,transres=None,rotres=None,checkrigid=None):
+        """See :ref:`module-visualfeedback-computevisibilitymap`
+        """
+        cmd = 'ComputeVisibilityMap '
+        if transres is not None:
+            cmd += 'transres %.15e '%transres
+        if rotres is not None:
+            cmd += 'rotres %.15e '%rotres
+        if checkrigid is not None:
+            cmd += 'checkrigid %d '%checkrigid
+        res = self.prob.SendCommand(cmd)
+        if res is None:
+            raise PlanningError()
+        return int(res)
+    def SaveVisibilityMap(self,filename):
+        """See :ref:`module-visualfeedback-savevisibilitymap`
+        """
+        res = self.prob.SendCommand('SaveVisibilityMap %s'%filename)
+        if res is None:
+            raise PlanningError()
+        return res
+    def LoadVisibilityMap(self,filename):
+        """See :ref:`module-visualfeedback-loadvisibilitymap`
+        """
+        res = self.prob.SendCommand('LoadVisibilityMap %s'%filename)
+        if res is None:
+            raise PlanningError()
+        return int(res)
+    
     def ComputeVisibleConfiguration(self,pose):
         """See :ref:`module-visualfeedback-computevisibleconfiguration`
         """
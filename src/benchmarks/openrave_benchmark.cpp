@@ -0,0 +1,401 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2006-2016 Rosen Diankov <rosen.diankov@gmail.com>
+//
+// This file is part of OpenRAVE.
+// OpenRAVE is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+/** \file openrave_benchmark.cpp
+    \brief Measures the throughput of the core hot paths on reference robots.
+
+    Usage:
+    \verbatim
+    openrave_benchmark [--robot filename]... [--manip name] [--iterations N] [--trials N] [--seed N] [--filter substring]
+                       [--output results.json] [--compare baseline.json] [--tolerance 0.1] [--checker name]
+    \endverbatim
+
+    Every benchmark is run for a number of trials of a fixed number of iterations on inputs generated from a fixed
+    seed, so two runs on the same machine measure the same work. The results are written as JSON. When --compare is
+    given, the median time per iteration of every benchmark is compared against the baseline file and the program
+    returns 1 if any benchmark is slower by more than the tolerance.
+ */
+#include "../libopenrave-core/openrave-core.h"
+#include <openrave/openravejson.h>
+#include <openrave/planningutils.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <boost/function.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+#include <rapidjson/istreamwrapper.h>
+#include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/prettywriter.h>
+
+using namespace OpenRAVE;
+using namespace std;
+
+namespace {
+
+struct BenchmarkOptions
+{
+    BenchmarkOptions() : manipname(), iterations(1000), trials(5), seed(0), tolerance(0.1) {
+    }
+
+    std::vector<std::string> vrobotfilenames;
+    std::string manipname; ///< if empty, uses the active manipulator of the robot
+    std::string checkername; ///< if empty, uses the default collision checker of the environment
+    int iterations;
+    int trials;
+    uint32_t seed;
+    std::string filter; ///< only run benchmarks whose name contains this substring
+    std::string outputfilename;
+    std::string comparefilename;
+    dReal tolerance;
+};
+
+struct BenchmarkResult
+{
+    std::string name;
+    int iterations;
+    std::vector<double> vtrialns; ///< nanoseconds per iteration of every trial
+    double medianns, minns, meanns;
+};
+
+/// \brief runs fn(iteration) for opts.trials trials of numiterations each after one warm up trial
+void RunBenchmark(const std::string& name, int numiterations, const BenchmarkOptions& opts, const boost::function<void(int)>& fn, std::vector<BenchmarkResult>& vresults)
+{
+    if( opts.filter.size() > 0 && name.find(opts.filter) == std::string::npos ) {
+        return;
+    }
+    numiterations = max(1, numiterations);
+    BenchmarkResult result;
+    result.name = name;
+    result.iterations = numiterations;
+    for(int itrial = -1; itrial < opts.trials; ++itrial) {
+        uint64_t starttime = RaveGetProfilingTime();
+        for(int iteration = 0; iteration < numiterations; ++iteration) {
+            fn(iteration);
+        }
+        uint64_t duration = RaveGetProfilingTime() - starttime;
+        if( itrial >= 0 ) {
+            result.vtrialns.push_back((double)duration/(double)numiterations);
+        }
+    }
+    std::vector<double> vsorted = result.vtrialns;
+    std::sort(vsorted.begin(), vsorted.end());
+    result.medianns = vsorted.at(vsorted.size()/2);
+    result.minns = vsorted.at(0);
+    result.meanns = 0;
+    for(size_t itrial = 0; itrial < vsorted.size(); ++itrial) {
+        result.meanns += vsorted[itrial];
+    }
+    result.meanns /= vsorted.size();
+    RAVELOG_INFO_FORMAT("%s: median %.1fns, min %.1fns over %d trials of %d iterations", name%result.medianns%result.minns%opts.trials%numiterations);
+    vresults.push_back(result);
+}
+
+/// \brief random configurations inside the joint limits of the active dofs
+void SampleConfigurations(RobotBasePtr probot, int numconfigs, uint32_t seed, std::vector< std::vector<dReal> >& vconfigs)
+{
+    boost::mt19937 rng(seed);
+    std::vector<dReal> vlower, vupper;
+    probot->GetActiveDOFLimits(vlower, vupper);
+    vconfigs.resize(numconfigs);
+    for(size_t iconfig = 0; iconfig < vconfigs.size(); ++iconfig) {
+        vconfigs[iconfig].resize(vlower.size());
+        for(size_t idof = 0; idof < vlower.size(); ++idof) {
+            // continuous joints have huge limits
+            dReal lower = max(vlower[idof], dReal(-PI)), upper = min(vupper[idof], dReal(PI));
+            vconfigs[iconfig][idof] = boost::random::uniform_real_distribution<dReal>(lower, upper)(rng);
+        }
+    }
+}
+
+void BenchmarkRobot(EnvironmentBasePtr penv, const std::string& robotfilename, const BenchmarkOptions& opts, std::vector<BenchmarkResult>& vresults)
+{
+    EnvironmentMutex::scoped_lock lock(penv->GetMutex());
+    penv->Reset();
+    RobotBasePtr probot = penv->ReadRobotURI(RobotBasePtr(), robotfilename);
+    if( !probot ) {
+        throw OPENRAVE_EXCEPTION_FORMAT("failed to load robot %s", robotfilename, ORE_InvalidArguments);
+    }
+    penv->Add(probot);
+    if( opts.manipname.size() > 0 ) {
+        probot->SetActiveManipulator(opts.manipname);
+    }
+    RobotBase::ManipulatorPtr pmanip = probot->GetActiveManipulator();
+    if( !pmanip ) {
+        throw OPENRAVE_EXCEPTION_FORMAT("robot %s does not have an active manipulator", probot->GetName(), ORE_InvalidArguments);
+    }
+    probot->SetActiveDOFs(pmanip->GetArmIndices());
+    std::string prefix = probot->GetName() + "/";
+
+    const int numconfigs = 256;
+    std::vector< std::vector<dReal> > vconfigs;
+    SampleConfigurations(probot, numconfigs, opts.seed, vconfigs);
+    const std::vector<int>& varmindices = pmanip->GetArmIndices();
+
+    RunBenchmark(prefix + "SetDOFValues", opts.iterations, opts, [&](int iteration) {
+        probot->SetDOFValues(vconfigs[iteration%numconfigs], KinBody::CLA_Nothing, varmindices);
+    }, vresults);
+
+    CollisionReportPtr report(new CollisionReport());
+    RunBenchmark(prefix + "CheckCollision", opts.iterations, opts, [&](int iteration) {
+        probot->SetDOFValues(vconfigs[iteration%numconfigs], KinBody::CLA_Nothing, varmindices);
+        penv->CheckCollision(KinBodyConstPtr(probot), report);
+    }, vresults);
+
+    RunBenchmark(prefix + "CheckSelfCollision", opts.iterations, opts, [&](int iteration) {
+        probot->SetDOFValues(vconfigs[iteration%numconfigs], KinBody::CLA_Nothing, varmindices);
+        probot->CheckSelfCollision(report);
+    }, vresults);
+
+    std::vector<dReal> vjacobian;
+    int eeindex = pmanip->GetEndEffector()->GetIndex();
+    RunBenchmark(prefix + "ComputeJacobianTranslation", opts.iterations, opts, [&](int iteration) {
+        probot->SetDOFValues(vconfigs[iteration%numconfigs], KinBody::CLA_Nothing, varmindices);
+        probot->ComputeJacobianTranslation(eeindex, pmanip->GetTransform().trans, vjacobian, varmindices);
+    }, vresults);
+
+    // ik needs an ikfast solver for the robot. generating one takes minutes and would swamp the timings, so only the solvers prebuilt into the ikfastsolvers plugin are tried
+    if( !pmanip->GetIkSolver() ) {
+        const char* prebuiltsolvers[] = {"WAM7ikfast 0.05", "pa10ikfast", "pumaikfast", "ikfast_pr2_leftarm 0.05", "ikfast_pr2_rightarm 0.05", "ikfast_schunk_lwa3 0.05"};
+        std::string ikhash = pmanip->GetInverseKinematicsStructureHash(IKP_Transform6D);
+        for(size_t isolver = 0; isolver < sizeof(prebuiltsolvers)/sizeof(prebuiltsolvers[0]) && !pmanip->GetIkSolver(); ++isolver) {
+            IkSolverBasePtr psolver = RaveCreateIkSolver(penv, prebuiltsolvers[isolver]);
+            if( !!psolver && psolver->Supports(IKP_Transform6D) && psolver->GetKinematicsStructureHash() == ikhash ) {
+                pmanip->SetIkSolver(psolver);
+            }
+        }
+    }
+    if( !!pmanip->GetIkSolver() && pmanip->GetIkSolver()->Supports(IKP_Transform6D) ) {
+        std::vector<IkParameterization> vikparams(numconfigs);
+        for(int iconfig = 0; iconfig < numconfigs; ++iconfig) {
+            probot->SetDOFValues(vconfigs[iconfig], KinBody::CLA_Nothing, varmindices);
+            vikparams[iconfig] = pmanip->GetIkParameterization(IKP_Transform6D);
+        }
+        std::vector<dReal> vsolution;
+        std::vector< std::vector<dReal> > vsolutions;
+        RunBenchmark(prefix + "FindIKSolution", opts.iterations, opts, [&](int iteration) {
+            pmanip->FindIKSolution(vikparams[iteration%numconfigs], vsolution, 0);
+        }, vresults);
+        RunBenchmark(prefix + "FindIKSolutions", opts.iterations/10, opts, [&](int iteration) {
+            pmanip->FindIKSolutions(vikparams[iteration%numconfigs], vsolutions, 0);
+        }, vresults);
+    }
+    else {
+        RAVELOG_WARN_FORMAT("skipping ik benchmarks for %s since it has no Transform6D ik solver", probot->GetName());
+    }
+
+    // trajectory through collision-free configurations so the smoother has valid input
+    const int numwaypoints = 16;
+    std::vector<dReal> vwaypoints;
+    for(int iconfig = 0; iconfig < numconfigs && (int)vwaypoints.size() < numwaypoints*probot->GetActiveDOF(); ++iconfig) {
+        probot->SetActiveDOFValues(vconfigs[iconfig], KinBody::CLA_Nothing);
+        if( !penv->CheckCollision(KinBodyConstPtr(probot)) && !probot->CheckSelfCollision() ) {
+            vwaypoints.insert(vwaypoints.end(), vconfigs[iconfig].begin(), vconfigs[iconfig].end());
+        }
+    }
+    TrajectoryBasePtr ptraj = RaveCreateTrajectory(penv, "");
+    ptraj->Init(probot->GetActiveConfigurationSpecification("linear"));
+    ptraj->Insert(0, vwaypoints);
+    planningutils::RetimeActiveDOFTrajectory(ptraj, probot);
+    if( ptraj->GetNumWaypoints() > 1 && ptraj->GetDuration() > 0 ) {
+        std::vector<dReal> vsample;
+        dReal fDuration = ptraj->GetDuration();
+        RunBenchmark(prefix + "GenericTrajectory::Sample", opts.iterations*10, opts, [&](int iteration) {
+            ptraj->Sample(vsample, fDuration*(iteration%997)/997);
+        }, vresults);
+
+        // smoothing is orders of magnitude slower than the other calls, so reduce the iterations
+        TrajectoryBasePtr ptrajsmooth = RaveCreateTrajectory(penv, "");
+        RunBenchmark(prefix + "ParabolicSmoother2::PlanPath", opts.iterations/500, opts, [&](int iteration) {
+            ptrajsmooth->Clone(ptraj, 0);
+            planningutils::SmoothActiveDOFTrajectory(ptrajsmooth, probot, 1, 1, "ParabolicSmoother2", "<_nmaxiterations>20</_nmaxiterations><_nrandomgeneratorseed>0</_nrandomgeneratorseed>");
+        }, vresults);
+    }
+    else {
+        RAVELOG_WARN_FORMAT("skipping trajectory benchmarks for %s since not enough collision-free waypoints were found", probot->GetName());
+    }
+
+    rapidjson::Document rEnvironment;
+    penv->SerializeJSON(rEnvironment, rEnvironment.GetAllocator());
+    EnvironmentBasePtr penvjson = RaveCreateEnvironment();
+    RunBenchmark(prefix + "LoadJSON", opts.iterations/50, opts, [&](int iteration) {
+        EnvironmentMutex::scoped_lock lockjson(penvjson->GetMutex());
+        penvjson->Reset();
+        penvjson->LoadJSON(rEnvironment);
+    }, vresults);
+    penvjson->Destroy();
+}
+
+void WriteResults(const std::vector<BenchmarkResult>& vresults, const BenchmarkOptions& opts, EnvironmentBasePtr penv, rapidjson::Document& rResults)
+{
+    rapidjson::Document::AllocatorType& alloc = rResults.GetAllocator();
+    rResults.SetObject();
+    orjson::SetJsonValueByKey(rResults, "openraveVersion", OPENRAVE_VERSION_STRING, alloc);
+    orjson::SetJsonValueByKey(rResults, "collisionChecker", !!penv->GetCollisionChecker() ? penv->GetCollisionChecker()->GetXMLId() : std::string(), alloc);
+    orjson::SetJsonValueByKey(rResults, "seed", opts.seed, alloc);
+    orjson::SetJsonValueByKey(rResults, "trials", opts.trials, alloc);
+    rapidjson::Value rBenchmarks(rapidjson::kArrayType);
+    for(std::vector<BenchmarkResult>::const_iterator itresult = vresults.begin(); itresult != vresults.end(); ++itresult) {
+        rapidjson::Value rBenchmark(rapidjson::kObjectType);
+        orjson::SetJsonValueByKey(rBenchmark, "name", itresult->name, alloc);
+        orjson::SetJsonValueByKey(rBenchmark, "iterations", itresult->iterations, alloc);
+        orjson::SetJsonValueByKey(rBenchmark, "medianNS", itresult->medianns, alloc);
+        orjson::SetJsonValueByKey(rBenchmark, "minNS", itresult->minns, alloc);
+        orjson::SetJsonValueByKey(rBenchmark, "meanNS", itresult->meanns, alloc);
+        orjson::SetJsonValueByKey(rBenchmark, "trialsNS", itresult->vtrialns, alloc);
+        rBenchmarks.PushBack(rBenchmark, alloc);
+    }
+    rResults.AddMember("benchmarks", rBenchmarks, alloc);
+}
+
+/// \brief compares the medians against the baseline, returns the number of regressions
+int CompareResults(const std::vector<BenchmarkResult>& vresults, const std::string& baselinefilename, dReal tolerance)
+{
+    std::ifstream fbaseline(baselinefilename.c_str());
+    if( !fbaseline ) {
+        throw OPENRAVE_EXCEPTION_FORMAT("failed to open baseline %s", baselinefilename, ORE_InvalidArguments);
+    }
+    rapidjson::IStreamWrapper isw(fbaseline);
+    rapidjson::Document rBaseline;
+    rBaseline.ParseStream(isw);
+    if( rBaseline.HasParseError() || !rBaseline.IsObject() || !rBaseline.HasMember("benchmarks") ) {
+        throw OPENRAVE_EXCEPTION_FORMAT("baseline %s is not a benchmark result file", baselinefilename, ORE_InvalidArguments);
+    }
+
+    std::map<std::string, double> mapBaselineMedians;
+    for(rapidjson::Value::ConstValueIterator itbenchmark = rBaseline["benchmarks"].Begin(); itbenchmark != rBaseline["benchmarks"].End(); ++itbenchmark) {
+        mapBaselineMedians[orjson::GetJsonValueByKey<std::string>(*itbenchmark, "name")] = orjson::GetJsonValueByKey<double>(*itbenchmark, "medianNS", 0.0);
+    }
+
+    int numregressions = 0;
+    stringstream ss;
+    ss << std::fixed << std::setprecision(1);
+    for(std::vector<BenchmarkResult>::const_iterator itresult = vresults.begin(); itresult != vresults.end(); ++itresult) {
+        std::map<std::string, double>::const_iterator itbaseline = mapBaselineMedians.find(itresult->name);
+        if( itbaseline == mapBaselineMedians.end() || itbaseline->second <= 0 ) {
+            ss << itresult->name << ": no baseline" << endl;
+            continue;
+        }
+        double ratio = itresult->medianns/itbaseline->second;
+        bool bRegression = ratio > 1 + tolerance;
+        ss << itresult->name << ": " << itbaseline->second << "ns -> " << itresult->medianns << "ns (" << (100*(ratio-1)) << "%)" << (bRegression ? " REGRESSION" : "") << endl;
+        if( bRegression ) {
+            ++numregressions;
+        }
+    }
+    RAVELOG_INFO_FORMAT("comparison against %s with tolerance %.1f%%:\n%s", baselinefilename%(100*tolerance)%ss.str());
+    return numregressions;
+}
+
+void PrintHelp()
+{
+    RAVELOG_INFO("openrave_benchmark [--robot filename]... [--manip name] [--iterations N] [--trials N] [--seed N] [--filter substring] [--output results.json] [--compare baseline.json] [--tolerance 0.1] [--checker name]\n");
+}
+
+} // end namespace
+
+int main(int argc, char ** argv)
+{
+    BenchmarkOptions opts;
+    for(int i = 1; i < argc; ++i) {
+        bool bHasValue = i+1 < argc;
+        if( strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0 ) {
+            PrintHelp();
+            return 0;
+        }
+        else if( strcmp(argv[i], "--robot") == 0 && bHasValue ) {
+            opts.vrobotfilenames.push_back(argv[++i]);
+        }
+        else if( strcmp(argv[i], "--manip") == 0 && bHasValue ) {
+            opts.manipname = argv[++i];
+        }
+        else if( strcmp(argv[i], "--checker") == 0 && bHasValue ) {
+            opts.checkername = argv[++i];
+        }
+        else if( strcmp(argv[i], "--iterations") == 0 && bHasValue ) {
+            opts.iterations = atoi(argv[++i]);
+        }
+        else if( strcmp(argv[i], "--trials") == 0 && bHasValue ) {
+            opts.trials = max(1, atoi(argv[++i]));
+        }
+        else if( strcmp(argv[i], "--seed") == 0 && bHasValue ) {
+            opts.seed = (uint32_t)atoi(argv[++i]);
+        }
+        else if( strcmp(argv[i], "--filter") == 0 && bHasValue ) {
+            opts.filter = argv[++i];
+        }
+        else if( strcmp(argv[i], "--output") == 0 && bHasValue ) {
+            opts.outputfilename = argv[++i];
+        }
+        else if( strcmp(argv[i], "--compare") == 0 && bHasValue ) {
+            opts.comparefilename = argv[++i];
+        }
+        else if( strcmp(argv[i], "--tolerance") == 0 && bHasValue ) {
+            opts.tolerance = atof(argv[++i]);
+        }
+        else {
+            RAVELOG_ERROR_FORMAT("unknown option %s", argv[i]);
+            PrintHelp();
+            return -1;
+        }
+    }
+    if( opts.vrobotfilenames.size() == 0 ) {
+        opts.vrobotfilenames.push_back("robots/barrettwam.robot.xml");
+        opts.vrobotfilenames.push_back("robots/pr2-beta-static.zae");
+    }
+
+    RaveInitialize(true, Level_Info);
+    int ret = 0;
+    try {
+        EnvironmentBasePtr penv = RaveCreateEnvironment();
+        if( opts.checkername.size() > 0 ) {
+            CollisionCheckerBasePtr pchecker = RaveCreateCollisionChecker(penv, opts.checkername);
+            if( !pchecker ) {
+                throw OPENRAVE_EXCEPTION_FORMAT("failed to create collision checker %s", opts.checkername, ORE_InvalidArguments);
+            }
+            penv->SetCollisionChecker(pchecker);
+        }
+
+        std::vector<BenchmarkResult> vresults;
+        for(std::vector<std::string>::const_iterator itfilename = opts.vrobotfilenames.begin(); itfilename != opts.vrobotfilenames.end(); ++itfilename) {
+            BenchmarkRobot(penv, *itfilename, opts, vresults);
+        }
+
+        rapidjson::Document rResults;
+        WriteResults(vresults, opts, penv, rResults);
+        if( opts.outputfilename.size() > 0 ) {
+            std::ofstream fresults(opts.outputfilename.c_str());
+            rapidjson::OStreamWrapper osw(fresults);
+            rapidjson::PrettyWriter<rapidjson::OStreamWrapper> writer(osw);
+            rResults.Accept(writer);
+        }
+        if( opts.comparefilename.size() > 0 ) {
+            ret = CompareResults(vresults, opts.comparefilename, opts.tolerance) > 0 ? 1 : 0;
+        }
+        penv->Destroy();
+    }
+    catch(const OpenRAVEException& ex) {
+        RAVELOG_ERROR_FORMAT("benchmark failed: %s", ex.what());
+        ret = -2;
+    }
+    RaveDestroy();
+    return ret;
+}
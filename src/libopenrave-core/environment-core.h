@@ -119,6 +119,8 @@ public:
 
         _nBodiesModifiedStamp = 0;
         _nEnvironmentIndex = 1;
+        _nInfoDeltaStamp = 0;
+        _nInfoDeltaMinStamp = 0;
 
         _fDeltaSimTime = 0.01f;
         _nCurSimTime = 0;
@@ -128,6 +130,11 @@ public:
         _bEnableSimulation = true;     // need to start by default
         _unit = std::make_pair("meter",1.0); //default unit settings
 
+        const char* pTraceMutex = getenv("OPENRAVE_TRACE_ENVIRONMENT_MUTEX");
+        if( !!pTraceMutex && atoi(pTraceMutex) != 0 ) {
+            _mutexEnvironment.SetTracing(true);
+        }
+
         _vRapidJsonLoadBuffer.resize(4000000);
         _prLoadEnvAlloc.reset(new rapidjson::MemoryPoolAllocator<>(&_vRapidJsonLoadBuffer[0], _vRapidJsonLoadBuffer.size()));
 
@@ -280,6 +287,7 @@ public:
                 listSensors.swap(_listSensors);
                 _vPublishedBodies.clear();
                 _nBodiesModifiedStamp++;
+                _ResetInfoDeltaStamps();
                 _listModules.clear();
                 _listViewers.clear();
                 _listOwnedInterfaces.clear();
@@ -355,6 +363,7 @@ public:
             _vecrobots.clear();
             _vPublishedBodies.clear();
             _nBodiesModifiedStamp++;
+            _ResetInfoDeltaStamps();
 
             _mapBodies.clear();
 
@@ -1131,6 +1140,7 @@ public:
     virtual bool CheckCollision(KinBodyConstPtr pbody1, CollisionReportPtr report)
     {
         EnvironmentMutex::scoped_lock lockenv(GetMutex());
+        ProfilingScope profilingscope(PC_CollisionCheck);
         CHECK_COLLISION_BODY(pbody1);
         return _pCurrentChecker->CheckCollision(pbody1,report);
     }
@@ -1138,6 +1148,7 @@ public:
     virtual bool CheckCollision(KinBodyConstPtr pbody1, KinBodyConstPtr pbody2, CollisionReportPtr report)
     {
         EnvironmentMutex::scoped_lock lockenv(GetMutex());
+        ProfilingScope profilingscope(PC_CollisionCheck);
         CHECK_COLLISION_BODY(pbody1);
         CHECK_COLLISION_BODY(pbody2);
         return _pCurrentChecker->CheckCollision(pbody1,pbody2,report);
@@ -1146,6 +1157,7 @@ public:
     virtual bool CheckCollision(KinBody::LinkConstPtr plink, CollisionReportPtr report )
     {
         EnvironmentMutex::scoped_lock lockenv(GetMutex());
+        ProfilingScope profilingscope(PC_CollisionCheck);
         CHECK_COLLISION_BODY(plink->GetParent());
         return _pCurrentChecker->CheckCollision(plink,report);
     }
@@ -1153,6 +1165,7 @@ public:
     virtual bool CheckCollision(KinBody::LinkConstPtr plink1, KinBody::LinkConstPtr plink2, CollisionReportPtr report)
     {
         EnvironmentMutex::scoped_lock lockenv(GetMutex());
+        ProfilingScope profilingscope(PC_CollisionCheck);
         CHECK_COLLISION_BODY(plink1->GetParent());
         CHECK_COLLISION_BODY(plink2->GetParent());
         return _pCurrentChecker->CheckCollision(plink1,plink2,report);
@@ -1161,6 +1174,7 @@ public:
     virtual bool CheckCollision(KinBody::LinkConstPtr plink, KinBodyConstPtr pbody, CollisionReportPtr report)
     {
         EnvironmentMutex::scoped_lock lockenv(GetMutex());
+        ProfilingScope profilingscope(PC_CollisionCheck);
         CHECK_COLLISION_BODY(plink->GetParent());
         CHECK_COLLISION_BODY(pbody);
         return _pCurrentChecker->CheckCollision(plink,pbody,report);
@@ -1169,6 +1183,7 @@ public:
     virtual bool CheckCollision(KinBody::LinkConstPtr plink, const std::vector<KinBodyConstPtr>& vbodyexcluded, const std::vector<KinBody::LinkConstPtr>& vlinkexcluded, CollisionReportPtr report)
     {
         EnvironmentMutex::scoped_lock lockenv(GetMutex());
+        ProfilingScope profilingscope(PC_CollisionCheck);
         CHECK_COLLISION_BODY(plink->GetParent());
         return _pCurrentChecker->CheckCollision(plink,vbodyexcluded,vlinkexcluded,report);
     }
@@ -1176,6 +1191,7 @@ public:
     virtual bool CheckCollision(KinBodyConstPtr pbody, const std::vector<KinBodyConstPtr>& vbodyexcluded, const std::vector<KinBody::LinkConstPtr>& vlinkexcluded, CollisionReportPtr report)
     {
         EnvironmentMutex::scoped_lock lockenv(GetMutex());
+        ProfilingScope profilingscope(PC_CollisionCheck);
         CHECK_COLLISION_BODY(pbody);
         return _pCurrentChecker->CheckCollision(pbody,vbodyexcluded,vlinkexcluded,report);
     }
@@ -1183,23 +1199,27 @@ public:
     virtual bool CheckCollision(const RAY& ray, KinBody::LinkConstPtr plink, CollisionReportPtr report)
     {
         EnvironmentMutex::scoped_lock lockenv(GetMutex());
+        ProfilingScope profilingscope(PC_CollisionCheck);
         CHECK_COLLISION_BODY(plink->GetParent());
         return _pCurrentChecker->CheckCollision(ray,plink,report);
     }
     virtual bool CheckCollision(const RAY& ray, KinBodyConstPtr pbody, CollisionReportPtr report)
     {
         EnvironmentMutex::scoped_lock lockenv(GetMutex());
+        ProfilingScope profilingscope(PC_CollisionCheck);
         CHECK_COLLISION_BODY(pbody);
         return _pCurrentChecker->CheckCollision(ray,pbody,report);
     }
     virtual bool CheckCollision(const RAY& ray, CollisionReportPtr report)
     {
+        ProfilingScope profilingscope(PC_CollisionCheck);
         return _pCurrentChecker->CheckCollision(ray,report);
     }
 
     virtual bool CheckCollision(const TriMesh& trimesh, KinBodyConstPtr pbody, CollisionReportPtr report)
     {
         EnvironmentMutex::scoped_lock lockenv(GetMutex());
+        ProfilingScope profilingscope(PC_CollisionCheck);
         CHECK_COLLISION_BODY(pbody);
         return _pCurrentChecker->CheckCollision(trimesh,pbody,report);
     }
@@ -1207,6 +1227,7 @@ public:
     virtual bool CheckStandaloneSelfCollision(KinBodyConstPtr pbody, CollisionReportPtr report)
     {
         EnvironmentMutex::scoped_lock lockenv(GetMutex());
+        ProfilingScope profilingscope(PC_CollisionCheck);
         CHECK_COLLISION_BODY(pbody);
         return _pCurrentChecker->CheckStandaloneSelfCollision(pbody,report);
     }
@@ -1244,16 +1265,41 @@ public:
         }
 
         // simulate the sensors last (ie, they always reflect the most recent bodies
+        // sensors that cannot run concurrently are stepped first, then all the others are stepped in parallel since they only read the scene
+        std::vector<SensorBasePtr>& vConcurrentSensors = _vConcurrentSensorsCache;
+        vConcurrentSensors.clear();
         FOREACH(itsensor, listSensors) {
-            (*itsensor)->SimulationStep(fTimeStep);
+            if( (*itsensor)->SupportsConcurrentSimulationStep() ) {
+                vConcurrentSensors.push_back(*itsensor);
+            }
+            else {
+                (*itsensor)->SimulationStep(fTimeStep);
+            }
         }
         FOREACH(itrobot, vecrobots) {
             FOREACH(itsensor, (*itrobot)->GetAttachedSensors()) {
-                if( !!(*itsensor)->GetSensor() ) {
-                    (*itsensor)->GetSensor()->SimulationStep(fTimeStep);
+                SensorBasePtr psensor = (*itsensor)->GetSensor();
+                if( !!psensor ) {
+                    if( psensor->SupportsConcurrentSimulationStep() ) {
+                        vConcurrentSensors.push_back(psensor);
+                    }
+                    else {
+                        psensor->SimulationStep(fTimeStep);
+                    }
                 }
             }
         }
+        if( vConcurrentSensors.size() > 0 ) {
+            try {
+                // the stepping thread works on the sensors too and returns only after all of them were stepped
+                RaveRunParallelJobs(boost::bind(&Environment::_StepConcurrentSensor, this, boost::cref(vConcurrentSensors), fTimeStep, _1), (int)vConcurrentSensors.size());
+            }
+            catch(...) {
+                vConcurrentSensors.clear();
+                throw;
+            }
+        }
+        vConcurrentSensors.clear(); // do not hold on to the sensors
         _nCurSimTime += step;
     }
 
@@ -2451,7 +2497,6 @@ public:
         vRemovedBodies.clear();
 
         EnvironmentMutex::scoped_lock lockenv(GetMutex());
-        std::vector<dReal> vDOFValues;
 
         // copy basic info into EnvironmentBase
         _revision = info._revision;
@@ -2479,7 +2524,6 @@ public:
             const KinBody::KinBodyInfoConstPtr& pKinBodyInfo = info._vBodyInfos[bodyIndex];
             const KinBody::KinBodyInfo& kinBodyInfo = *pKinBodyInfo;
             RAVELOG_VERBOSE_FORMAT("==== body: env = %d, id = %s, name = %s ===", GetId()%pKinBodyInfo->_id%pKinBodyInfo->_name);
-            RobotBase::RobotBaseInfoConstPtr pRobotBaseInfo = OPENRAVE_DYNAMIC_POINTER_CAST<const RobotBase::RobotBaseInfo>(pKinBodyInfo);
             KinBodyPtr pMatchExistingBody; // matches to pKinBodyInfo
             {
                 // find existing body in the env
@@ -2548,127 +2592,11 @@ public:
                 }
             }
 
-            KinBodyPtr pInitBody; // body that has to be Init() again
-            if( !!pMatchExistingBody ) {
-                RAVELOG_VERBOSE_FORMAT("env=%d, update existing body %s", GetId()%pMatchExistingBody->_id);
-                // interface should match at this point
-                // update existing body or robot
-                UpdateFromInfoResult updateFromInfoResult = UFIR_NoChange;
-                if (pKinBodyInfo->_isRobot && pMatchExistingBody->IsRobot()) {
-                    RobotBasePtr pRobot = RaveInterfaceCast<RobotBase>(pMatchExistingBody);
-                    if( !!pRobotBaseInfo ) {
-                        updateFromInfoResult = pRobot->UpdateFromRobotInfo(*pRobotBaseInfo);
-                    }
-                    else {
-                        updateFromInfoResult = pRobot->UpdateFromKinBodyInfo(*pKinBodyInfo);
-                    }
-                } else {
-                    updateFromInfoResult = pMatchExistingBody->UpdateFromKinBodyInfo(*pKinBodyInfo);
-                }
-                RAVELOG_VERBOSE_FORMAT("env=%d, update body %s from info result %d", GetId()%pMatchExistingBody->_id%updateFromInfoResult);
-                if (updateFromInfoResult == UFIR_NoChange) {
-                    continue;
-                }
-                vModifiedBodies.push_back(pMatchExistingBody);
-                if (updateFromInfoResult == UFIR_Success) {
-                    continue;
-                }
-
-                // updating this body requires removing it and re-adding it to env
-                {
-                    boost::timed_mutex::scoped_lock lock(_mutexInterfaces);
-                    vector<KinBodyPtr>::iterator itExisting = std::find(_vecbodies.begin(), _vecbodies.end(), pMatchExistingBody);
-                    if( itExisting != _vecbodies.end() ) {
-                        _RemoveKinBodyFromIterator(itExisting);
-                    }
-                }
-
-                if (pMatchExistingBody->IsRobot()) {
-                    RobotBasePtr pRobot = RaveInterfaceCast<RobotBase>(pMatchExistingBody);
-                    if (updateFromInfoResult == UFIR_RequireRemoveFromEnvironment) {
-                        // first try udpating again after removing from env
-                        if( !!pRobotBaseInfo ) {
-                            updateFromInfoResult = pRobot->UpdateFromRobotInfo(*pRobotBaseInfo);
-                        }
-                        else {
-                            updateFromInfoResult = pRobot->UpdateFromKinBodyInfo(*pKinBodyInfo);
-                        }
-                    }
-                    if (updateFromInfoResult != UFIR_NoChange && updateFromInfoResult != UFIR_Success) {
-                        // have to reinit
-                        if( !!pRobotBaseInfo ) {
-                            pRobot->InitFromRobotInfo(*pRobotBaseInfo);
-                        }
-                        else {
-                            pRobot->InitFromKinBodyInfo(*pKinBodyInfo);
-                        }
-                        pInitBody = pRobot;
-                    }
-                    _AddRobot(pRobot, false); // internally locks _mutexInterfaces, name guarnateed to be unique
-                }
-                else {
-                    if (updateFromInfoResult == UFIR_RequireRemoveFromEnvironment) {
-                        // first try udpating again after removing from env
-                        updateFromInfoResult = pMatchExistingBody->UpdateFromKinBodyInfo(*pKinBodyInfo);
-                    }
-                    if (updateFromInfoResult != UFIR_NoChange && updateFromInfoResult != UFIR_Success) {
-                        // have to reinit
-                        pMatchExistingBody->InitFromKinBodyInfo(*pKinBodyInfo);
-                        pInitBody = pMatchExistingBody;
-                    }
-                    _AddKinBody(pMatchExistingBody, false); // internally locks _mutexInterfaces, name guarnateed to be unique
-                }
-            }
-            else {
-                // for new body or robot
-                KinBodyPtr pNewBody;
-                if (pKinBodyInfo->_isRobot) {
-                    RAVELOG_VERBOSE_FORMAT("add new robot %s", pKinBodyInfo->_id);
-                    RobotBasePtr pRobot = RaveCreateRobot(shared_from_this(), pKinBodyInfo->_interfaceType);
-                    if( !pRobot ) {
-                        pRobot = RaveCreateRobot(shared_from_this(), "");
-                    }
-
-                    if( !!pRobotBaseInfo ) {
-                        pRobot->InitFromRobotInfo(*pRobotBaseInfo);
-                    }
-                    else {
-                        pRobot->InitFromKinBodyInfo(*pKinBodyInfo);
-                    }
-                    pInitBody = pRobot;
-                    _AddRobot(pRobot, true);
-                    pNewBody = RaveInterfaceCast<KinBody>(pRobot);
-                }
-                else {
-                    RAVELOG_VERBOSE_FORMAT("add new kinbody %s", pKinBodyInfo->_id);
-                    pNewBody = RaveCreateKinBody(shared_from_this(), pKinBodyInfo->_interfaceType);
-                    if( !pNewBody ) {
-                        pNewBody = RaveCreateKinBody(shared_from_this(), "");
-                    }
-                    pNewBody->InitFromKinBodyInfo(*pKinBodyInfo);
-                    pInitBody = pNewBody;
-                    _AddKinBody(pNewBody, true);
-                }
+            KinBodyPtr pNewBody = _UpdateBodyFromInfo(pKinBodyInfo, pMatchExistingBody, vModifiedBodies);
+            if( !!pNewBody ) {
                 vBodies.insert(vBodies.begin()+bodyIndex, pNewBody);
                 vCreatedBodies.push_back(pNewBody);
             }
-
-            if (!!pInitBody) {
-                // only for init body we need to set name and dofvalues again
-                OPENRAVE_ASSERT_OP_FORMAT0(pInitBody->GetName(), ==, pKinBodyInfo->_name, "names should be matching", ORE_InvalidArguments);
-
-                // dof value
-                pInitBody->GetDOFValues(vDOFValues);
-                FOREACH(it, pKinBodyInfo->_dofValues) {
-                    FOREACH(itJoint, pInitBody->_vecjoints) {
-                        if ((*itJoint)->GetName() == it->first.first) {
-                            vDOFValues[(*itJoint)->GetDOFIndex()+it->first.second] = (*it).second;
-                            break;
-                        }
-                    }
-                }
-                pInitBody->SetDOFValues(vDOFValues, pKinBodyInfo->_transform, KinBody::CLA_Nothing);
-            }
         }
 
         // remove extra bodies at the end of vBodies
@@ -2724,8 +2652,357 @@ public:
         UpdatePublishedBodies();
     }
 
+    virtual void ExtractInfoDelta(EnvironmentBaseInfoDelta& delta, int nSinceStamp)
+    {
+        EnvironmentMutex::scoped_lock lockenv(GetMutex());
+        std::vector<KinBodyPtr> vBodies;
+        {
+            boost::timed_mutex::scoped_lock lock(_mutexInterfaces);
+            vBodies = _vecbodies;
+        }
+
+        // record the changes of every body at the next stamp, only integers are compared here
+        const int nNextStamp = _nInfoDeltaStamp + 1;
+        bool bChanged = _listRemovedBodyInfoDeltas.size() > 0 && _listRemovedBodyInfoDeltas.back()._stamp == nNextStamp;
+        FOREACHC(itbody, vBodies) {
+            BodyInfoDeltaStamps& stamps = _mapBodyInfoDeltaStamps[(*itbody)->GetEnvironmentId()];
+            if( stamps._infoUpdateStamp != (*itbody)->GetInfoUpdateStamp() ) {
+                stamps._infoChangedStamp = nNextStamp;
+                bChanged = true;
+            }
+            else if( stamps._updateStamp != (*itbody)->GetUpdateStamp() ) {
+                stamps._stateChangedStamp = nNextStamp;
+                bChanged = true;
+            }
+            stamps._infoUpdateStamp = (*itbody)->GetInfoUpdateStamp();
+            stamps._updateStamp = (*itbody)->GetUpdateStamp();
+        }
+        if( bChanged ) {
+            _nInfoDeltaStamp = nNextStamp;
+        }
+
+        delta.Reset();
+        delta._stamp = _nInfoDeltaStamp;
+        delta._isFull = nSinceStamp <= 0 || nSinceStamp < _nInfoDeltaMinStamp || nSinceStamp > _nInfoDeltaStamp;
+        delta._revision = _revision;
+        delta._name = _name;
+        delta._keywords = _keywords;
+        delta._description = _description;
+        if (!!_pPhysicsEngine) {
+            delta._gravity = _pPhysicsEngine->GetGravity();
+        }
+
+        if( !delta._isFull ) {
+            FOREACHC(itremoved, _listRemovedBodyInfoDeltas) {
+                if( itremoved->_stamp > nSinceStamp ) {
+                    delta._vRemovedBodies.emplace_back(itremoved->_id, itremoved->_name);
+                }
+            }
+        }
+
+        FOREACHC(itbody, vBodies) {
+            BodyInfoDeltaStamps& stamps = _mapBodyInfoDeltaStamps[(*itbody)->GetEnvironmentId()];
+            if( delta._isFull || stamps._infoChangedStamp > nSinceStamp ) {
+                if ((*itbody)->IsRobot()) {
+                    RobotBase::RobotBaseInfoPtr pRobotBaseInfo(new RobotBase::RobotBaseInfo());
+                    RaveInterfaceCast<RobotBase>(*itbody)->ExtractInfo(*pRobotBaseInfo);
+                    delta._vBodyInfos.push_back(pRobotBaseInfo);
+                }
+                else {
+                    KinBody::KinBodyInfoPtr pKinBodyInfo(new KinBody::KinBodyInfo());
+                    (*itbody)->ExtractInfo(*pKinBodyInfo);
+                    delta._vBodyInfos.push_back(pKinBodyInfo);
+                }
+                // ExtractInfo restores the body state, so have to update the stamp in order to not report it as changed next time
+                stamps._updateStamp = (*itbody)->GetUpdateStamp();
+            }
+            else if( stamps._stateChangedStamp > nSinceStamp ) {
+                delta._vBodyStates.push_back(EnvironmentBaseInfoDelta::BodyStateInfo());
+                EnvironmentBaseInfoDelta::BodyStateInfo& bodyState = delta._vBodyStates.back();
+                bodyState._id = (*itbody)->_id;
+                bodyState._name = (*itbody)->GetName();
+                bodyState._transform = (*itbody)->GetTransform();
+                (*itbody)->GetDOFValues(bodyState._vDOFValues);
+            }
+        }
+    }
+
+    virtual void UpdateFromInfoDelta(const EnvironmentBaseInfoDelta& delta, std::vector<KinBodyPtr>& vCreatedBodies, std::vector<KinBodyPtr>& vModifiedBodies, std::vector<KinBodyPtr>& vRemovedBodies)
+    {
+        if( delta._isFull ) {
+            EnvironmentBaseInfo info;
+            info._vBodyInfos = delta._vBodyInfos;
+            info._revision = delta._revision;
+            info._name = delta._name;
+            info._keywords = delta._keywords;
+            info._description = delta._description;
+            info._gravity = delta._gravity;
+            UpdateFromInfo(info, vCreatedBodies, vModifiedBodies, vRemovedBodies);
+            return;
+        }
+
+        RAVELOG_VERBOSE_FORMAT("env=%d, update from delta stamp=%d, bodies=%d, states=%d, removed=%d", GetId()%delta._stamp%delta._vBodyInfos.size()%delta._vBodyStates.size()%delta._vRemovedBodies.size());
+        vCreatedBodies.clear();
+        vModifiedBodies.clear();
+        vRemovedBodies.clear();
+
+        EnvironmentMutex::scoped_lock lockenv(GetMutex());
+
+        _revision = delta._revision;
+        _name = delta._name;
+        _keywords = delta._keywords;
+        _description = delta._description;
+        if (!!_pPhysicsEngine) {
+            Vector gravityDiff = _pPhysicsEngine->GetGravity() - delta._gravity;
+            if (OpenRAVE::RaveFabs(gravityDiff.x) > 1e-7 || OpenRAVE::RaveFabs(gravityDiff.y) > 1e-7 || OpenRAVE::RaveFabs(gravityDiff.z) > 1e-7) {
+                _pPhysicsEngine->SetGravity(delta._gravity);
+            }
+        }
+
+        // have to process the removed bodies first since a new body can reuse the id of a removed one
+        FOREACHC(itremoved, delta._vRemovedBodies) {
+            boost::timed_mutex::scoped_lock lock(_mutexInterfaces);
+            std::vector<KinBodyPtr>::iterator itbody = _FindBodyFromIdName(itremoved->first, itremoved->second);
+            if( itbody != _vecbodies.end() ) {
+                RAVELOG_VERBOSE_FORMAT("env=%d, remove body id=%s, name=%s", GetId()%itremoved->first%itremoved->second);
+                vRemovedBodies.push_back(*itbody);
+                _RemoveKinBodyFromIterator(itbody);
+            }
+        }
+
+        FOREACHC(itinfo, delta._vBodyInfos) {
+            const KinBody::KinBodyInfoPtr& pKinBodyInfo = *itinfo;
+            KinBodyPtr pMatchExistingBody;
+            {
+                boost::timed_mutex::scoped_lock lock(_mutexInterfaces);
+                std::vector<KinBodyPtr>::iterator itbody = _FindBodyFromIdName(pKinBodyInfo->_id, pKinBodyInfo->_name);
+                if( itbody != _vecbodies.end() ) {
+                    pMatchExistingBody = *itbody;
+                    if( pMatchExistingBody->GetXMLId() != pKinBodyInfo->_interfaceType || pMatchExistingBody->IsRobot() != pKinBodyInfo->_isRobot ) {
+                        RAVELOG_VERBOSE_FORMAT("env=%d, body %s interface is changed, remove old body from environment. xmlid=%s, _interfaceType=%s, isRobot %d != %d", GetId()%pMatchExistingBody->_id%pMatchExistingBody->GetXMLId()%pKinBodyInfo->_interfaceType%pMatchExistingBody->IsRobot()%pKinBodyInfo->_isRobot);
+                        vRemovedBodies.push_back(pMatchExistingBody);
+                        _RemoveKinBodyFromIterator(itbody);
+                        pMatchExistingBody.reset();
+                    }
+                }
+            }
+
+            KinBodyPtr pNewBody = _UpdateBodyFromInfo(pKinBodyInfo, pMatchExistingBody, vModifiedBodies);
+            if( !!pNewBody ) {
+                vCreatedBodies.push_back(pNewBody);
+            }
+        }
+
+        std::vector<dReal> vDOFValues;
+        FOREACHC(itstate, delta._vBodyStates) {
+            KinBodyPtr pbody;
+            {
+                boost::timed_mutex::scoped_lock lock(_mutexInterfaces);
+                std::vector<KinBodyPtr>::iterator itbody = _FindBodyFromIdName(itstate->_id, itstate->_name);
+                if( itbody != _vecbodies.end() ) {
+                    pbody = *itbody;
+                }
+            }
+            if( !pbody ) {
+                RAVELOG_WARN_FORMAT("env=%d, could not find body with id='%s', name='%s' to update its state, environment is out of sync", GetId()%itstate->_id%itstate->_name);
+                continue;
+            }
+            if( pbody->GetDOF() != (int)itstate->_vDOFValues.size() ) {
+                RAVELOG_WARN_FORMAT("env=%d, body '%s' has %d DOF, but state has %d values, environment is out of sync", GetId()%pbody->GetName()%pbody->GetDOF()%itstate->_vDOFValues.size());
+                continue;
+            }
+            pbody->GetDOFValues(vDOFValues);
+            if( vDOFValues != itstate->_vDOFValues || pbody->GetTransform() != itstate->_transform ) {
+                pbody->SetDOFValues(itstate->_vDOFValues, itstate->_transform, KinBody::CLA_Nothing);
+                vModifiedBodies.push_back(pbody);
+            }
+        }
+
+        // after all bodies are updated, update the grab states of the bodies whose info changed
+        std::vector<KinBody::GrabbedInfoConstPtr> vGrabbedInfos;
+        FOREACHC(itinfo, delta._vBodyInfos) {
+            KinBodyPtr pbody = GetKinBody((*itinfo)->_name);
+            if( !pbody ) {
+                RAVELOG_WARN_FORMAT("env=%d, could not find body with name='%s'", GetId()%(*itinfo)->_name);
+                continue;
+            }
+            vGrabbedInfos.clear();
+            vGrabbedInfos.reserve((*itinfo)->_vGrabbedInfos.size());
+            FOREACHC(itGrabbedInfo, (*itinfo)->_vGrabbedInfos) {
+                if (!!GetKinBody((*itGrabbedInfo)->_grabbedname)) {
+                    vGrabbedInfos.push_back(*itGrabbedInfo);
+                }
+                else {
+                    RAVELOG_WARN_FORMAT("env=%d, body %s grabbed by %s is gone, ignoring grabbed info %s", GetId()%(*itGrabbedInfo)->_grabbedname%(*itinfo)->_name%(*itGrabbedInfo)->_id);
+                }
+            }
+            pbody->ResetGrabbed(vGrabbedInfos);
+        }
+
+        UpdatePublishedBodies();
+    }
+
 protected:
 
+    /// \brief finds a body in _vecbodies by id, or by name if id is empty or not found
+    ///
+    /// assumes _mutexInterfaces is locked
+    std::vector<KinBodyPtr>::iterator _FindBodyFromIdName(const std::string& id, const std::string& name)
+    {
+        std::vector<KinBodyPtr>::iterator itSameName = _vecbodies.end();
+        for(std::vector<KinBodyPtr>::iterator itbody = _vecbodies.begin(); itbody != _vecbodies.end(); ++itbody) {
+            if( !id.empty() && (*itbody)->_id == id ) {
+                return itbody;
+            }
+            if( itSameName == _vecbodies.end() && !name.empty() && (*itbody)->_name == name ) {
+                itSameName = itbody;
+            }
+        }
+        return itSameName;
+    }
+
+    /// \brief invalidates all stamps returned by ExtractInfoDelta so that the next delta is a full one
+    ///
+    /// assumes environment is locked
+    void _ResetInfoDeltaStamps()
+    {
+        _mapBodyInfoDeltaStamps.clear();
+        _listRemovedBodyInfoDeltas.clear();
+        _nInfoDeltaStamp++;
+        _nInfoDeltaMinStamp = _nInfoDeltaStamp;
+    }
+
+    /// \brief updates an existing body from its info, or creates and adds a new body if pMatchExistingBody is empty
+    ///
+    /// assumes environment is locked. internally manipulates _vecbodies using _AddKinBody/_AddRobot/_RemoveKinBodyFromIterator
+    /// \param[inout] vModifiedBodies pMatchExistingBody is appended to it if it was changed
+    /// \return the newly created body, or empty if pMatchExistingBody was updated
+    KinBodyPtr _UpdateBodyFromInfo(const KinBody::KinBodyInfoConstPtr& pKinBodyInfo, KinBodyPtr pMatchExistingBody, std::vector<KinBodyPtr>& vModifiedBodies)
+    {
+        RobotBase::RobotBaseInfoConstPtr pRobotBaseInfo = OPENRAVE_DYNAMIC_POINTER_CAST<const RobotBase::RobotBaseInfo>(pKinBodyInfo);
+        std::vector<dReal> vDOFValues;
+        KinBodyPtr pInitBody; // body that has to be Init() again
+        KinBodyPtr pNewBody; // body created from pKinBodyInfo
+        if( !!pMatchExistingBody ) {
+            RAVELOG_VERBOSE_FORMAT("env=%d, update existing body %s", GetId()%pMatchExistingBody->_id);
+            // interface should match at this point
+            // update existing body or robot
+            UpdateFromInfoResult updateFromInfoResult = UFIR_NoChange;
+            if (pKinBodyInfo->_isRobot && pMatchExistingBody->IsRobot()) {
+                RobotBasePtr pRobot = RaveInterfaceCast<RobotBase>(pMatchExistingBody);
+                if( !!pRobotBaseInfo ) {
+                    updateFromInfoResult = pRobot->UpdateFromRobotInfo(*pRobotBaseInfo);
+                }
+                else {
+                    updateFromInfoResult = pRobot->UpdateFromKinBodyInfo(*pKinBodyInfo);
+                }
+            } else {
+                updateFromInfoResult = pMatchExistingBody->UpdateFromKinBodyInfo(*pKinBodyInfo);
+            }
+            RAVELOG_VERBOSE_FORMAT("env=%d, update body %s from info result %d", GetId()%pMatchExistingBody->_id%updateFromInfoResult);
+            if (updateFromInfoResult == UFIR_NoChange) {
+                return KinBodyPtr();
+            }
+            vModifiedBodies.push_back(pMatchExistingBody);
+            if (updateFromInfoResult == UFIR_Success) {
+                return KinBodyPtr();
+            }
+
+            // updating this body requires removing it and re-adding it to env
+            {
+                boost::timed_mutex::scoped_lock lock(_mutexInterfaces);
+                vector<KinBodyPtr>::iterator itExisting = std::find(_vecbodies.begin(), _vecbodies.end(), pMatchExistingBody);
+                if( itExisting != _vecbodies.end() ) {
+                    _RemoveKinBodyFromIterator(itExisting);
+                }
+            }
+
+            if (pMatchExistingBody->IsRobot()) {
+                RobotBasePtr pRobot = RaveInterfaceCast<RobotBase>(pMatchExistingBody);
+                if (updateFromInfoResult == UFIR_RequireRemoveFromEnvironment) {
+                    // first try udpating again after removing from env
+                    if( !!pRobotBaseInfo ) {
+                        updateFromInfoResult = pRobot->UpdateFromRobotInfo(*pRobotBaseInfo);
+                    }
+                    else {
+                        updateFromInfoResult = pRobot->UpdateFromKinBodyInfo(*pKinBodyInfo);
+                    }
+                }
+                if (updateFromInfoResult != UFIR_NoChange && updateFromInfoResult != UFIR_Success) {
+                    // have to reinit
+                    if( !!pRobotBaseInfo ) {
+                        pRobot->InitFromRobotInfo(*pRobotBaseInfo);
+                    }
+                    else {
+                        pRobot->InitFromKinBodyInfo(*pKinBodyInfo);
+                    }
+                    pInitBody = pRobot;
+                }
+                _AddRobot(pRobot, false); // internally locks _mutexInterfaces, name guarnateed to be unique
+            }
+            else {
+                if (updateFromInfoResult == UFIR_RequireRemoveFromEnvironment) {
+                    // first try udpating again after removing from env
+                    updateFromInfoResult = pMatchExistingBody->UpdateFromKinBodyInfo(*pKinBodyInfo);
+                }
+                if (updateFromInfoResult != UFIR_NoChange && updateFromInfoResult != UFIR_Success) {
+                    // have to reinit
+                    pMatchExistingBody->InitFromKinBodyInfo(*pKinBodyInfo);
+                    pInitBody = pMatchExistingBody;
+                }
+                _AddKinBody(pMatchExistingBody, false); // internally locks _mutexInterfaces, name guarnateed to be unique
+            }
+        }
+        else {
+            // for new body or robot
+            if (pKinBodyInfo->_isRobot) {
+                RAVELOG_VERBOSE_FORMAT("add new robot %s", pKinBodyInfo->_id);
+                RobotBasePtr pRobot = RaveCreateRobot(shared_from_this(), pKinBodyInfo->_interfaceType);
+                if( !pRobot ) {
+                    pRobot = RaveCreateRobot(shared_from_this(), "");
+                }
+
+                if( !!pRobotBaseInfo ) {
+                    pRobot->InitFromRobotInfo(*pRobotBaseInfo);
+                }
+                else {
+                    pRobot->InitFromKinBodyInfo(*pKinBodyInfo);
+                }
+                pInitBody = pRobot;
+                _AddRobot(pRobot, true);
+                pNewBody = RaveInterfaceCast<KinBody>(pRobot);
+            }
+            else {
+                RAVELOG_VERBOSE_FORMAT("add new kinbody %s", pKinBodyInfo->_id);
+                pNewBody = RaveCreateKinBody(shared_from_this(), pKinBodyInfo->_interfaceType);
+                if( !pNewBody ) {
+                    pNewBody = RaveCreateKinBody(shared_from_this(), "");
+                }
+                pNewBody->InitFromKinBodyInfo(*pKinBodyInfo);
+                pInitBody = pNewBody;
+                _AddKinBody(pNewBody, true);
+            }
+        }
+
+        if (!!pInitBody) {
+            // only for init body we need to set name and dofvalues again
+            OPENRAVE_ASSERT_OP_FORMAT0(pInitBody->GetName(), ==, pKinBodyInfo->_name, "names should be matching", ORE_InvalidArguments);
+
+            // dof value
+            pInitBody->GetDOFValues(vDOFValues);
+            FOREACH(it, pKinBodyInfo->_dofValues) {
+                FOREACH(itJoint, pInitBody->_vecjoints) {
+                    if ((*itJoint)->GetName() == it->first.first) {
+                        vDOFValues[(*itJoint)->GetDOFIndex()+it->first.second] = (*it).second;
+                        break;
+                    }
+                }
+            }
+            pInitBody->SetDOFValues(vDOFValues, pKinBodyInfo->_transform, KinBody::CLA_Nothing);
+        }
+        return pNewBody;
+    }
+
     /// \brief removes a kinbody from _vecbodies
     ///
     /// assumes environment and _mutexInterfaces are locked
@@ -2755,6 +3032,16 @@ protected:
             _pPhysicsEngine->RemoveKinBody(*it);
         }
         (*it)->_PostprocessChangedParameters(KinBody::Prop_BodyRemoved);
+        _mapBodyInfoDeltaStamps.erase((*it)->GetEnvironmentId());
+        _listRemovedBodyInfoDeltas.push_back(RemovedBodyInfoDelta());
+        _listRemovedBodyInfoDeltas.back()._stamp = _nInfoDeltaStamp + 1;
+        _listRemovedBodyInfoDeltas.back()._id = (*it)->_id;
+        _listRemovedBodyInfoDeltas.back()._name = (*it)->_name;
+        if( _listRemovedBodyInfoDeltas.size() > s_nMaxRemovedBodyInfoDeltas ) {
+            // stamps before the dropped removal cannot produce a correct delta anymore
+            _nInfoDeltaMinStamp = _listRemovedBodyInfoDeltas.front()._stamp;
+            _listRemovedBodyInfoDeltas.pop_front();
+        }
         RemoveEnvironmentId(*it);
         vector<KinBodyPtr>::iterator itnew = _vecbodies.erase(it);
         _nBodiesModifiedStamp++;
@@ -2797,6 +3084,7 @@ protected:
         }
 
         _nBodiesModifiedStamp = r->_nBodiesModifiedStamp;
+        _ResetInfoDeltaStamps();
         _homedirectory = r->_homedirectory;
         _fDeltaSimTime = r->_fDeltaSimTime;
         _nCurSimTime = 0;
@@ -3225,6 +3513,12 @@ protected:
         }
     }
 
+    /// \brief job of RaveRunParallelJobs for StepSimulation, the environment stays locked by the stepping thread
+    void _StepConcurrentSensor(const std::vector<SensorBasePtr>& vsensors, dReal fTimeStep, int jobindex)
+    {
+        vsensors.at(jobindex)->SimulationStep(fTimeStep);
+    }
+
     void _SimulationThread()
     {
         int environmentid = RaveGetEnvironmentId(shared_from_this());
@@ -3331,6 +3625,7 @@ protected:
 #else
         boost::shared_ptr<EnvironmentMutex::scoped_try_lock> lockenv(new EnvironmentMutex::scoped_try_lock(GetMutex(),false));
 #endif
+        ProfilingScope profilingscope(PC_EnvironmentLockWait);
         uint64_t basetime = utils::GetMicroTime();
         while(utils::GetMicroTime()-basetime<timeout ) {
             lockenv->try_lock();
@@ -3502,6 +3797,30 @@ protected:
     uint64_t _nSimStartTime;
     int _nBodiesModifiedStamp;     ///< incremented every tiem bodies vector is modified
 
+    /// \brief stamps of a body used by ExtractInfoDelta to detect changes
+    struct BodyInfoDeltaStamps
+    {
+        int _updateStamp = -1; ///< last seen KinBody::GetUpdateStamp
+        int _infoUpdateStamp = -1; ///< last seen KinBody::GetInfoUpdateStamp
+        int _stateChangedStamp = 0; ///< delta stamp when the transform or DOF values last changed
+        int _infoChangedStamp = 0; ///< delta stamp when the body was added or its info last changed
+    };
+
+    /// \brief body removed from the environment, used by ExtractInfoDelta
+    struct RemovedBodyInfoDelta
+    {
+        int _stamp = 0; ///< delta stamp when the body was removed
+        std::string _id;
+        std::string _name;
+    };
+
+    static const size_t s_nMaxRemovedBodyInfoDeltas = 10000; ///< max number of removals stored for ExtractInfoDelta
+
+    int _nInfoDeltaStamp; ///< current stamp returned by ExtractInfoDelta, incremented only when changes are found
+    int _nInfoDeltaMinStamp; ///< ExtractInfoDelta returns a full delta for stamps older than this
+    std::map<int, BodyInfoDeltaStamps> _mapBodyInfoDeltaStamps; ///< environment body id -> stamps, protected by the environment mutex
+    std::list<RemovedBodyInfoDelta> _listRemovedBodyInfoDeltas; ///< removed bodies sorted by stamp, protected by the environment mutex
+
     CollisionCheckerBasePtr _pCurrentChecker;
     PhysicsEngineBasePtr _pPhysicsEngine;
 
@@ -3509,6 +3828,7 @@ protected:
     std::map<int, KinBodyWeakPtr> _mapBodies;     ///< a map of all the bodies in the environment. Controlled through the KinBody constructor and destructors
 
     boost::shared_ptr<boost::thread> _threadSimulation;                      ///< main loop for environment simulation
+    std::vector<SensorBasePtr> _vConcurrentSensorsCache; ///< cache for StepSimulation
 
     mutable EnvironmentMutex _mutexEnvironment;          ///< protects internal data from multithreading issues
     mutable boost::mutex _mutexEnvironmentIds;      ///< protects _vecbodies/_vecrobots from multithreading issues
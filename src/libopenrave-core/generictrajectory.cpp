@@ -286,6 +286,7 @@ public:
 
     void Sample(std::vector<dReal>& data, dReal time) const
     {
+        ProfilingScope profilingscope(PC_TrajectorySample);
         BOOST_ASSERT(_bInit);
         BOOST_ASSERT(_timeoffset>=0);
         BOOST_ASSERT(time >= 0);
@@ -330,6 +331,7 @@ public:
 
     void Sample(std::vector<dReal>& data, dReal time, const ConfigurationSpecification& spec, bool reintializeData) const
     {
+        ProfilingScope profilingscope(PC_TrajectorySample);
         BOOST_ASSERT(_bInit);
         OPENRAVE_ASSERT_OP(_timeoffset,>=,0);
         OPENRAVE_ASSERT_OP(time, >=, -g_fEpsilon);
@@ -20,8 +20,11 @@
 #include <openrave/openravemsgpack.h>
 #include <openrave/openrave.h>
 #include <rapidjson/istreamwrapper.h>
+#include <boost/filesystem/operations.hpp>
+#include <boost/thread/mutex.hpp>
 #include <string>
 #include <fstream>
+#include <list>
 
 namespace OpenRAVE {
 
@@ -104,6 +107,182 @@ static std::string ResolveURI(const std::string& uri, const std::vector<std::str
     return ResolveURI(scheme, path, vOpenRAVESchemeAliases);
 }
 
+/// \brief modification stamp of a file on disk, cached entries are invalidated when it changes
+struct JSONFileStamp
+{
+    std::string filename;
+    std::time_t modifiedTime = 0;
+    uintmax_t fileSize = 0;
+};
+
+/// \brief fills the stamp of filename, returns false if the file cannot be stat-ed
+static bool _GetJSONFileStamp(const std::string& filename, JSONFileStamp& stamp)
+{
+    boost::system::error_code ec;
+    boost::filesystem::path path(filename);
+    std::time_t modifiedTime = boost::filesystem::last_write_time(path, ec);
+    if( !!ec ) {
+        return false;
+    }
+    uintmax_t fileSize = boost::filesystem::file_size(path, ec);
+    if( !!ec ) {
+        return false;
+    }
+    stamp.filename = filename;
+    stamp.modifiedTime = modifiedTime;
+    stamp.fileSize = fileSize;
+    return true;
+}
+
+/// \brief process-wide cache of parsed documents and of bodies expanded from referenceUri, shared among all JSONReader instances.
+///
+/// Documents are keyed by their resolved filename and expanded bodies by their resolved uri and the parse options. Every entry remembers the stamps of the files it was built from and is dropped as soon as one of them changes on disk. Both caches are bounded and evict the least recently used entries first.
+class JSONDocumentCache
+{
+public:
+    static JSONDocumentCache& GetInstance()
+    {
+        static JSONDocumentCache s_cache;
+        return s_cache;
+    }
+
+    /// \brief returns the cached document if it is still up to date with stamp
+    boost::shared_ptr<const rapidjson::Document> GetDocument(const JSONFileStamp& stamp)
+    {
+        boost::mutex::scoped_lock lock(_mutex);
+        std::map<std::string, std::list<DocumentEntry>::iterator>::iterator itindex = _mapDocuments.find(stamp.filename);
+        if( itindex == _mapDocuments.end() ) {
+            return boost::shared_ptr<const rapidjson::Document>();
+        }
+        std::list<DocumentEntry>::iterator itentry = itindex->second;
+        if( !_IsStampEqual(itentry->stamp, stamp) ) {
+            _nDocumentBytes -= itentry->nBytes;
+            _listDocuments.erase(itentry);
+            _mapDocuments.erase(itindex);
+            return boost::shared_ptr<const rapidjson::Document>();
+        }
+        _listDocuments.splice(_listDocuments.begin(), _listDocuments, itentry);
+        return itentry->pdoc;
+    }
+
+    void AddDocument(const JSONFileStamp& stamp, boost::shared_ptr<const rapidjson::Document> pdoc, size_t nBytes)
+    {
+        if( nBytes > s_nMaxDocumentBytes ) {
+            return;
+        }
+        boost::mutex::scoped_lock lock(_mutex);
+        std::map<std::string, std::list<DocumentEntry>::iterator>::iterator itindex = _mapDocuments.find(stamp.filename);
+        if( itindex != _mapDocuments.end() ) {
+            _nDocumentBytes -= itindex->second->nBytes;
+            _listDocuments.erase(itindex->second);
+            _mapDocuments.erase(itindex);
+        }
+        _listDocuments.push_front(DocumentEntry());
+        DocumentEntry& entry = _listDocuments.front();
+        entry.stamp = stamp;
+        entry.pdoc = pdoc;
+        entry.nBytes = nBytes;
+        _mapDocuments[stamp.filename] = _listDocuments.begin();
+        _nDocumentBytes += nBytes;
+        while( _nDocumentBytes > s_nMaxDocumentBytes && _listDocuments.size() > 1 ) {
+            DocumentEntry& oldest = _listDocuments.back();
+            _nDocumentBytes -= oldest.nBytes;
+            _mapDocuments.erase(oldest.stamp.filename);
+            _listDocuments.pop_back();
+        }
+    }
+
+    /// \brief returns the cached expanded body for key if none of the files it was expanded from changed. The returned info is shared and must not be modified.
+    KinBody::KinBodyInfoConstPtr GetBodyInfo(const std::string& key)
+    {
+        std::vector<JSONFileStamp> vStamps;
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+            std::map<std::string, std::list<BodyInfoEntry>::iterator>::iterator itindex = _mapBodyInfos.find(key);
+            if( itindex == _mapBodyInfos.end() ) {
+                return KinBody::KinBodyInfoConstPtr();
+            }
+            vStamps = itindex->second->vStamps;
+        }
+
+        // stat outside of the lock
+        bool bUpToDate = true;
+        FOREACHC(itstamp, vStamps) {
+            JSONFileStamp stamp;
+            if( !_GetJSONFileStamp(itstamp->filename, stamp) || !_IsStampEqual(*itstamp, stamp) ) {
+                bUpToDate = false;
+                break;
+            }
+        }
+
+        boost::mutex::scoped_lock lock(_mutex);
+        std::map<std::string, std::list<BodyInfoEntry>::iterator>::iterator itindex = _mapBodyInfos.find(key);
+        if( itindex == _mapBodyInfos.end() ) {
+            return KinBody::KinBodyInfoConstPtr();
+        }
+        if( !bUpToDate ) {
+            _listBodyInfos.erase(itindex->second);
+            _mapBodyInfos.erase(itindex);
+            return KinBody::KinBodyInfoConstPtr();
+        }
+        _listBodyInfos.splice(_listBodyInfos.begin(), _listBodyInfos, itindex->second);
+        return itindex->second->pinfo;
+    }
+
+    void AddBodyInfo(const std::string& key, KinBody::KinBodyInfoConstPtr pinfo, const std::vector<JSONFileStamp>& vStamps)
+    {
+        boost::mutex::scoped_lock lock(_mutex);
+        std::map<std::string, std::list<BodyInfoEntry>::iterator>::iterator itindex = _mapBodyInfos.find(key);
+        if( itindex != _mapBodyInfos.end() ) {
+            _listBodyInfos.erase(itindex->second);
+            _mapBodyInfos.erase(itindex);
+        }
+        _listBodyInfos.push_front(BodyInfoEntry());
+        BodyInfoEntry& entry = _listBodyInfos.front();
+        entry.key = key;
+        entry.pinfo = pinfo;
+        entry.vStamps = vStamps;
+        _mapBodyInfos[key] = _listBodyInfos.begin();
+        while( _listBodyInfos.size() > s_nMaxBodyInfos ) {
+            _mapBodyInfos.erase(_listBodyInfos.back().key);
+            _listBodyInfos.pop_back();
+        }
+    }
+
+private:
+    struct DocumentEntry
+    {
+        JSONFileStamp stamp;
+        boost::shared_ptr<const rapidjson::Document> pdoc;
+        size_t nBytes = 0; ///< memory held by the document allocator
+    };
+
+    struct BodyInfoEntry
+    {
+        std::string key;
+        KinBody::KinBodyInfoConstPtr pinfo;
+        std::vector<JSONFileStamp> vStamps; ///< all files read while expanding the body
+    };
+
+    JSONDocumentCache() : _nDocumentBytes(0) {
+    }
+
+    static bool _IsStampEqual(const JSONFileStamp& stamp0, const JSONFileStamp& stamp1)
+    {
+        return stamp0.modifiedTime == stamp1.modifiedTime && stamp0.fileSize == stamp1.fileSize;
+    }
+
+    static const size_t s_nMaxDocumentBytes = 256*1024*1024; ///< max memory held by all cached documents
+    static const size_t s_nMaxBodyInfos = 1000; ///< max number of cached expanded bodies
+
+    boost::mutex _mutex; ///< protects all members below
+    std::list<DocumentEntry> _listDocuments; ///< most recently used first
+    std::map<std::string, std::list<DocumentEntry>::iterator> _mapDocuments; ///< filename -> entry in _listDocuments
+    size_t _nDocumentBytes;
+    std::list<BodyInfoEntry> _listBodyInfos; ///< most recently used first
+    std::map<std::string, std::list<BodyInfoEntry>::iterator> _mapBodyInfos; ///< key -> entry in _listBodyInfos
+};
+
 class JSONReader
 {
 public:
@@ -148,8 +327,7 @@ public:
                 std::string bodyId = orjson::GetJsonValueByKey<std::string>(*it, "id", "");
                 std::string referenceUri = orjson::GetJsonValueByKey<std::string>(*it, "referenceUri", "");
                 if (_IsExpandableReferenceUri(referenceUri)) {
-                    std::set<std::string> circularReference;
-                    if (!_ExpandRapidJSON(envInfo, bodyId, doc, referenceUri, circularReference, fUnitScale, alloc)) {
+                    if (!_ExpandReferenceUri(envInfo, bodyId, doc, &(*it), referenceUri, fUnitScale, alloc)) {
                         RAVELOG_WARN_FORMAT("failed to load referenced body from uri '%s'", referenceUri);
                         if (_bMustResolveURI) {
                             throw OPENRAVE_EXCEPTION_FORMAT("failed to load referenced body from uri '%s'", referenceUri, ORE_InvalidURI);
@@ -277,29 +455,200 @@ protected:
         return false;
     }
 
-    boost::shared_ptr<const rapidjson::Document> _GetDocumentFromFilename(const std::string& fullFilename, rapidjson::Document::AllocatorType& alloc)
+    /// \brief returns the parsed document of fullFilename, sharing it with other readers through JSONDocumentCache
+    boost::shared_ptr<const rapidjson::Document> _GetDocumentFromFilename(const std::string& fullFilename)
     {
+        JSONFileStamp stamp;
+        bool bHasStamp = _GetJSONFileStamp(fullFilename, stamp);
+        if( bHasStamp && !!_pvExpandedFileStamps ) {
+            _pvExpandedFileStamps->push_back(stamp);
+        }
+
         boost::shared_ptr<const rapidjson::Document> doc;
-        // TODO: optimize this. for the first time doc is cached, all the expandable object will never get cached, because we are not update document cache after expand any body
-        if (_rapidJSONDocuments.find(fullFilename) != _rapidJSONDocuments.end()) {
-            doc = _rapidJSONDocuments[fullFilename];
+        if( bHasStamp ) {
+            doc = JSONDocumentCache::GetInstance().GetDocument(stamp);
+            if( !!doc ) {
+                return doc;
+            }
         }
-        else {
-            boost::shared_ptr<rapidjson::Document> newDoc;
-            if (_EndsWith(fullFilename, ".json")) {
-                newDoc.reset(new rapidjson::Document(&alloc));
-                OpenRapidJsonDocument(fullFilename, *newDoc);
+
+        // documents own their allocator since they outlive the reader and the environment
+        boost::shared_ptr<rapidjson::Document> newDoc;
+        if (_EndsWith(fullFilename, ".json")) {
+            newDoc.reset(new rapidjson::Document());
+            OpenRapidJsonDocument(fullFilename, *newDoc);
+        }
+        else if (_EndsWith(fullFilename, ".msgpack")) {
+            newDoc.reset(new rapidjson::Document());
+            OpenMsgPackDocument(fullFilename, *newDoc);
+        }
+        if (!!newDoc) {
+            doc = newDoc;
+            if( bHasStamp ) {
+                JSONDocumentCache::GetInstance().AddDocument(stamp, doc, newDoc->GetAllocator().Size());
             }
-            else if (_EndsWith(fullFilename, ".msgpack")) {
-                newDoc.reset(new rapidjson::Document(&alloc));
-                OpenMsgPackDocument(fullFilename, *newDoc);
+        }
+        return doc;
+    }
+
+    /// \brief returns true if the scene body value only overrides top-level fields of its referenced body, in which case the expanded referenced body can be shared from the cache.
+    static bool _IsCacheableBodyOverlay(const rapidjson::Value& bodyValue)
+    {
+        if( !bodyValue.IsObject() ) {
+            return false;
+        }
+        for (rapidjson::Value::ConstMemberIterator it = bodyValue.MemberBegin(); it != bodyValue.MemberEnd(); ++it) {
+            const char* name = it->name.GetString();
+            if( strcmp(name, "id") != 0 && strcmp(name, "name") != 0 && strcmp(name, "referenceUri") != 0 && strcmp(name, "transform") != 0 && strcmp(name, "dofValues") != 0 && strcmp(name, "interfaceType") != 0 ) {
+                return false;
             }
-            if (!!newDoc) {
-                doc = newDoc;
-                _rapidJSONDocuments[fullFilename] = doc;
+        }
+        return true;
+    }
+
+    /// \brief replaces every element of vinfos with a copy of itself
+    template <typename T>
+    static void _CloneInfos(std::vector< boost::shared_ptr<T> >& vinfos)
+    {
+        FOREACH(itinfo, vinfos) {
+            if( !!*itinfo ) {
+                itinfo->reset(new T(**itinfo));
+            }
+        }
+    }
+
+    static void _CloneLinkInfos(std::vector<KinBody::LinkInfoPtr>& vLinkInfos)
+    {
+        _CloneInfos(vLinkInfos);
+        FOREACH(itLinkInfo, vLinkInfos) {
+            if( !!*itLinkInfo ) {
+                _CloneInfos((*itLinkInfo)->_vgeometryinfos);
+            }
+        }
+    }
+
+    static void _CloneJointInfos(std::vector<KinBody::JointInfoPtr>& vJointInfos)
+    {
+        _CloneInfos(vJointInfos);
+        FOREACH(itJointInfo, vJointInfos) {
+            KinBody::JointInfoPtr pJointInfo = *itJointInfo;
+            if( !pJointInfo ) {
+                continue;
+            }
+            FOREACH(itmimic, pJointInfo->_vmimic) {
+                if( !!*itmimic ) {
+                    itmimic->reset(new KinBody::MimicInfo(**itmimic));
+                }
+            }
+            if( !!pJointInfo->_infoElectricMotor ) {
+                pJointInfo->_infoElectricMotor.reset(new ElectricMotorActuatorInfo(*pJointInfo->_infoElectricMotor));
+            }
+            if( !!pJointInfo->_jci_robotcontroller ) {
+                pJointInfo->_jci_robotcontroller.reset(new KinBody::JointInfo::JointControlInfo_RobotController(*pJointInfo->_jci_robotcontroller));
+            }
+            if( !!pJointInfo->_jci_io ) {
+                pJointInfo->_jci_io.reset(new KinBody::JointInfo::JointControlInfo_IO(*pJointInfo->_jci_io));
+            }
+            if( !!pJointInfo->_jci_externaldevice ) {
+                pJointInfo->_jci_externaldevice.reset(new KinBody::JointInfo::JointControlInfo_ExternalDevice(*pJointInfo->_jci_externaldevice));
             }
         }
-        return doc;
+    }
+
+    /// \brief deep copies the cached info so that it can be modified by the overlay, the uri processing and the caller without touching the cache.
+    ///
+    /// The copy constructors of the infos only copy the pointers of their element infos, so every element info is copied here.
+    static KinBody::KinBodyInfoPtr _CloneCachedBodyInfo(const KinBody::KinBodyInfo& info)
+    {
+        KinBody::KinBodyInfoPtr pNewKinBodyInfo;
+        const RobotBase::RobotBaseInfo* pRobotBaseInfo = dynamic_cast<const RobotBase::RobotBaseInfo*>(&info);
+        if( !pRobotBaseInfo ) {
+            pNewKinBodyInfo.reset(new KinBody::KinBodyInfo(info));
+        }
+        else {
+            RobotBase::RobotBaseInfoPtr pNewRobotBaseInfo(new RobotBase::RobotBaseInfo(*pRobotBaseInfo));
+            _CloneInfos(pNewRobotBaseInfo->_vManipulatorInfos);
+            _CloneInfos(pNewRobotBaseInfo->_vAttachedSensorInfos);
+            _CloneInfos(pNewRobotBaseInfo->_vGripperInfos);
+            // connected bodies are filled in place by _ProcessURIsInRobotBaseInfo
+            _CloneInfos(pNewRobotBaseInfo->_vConnectedBodyInfos);
+            FOREACH(itConnected, pNewRobotBaseInfo->_vConnectedBodyInfos) {
+                RobotBase::ConnectedBodyInfoPtr pConnectedBodyInfo = *itConnected;
+                if( !pConnectedBodyInfo ) {
+                    continue;
+                }
+                _CloneLinkInfos(pConnectedBodyInfo->_vLinkInfos);
+                _CloneJointInfos(pConnectedBodyInfo->_vJointInfos);
+                _CloneInfos(pConnectedBodyInfo->_vManipulatorInfos);
+                _CloneInfos(pConnectedBodyInfo->_vAttachedSensorInfos);
+                _CloneInfos(pConnectedBodyInfo->_vGripperInfos);
+            }
+            pNewKinBodyInfo = pNewRobotBaseInfo;
+        }
+        _CloneLinkInfos(pNewKinBodyInfo->_vLinkInfos);
+        _CloneJointInfos(pNewKinBodyInfo->_vJointInfos);
+        _CloneInfos(pNewKinBodyInfo->_vGrabbedInfos);
+        return pNewKinBodyInfo;
+    }
+
+    /// \brief expands referenceUri of body originBodyId into envInfo. Bodies referenced from files are expanded once and shared through JSONDocumentCache.
+    ///
+    /// \param pBodyValue the scene value of the body that is overlayed on top of the expanded body, or NULL if nothing is overlayed
+    bool _ExpandReferenceUri(EnvironmentBase::EnvironmentBaseInfo& envInfo, const std::string& originBodyId, const rapidjson::Value& currentDoc, const rapidjson::Value* pBodyValue, const std::string& referenceUri, dReal fUnitScale, rapidjson::Document::AllocatorType& alloc)
+    {
+        std::string scheme, path, fragment;
+        ParseURI(referenceUri, scheme, path, fragment);
+        bool bCacheable = !scheme.empty() && !path.empty() && (!pBodyValue || _IsCacheableBodyOverlay(*pBodyValue));
+        if( bCacheable ) {
+            // cannot share anything if the reference is expanded on top of an existing body
+            FOREACHC(itBodyInfo, envInfo._vBodyInfos) {
+                if( (*itBodyInfo)->_id == originBodyId ) {
+                    bCacheable = false;
+                    break;
+                }
+            }
+        }
+        std::set<std::string> circularReference;
+        if( !bCacheable ) {
+            return _ExpandRapidJSON(envInfo, originBodyId, currentDoc, referenceUri, circularReference, fUnitScale, alloc);
+        }
+
+        _ReplaceFilenameSuffix(path, ".dae", _defaultSuffix);
+        std::string fullFilename = ResolveURI(scheme, path, GetOpenRAVESchemeAliases());
+        if( fullFilename.empty() ) {
+            return _ExpandRapidJSON(envInfo, originBodyId, currentDoc, referenceUri, circularReference, fUnitScale, alloc);
+        }
+        std::string key = str(boost::format("%s#%s?unitScale=%.15e&options=%d&suffix=%s")%fullFilename%fragment%fUnitScale%_deserializeOptions%_defaultSuffix);
+        KinBody::KinBodyInfoConstPtr pCachedInfo = JSONDocumentCache::GetInstance().GetBodyInfo(key);
+        if( !!pCachedInfo ) {
+            KinBody::KinBodyInfoPtr pKinBodyInfo = _CloneCachedBodyInfo(*pCachedInfo);
+            pKinBodyInfo->_id = originBodyId;
+            envInfo._vBodyInfos.push_back(pKinBodyInfo);
+            RAVELOG_DEBUG_FORMAT("loaded referenced body from uri '%s' for body %s from cache", referenceUri%originBodyId);
+            return true;
+        }
+
+        EnvironmentBase::EnvironmentBaseInfo expandedEnvInfo;
+        std::vector<JSONFileStamp> vStamps;
+        _pvExpandedFileStamps = &vStamps;
+        bool bSuccess = false;
+        try {
+            bSuccess = _ExpandRapidJSON(expandedEnvInfo, originBodyId, currentDoc, referenceUri, circularReference, fUnitScale, alloc);
+        }
+        catch(...) {
+            _pvExpandedFileStamps = NULL;
+            throw;
+        }
+        _pvExpandedFileStamps = NULL;
+        if( !bSuccess ) {
+            return false;
+        }
+        if( expandedEnvInfo._vBodyInfos.size() == 1 && expandedEnvInfo._vBodyInfos[0]->_mReadableInterfaces.empty() ) {
+            // readable interfaces are modified in place and can come from plugins, so never share them
+            JSONDocumentCache::GetInstance().AddBodyInfo(key, _CloneCachedBodyInfo(*expandedEnvInfo._vBodyInfos[0]), vStamps);
+        }
+        envInfo._vBodyInfos.insert(envInfo._vBodyInfos.end(), expandedEnvInfo._vBodyInfos.begin(), expandedEnvInfo._vBodyInfos.end());
+        return true;
     }
 
     bool _ExpandRapidJSON(EnvironmentBase::EnvironmentBaseInfo& envInfo, const std::string& originBodyId, const rapidjson::Value& currentDoc, const std::string& referenceUri, std::set<std::string>& circularReference, dReal fUnitScale, rapidjson::Document::AllocatorType& alloc) {
@@ -353,7 +702,7 @@ protected:
                 return false;
             }
 
-            boost::shared_ptr<const rapidjson::Document> referenceDoc = _GetDocumentFromFilename(fullFilename, alloc);
+            boost::shared_ptr<const rapidjson::Document> referenceDoc = _GetDocumentFromFilename(fullFilename);
             if (!referenceDoc || !(*referenceDoc).HasMember("bodies")) {
                 RAVELOG_ERROR_FORMAT("referenced document cannot be loaded, or has no bodies: %s", fullFilename);
                 return false;
@@ -534,9 +883,8 @@ protected:
             if( !_IsExpandableReferenceUri(pConnected->_uri) ) {
                 continue;
             }
-            std::set<std::string> circularReference;
             EnvironmentBase::EnvironmentBaseInfo envInfo;
-            if (!_ExpandRapidJSON(envInfo, "__connectedBody__", doc, pConnected->_uri, circularReference, fUnitScale, alloc)) {
+            if (!_ExpandReferenceUri(envInfo, "__connectedBody__", doc, NULL, pConnected->_uri, fUnitScale, alloc)) {
                 RAVELOG_ERROR_FORMAT("failed to load connected body from uri '%s'", pConnected->_uri);
                 if (_bMustResolveURI) {
                     throw OPENRAVE_EXCEPTION_FORMAT("failed to load connected body from uri '%s'", pConnected->_uri, ORE_InvalidURI);
@@ -575,8 +923,7 @@ protected:
     std::string _defaultSuffix; ///< defaultSuffix of the main document, either ".json" or ".msgpack"
     std::vector<std::string> _vOpenRAVESchemeAliases;
     bool _bMustResolveURI = false; ///< if true, throw exception if uri does not resolve
-
-    std::map<std::string, boost::shared_ptr<const rapidjson::Document> > _rapidJSONDocuments; ///< cache for opened rapidjson Documents
+    std::vector<JSONFileStamp>* _pvExpandedFileStamps = NULL; ///< if set, receives the stamps of all files opened by _GetDocumentFromFilename
 };
 
 bool RaveParseJSON(EnvironmentBasePtr penv, const rapidjson::Value& doc, const AttributesList& atts, rapidjson::Document::AllocatorType& alloc)
@@ -16,6 +16,35 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "libopenrave.h"
 
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/array.hpp>
+#include <boost/core/demangle.hpp>
+#include <boost/lexical_cast.hpp>
+
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#endif
+
+#if defined(__GLIBC__) || defined(__APPLE__)
+#include <execinfo.h>
+#define RAVE_HAS_BACKTRACE
+#endif
+
+/// \brief fills ppframes with the return addresses of the callers of the current function, innermost first.
+///
+/// Has to be a macro so that the frame of the function calling it is the first one returned by backtrace.
+#if defined(RAVE_HAS_BACKTRACE)
+#define RAVE_CAPTURE_CALLERS(ppframes, numframes) { \
+        void* ppbacktrace[s_nCallSiteFrames+1]; \
+        numframes = backtrace(ppbacktrace, s_nCallSiteFrames+1) - 1; \
+        for(int iframe = 0; iframe < numframes; ++iframe) { ppframes[iframe] = ppbacktrace[iframe+1]; } \
+}
+#elif defined(__GNUC__) || defined(__clang__)
+#define RAVE_CAPTURE_CALLERS(ppframes, numframes) { ppframes[0] = __builtin_return_address(0); numframes = 1; }
+#else
+#define RAVE_CAPTURE_CALLERS(ppframes, numframes) { numframes = 0; }
+#endif
+
 void EnvironmentBase::EnvironmentBaseInfo::Reset()
 {
     _vBodyInfos.clear();
@@ -162,3 +191,393 @@ void EnvironmentBase::EnvironmentBaseInfo::DeserializeJSON(const rapidjson::Valu
         }
     }
 }
+
+void EnvironmentBase::EnvironmentBaseInfoDelta::Reset()
+{
+    _stamp = 0;
+    _isFull = false;
+    _vBodyInfos.clear();
+    _vBodyStates.clear();
+    _vRemovedBodies.clear();
+    _revision = 0;
+    _name.clear();
+    _description.clear();
+    _keywords.clear();
+    _gravity = Vector(0,0,-9.797930195020351);
+}
+
+void EnvironmentBase::EnvironmentBaseInfoDelta::SerializeJSON(rapidjson::Value& value, rapidjson::Document::AllocatorType& allocator, dReal fUnitScale, int options) const
+{
+    value.SetObject();
+
+    orjson::SetJsonValueByKey(value, "stamp", _stamp, allocator);
+    orjson::SetJsonValueByKey(value, "isFull", _isFull, allocator);
+    orjson::SetJsonValueByKey(value, "revision", _revision, allocator);
+    orjson::SetJsonValueByKey(value, "name", _name, allocator);
+    orjson::SetJsonValueByKey(value, "keywords", _keywords, allocator);
+    orjson::SetJsonValueByKey(value, "description", _description, allocator);
+    orjson::SetJsonValueByKey(value, "gravity", _gravity, allocator);
+
+    if (_vBodyInfos.size() > 0) {
+        rapidjson::Value rBodiesValue;
+        rBodiesValue.SetArray();
+        rBodiesValue.Reserve(_vBodyInfos.size(), allocator);
+        FOREACHC(it, _vBodyInfos) {
+            rapidjson::Value bodyValue;
+            (*it)->SerializeJSON(bodyValue, allocator, fUnitScale, options);
+            rBodiesValue.PushBack(bodyValue, allocator);
+        }
+        value.AddMember("bodies", rBodiesValue, allocator);
+    }
+
+    if (_vBodyStates.size() > 0) {
+        rapidjson::Value rBodyStatesValue;
+        rBodyStatesValue.SetArray();
+        rBodyStatesValue.Reserve(_vBodyStates.size(), allocator);
+        FOREACHC(it, _vBodyStates) {
+            rapidjson::Value bodyStateValue;
+            bodyStateValue.SetObject();
+            orjson::SetJsonValueByKey(bodyStateValue, "id", it->_id, allocator);
+            orjson::SetJsonValueByKey(bodyStateValue, "name", it->_name, allocator);
+            orjson::SetJsonValueByKey(bodyStateValue, "transform", it->_transform, allocator);
+            orjson::SetJsonValueByKey(bodyStateValue, "dofValues", it->_vDOFValues, allocator);
+            rBodyStatesValue.PushBack(bodyStateValue, allocator);
+        }
+        value.AddMember("bodyStates", rBodyStatesValue, allocator);
+    }
+
+    if (_vRemovedBodies.size() > 0) {
+        rapidjson::Value rRemovedBodiesValue;
+        rRemovedBodiesValue.SetArray();
+        rRemovedBodiesValue.Reserve(_vRemovedBodies.size(), allocator);
+        FOREACHC(it, _vRemovedBodies) {
+            rapidjson::Value removedBodyValue;
+            removedBodyValue.SetObject();
+            orjson::SetJsonValueByKey(removedBodyValue, "id", it->first, allocator);
+            orjson::SetJsonValueByKey(removedBodyValue, "name", it->second, allocator);
+            rRemovedBodiesValue.PushBack(removedBodyValue, allocator);
+        }
+        value.AddMember("removedBodies", rRemovedBodiesValue, allocator);
+    }
+}
+
+void EnvironmentBase::EnvironmentBaseInfoDelta::DeserializeJSON(const rapidjson::Value& value, dReal fUnitScale, int options)
+{
+    Reset();
+
+    orjson::LoadJsonValueByKey(value, "stamp", _stamp);
+    orjson::LoadJsonValueByKey(value, "isFull", _isFull);
+    orjson::LoadJsonValueByKey(value, "revision", _revision);
+    orjson::LoadJsonValueByKey(value, "name", _name);
+    orjson::LoadJsonValueByKey(value, "keywords", _keywords);
+    orjson::LoadJsonValueByKey(value, "description", _description);
+    orjson::LoadJsonValueByKey(value, "gravity", _gravity);
+
+    if (value.HasMember("bodies")) {
+        _vBodyInfos.reserve(value["bodies"].Size());
+        for (rapidjson::Value::ConstValueIterator it = value["bodies"].Begin(); it != value["bodies"].End(); ++it) {
+            if (orjson::GetJsonValueByKey<bool>(*it, "isRobot", false)) {
+                RobotBase::RobotBaseInfoPtr pRobotBaseInfo(new RobotBase::RobotBaseInfo());
+                pRobotBaseInfo->DeserializeJSON(*it, fUnitScale, options);
+                _vBodyInfos.push_back(pRobotBaseInfo);
+            }
+            else {
+                KinBody::KinBodyInfoPtr pKinBodyInfo(new KinBody::KinBodyInfo());
+                pKinBodyInfo->DeserializeJSON(*it, fUnitScale, options);
+                _vBodyInfos.push_back(pKinBodyInfo);
+            }
+        }
+    }
+
+    if (value.HasMember("bodyStates")) {
+        _vBodyStates.resize(value["bodyStates"].Size());
+        for (rapidjson::SizeType istate = 0; istate < value["bodyStates"].Size(); ++istate) {
+            const rapidjson::Value& rBodyState = value["bodyStates"][istate];
+            orjson::LoadJsonValueByKey(rBodyState, "id", _vBodyStates[istate]._id);
+            orjson::LoadJsonValueByKey(rBodyState, "name", _vBodyStates[istate]._name);
+            orjson::LoadJsonValueByKey(rBodyState, "transform", _vBodyStates[istate]._transform);
+            orjson::LoadJsonValueByKey(rBodyState, "dofValues", _vBodyStates[istate]._vDOFValues);
+        }
+    }
+
+    if (value.HasMember("removedBodies")) {
+        _vRemovedBodies.resize(value["removedBodies"].Size());
+        for (rapidjson::SizeType iremoved = 0; iremoved < value["removedBodies"].Size(); ++iremoved) {
+            const rapidjson::Value& rRemovedBody = value["removedBodies"][iremoved];
+            orjson::LoadJsonValueByKey(rRemovedBody, "id", _vRemovedBodies[iremoved].first);
+            orjson::LoadJsonValueByKey(rRemovedBody, "name", _vRemovedBodies[iremoved].second);
+        }
+    }
+}
+
+namespace OpenRAVE {
+
+namespace {
+
+static const size_t s_nMaxEnvironmentMutexEvents = 4096; ///< size of the ring buffer of acquisitions
+static const int s_nCallSiteFrames = 4; ///< number of callers of lock recorded per acquisition
+
+/// \brief return addresses of the callers of lock, innermost first. Several frames are kept since lock is usually called from boost::unique_lock or std::lock_guard when they are not inlined.
+typedef boost::array<const void*, s_nCallSiteFrames> CallSite;
+
+/// \brief returns the name of the first caller that is not a lock wrapper, or the hex value of the innermost caller if it cannot be resolved
+static std::string _GetCallSiteName(const CallSite& callsite)
+{
+#if !defined(_WIN32)
+    FOREACHC(itframe, callsite) {
+        Dl_info info;
+        if( !*itframe || dladdr(*itframe, &info) == 0 || !info.dli_sname ) {
+            continue;
+        }
+        std::string name = boost::core::demangle(info.dli_sname);
+        if( boost::starts_with(name, "boost::") || boost::starts_with(name, "std::") || boost::starts_with(name, "OpenRAVE::EnvironmentMutex::") ) {
+            continue;
+        }
+        return str(boost::format("%s+0x%x")%name%((const char*)*itframe - (const char*)info.dli_saddr));
+    }
+#endif
+    return str(boost::format("%p")%callsite[0]);
+}
+
+} // end namespace
+
+class EnvironmentMutex::TracingData
+{
+public:
+    struct Event
+    {
+        boost::thread::id threadid;
+        CallSite callsite;
+        uint64_t requesttime; ///< when the lock was requested
+        uint64_t waitduration; ///< time between the request and the acquisition
+        uint64_t holdduration;
+        int numwaiters; ///< number of other threads waiting when the lock was released
+    };
+
+    struct CallSiteStatistics
+    {
+        CallSiteStatistics() : count(0), totalwait(0), maxwait(0), totalhold(0), maxhold(0), contended(0) {
+        }
+        uint64_t count, totalwait, maxwait, totalhold, maxhold;
+        uint64_t contended; ///< number of releases that had at least one thread waiting
+    };
+
+    TracingData() : numwaiters(0), holderrequesttime(0), holderacquiretime(0), nextevent(0) {
+        holdercallsite.fill(NULL);
+    }
+
+    mutable boost::mutex mutex; ///< protects all members
+    int numwaiters; ///< number of threads currently blocked in lock
+
+    // information of the current holder, valid while holderacquiretime > 0
+    boost::thread::id holderthreadid;
+    CallSite holdercallsite;
+    uint64_t holderrequesttime;
+    uint64_t holderacquiretime;
+
+    std::vector<Event> vevents; ///< ring buffer
+    size_t nextevent;
+    std::map<CallSite, CallSiteStatistics> mapCallSiteStatistics;
+};
+
+EnvironmentMutex::EnvironmentMutex() : _nLockDepth(0), _bHolderRecorded(false), _bTracing(false), _pTracingData(new TracingData())
+{
+}
+
+EnvironmentMutex::~EnvironmentMutex()
+{
+    delete _pTracingData;
+}
+
+void EnvironmentMutex::lock()
+{
+    if( !_bTracing ) {
+        if( !_mutex.try_lock() ) {
+            ProfilingScope profilingscope(PC_EnvironmentLockWait);
+            _mutex.lock();
+        }
+        ++_nLockDepth;
+        return;
+    }
+
+    void* ppcallers[s_nCallSiteFrames];
+    int numcallers = 0;
+    RAVE_CAPTURE_CALLERS(ppcallers, numcallers);
+    uint64_t requesttime = RaveGetProfilingTime();
+    if( !_mutex.try_lock() ) {
+        {
+            boost::mutex::scoped_lock lock(_pTracingData->mutex);
+            ++_pTracingData->numwaiters;
+        }
+        {
+            ProfilingScope profilingscope(PC_EnvironmentLockWait);
+            _mutex.lock();
+        }
+        boost::mutex::scoped_lock lock(_pTracingData->mutex);
+        --_pTracingData->numwaiters;
+    }
+    _OnAcquired(ppcallers, numcallers, requesttime);
+}
+
+bool EnvironmentMutex::try_lock()
+{
+    if( !_bTracing ) {
+        if( !_mutex.try_lock() ) {
+            return false;
+        }
+        ++_nLockDepth;
+        return true;
+    }
+
+    void* ppcallers[s_nCallSiteFrames];
+    int numcallers = 0;
+    RAVE_CAPTURE_CALLERS(ppcallers, numcallers);
+    uint64_t requesttime = RaveGetProfilingTime();
+    if( !_mutex.try_lock() ) {
+        return false;
+    }
+    _OnAcquired(ppcallers, numcallers, requesttime);
+    return true;
+}
+
+void EnvironmentMutex::unlock()
+{
+    --_nLockDepth;
+    if( _nLockDepth == 0 && _bHolderRecorded ) {
+        // the holder was recorded by _OnAcquired, so finish the event even if tracing was disabled meanwhile
+        _bHolderRecorded = false;
+        boost::mutex::scoped_lock lock(_pTracingData->mutex);
+        if( _pTracingData->holderacquiretime > 0 ) {
+            TracingData::Event event;
+            event.threadid = _pTracingData->holderthreadid;
+            event.callsite = _pTracingData->holdercallsite;
+            event.requesttime = _pTracingData->holderrequesttime;
+            event.waitduration = _pTracingData->holderacquiretime - _pTracingData->holderrequesttime;
+            event.holdduration = RaveGetProfilingTime() - _pTracingData->holderacquiretime;
+            event.numwaiters = _pTracingData->numwaiters;
+            _pTracingData->holderacquiretime = 0;
+
+            if( _pTracingData->vevents.size() < s_nMaxEnvironmentMutexEvents ) {
+                _pTracingData->vevents.push_back(event);
+            }
+            else {
+                _pTracingData->vevents[_pTracingData->nextevent] = event;
+                _pTracingData->nextevent = (_pTracingData->nextevent + 1) % s_nMaxEnvironmentMutexEvents;
+            }
+            TracingData::CallSiteStatistics& stats = _pTracingData->mapCallSiteStatistics[event.callsite];
+            stats.count += 1;
+            stats.totalwait += event.waitduration;
+            stats.maxwait = max(stats.maxwait, event.waitduration);
+            stats.totalhold += event.holdduration;
+            stats.maxhold = max(stats.maxhold, event.holdduration);
+            if( event.numwaiters > 0 ) {
+                stats.contended += 1;
+            }
+        }
+    }
+    _mutex.unlock();
+}
+
+void EnvironmentMutex::_OnAcquired(void* const* ppcallers, int numcallers, uint64_t requesttime)
+{
+    ++_nLockDepth;
+    if( _nLockDepth == 1 ) {
+        CallSite callsite;
+        callsite.fill(NULL);
+        std::copy(ppcallers, ppcallers+min(numcallers, s_nCallSiteFrames), callsite.begin());
+        uint64_t acquiretime = RaveGetProfilingTime();
+        _bHolderRecorded = true;
+        boost::mutex::scoped_lock lock(_pTracingData->mutex);
+        _pTracingData->holderthreadid = boost::this_thread::get_id();
+        _pTracingData->holdercallsite = callsite;
+        _pTracingData->holderrequesttime = requesttime;
+        _pTracingData->holderacquiretime = max(acquiretime, uint64_t(1));
+    }
+}
+
+void EnvironmentMutex::SetTracing(bool bTracing)
+{
+    _bTracing = bTracing;
+}
+
+void EnvironmentMutex::ResetTracingStatistics()
+{
+    boost::mutex::scoped_lock lock(_pTracingData->mutex);
+    _pTracingData->vevents.clear();
+    _pTracingData->nextevent = 0;
+    _pTracingData->mapCallSiteStatistics.clear();
+}
+
+void EnvironmentMutex::GetTracingStatistics(rapidjson::Value& rStatistics, rapidjson::Document::AllocatorType& alloc) const
+{
+    std::vector<TracingData::Event> vevents;
+    std::map<CallSite, TracingData::CallSiteStatistics> mapCallSiteStatistics;
+    TracingData::Event holder;
+    bool bHasHolder = false;
+    int numwaiters = 0;
+    {
+        boost::mutex::scoped_lock lock(_pTracingData->mutex);
+        // return the events from oldest to newest
+        vevents.insert(vevents.end(), _pTracingData->vevents.begin()+_pTracingData->nextevent, _pTracingData->vevents.end());
+        vevents.insert(vevents.end(), _pTracingData->vevents.begin(), _pTracingData->vevents.begin()+_pTracingData->nextevent);
+        mapCallSiteStatistics = _pTracingData->mapCallSiteStatistics;
+        numwaiters = _pTracingData->numwaiters;
+        if( _pTracingData->holderacquiretime > 0 ) {
+            bHasHolder = true;
+            holder.threadid = _pTracingData->holderthreadid;
+            holder.callsite = _pTracingData->holdercallsite;
+            holder.waitduration = _pTracingData->holderacquiretime - _pTracingData->holderrequesttime;
+            holder.holdduration = RaveGetProfilingTime() - _pTracingData->holderacquiretime;
+        }
+    }
+
+    std::map<CallSite, std::string> mapCallSiteNames;
+    rStatistics.SetObject();
+    orjson::SetJsonValueByKey(rStatistics, "tracing", (bool)_bTracing, alloc);
+    orjson::SetJsonValueByKey(rStatistics, "numWaiters", numwaiters, alloc);
+    if( bHasHolder ) {
+        rapidjson::Value rHolder(rapidjson::kObjectType);
+        orjson::SetJsonValueByKey(rHolder, "thread", boost::lexical_cast<std::string>(holder.threadid), alloc);
+        orjson::SetJsonValueByKey(rHolder, "callSite", mapCallSiteNames[holder.callsite] = _GetCallSiteName(holder.callsite), alloc);
+        orjson::SetJsonValueByKey(rHolder, "waitNS", holder.waitduration, alloc);
+        orjson::SetJsonValueByKey(rHolder, "heldNS", holder.holdduration, alloc);
+        rStatistics.AddMember("holder", rHolder, alloc);
+    }
+
+    rapidjson::Value rCallSites(rapidjson::kArrayType);
+    FOREACHC(itstats, mapCallSiteStatistics) {
+        std::string& callsitename = mapCallSiteNames[itstats->first];
+        if( callsitename.size() == 0 ) {
+            callsitename = _GetCallSiteName(itstats->first);
+        }
+        rapidjson::Value rCallSite(rapidjson::kObjectType);
+        orjson::SetJsonValueByKey(rCallSite, "callSite", callsitename, alloc);
+        orjson::SetJsonValueByKey(rCallSite, "count", itstats->second.count, alloc);
+        orjson::SetJsonValueByKey(rCallSite, "contended", itstats->second.contended, alloc);
+        orjson::SetJsonValueByKey(rCallSite, "totalWaitNS", itstats->second.totalwait, alloc);
+        orjson::SetJsonValueByKey(rCallSite, "maxWaitNS", itstats->second.maxwait, alloc);
+        orjson::SetJsonValueByKey(rCallSite, "totalHoldNS", itstats->second.totalhold, alloc);
+        orjson::SetJsonValueByKey(rCallSite, "maxHoldNS", itstats->second.maxhold, alloc);
+        rCallSites.PushBack(rCallSite, alloc);
+    }
+    rStatistics.AddMember("callSites", rCallSites, alloc);
+
+    rapidjson::Value rEvents(rapidjson::kArrayType);
+    FOREACHC(itevent, vevents) {
+        std::string& callsitename = mapCallSiteNames[itevent->callsite];
+        if( callsitename.size() == 0 ) {
+            callsitename = _GetCallSiteName(itevent->callsite);
+        }
+        rapidjson::Value rEvent(rapidjson::kObjectType);
+        orjson::SetJsonValueByKey(rEvent, "thread", boost::lexical_cast<std::string>(itevent->threadid), alloc);
+        orjson::SetJsonValueByKey(rEvent, "callSite", callsitename, alloc);
+        orjson::SetJsonValueByKey(rEvent, "requestTimeNS", itevent->requesttime, alloc);
+        orjson::SetJsonValueByKey(rEvent, "waitNS", itevent->waitduration, alloc);
+        orjson::SetJsonValueByKey(rEvent, "holdNS", itevent->holdduration, alloc);
+        orjson::SetJsonValueByKey(rEvent, "numWaiters", itevent->numwaiters, alloc);
+        rEvents.PushBack(rEvent, alloc);
+    }
+    rStatistics.AddMember("events", rEvents, alloc);
+}
+
+} // end namespace OpenRAVE
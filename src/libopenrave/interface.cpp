@@ -17,6 +17,58 @@
 #include "libopenrave.h"
 
 namespace OpenRAVE {
+
+typedef boost::function<void (const rapidjson::Value&, rapidjson::Value&, rapidjson::Document::AllocatorType&)> GlobalJSONCommandFn;
+typedef std::map<std::string, std::pair<GlobalJSONCommandFn, std::string> > GLOBALJSONCMDMAP;
+
+static void _SetProfilingOptionsJSONCommand(const rapidjson::Value& input, rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator)
+{
+    int options = RaveGetProfilingOptions();
+    if( input.IsObject() ) {
+        bool bCounters = !!(options & PO_Counters), bTrace = !!(options & PO_Trace), bReset = false;
+        orjson::LoadJsonValueByKey(input, "counters", bCounters);
+        orjson::LoadJsonValueByKey(input, "trace", bTrace);
+        orjson::LoadJsonValueByKey(input, "reset", bReset);
+        options = (bCounters ? PO_Counters : 0) | (bTrace ? PO_Trace : 0);
+        if( bReset ) {
+            RaveResetProfilingStatistics();
+        }
+        RaveSetProfilingOptions(options);
+    }
+    output.SetObject();
+    orjson::SetJsonValueByKey(output, "counters", !!(options & PO_Counters), allocator);
+    orjson::SetJsonValueByKey(output, "trace", !!(options & PO_Trace), allocator);
+}
+
+static void _GetProfilingStatisticsJSONCommand(const rapidjson::Value& input, rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator)
+{
+    RaveGetProfilingStatistics(output, allocator);
+    if( input.IsObject() && orjson::GetJsonValueByKey<bool>(input, "reset", false) ) {
+        RaveResetProfilingStatistics();
+    }
+}
+
+static void _GetProfilingTraceJSONCommand(const rapidjson::Value& input, rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator)
+{
+    RaveGetProfilingTrace(output, allocator);
+}
+
+static GLOBALJSONCMDMAP _CreateGlobalJSONCommands()
+{
+    GLOBALJSONCMDMAP mapCommands;
+    mapCommands["SetProfilingOptions"] = std::make_pair(GlobalJSONCommandFn(_SetProfilingOptionsJSONCommand), std::string("enables profiling of the hot paths of all interfaces. input is {\"counters\":bool, \"trace\":bool, \"reset\":bool}."));
+    mapCommands["GetProfilingStatistics"] = std::make_pair(GlobalJSONCommandFn(_GetProfilingStatisticsJSONCommand), std::string("returns the profiling counters and latency histograms per category. input is {\"reset\":bool}."));
+    mapCommands["GetProfilingTrace"] = std::make_pair(GlobalJSONCommandFn(_GetProfilingTraceJSONCommand), std::string("returns the recorded profiling samples in the Chrome trace event format."));
+    return mapCommands;
+}
+
+/// \brief JSON commands that every interface supports. They only act on the global state, so they are created once instead of being registered by every interface.
+static const GLOBALJSONCMDMAP& _GetGlobalJSONCommands()
+{
+    static const GLOBALJSONCMDMAP s_mapCommands = _CreateGlobalJSONCommands();
+    return s_mapCommands;
+}
+
 InterfaceBase::InterfaceBase(InterfaceType type, EnvironmentBasePtr penv) : __type(type), __penv(penv)
 {
     RaveInitializeFromState(penv->GlobalState()); // make sure global state is set
@@ -210,8 +262,13 @@ bool InterfaceBase::_GetCommandHelp(std::ostream& o, std::istream& sinput) const
 
 bool InterfaceBase::SupportsJSONCommand(const std::string& cmd)
 {
-    boost::shared_lock< boost::shared_mutex > lock(_mutexInterface);
-    return __mapJSONCommands.find(cmd) != __mapJSONCommands.end();
+    {
+        boost::shared_lock< boost::shared_mutex > lock(_mutexInterface);
+        if( __mapJSONCommands.find(cmd) != __mapJSONCommands.end() ) {
+            return true;
+        }
+    }
+    return _GetGlobalJSONCommands().find(cmd) != _GetGlobalJSONCommands().end();
 }
 
 void InterfaceBase::RegisterJSONCommand(const std::string& cmdname, InterfaceBase::InterfaceJSONCommandFn fncmd, const std::string& strhelp)
@@ -242,10 +299,17 @@ void InterfaceBase::SendJSONCommand(const std::string& cmdname, const rapidjson:
     {
         boost::shared_lock< boost::shared_mutex > lock(_mutexInterface);
         JSONCMDMAP::iterator it = __mapJSONCommands.find(cmdname);
-        if( it == __mapJSONCommands.end() ) {
+        if( it != __mapJSONCommands.end() ) {
+            interfacecmd = it->second;
+        }
+    }
+    if( !interfacecmd ) {
+        GLOBALJSONCMDMAP::const_iterator itglobal = _GetGlobalJSONCommands().find(cmdname);
+        if( itglobal == _GetGlobalJSONCommands().end() ) {
             throw openrave_exception(str(boost::format(_("failed to find JSON command '%s' in interface %s\n"))%cmdname.c_str()%GetXMLId()),ORE_CommandNotSupported);
         }
-        interfacecmd = it->second;
+        itglobal->second.first(input, output, allocator);
+        return;
     }
     interfacecmd->fn(input, output, allocator);
 }
@@ -256,6 +320,11 @@ void InterfaceBase::_GetJSONCommandHelp(const rapidjson::Value& input, rapidjson
     for(JSONCMDMAP::const_iterator it = __mapJSONCommands.begin(); it != __mapJSONCommands.end(); ++it) {
         output.AddMember(rapidjson::Value().SetString(it->first.c_str(), allocator), rapidjson::Value().SetString(it->second->help.c_str(), allocator), allocator);
     }
+    FOREACHC(itglobal, _GetGlobalJSONCommands()) {
+        if( __mapJSONCommands.find(itglobal->first) == __mapJSONCommands.end() ) {
+            output.AddMember(rapidjson::Value().SetString(itglobal->first.c_str(), allocator), rapidjson::Value().SetString(itglobal->second.second.c_str(), allocator), allocator);
+        }
+    }
 }
 
 ReadablePtr InterfaceBase::GetReadableInterface(const std::string& id) const
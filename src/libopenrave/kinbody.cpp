@@ -335,6 +335,7 @@ KinBody::KinBody(InterfaceType type, EnvironmentBasePtr penv) : InterfaceBase(ty
     _environmentid = 0;
     _nNonAdjacentLinkCache = 0x80000000;
     _nUpdateStampId = 0;
+    _nInfoUpdateStampId = 0;
     _bAreAllJoints1DOFAndNonCircular = false;
 }
 
@@ -5110,11 +5111,15 @@ void KinBody::Clone(InterfaceBaseConstPtr preference, int cloningoptions)
     }
 
     _nUpdateStampId++; // update the stamp instead of copying
+    _nInfoUpdateStampId++;
 }
 
 void KinBody::_PostprocessChangedParameters(uint32_t parameters)
 {
     _nUpdateStampId++;
+    if( parameters & ~Prop_LinkTransforms ) {
+        _nInfoUpdateStampId++;
+    }
     if( _nHierarchyComputed == 1 ) {
         _nParametersChanged |= parameters;
         return;
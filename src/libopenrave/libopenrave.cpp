@@ -19,6 +19,8 @@
 #include <boost/scoped_ptr.hpp>
 #include <boost/utility.hpp>
 #include <boost/thread/once.hpp>
+#include <boost/thread/condition.hpp>
+#include <exception>
 
 #include <streambuf>
 
@@ -344,6 +346,136 @@ dReal RaveCeil(dReal f) {
 static std::set<std::string> _gettextDomainsInitialized;
 static boost::once_flag _onceRaveInitialize = BOOST_ONCE_INIT;
 
+/// \brief worker threads shared by all the callers of RaveRunParallelJobs
+///
+/// Every call queues a batch until all its jobs are taken. Workers take jobs from the oldest queued batch, while the
+/// calling thread only takes jobs of its own batch, so nested and concurrent calls always make progress.
+class ParallelJobPool : private boost::noncopyable
+{
+    struct Batch
+    {
+        const ParallelJobFn* pfn;
+        int numjobs;
+        int nextjob; ///< next job to be taken
+        int numfinished; ///< number of jobs that finished
+        int numworkers; ///< number of workers currently taking jobs of the batch, the calling thread is not counted
+        int maxworkers; ///< maximum for numworkers
+        std::exception_ptr exception; ///< first exception thrown by a job
+    };
+
+public:
+    ParallelJobPool(int nworkers) : _bShutdown(false)
+    {
+        for(int ithread = 0; ithread < nworkers; ++ithread) {
+            _vthreads.push_back(boost::make_shared<boost::thread>(boost::bind(&ParallelJobPool::_WorkerThread, this, ithread+1)));
+        }
+    }
+
+    virtual ~ParallelJobPool()
+    {
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+            _bShutdown = true;
+            _condWork.notify_all();
+        }
+        FOREACH(itthread, _vthreads) {
+            (*itthread)->join();
+        }
+        _vthreads.clear();
+    }
+
+    inline int GetNumThreads() const {
+        return (int)_vthreads.size()+1;
+    }
+
+    void Run(const ParallelJobFn& fn, int numjobs, int maxthreads)
+    {
+        Batch batch;
+        batch.pfn = &fn;
+        batch.numjobs = numjobs;
+        batch.nextjob = 0;
+        batch.numfinished = 0;
+        batch.numworkers = 0;
+        batch.maxworkers = maxthreads > 0 ? min(maxthreads-1, (int)_vthreads.size()) : (int)_vthreads.size();
+
+        boost::mutex::scoped_lock lock(_mutex);
+        if( batch.maxworkers > 0 && numjobs > 1 ) {
+            _listbatches.push_back(&batch);
+            _condWork.notify_all();
+        }
+        _ProcessJobs(batch, s_nThreadIndex, lock);
+        while( batch.numfinished < batch.numjobs || batch.numworkers > 0 ) {
+            _condDone.wait(lock);
+        }
+        if( !!batch.exception ) {
+            std::rethrow_exception(batch.exception);
+        }
+    }
+
+private:
+    void _WorkerThread(int threadindex)
+    {
+        s_nThreadIndex = threadindex;
+        boost::mutex::scoped_lock lock(_mutex);
+        while( !_bShutdown ) {
+            Batch* pbatch = NULL;
+            FOREACH(itbatch, _listbatches) {
+                if( (*itbatch)->numworkers < (*itbatch)->maxworkers ) {
+                    pbatch = *itbatch;
+                    break;
+                }
+            }
+            if( !pbatch ) {
+                _condWork.wait(lock);
+                continue;
+            }
+            ++pbatch->numworkers;
+            _ProcessJobs(*pbatch, threadindex, lock);
+            --pbatch->numworkers;
+            if( pbatch->numfinished >= pbatch->numjobs && pbatch->numworkers == 0 ) {
+                _condDone.notify_all();
+            }
+        }
+    }
+
+    /// \brief takes jobs of the batch until all are taken. _mutex has to be locked by lock, it is released while the jobs run.
+    void _ProcessJobs(Batch& batch, int threadindex, boost::mutex::scoped_lock& lock)
+    {
+        while( batch.nextjob < batch.numjobs ) {
+            int jobindex = batch.nextjob++;
+            if( batch.nextjob >= batch.numjobs ) {
+                _listbatches.remove(&batch);
+            }
+            lock.unlock();
+            std::exception_ptr exception;
+            try {
+                (*batch.pfn)(jobindex, threadindex);
+            }
+            catch(...) {
+                exception = std::current_exception();
+            }
+            lock.lock();
+            if( !!exception && !batch.exception ) {
+                batch.exception = exception;
+            }
+            ++batch.numfinished;
+        }
+    }
+
+    std::vector<boost::shared_ptr<boost::thread> > _vthreads;
+    boost::mutex _mutex; ///< protects all the state below and the batches
+    boost::condition _condWork; ///< notified when a batch is queued or on shutdown
+    boost::condition _condDone; ///< notified when a worker leaves a finished batch
+    std::list<Batch*> _listbatches; ///< batches that still have jobs to be taken, owned by the callers of Run
+    bool _bShutdown;
+
+    static thread_local int s_nThreadIndex; ///< index of the worker running on this thread, 0 for other threads
+};
+
+thread_local int ParallelJobPool::s_nThreadIndex = 0;
+
+typedef boost::shared_ptr<ParallelJobPool> ParallelJobPoolPtr;
+
 /// there is only once global openrave state. It is created when openrave
 /// is first used, and destroyed when the program quits or RaveDestroy is called.
 class RaveGlobal : private boost::noncopyable, public boost::enable_shared_from_this<RaveGlobal>, public UserData
@@ -438,11 +570,6 @@ public:
             RAVELOG_WARN("failed to set to C locale: %s\n",e.what());
         }
 
-        _pdatabase.reset(new RaveDatabase());
-        if( !_pdatabase->Init(bLoadAllPlugins) ) {
-            RAVELOG_FATAL("failed to create the openrave plugin database\n");
-        }
-
         char* phomedir = getenv("OPENRAVE_HOME"); // getenv not thread-safe?
         if( phomedir == NULL ) {
 #ifndef _WIN32
@@ -460,6 +587,13 @@ public:
         CreateDirectory(_homedirectory.c_str(),NULL);
 #endif
 
+        // the home directory holds the plugin manifest, so has to be known before loading the plugins
+        _pdatabase.reset(new RaveDatabase());
+        std::string manifestfilename = str(boost::format("%s%cpluginmanifest.%s.%s.txt")%_homedirectory%s_filesep%OPENRAVE_VERSION_STRING%OPENRAVE_PLUGININFO_HASH);
+        if( !_pdatabase->Init(bLoadAllPlugins, manifestfilename) ) {
+            RAVELOG_FATAL("failed to create the openrave plugin database\n");
+        }
+
 #ifdef _WIN32
         const char* delim = ";";
 #else
@@ -504,6 +638,15 @@ public:
         mapenvironments.clear();
         _mapenvironments.clear();
         _pdefaultsampler.reset();
+        {
+            // jobs can be plugin code, so stop the workers before the plugins are unloaded
+            ParallelJobPoolPtr pParallelJobPool;
+            {
+                boost::mutex::scoped_lock lock(_mutexinternal);
+                pParallelJobPool.swap(_pParallelJobPool);
+            }
+            pParallelJobPool.reset();
+        }
         _mapxmlreaders.clear();
         _mapjsonreaders.clear();
 
@@ -534,6 +677,8 @@ public:
         }
 #endif
 
+        // write out all queued messages before the logger goes away
+        RaveSetLoggingMode(LM_Synchronous);
 #if OPENRAVE_LOG4CXX
         _logger = 0;
 #endif
@@ -659,6 +804,9 @@ protected:
 
     UserDataPtr RegisterXMLReader(InterfaceType type, const std::string& xmltag, const CreateXMLReaderFn& fn)
     {
+        if( !!_pdatabase ) {
+            _pdatabase->NotifyRegistration();
+        }
         return UserDataPtr(new XMLReaderFunctionData(type,xmltag,fn,shared_from_this()));
     }
 
@@ -698,6 +846,9 @@ protected:
 
     UserDataPtr RegisterJSONReader(InterfaceType type, const std::string& id, const CreateJSONReaderFn& fn)
     {
+        if( !!_pdatabase ) {
+            _pdatabase->NotifyRegistration();
+        }
         return UserDataPtr(new JSONReaderFunctionData(type,id,fn,shared_from_this()));
     }
 
@@ -787,6 +938,16 @@ protected:
         }
     }
 
+    ParallelJobPoolPtr GetParallelJobPool()
+    {
+        boost::mutex::scoped_lock lock(_mutexinternal);
+        if( !_pParallelJobPool ) {
+            int nthreads = (int)boost::thread::hardware_concurrency();
+            _pParallelJobPool.reset(new ParallelJobPool(max(0, nthreads-1))); // the calling thread runs jobs too
+        }
+        return _pParallelJobPool;
+    }
+
     SpaceSamplerBasePtr GetDefaultSampler()
     {
         if( !_pdefaultsampler ) {
@@ -1077,6 +1238,26 @@ protected:
         }
 #endif
         SetDebugLevel(level);
+
+        // OPENRAVE_LOGGING_MODE=async or binary:filename
+        const char* pOPENRAVE_LOGGING_MODE = std::getenv("OPENRAVE_LOGGING_MODE");
+        if( !!pOPENRAVE_LOGGING_MODE && strlen(pOPENRAVE_LOGGING_MODE) > 0 ) {
+            std::string mode(pOPENRAVE_LOGGING_MODE);
+            try {
+                if( mode == "async" ) {
+                    RaveSetLoggingMode(LM_AsyncText);
+                }
+                else if( mode.size() > 7 && mode.substr(0,7) == "binary:" ) {
+                    RaveSetLoggingMode(LM_AsyncBinary, mode.substr(7));
+                }
+                else if( mode != "sync" ) {
+                    RAVELOG_WARN_FORMAT("unknown OPENRAVE_LOGGING_MODE '%s', logging synchronously", mode);
+                }
+            }
+            catch(const openrave_exception& ex) {
+                RAVELOG_WARN_FORMAT("failed to set logging mode '%s': %s", mode%ex.what());
+            }
+        }
     }
 
 private:
@@ -1098,6 +1279,7 @@ private:
     std::vector<std::string> _vdbdirectories;
     int _nGlobalEnvironmentId;
     SpaceSamplerBasePtr _pdefaultsampler;
+    ParallelJobPoolPtr _pParallelJobPool; ///< created by the first RaveRunParallelJobs call
 #ifdef USE_CRLIBM
     long long _crlibm_fpu_state;
     bool _bcrlibmInit; ///< true if crlibm is initialized
@@ -1396,6 +1578,37 @@ std::string RaveGetDefaultViewerType()
     return RaveGlobal::instance()->GetDefaultViewerType();
 }
 
+int RaveGetNumParallelJobThreads()
+{
+    return RaveGlobal::instance()->GetParallelJobPool()->GetNumThreads();
+}
+
+void RaveRunParallelJobs(const ParallelJobFn& fn, int numjobs, int maxthreads)
+{
+    if( numjobs <= 0 ) {
+        return;
+    }
+    if( numjobs == 1 || maxthreads == 1 ) {
+        // same semantics as the pool, the remaining jobs still run and the first exception is rethrown
+        std::exception_ptr exception;
+        for(int ijob = 0; ijob < numjobs; ++ijob) {
+            try {
+                fn(ijob, 0);
+            }
+            catch(...) {
+                if( !exception ) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+        if( !!exception ) {
+            std::rethrow_exception(exception);
+        }
+        return;
+    }
+    RaveGlobal::instance()->GetParallelJobPool()->Run(fn, numjobs, maxthreads);
+}
+
 const char *RaveGetLocalizedTextForDomain(const std::string& domainname, const char *msgid)
 {
 #ifndef _WIN32
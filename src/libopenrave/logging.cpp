@@ -0,0 +1,480 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2006-2016 Rosen Diankov <rosen.diankov@gmail.com>
+//
+// This file is part of OpenRAVE.
+// OpenRAVE is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include "libopenrave.h"
+
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <boost/thread/condition.hpp>
+
+namespace OpenRAVE {
+
+namespace {
+
+static const size_t s_nLogRingSize = 1024; ///< number of messages each thread can queue, messages logged while the ring is full are dropped
+static const uint32_t s_nLoggerThreadIndex = 0xffffffff; ///< thread index of the messages written by the logger itself
+
+#if OPENRAVE_LOG4CXX
+/// \brief the logger and location given to the log4cxx RAVELOG macros
+struct LogSource
+{
+    LogSource(const log4cxx::LoggerPtr& logger, const log4cxx::spi::LocationInfo& location) : logger(logger), location(location) {
+    }
+    const log4cxx::LoggerPtr& logger;
+    const log4cxx::spi::LocationInfo& location;
+};
+#else
+struct LogSource;
+#endif
+
+struct LogRecord
+{
+    uint64_t timestamp; ///< wall time in nanoseconds since epoch
+    int level;
+    bool bRaw; ///< if true, written as is, otherwise a new line is added if missing
+    std::string message; ///< keeps its capacity when the slot is reused
+#if OPENRAVE_LOG4CXX
+    log4cxx::LoggerPtr logger; ///< if set, the record is appended to it with the location below. Reset once written.
+    std::string filename, methodname; ///< copied since the location only points to them
+    int linenumber;
+#endif
+};
+
+/// \brief single producer single consumer ring of one thread. The owning thread only writes _head, the writer thread only writes _tail.
+class LogRing
+{
+public:
+    LogRing(uint32_t threadindex) : threadindex(threadindex), _head(0), _tail(0), _vrecords(s_nLogRingSize) {
+    }
+
+    /// \brief called by the owning thread, returns false if the ring is full
+    bool TryPush(int level, bool bRaw, const char* s, size_t len, uint64_t timestamp, const LogSource* psource)
+    {
+        uint64_t head = _head.load(std::memory_order_relaxed);
+        if( head - _tail.load(std::memory_order_acquire) >= s_nLogRingSize ) {
+            return false;
+        }
+        LogRecord& record = _vrecords[head % s_nLogRingSize];
+        record.timestamp = timestamp;
+        record.level = level;
+        record.bRaw = bRaw;
+        record.message.assign(s, len);
+#if OPENRAVE_LOG4CXX
+        if( !!psource ) {
+            record.logger = psource->logger;
+            record.filename.assign(psource->location.getFileName());
+            record.methodname.assign(psource->location.getMethodName());
+            record.linenumber = psource->location.getLineNumber();
+        }
+#endif
+        _head.store(head+1, std::memory_order_release);
+        return true;
+    }
+
+    /// \brief called by the writer thread, calls fn on all the queued records in order. fn can release the resources of the record.
+    template <typename F>
+    size_t Drain(F& fn)
+    {
+        uint64_t tail = _tail.load(std::memory_order_relaxed);
+        uint64_t head = _head.load(std::memory_order_acquire);
+        for(uint64_t index = tail; index < head; ++index) {
+            fn(threadindex, _vrecords[index % s_nLogRingSize]);
+        }
+        _tail.store(head, std::memory_order_release);
+        return head - tail;
+    }
+
+    inline size_t GetNumQueued() const {
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+
+    const uint32_t threadindex;
+
+private:
+    std::atomic<uint64_t> _head; ///< index of the next record to write
+    std::atomic<uint64_t> _tail; ///< index of the next record to read
+    std::vector<LogRecord> _vrecords;
+};
+
+typedef boost::shared_ptr<LogRing> LogRingPtr;
+
+/// \brief owns the rings of all threads and the thread writing them
+class AsyncLogger
+{
+public:
+    AsyncLogger() : _mode(LM_Synchronous), _nDropped(0), _nNextThreadIndex(0), _bShutdown(false), _pbinaryfile(NULL), _nFlushRequests(0), _nFlushesDone(0) {
+    }
+
+    ~AsyncLogger() {
+        // global logging state might already be destroyed, so write everything to stdout
+        _StopWriter();
+        _bStaticDestruction = true;
+        _DrainAll();
+        _CloseBinaryFile();
+    }
+
+    inline int GetMode() const {
+        return _mode.load(std::memory_order_relaxed);
+    }
+
+    void SetMode(int mode, const std::string& filename)
+    {
+        boost::mutex::scoped_lock lockmode(_mutexMode);
+        // new messages are logged synchronously while the queued ones are written
+        _mode.store(LM_Synchronous);
+        _StopWriter();
+        _DrainAll();
+        _CloseBinaryFile();
+        if( mode == LM_AsyncBinary ) {
+            _pbinaryfile = fopen(filename.c_str(), "wb");
+            if( !_pbinaryfile ) {
+                throw OPENRAVE_EXCEPTION_FORMAT("failed to open binary log file '%s'", filename, ORE_InvalidArguments);
+            }
+            const char header[] = "OPENRAVELOG1\n";
+            fwrite(header, 1, sizeof(header)-1, _pbinaryfile);
+        }
+        if( mode != LM_Synchronous ) {
+            _bShutdown = false;
+            _writerthread.reset(new boost::thread(boost::bind(&AsyncLogger::_WriterThread, this)));
+        }
+        _mode.store(mode);
+    }
+
+    int Push(int level, bool bRaw, const char* s, size_t len, const LogSource* psource=NULL)
+    {
+        // the writer thread logs synchronously, otherwise it would wait on itself
+        if( s_bWriterThread ) {
+            return -1;
+        }
+        uint64_t timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        LogRing& ring = _GetThreadRing();
+        if( !ring.TryPush(level, bRaw, s, len, timestamp, psource) ) {
+            // writer is behind, drop the message instead of blocking the caller. The writer reports how many were dropped.
+            _nDropped.fetch_add(1, std::memory_order_relaxed);
+            _condWork.notify_one();
+            return 0;
+        }
+        if( ring.GetNumQueued() >= s_nLogRingSize/2 ) {
+            _condWork.notify_one();
+        }
+        return (int)len;
+    }
+
+    void Flush()
+    {
+        if( GetMode() == LM_Synchronous || s_bWriterThread ) {
+            return;
+        }
+        boost::mutex::scoped_lock lock(_mutexWriter);
+        uint64_t request = ++_nFlushRequests;
+        _condWork.notify_one();
+        while( _nFlushesDone < request && !_bShutdown ) {
+            _condFlushed.wait(lock);
+        }
+    }
+
+private:
+    LogRing& _GetThreadRing()
+    {
+        static thread_local LogRingPtr s_pRing;
+        if( !s_pRing ) {
+            boost::mutex::scoped_lock lock(_mutexRings);
+            s_pRing.reset(new LogRing(_nNextThreadIndex++));
+            _vRings.push_back(s_pRing);
+        }
+        return *s_pRing;
+    }
+
+    void _WriterThread()
+    {
+        s_bWriterThread = true;
+        while(1) {
+            uint64_t nFlushRequests;
+            {
+                boost::mutex::scoped_lock lock(_mutexWriter);
+                if( _bShutdown ) {
+                    break;
+                }
+                if( _nFlushesDone >= _nFlushRequests ) {
+                    _condWork.timed_wait(lock, boost::posix_time::milliseconds(10));
+                }
+                nFlushRequests = _nFlushRequests;
+            }
+            _DrainAll();
+            {
+                boost::mutex::scoped_lock lock(_mutexWriter);
+                _nFlushesDone = nFlushRequests;
+                _condFlushed.notify_all();
+            }
+        }
+    }
+
+    void _StopWriter()
+    {
+        if( !!_writerthread ) {
+            {
+                boost::mutex::scoped_lock lock(_mutexWriter);
+                _bShutdown = true;
+                _condWork.notify_all();
+                _condFlushed.notify_all();
+            }
+            _writerthread->join();
+            _writerthread.reset();
+        }
+    }
+
+    /// \brief writes all queued records, forgets the rings of threads that exited
+    void _DrainAll()
+    {
+        std::vector<LogRingPtr> vRings;
+        {
+            boost::mutex::scoped_lock lock(_mutexRings);
+            vRings = _vRings;
+        }
+        size_t numwritten = 0;
+        FOREACH(itring, vRings) {
+            numwritten += (*itring)->Drain(*this);
+        }
+        uint64_t numdropped = _nDropped.exchange(0, std::memory_order_relaxed);
+        if( numdropped > 0 ) {
+            LogRecord record;
+            record.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+            record.level = Level_Warn;
+            record.bRaw = false;
+            record.message = str(boost::format("dropped %d log messages because the writer fell behind")%numdropped);
+            (*this)(s_nLoggerThreadIndex, record);
+            ++numwritten;
+        }
+        if( numwritten > 0 ) {
+            fflush(!!_pbinaryfile ? _pbinaryfile : stdout);
+        }
+
+        // release the snapshot first, so a ring registered after it was taken still counts its owning thread and is not mistaken for an exited one
+        vRings.clear();
+        boost::mutex::scoped_lock lock(_mutexRings);
+        std::vector<LogRingPtr>::iterator itwrite = _vRings.begin();
+        FOREACH(itring, _vRings) {
+            if( itring->use_count() > 1 || (*itring)->GetNumQueued() > 0 ) { // referenced by _vRings and the owning thread
+                *itwrite++ = *itring;
+            }
+        }
+        _vRings.erase(itwrite, _vRings.end());
+    }
+
+    void _CloseBinaryFile()
+    {
+        if( !!_pbinaryfile ) {
+            fclose(_pbinaryfile);
+            _pbinaryfile = NULL;
+        }
+    }
+
+    /// \brief returns a pointer to a copy of s that stays valid for the lifetime of the logger, since log4cxx keeps the location pointers in its events
+    const char* _GetPersistentString(const std::string& s)
+    {
+        return _setPersistentStrings.insert(s).first->c_str();
+    }
+
+    /// \brief appends value to vbuffer as numbytes little-endian bytes
+    static void _AppendLittleEndian(std::vector<uint8_t>& vbuffer, uint64_t value, int numbytes)
+    {
+        for(int ibyte = 0; ibyte < numbytes; ++ibyte) {
+            vbuffer.push_back((uint8_t)(value >> (8*ibyte)));
+        }
+    }
+
+#if OPENRAVE_LOG4CXX
+    static log4cxx::LevelPtr _GetLog4cxxLevel(int level)
+    {
+        switch(level&Level_OutputMask) {
+        case Level_Fatal: return log4cxx::Level::getFatal();
+        case Level_Error: return log4cxx::Level::getError();
+        case Level_Warn: return log4cxx::Level::getWarn();
+        case Level_Debug: return log4cxx::Level::getDebug();
+        case Level_Verbose: return RaveGetVerboseLogLevel();
+        default: return log4cxx::Level::getInfo();
+        }
+    }
+#endif
+
+public:
+    /// \brief writes one record, called by Drain
+    void operator()(uint32_t threadindex, LogRecord& record)
+    {
+#if OPENRAVE_LOG4CXX
+        log4cxx::LoggerPtr logger;
+        std::swap(logger, record.logger);
+#endif
+        if( !!_pbinaryfile ) {
+            std::string slocation;
+#if OPENRAVE_LOG4CXX
+            if( !!logger ) {
+                slocation = str(boost::format("[%s:%d %s] ")%record.filename%record.linenumber%record.methodname);
+            }
+#endif
+            uint32_t size = slocation.size() + record.message.size();
+            _vbinarybuffer.resize(0);
+            _AppendLittleEndian(_vbinarybuffer, record.timestamp, 8);
+            _AppendLittleEndian(_vbinarybuffer, threadindex, 4);
+            _AppendLittleEndian(_vbinarybuffer, (uint8_t)record.level, 1);
+            _AppendLittleEndian(_vbinarybuffer, size, 4);
+            fwrite(&_vbinarybuffer[0], 1, _vbinarybuffer.size(), _pbinaryfile);
+            fwrite(slocation.c_str(), 1, slocation.size(), _pbinaryfile);
+            fwrite(record.message.c_str(), 1, record.message.size(), _pbinaryfile);
+            return;
+        }
+#if OPENRAVE_LOG4CXX
+        if( !_bStaticDestruction && !!logger ) {
+            // same output as the synchronous path of the RAVELOG macros, with the location of the caller
+            log4cxx::LevelPtr levelptr = _GetLog4cxxLevel(record.level);
+            if( logger->isEnabledFor(levelptr) ) {
+                size_t len = record.message.size();
+                if( len > 0 && record.message[len-1] == '\n' ) {
+                    record.message.resize(len-1);
+                }
+                log4cxx::spi::LocationInfo location(_GetPersistentString(record.filename), _GetPersistentString(record.methodname), record.linenumber);
+                logger->forcedLog(levelptr, record.message, location);
+            }
+            return;
+        }
+#endif
+        if( !_bStaticDestruction && !record.bRaw ) {
+            // same output as the synchronous path, s_bWriterThread makes sure it is not queued again
+            RavePrintfA(record.message, record.level);
+            return;
+        }
+        fputs(record.message.c_str(), stdout);
+        if( !record.bRaw && (record.message.size() == 0 || record.message[record.message.size()-1] != '\n') ) {
+            fputc('\n', stdout);
+        }
+    }
+
+private:
+    std::atomic<int> _mode;
+    boost::mutex _mutexMode; ///< serializes SetMode
+    std::atomic<uint64_t> _nDropped; ///< number of messages dropped since the last drain
+
+    boost::mutex _mutexRings; ///< protects _vRings and _nNextThreadIndex
+    std::vector<LogRingPtr> _vRings;
+    uint32_t _nNextThreadIndex;
+
+    boost::mutex _mutexWriter; ///< protects the state below
+    boost::condition _condWork, _condFlushed;
+    bool _bShutdown;
+    boost::shared_ptr<boost::thread> _writerthread;
+    FILE* _pbinaryfile; ///< only written by the writer thread while it runs
+
+    // only used by the thread draining the rings
+    std::vector<uint8_t> _vbinarybuffer;
+    std::set<std::string> _setPersistentStrings;
+    uint64_t _nFlushRequests, _nFlushesDone;
+
+    static thread_local bool s_bWriterThread;
+    static bool _bStaticDestruction;
+};
+
+thread_local bool AsyncLogger::s_bWriterThread = false;
+bool AsyncLogger::_bStaticDestruction = false;
+
+static AsyncLogger& GetAsyncLogger()
+{
+    static AsyncLogger s_logger;
+    return s_logger;
+}
+
+} // end namespace
+
+void RaveSetLoggingMode(int mode, const std::string& filename)
+{
+    GetAsyncLogger().SetMode(mode, filename);
+}
+
+int RaveGetLoggingMode()
+{
+    return GetAsyncLogger().GetMode();
+}
+
+void RaveFlushLogging()
+{
+    GetAsyncLogger().Flush();
+}
+
+/// \brief formats fmt and queues it
+static int _RaveLogAsyncV(AsyncLogger& logger, int level, bool bRaw, const LogSource* psource, const char* fmt, va_list list)
+{
+    char buf[512];
+    va_list listcopy;
+    va_copy(listcopy, list);
+    int r = vsnprintf(buf, sizeof(buf), fmt, listcopy);
+    va_end(listcopy);
+    if( r < 0 ) {
+        return -1;
+    }
+    if( r < (int)sizeof(buf) ) {
+        return logger.Push(level, bRaw, buf, r, psource);
+    }
+    std::vector<char> vbuf(r+1);
+    va_copy(listcopy, list);
+    r = vsnprintf(&vbuf[0], vbuf.size(), fmt, listcopy);
+    va_end(listcopy);
+    if( r < 0 ) {
+        return -1;
+    }
+    return logger.Push(level, bRaw, &vbuf[0], r, psource);
+}
+
+int RaveLogAsync(int level, const char* s, size_t len)
+{
+    AsyncLogger& logger = GetAsyncLogger();
+    if( logger.GetMode() == LM_Synchronous ) {
+        return -1;
+    }
+    return logger.Push(level, false, s, len);
+}
+
+int RaveLogAsyncV(int level, const char* fmt, va_list list)
+{
+    AsyncLogger& logger = GetAsyncLogger();
+    if( logger.GetMode() == LM_Synchronous ) {
+        return -1;
+    }
+    return _RaveLogAsyncV(logger, level, true, NULL, fmt, list);
+}
+
+#if OPENRAVE_LOG4CXX
+int RaveLogAsync(const log4cxx::LoggerPtr& logger, const log4cxx::spi::LocationInfo& location, int level, const char* s, size_t len)
+{
+    AsyncLogger& asynclogger = GetAsyncLogger();
+    if( asynclogger.GetMode() == LM_Synchronous || !logger ) {
+        return -1;
+    }
+    LogSource source(logger, location);
+    return asynclogger.Push(level, false, s, len, &source);
+}
+
+int RaveLogAsyncV(const log4cxx::LoggerPtr& logger, const log4cxx::spi::LocationInfo& location, int level, const char* fmt, va_list list)
+{
+    AsyncLogger& asynclogger = GetAsyncLogger();
+    if( asynclogger.GetMode() == LM_Synchronous || !logger ) {
+        return -1;
+    }
+    LogSource source(logger, location);
+    return _RaveLogAsyncV(asynclogger, level, false, &source, fmt, list);
+}
+#endif
+
+} // end namespace OpenRAVE
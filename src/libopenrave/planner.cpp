@@ -1081,6 +1081,7 @@ PlannerStatus PlannerBase::_ProcessPostPlanners(RobotBasePtr probot, TrajectoryB
         __cachePostProcessPlanner.reset();
         return PlannerStatus(PS_HasSolution);
     }
+    ProfilingScope profilingscope(PC_PlannerPostProcess);
     if( !__cachePostProcessPlanner || __cachePostProcessPlanner->GetXMLId() != GetParameters()->_sPostProcessingPlanner ) {
         __cachePostProcessPlanner = RaveCreatePlanner(GetEnv(), GetParameters()->_sPostProcessingPlanner);
         if( !__cachePostProcessPlanner ) {
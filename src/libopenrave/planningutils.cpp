@@ -28,6 +28,20 @@ namespace planningutils {
 
 static const dReal g_fEpsilonQuadratic = RavePow(g_fEpsilon,0.55); // should be 0.6...perhaps this is related to parabolic smoother epsilons?
 
+/// \brief calls PlannerBase::InitPlan and records it under PC_PlannerInit
+static inline bool _ProfiledInitPlan(PlannerBasePtr planner, RobotBasePtr probot, PlannerBase::PlannerParametersConstPtr params)
+{
+    ProfilingScope profilingscope(PC_PlannerInit);
+    return planner->InitPlan(probot, params);
+}
+
+/// \brief calls PlannerBase::PlanPath and records it under PC_PlannerPlan
+static inline PlannerStatus _ProfiledPlanPath(PlannerBasePtr planner, TrajectoryBasePtr traj, int planningoptions=0)
+{
+    ProfilingScope profilingscope(PC_PlannerPlan);
+    return planner->PlanPath(traj, planningoptions);
+}
+
 int JitterActiveDOF(RobotBasePtr robot,int nMaxIterations,dReal fRand,const PlannerBase::PlannerParameters::NeighStateFn& neighstatefn)
 {
     RAVELOG_VERBOSE("starting jitter active dof...\n");
@@ -491,16 +505,26 @@ public:
                 }
                 IntervalType interval = bHasAllLinearInterpolation ? (IntervalType)(IT_Closed | IT_AllLinear) : IT_Closed;
 
+                // remove the sample times that are too close to each other, each consecutive pair of the remaining times is a segment to check
+                std::vector<dReal> vsegmenttimes;
+                vsegmenttimes.reserve(vsampletimes.size());
+                FOREACHC(itsampletime, vsampletimes) {
+                    if( vsegmenttimes.size() == 0 || *itsampletime >= vsegmenttimes.back() + 1e-5 ) {
+                        vsegmenttimes.push_back(*itsampletime);
+                    }
+                }
+
+                // check the segments in bisection order so that an invalid trajectory is rejected as early as possible
+                std::vector<size_t> vsegmentorder;
+                ComputeBisectionOrder(vsegmenttimes.size() > 0 ? vsegmenttimes.size()-1 : 0, vsegmentorder);
                 std::vector<dReal> vprevdata, vprevdatavel;
                 ConstraintFilterReturnPtr filterreturn(new ConstraintFilterReturn());
-                trajectory->Sample(vprevdata,0,_parameters->_configurationspecification);
-                trajectory->Sample(vprevdatavel,0,velspec);
-                std::vector<dReal>::iterator itprevtime = vsampletimes.begin();
-                for(std::vector<dReal>::iterator itsampletime = vsampletimes.begin()+1; itsampletime != vsampletimes.end(); ++itsampletime) {
-                    if (*itsampletime < *itprevtime + 1e-5 ) {
-                        continue;
-                    }
+                FOREACHC(itsegment, vsegmentorder) {
+                    std::vector<dReal>::const_iterator itprevtime = vsegmenttimes.begin() + *itsegment;
+                    std::vector<dReal>::const_iterator itsampletime = itprevtime + 1;
                     filterreturn->Clear();
+                    trajectory->Sample(vprevdata,*itprevtime,_parameters->_configurationspecification);
+                    trajectory->Sample(vprevdatavel,*itprevtime,velspec);
                     trajectory->Sample(vdata,*itsampletime,_parameters->_configurationspecification);
                     trajectory->Sample(vdatavel,*itsampletime,velspec);
                     dReal deltatime = *itsampletime - *itprevtime;
@@ -541,13 +565,13 @@ public:
                         }
                         itprevconfig=itcurconfig;
                     }
-                    vprevdata.swap(vdata);
-                    vprevdatavel.swap(vdatavel);
-                    itprevtime = itsampletime;
                 }
             }
             else {
-                for(size_t i = 0; i < trajectory->GetNumWaypoints(); ++i) {
+                std::vector<size_t> vwaypointorder;
+                ComputeBisectionOrder(trajectory->GetNumWaypoints(), vwaypointorder);
+                FOREACHC(itwaypoint, vwaypointorder) {
+                    size_t i = *itwaypoint;
                     trajectory->GetWaypoint(i,vdata,_parameters->_configurationspecification);
                     if( _parameters->CheckPathAllConstraints(vdata,vdata,std::vector<dReal>(), std::vector<dReal>(), 0, IT_OpenStart) != 0 ) {
                         throw OPENRAVE_EXCEPTION_FORMAT(_("CheckPathAllConstraints, failed at %d, wrote trajectory to %s"),i%DumpTrajectory(trajectory),ORE_InconsistentConstraints);
@@ -570,6 +594,29 @@ protected:
     PlannerBase::PlannerParametersConstPtr _parameters;
 };
 
+void ComputeBisectionOrder(size_t numitems, std::vector<size_t>& vorder)
+{
+    vorder.resize(0);
+    vorder.reserve(numitems);
+    // breadth-first traversal of the [lo,hi) ranges so that each level of the bisection is output before the next one
+    std::list< std::pair<size_t, size_t> > listranges;
+    if( numitems > 0 ) {
+        listranges.push_back(std::make_pair(size_t(0), numitems));
+    }
+    while( listranges.size() > 0 ) {
+        size_t lo = listranges.front().first, hi = listranges.front().second;
+        listranges.pop_front();
+        size_t mid = lo + (hi-lo)/2;
+        vorder.push_back(mid);
+        if( lo < mid ) {
+            listranges.push_back(std::make_pair(lo, mid));
+        }
+        if( mid+1 < hi ) {
+            listranges.push_back(std::make_pair(mid+1, hi));
+        }
+    }
+}
+
 void VerifyTrajectory(PlannerBase::PlannerParametersConstPtr parameters, TrajectoryBaseConstPtr trajectory, dReal samplingstep)
 {
     if( !parameters ) {
@@ -614,10 +661,10 @@ PlannerStatus _PlanActiveDOFTrajectory(TrajectoryBasePtr traj, RobotBasePtr prob
     params->_sPostProcessingPlanner = ""; // have to turn off the second post processing stage
     params->_hastimestamps = hastimestamps;
     params->_sExtraParameters += plannerparameters;
-    if( !planner->InitPlan(probot,params) ) {
+    if( !_ProfiledInitPlan(planner, probot,params) ) {
         return PlannerStatus("InitPlan failed", PS_Failed);
     }
-    PlannerStatus plannerStatus = planner->PlanPath(traj);
+    PlannerStatus plannerStatus = _ProfiledPlanPath(planner, traj);
     if( plannerStatus.GetStatusCode() != PS_HasSolution ) {
         return plannerStatus;
     }
@@ -643,7 +690,7 @@ ActiveDOFTrajectorySmoother::ActiveDOFTrajectorySmoother(RobotBasePtr robot, con
     params->_sPostProcessingPlanner = ""; // have to turn off the second post processing stage
     params->_hastimestamps = false;
     params->_sExtraParameters += plannerparameters;
-    if( !_planner->InitPlan(_robot,params) ) {
+    if( !_ProfiledInitPlan(_planner, _robot,params) ) {
         throw OPENRAVE_EXCEPTION_FORMAT(_("failed to init planner %s with robot %s"), plannername%_robot->GetName(), ORE_InvalidArguments);
     }
     _parameters=params; // necessary because SetRobotActiveJoints builds functions that hold weak_ptr to the parameters
@@ -665,7 +712,7 @@ PlannerStatus ActiveDOFTrajectorySmoother::PlanPath(TrajectoryBasePtr traj, int
 
     EnvironmentBasePtr env = traj->GetEnv();
     CollisionOptionsStateSaver optionstate(env->GetCollisionChecker(),env->GetCollisionChecker()->GetCollisionOptions()|CO_ActiveDOFs,false);
-    PlannerStatus status = _planner->PlanPath(traj, planningoptions);
+    PlannerStatus status = _ProfiledPlanPath(_planner, traj, planningoptions);
     if( status.GetStatusCode() & PS_HasSolution ) {
         if( RaveGetDebugLevel() & Level_VerifyPlans ) {
             RobotBase::RobotStateSaver saver(_robot);
@@ -684,7 +731,7 @@ void ActiveDOFTrajectorySmoother::_UpdateParameters()
     params->_sPostProcessingPlanner = ""; // have to turn off the second post processing stage
     params->_hastimestamps = false;
     params->_sExtraParameters = _parameters->_sExtraParameters;
-    if( !_planner->InitPlan(_robot,params) ) {
+    if( !_ProfiledInitPlan(_planner, _robot,params) ) {
         throw OPENRAVE_EXCEPTION_FORMAT(_("failed to init planner %s with robot %s"), _planner->GetXMLId()%_robot->GetName(), ORE_InvalidArguments);
     }
     _parameters=params; // necessary because SetRobotActiveJoints builds functions that hold weak_ptr to the parameters
@@ -706,7 +753,7 @@ ActiveDOFTrajectoryRetimer::ActiveDOFTrajectoryRetimer(RobotBasePtr robot, const
     params->_setstatevaluesfn.clear();
     params->_checkpathvelocityconstraintsfn.clear();
     params->_sExtraParameters = plannerparameters;
-    if( !_planner->InitPlan(_robot,params) ) {
+    if( !_ProfiledInitPlan(_planner, _robot,params) ) {
         throw OPENRAVE_EXCEPTION_FORMAT(_("failed to init planner %s with robot %s"), plannername%_robot->GetName(), ORE_InvalidArguments);
     }
     _parameters=params; // necessary because SetRobotActiveJoints builds functions that hold weak_ptr to the parameters
@@ -729,12 +776,12 @@ PlannerStatus ActiveDOFTrajectoryRetimer::PlanPath(TrajectoryBasePtr traj, bool
     TrajectoryTimingParametersPtr parameters = boost::dynamic_pointer_cast<TrajectoryTimingParameters>(_parameters);
     if( parameters->_hastimestamps != hastimestamps ) {
         parameters->_hastimestamps = hastimestamps;
-        if( !_planner->InitPlan(_robot,parameters) ) {
+        if( !_ProfiledInitPlan(_planner, _robot,parameters) ) {
             throw OPENRAVE_EXCEPTION_FORMAT(_("failed to init planner %s with robot %s"), _planner->GetXMLId()%_robot->GetName(), ORE_InvalidArguments);
         }
     }
 
-    return _planner->PlanPath(traj, planningoptions);
+    return _ProfiledPlanPath(_planner, traj, planningoptions);
 }
 
 void ActiveDOFTrajectoryRetimer::_UpdateParameters()
@@ -748,7 +795,7 @@ void ActiveDOFTrajectoryRetimer::_UpdateParameters()
     params->_setstatevaluesfn.clear();
     params->_checkpathvelocityconstraintsfn.clear();
     params->_sExtraParameters = _parameters->_sExtraParameters;
-    if( !_planner->InitPlan(_robot,params) ) {
+    if( !_ProfiledInitPlan(_planner, _robot,params) ) {
         throw OPENRAVE_EXCEPTION_FORMAT(_("failed to init planner %s with robot %s"), _planner->GetXMLId()%_robot->GetName(), ORE_InvalidArguments);
     }
     _parameters=params; // necessary because SetRobotActiveJoints builds functions that hold weak_ptr to the parameters
@@ -785,10 +832,10 @@ PlannerStatus _PlanTrajectory(TrajectoryBasePtr traj, bool hastimestamps, dReal
     params->_sPostProcessingPlanner = ""; // have to turn off the second post processing stage
     params->_hastimestamps = hastimestamps;
     params->_sExtraParameters += plannerparameters;
-    if( !planner->InitPlan(RobotBasePtr(),params) ) {
+    if( !_ProfiledInitPlan(planner, RobotBasePtr(),params) ) {
         return PlannerStatus("InitPlan failed", PS_Failed);
     }
-    PlannerStatus plannerStatus = planner->PlanPath(traj);
+    PlannerStatus plannerStatus = _ProfiledPlanPath(planner, traj);
     if( !(plannerStatus.statusCode & PS_HasSolution) ) {
         return plannerStatus;
     }
@@ -985,10 +1032,10 @@ static PlannerStatus _PlanAffineTrajectory(TrajectoryBasePtr traj, const std::ve
     params->_hastimestamps = hastimestamps;
     params->_sExtraParameters = plannerparameters;
 
-    if( !planner->InitPlan(RobotBasePtr(),params) ) {
+    if( !_ProfiledInitPlan(planner, RobotBasePtr(),params) ) {
         return PlannerStatus("InitPlan failed", PS_Failed);
     }
-    PlannerStatus plannerStatus = planner->PlanPath(traj);
+    PlannerStatus plannerStatus = _ProfiledPlanPath(planner, traj);
     if( plannerStatus.GetStatusCode() != PS_HasSolution ) {
         return plannerStatus;
     }
@@ -1024,7 +1071,7 @@ void AffineTrajectoryRetimer::SetPlanner(const std::string& plannername, const s
         if( !!_parameters ) {
             _parameters->_sExtraParameters = _extraparameters;
             if( !!_planner ) {
-                if( !_planner->InitPlan(RobotBasePtr(), _parameters) ) {
+                if( !_ProfiledInitPlan(_planner, RobotBasePtr(), _parameters) ) {
                     throw OPENRAVE_EXCEPTION_FORMAT(_("failed to init planner %s"), _plannername, ORE_InvalidArguments);
                 }
             }
@@ -1139,13 +1186,13 @@ PlannerStatus AffineTrajectoryRetimer::PlanPath(TrajectoryBasePtr traj, const st
         bInitPlan = true;
     }
     if( bInitPlan ) {
-        if( !_planner->InitPlan(RobotBasePtr(),parameters) ) {
+        if( !_ProfiledInitPlan(_planner, RobotBasePtr(),parameters) ) {
             stringstream ss; ss << trajspec;
             throw OPENRAVE_EXCEPTION_FORMAT(_("failed to init planner %s with affine trajectory spec: %s"), _plannername%ss.str(), ORE_InvalidArguments);
         }
     }
 
-    return _planner->PlanPath(traj, planningoptions);
+    return _ProfiledPlanPath(_planner, traj, planningoptions);
 }
 
 PlannerStatus SmoothActiveDOFTrajectory(TrajectoryBasePtr traj, RobotBasePtr robot, dReal fmaxvelmult, dReal fmaxaccelmult, const std::string& plannername, const std::string& plannerparameters)
@@ -1417,7 +1464,7 @@ size_t InsertWaypointWithRetiming(int waypointindex, const std::vector<dReal>& d
     trajinitial->Init(newspec);
     trajinitial->Insert(0,vwaypointstart);
     trajinitial->Insert(1,vwaypointend);
-    if( !(planner->PlanPath(trajinitial).GetStatusCode() & PS_HasSolution) ) {
+    if( !(_ProfiledPlanPath(planner, trajinitial).GetStatusCode() & PS_HasSolution) ) {
         throw OPENRAVE_EXCEPTION_FORMAT0(_("failed to plan path"), ORE_Assert);
     }
 
@@ -1468,7 +1515,7 @@ size_t InsertWaypointWithSmoothing(int index, const std::vector<dReal>& dofvalue
     params->_hastimestamps = false;
 
     PlannerBasePtr planner = RaveCreatePlanner(traj->GetEnv(),plannername.size() > 0 ? plannername : string("parabolictrajectoryretimer"));
-    if( !planner->InitPlan(RobotBasePtr(),params) ) {
+    if( !_ProfiledInitPlan(planner, RobotBasePtr(),params) ) {
         throw OPENRAVE_EXCEPTION_FORMAT0(_("failed to InitPlan"),ORE_Failed);
     }
 
@@ -1527,7 +1574,7 @@ size_t InsertWaypointWithSmoothing(int index, const std::vector<dReal>& dofvalue
         ptesttraj->Insert(0,vwaypoint);
         ptesttraj->Insert(1,vstartdata,spectotal);
 
-        if( planner->PlanPath(ptesttraj).GetStatusCode() & PS_HasSolution ) {
+        if( _ProfiledPlanPath(planner, ptesttraj).GetStatusCode() & PS_HasSolution ) {
             // before checking, make sure it is better than we currently have
             dReal fNewDuration = fRemainingDuration+ptesttraj->GetDuration();
             if( fNewDuration < fBestDuration ) {
@@ -2083,7 +2130,7 @@ void GetDHParameters(std::vector<DHParameter>& vparameters, KinBodyConstPtr pbod
     }
 }
 
-DynamicsCollisionConstraint::DynamicsCollisionConstraint(PlannerBase::PlannerParametersConstPtr parameters, const std::list<KinBodyPtr>& listCheckBodies, int filtermask) : _listCheckBodies(listCheckBodies), _filtermask(filtermask), _torquelimitmode(DC_NominalTorque), _perturbation(0.1)
+DynamicsCollisionConstraint::DynamicsCollisionConstraint(PlannerBase::PlannerParametersConstPtr parameters, const std::list<KinBodyPtr>& listCheckBodies, int filtermask) : _listCheckBodies(listCheckBodies), _filtermask(filtermask), _torquelimitmode(DC_NominalTorque), _perturbation(0.1), _bAdaptiveStepping(false)
 {
     BOOST_ASSERT(listCheckBodies.size()>0);
     _report.reset(new CollisionReport());
@@ -2123,6 +2170,11 @@ void DynamicsCollisionConstraint::SetPerturbation(dReal perturbation)
     _perturbation = perturbation;
 }
 
+void DynamicsCollisionConstraint::SetAdaptiveStepping(bool bAdaptiveStepping)
+{
+    _bAdaptiveStepping = bAdaptiveStepping;
+}
+
 int DynamicsCollisionConstraint::_SetAndCheckState(PlannerBase::PlannerParametersConstPtr params, const std::vector<dReal>& vdofvalues, const std::vector<dReal>& vdofvelocities, const std::vector<dReal>& vdofaccels, int options, ConstraintFilterReturnPtr filterreturn)
 {
 //    if( IS_DEBUGLEVEL(Level_Verbose) ) {
@@ -2295,6 +2347,203 @@ void DynamicsCollisionConstraint::_PrintOnFailure(const std::string& prefix)
     }
 }
 
+bool DynamicsCollisionConstraint::_ComputeDOFDisplacementRadii(KinBodyPtr pbody, std::vector<dReal>& vdofradii)
+{
+    vdofradii.resize(0);
+    FOREACHC(itjoint, pbody->GetPassiveJoints()) {
+        if( (*itjoint)->IsMimic() ) {
+            // mimic joints move with the dofs and are not accounted for
+            return false;
+        }
+    }
+    std::vector<KinBodyPtr> vgrabbed;
+    pbody->GetGrabbed(vgrabbed);
+    std::vector<KinBody::JointPtr> vchainjoints;
+    std::vector<dReal> vlower, vupper;
+    vdofradii.resize(pbody->GetDOF(), 0);
+    FOREACHC(itjoint, pbody->GetJoints()) {
+        KinBody::JointPtr pjoint = *itjoint;
+        if( pjoint->GetDOF() != 1 ) {
+            return false;
+        }
+        if( pjoint->IsPrismatic(0) ) {
+            // every point moves by exactly the joint displacement
+            vdofradii.at(pjoint->GetDOFIndex()) = 1;
+            continue;
+        }
+        if( !pjoint->IsRevolute(0) ) {
+            return false;
+        }
+        // the max distance from the anchor to any point on a link is bounded by the distances between the anchors of the chain
+        // leading to the link, which are fixed for revolute joints, plus the ranges of the prismatic joints in the chain.
+        dReal fradius = 0;
+        FOREACHC(itlink, pbody->GetLinks()) {
+            if( !pbody->DoesAffect(pjoint->GetJointIndex(), (*itlink)->GetIndex()) ) {
+                continue;
+            }
+            pbody->GetChain(pjoint->GetHierarchyChildLink()->GetIndex(), (*itlink)->GetIndex(), vchainjoints);
+            Vector vprevanchor = pjoint->GetAnchor();
+            dReal fchainlength = 0;
+            FOREACHC(itchainjoint, vchainjoints) {
+                Vector vanchor = (*itchainjoint)->GetAnchor();
+                fchainlength += RaveSqrt((vanchor-vprevanchor).lengthsqr3());
+                if( (*itchainjoint)->IsPrismatic(0) ) {
+                    (*itchainjoint)->GetLimits(vlower, vupper);
+                    fchainlength += vupper.at(0) - vlower.at(0);
+                }
+                vprevanchor = vanchor;
+            }
+            if( (*itlink)->GetGeometries().size() > 0 ) {
+                AABB ab = (*itlink)->ComputeAABB();
+                fradius = max(fradius, fchainlength + RaveSqrt((ab.pos-vprevanchor).lengthsqr3()) + RaveSqrt(ab.extents.lengthsqr3()));
+            }
+            FOREACHC(itgrabbed, vgrabbed) {
+                if( pbody->IsGrabbing(**itgrabbed) == *itlink ) {
+                    AABB ab = (*itgrabbed)->ComputeAABB();
+                    fradius = max(fradius, fchainlength + RaveSqrt((ab.pos-vprevanchor).lengthsqr3()) + RaveSqrt(ab.extents.lengthsqr3()));
+                }
+            }
+        }
+        if( !(fradius < 1e5) ) {
+            // most likely unlimited prismatic joints
+            return false;
+        }
+        vdofradii.at(pjoint->GetDOFIndex()) = fradius;
+    }
+    return true;
+}
+
+int DynamicsCollisionConstraint::_CheckLinearAdaptive(PlannerBase::PlannerParametersConstPtr params, const std::vector<dReal>& q0, int start, int numSteps, int options, ConstraintFilterReturnPtr filterreturn)
+{
+    // map the dof displacement radii of all the check bodies to configuration space
+    if( _vcachedbodystamps.size() != _listCheckBodies.size() ) {
+        _vcachedbodystamps.resize(_listCheckBodies.size());
+        _vcacheddofradii.resize(_listCheckBodies.size());
+        std::fill(_vcachedbodystamps.begin(), _vcachedbodystamps.end(), -1);
+    }
+    _vconfigradii.resize(params->GetDOF());
+    std::fill(_vconfigradii.begin(), _vconfigradii.end(), dReal(-1));
+    size_t ibody = 0;
+    FOREACHC(itbody, _listCheckBodies) {
+        if( _vcachedbodystamps[ibody] != (*itbody)->GetInfoUpdateStamp() ) {
+            if( !_ComputeDOFDisplacementRadii(*itbody, _vcacheddofradii[ibody]) ) {
+                _vcacheddofradii[ibody].resize(0);
+            }
+            _vcachedbodystamps[ibody] = (*itbody)->GetInfoUpdateStamp();
+        }
+        params->_configurationspecification.ExtractUsedIndices(*itbody, _vuseddofindices, _vusedconfigindices);
+        if( _vuseddofindices.size() > 0 && _vcacheddofradii[ibody].size() == 0 ) {
+            return -1;
+        }
+        for(size_t i = 0; i < _vuseddofindices.size(); ++i) {
+            if( _vusedconfigindices[i] >= (int)_vconfigradii.size() ) {
+                return -1;
+            }
+            _vconfigradii[_vusedconfigindices[i]] = _vcacheddofradii[ibody].at(_vuseddofindices[i]);
+        }
+        ++ibody;
+    }
+
+    // the max distance any point of the check bodies moves over the entire segment
+    dReal fdisplacement = 0;
+    for(size_t i = 0; i < _vconfigradii.size(); ++i) {
+        if( _vconfigradii[i] < 0 ) {
+            // not a dof of the check bodies (affine dofs, other bodies), so cannot bound
+            return -1;
+        }
+        fdisplacement += RaveFabs(dQ.at(i))*_vconfigradii[i];
+    }
+    if( fdisplacement <= g_fEpsilon ) {
+        return -1;
+    }
+
+    EnvironmentBasePtr penv = _listCheckBodies.front()->GetEnv();
+    CollisionCheckerBasePtr pchecker = penv->GetCollisionChecker();
+    if( !pchecker ) {
+        return -1;
+    }
+    CollisionOptionsStateSaver optionsaver(pchecker, pchecker->GetCollisionOptions()|CO_Distance, false);
+    if( !(pchecker->GetCollisionOptions() & CO_Distance) ) {
+        return -1;
+    }
+    if( options & CFO_CheckSelfCollisions ) {
+        // the self-collision checkers copy the options of the environment checker, so only have to make sure they support distances
+        FOREACHC(itbody, _listCheckBodies) {
+            CollisionCheckerBasePtr pselfchecker = (*itbody)->GetSelfCollisionChecker();
+            if( !!pselfchecker && pselfchecker != pchecker ) {
+                int oldoptions = pselfchecker->GetCollisionOptions();
+                bool bsupported = pselfchecker->SetCollisionOptions(pchecker->GetCollisionOptions());
+                pselfchecker->SetCollisionOptions(oldoptions);
+                if( !bsupported ) {
+                    return -1;
+                }
+            }
+        }
+    }
+
+    // if start is 1, the clearance at q0 is only used to compute the first step and q0 is not reported as invalid
+    const dReal fminstep = dReal(1.0)/numSteps;
+    dReal fstep = 0;
+    int numchecks = 0;
+    while(1) {
+        for(size_t i = 0; i < _vtempconfig.size(); ++i) {
+            _vtempconfig[i] = q0[i] + fstep*dQ[i];
+        }
+        if( params->SetStateValues(_vtempconfig, 0) != 0 ) {
+            if( !!filterreturn ) {
+                filterreturn->_returncode = CFO_StateSettingError;
+            }
+            return CFO_StateSettingError;
+        }
+        ++numchecks;
+        dReal fclearance = std::numeric_limits<dReal>::infinity();
+        int nstateret = 0;
+        FOREACHC(itbody, _listCheckBodies) {
+            if( options & CFO_CheckEnvCollisions ) {
+                if( penv->CheckCollision(KinBodyConstPtr(*itbody),_report) ) {
+                    nstateret = CFO_CheckEnvCollisions;
+                    break;
+                }
+                fclearance = min(fclearance, _report->minDistance);
+            }
+            if( options & CFO_CheckSelfCollisions ) {
+                if( (*itbody)->CheckSelfCollision(_report) ) {
+                    nstateret = CFO_CheckSelfCollisions;
+                    break;
+                }
+                // both links of a self-collision pair can move
+                fclearance = min(fclearance, dReal(0.5)*_report->minDistance);
+            }
+        }
+        if( nstateret != 0 && (fstep > 0 || start == 0) ) {
+            if( !!filterreturn ) {
+                if( options & CFO_FillCollisionReport ) {
+                    filterreturn->_report = *_report;
+                }
+                filterreturn->_returncode = nstateret;
+                filterreturn->_invalidvalues = _vtempconfig;
+                filterreturn->_fTimeWhenInvalid = fstep;
+            }
+            if( IS_DEBUGLEVEL(Level_Verbose) ) {
+                _PrintOnFailure(std::string("adaptive collision failed ")+_report->__str__());
+            }
+            return nstateret;
+        }
+        if( nstateret != 0 ) {
+            fclearance = 0;
+        }
+
+        // moving by fdisplacement*ds keeps every point within the clearance
+        dReal fnextstep = fstep + max(fminstep, fclearance/fdisplacement);
+        if( fnextstep >= 1-g_fEpsilonLinear ) {
+            break;
+        }
+        fstep = fnextstep;
+    }
+    RAVELOG_VERBOSE_FORMAT("env=%d, adaptive stepping used %d checks instead of %d", penv->GetId()%numchecks%numSteps);
+    return 0;
+}
+
 inline std::ostream& RaveSerializeTransform(std::ostream& O, const Transform& t, char delim=',')
 {
     O << t.rot.x << delim << t.rot.y << delim << t.rot.z << delim << t.rot.w << delim << t.trans.x << delim << t.trans.y << delim << t.trans.z;
@@ -2535,6 +2784,7 @@ int DynamicsCollisionConstraint::Check(const std::vector<dReal>& q0, const std::
             filterreturn->_configurationtimes.reserve(1+numSteps);
         }
     }
+    const int intervalstart = start; // start is set to 1 once q0 is checked
     if (start == 0 ) {
         int nstateret = _SetAndCheckState(params, q0, dq0, _vtempaccelconfig, maskoptions, filterreturn);
         if( options & CFO_FillCheckedConfiguration ) {
@@ -3020,6 +3270,14 @@ int DynamicsCollisionConstraint::Check(const std::vector<dReal>& q0, const std::
         }
     }
     else {
+        if( _bAdaptiveStepping && !(maskoptions & (CFO_CheckTimeBasedConstraints|CFO_CheckUserConstraints|CFO_CheckWithPerturbation)) && !(options & CFO_FillCheckedConfiguration) ) {
+            // only collisions have to be checked, so can skip configurations that are guaranteed to be collision-free
+            int nadaptiveret = _CheckLinearAdaptive(params, q0, intervalstart, numSteps, maskoptions, filterreturn);
+            if( nadaptiveret >= 0 ) {
+                return nadaptiveret;
+            }
+        }
+
         // check for collision along the straight-line path
         // NOTE: this does not check the end config, and may or may
         // not check the start based on the value of 'start'
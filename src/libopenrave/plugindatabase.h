@@ -88,7 +88,7 @@ public:
     class Plugin : public UserData, public boost::enable_shared_from_this<Plugin>
     {
 public:
-        Plugin(boost::shared_ptr<RaveDatabase> pdatabase) : _pdatabase(pdatabase), plibrary(NULL), pfnCreate(NULL), pfnCreateNew(NULL), pfnGetPluginAttributes(NULL), pfnGetPluginAttributesNew(NULL), pfnDestroyPlugin(NULL), pfnOnRaveInitialized(NULL), pfnOnRavePreDestroy(NULL), _bShutdown(false), _bInitializing(true), _bHasCalledOnRaveInitialized(false) {
+        Plugin(boost::shared_ptr<RaveDatabase> pdatabase) : _pdatabase(pdatabase), plibrary(NULL), pfnCreate(NULL), pfnCreateNew(NULL), pfnGetPluginAttributes(NULL), pfnGetPluginAttributesNew(NULL), pfnDestroyPlugin(NULL), pfnOnRaveInitialized(NULL), pfnOnRavePreDestroy(NULL), _bShutdown(false), _bInitializing(true), _bHasCalledOnRaveInitialized(false), _bLoadOnDemand(false) {
         }
         virtual ~Plugin() {
             Destroy();
@@ -318,6 +318,10 @@ public:
         /// \brief call to initialize the plugin, if initialized already, then ignore the call.
         void OnRaveInitialized()
         {
+            if( _IsWaitingForDemand() ) {
+                // plugins restored from the manifest do not export OnRaveInitialized
+                return;
+            }
             if( Load_OnRaveInitialized() ) {
                 if( !!pfnOnRaveInitialized && !_bHasCalledOnRaveInitialized ) {
                     pfnOnRaveInitialized();
@@ -328,6 +332,9 @@ public:
 
         void OnRavePreDestroy()
         {
+            if( _IsWaitingForDemand() ) {
+                return;
+            }
             if( Load_OnRavePreDestroy() ) {
                 // always call destroy regardless of initialization state (safest)
                 if( !!pfnOnRavePreDestroy ) {
@@ -338,6 +345,16 @@ public:
         }
 
 protected:
+        /// \brief true if the plugin was restored from the manifest and its library has not been requested yet
+        bool _IsWaitingForDemand()
+        {
+            if( !_bLoadOnDemand ) {
+                return false;
+            }
+            boost::mutex::scoped_lock lock(_mutex);
+            return plibrary == NULL && !_bShutdown;
+        }
+
         /// if the library is not loaded yet, wait for it.
         void _confirmLibrary()
         {
@@ -375,6 +392,7 @@ protected:
         bool _bShutdown;         ///< managed by plugin database
         bool _bInitializing; ///< still in the initialization phase
         bool _bHasCalledOnRaveInitialized; ///< if true, then OnRaveInitialized has been called and does not need to call it again.
+        bool _bLoadOnDemand; ///< if true, _infocached was restored from the plugin manifest and the library is only opened on the first interface creation
 
         friend class RaveDatabase;
     };
@@ -382,7 +400,7 @@ protected:
     typedef boost::shared_ptr<Plugin const> PluginConstPtr;
     friend class Plugin;
 
-    RaveDatabase() : _bShutdown(false) {
+    RaveDatabase() : _bManifestModified(false), _nRegistrationStamp(0), _bShutdown(false) {
     }
     virtual ~RaveDatabase() {
         Destroy();
@@ -428,7 +446,8 @@ protected:
         return RaveInterfaceCast<SpaceSamplerBase>(Create(penv, PT_SpaceSampler, name));
     }
 
-    virtual bool Init(bool bLoadAllPlugins)
+    /// \param manifestfilename file caching the interfaces of every plugin found in the plugin directories. If not empty, plugins whose library did not change since the manifest was written are registered without opening their library.
+    virtual bool Init(bool bLoadAllPlugins, const std::string& manifestfilename=std::string())
     {
         _threadPluginLoader.reset(new boost::thread(boost::bind(&RaveDatabase::_PluginLoaderThread, this)));
         std::vector<std::string> vplugindirs;
@@ -500,11 +519,17 @@ protected:
             }
         }
         if( bLoadAllPlugins ) {
+            _manifestfilename = manifestfilename;
+            _bManifestModified = false;
+            _ReadPluginManifest();
             FOREACH(it, vplugindirs) {
                 if( it->size() > 0 ) {
                     AddDirectory(*it);
                 }
             }
+            if( _bManifestModified ) {
+                _WritePluginManifest();
+            }
         }
         return true;
     }
@@ -680,7 +705,7 @@ protected:
                 string strplugin = pdir;
                 strplugin += "\\";
                 strplugin += FindFileData.cFileName;
-                LoadPlugin(strplugin);
+                _AddDirectoryPlugin(strplugin);
             } while (FindNextFileA(hFind, &FindFileData) != 0);
             FindClose(hFind);
         }
@@ -698,7 +723,7 @@ protected:
                     string strplugin = pdir;
                     strplugin += "/";
                     strplugin += ep->d_name;
-                    LoadPlugin(strplugin);
+                    _AddDirectoryPlugin(strplugin);
                 }
             }
             (void) closedir (dp);
@@ -850,14 +875,217 @@ protected:
         boost::mutex::scoped_lock lock(_mutex);
         RegisteredInterfacePtr pdata(new RegisteredInterface(type,name,createfn,shared_from_this()));
         pdata->_iterator = _listRegisteredInterfaces.insert(_listRegisteredInterfaces.end(),pdata);
+        NotifyRegistration();
         return pdata;
     }
 
+    /// \brief called whenever a reader or an interface is registered so that plugins with side effects at load time are never loaded on demand.
+    void NotifyRegistration()
+    {
+        boost::mutex::scoped_lock lock(_mutexRegistrationStamp);
+        ++_nRegistrationStamp;
+    }
+
     static const char* GetInterfaceHash(InterfaceBasePtr pint) {
         return pint->GetHash();
     }
 
 protected:
+    /// \brief cached information of a plugin library in the plugin manifest
+    struct PluginManifestEntry
+    {
+        PluginManifestEntry() : modifiedtime(0), filesize(0), bEager(true) {
+        }
+        int64_t modifiedtime;
+        int64_t filesize;
+        bool bEager; ///< if true, the plugin has to be loaded at startup since it has side effects when loading
+        PLUGININFO info;
+    };
+
+    /// \brief gets the modification time and size of a library, returns false if it cannot be stat-ed
+    static bool _GetLibraryStamp(const std::string& libraryname, int64_t& modifiedtime, int64_t& filesize)
+    {
+#ifdef HAVE_BOOST_FILESYSTEM
+        boost::system::error_code ec;
+        boost::filesystem::path librarypath(libraryname);
+        std::time_t t = boost::filesystem::last_write_time(librarypath, ec);
+        if( !!ec ) {
+            return false;
+        }
+        uintmax_t size = boost::filesystem::file_size(librarypath, ec);
+        if( !!ec ) {
+            return false;
+        }
+        modifiedtime = static_cast<int64_t>(t);
+        filesize = static_cast<int64_t>(size);
+        return true;
+#elif !defined(_WIN32)
+        struct stat filestat;
+        if( stat(libraryname.c_str(), &filestat) != 0 ) {
+            return false;
+        }
+        modifiedtime = static_cast<int64_t>(filestat.st_mtime);
+        filesize = static_cast<int64_t>(filestat.st_size);
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /// \brief adds a plugin found while scanning a plugin directory. If the manifest has an up-to-date entry for the library, registers its interfaces without opening it.
+    void _AddDirectoryPlugin(const std::string& libraryname)
+    {
+        int64_t modifiedtime = 0, filesize = 0;
+        bool bHasStamp = !_manifestfilename.empty() && _GetLibraryStamp(libraryname, modifiedtime, filesize);
+        if( bHasStamp ) {
+            std::map<std::string, PluginManifestEntry>::const_iterator itentry = _mapPluginManifest.find(libraryname);
+            if( itentry != _mapPluginManifest.end() && !itentry->second.bEager && itentry->second.modifiedtime == modifiedtime && itentry->second.filesize == filesize ) {
+                PluginPtr p(new Plugin(shared_from_this()));
+                p->ppluginname = libraryname;
+                p->_infocached = itentry->second.info;
+                p->_bInitializing = false;
+                p->_bLoadOnDemand = true;
+                boost::mutex::scoped_lock lock(_mutex);
+                std::list<PluginPtr>::iterator it = _GetPlugin(libraryname);
+                if( it != _listplugins.end() ) {
+                    _listplugins.erase(it);
+                }
+                _listplugins.push_back(p);
+                RAVELOG_VERBOSE_FORMAT("registered plugin %s from manifest", libraryname);
+                return;
+            }
+        }
+
+        int nRegistrationStamp = _GetRegistrationStamp();
+        if( !LoadPlugin(libraryname) || !bHasStamp ) {
+            return;
+        }
+        PluginPtr p;
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+            std::list<PluginPtr>::iterator it = _GetPlugin(libraryname);
+            if( it != _listplugins.end() ) {
+                p = *it;
+            }
+        }
+        if( !p ) {
+            return;
+        }
+        PluginManifestEntry newentry;
+        newentry.modifiedtime = modifiedtime;
+        newentry.filesize = filesize;
+        // registrations from other threads only make this conservative
+        newentry.bEager = p->pfnOnRaveInitialized != NULL || nRegistrationStamp != _GetRegistrationStamp();
+        newentry.info = p->_infocached;
+        // eager plugins are loaded on every startup, so only rewrite the manifest when the entry actually changed
+        std::map<std::string, PluginManifestEntry>::iterator itentry = _mapPluginManifest.find(libraryname);
+        if( itentry == _mapPluginManifest.end() ) {
+            _mapPluginManifest[libraryname] = newentry;
+            _bManifestModified = true;
+        }
+        else if( !_IsManifestEntryEqual(itentry->second, newentry) ) {
+            itentry->second = newentry;
+            _bManifestModified = true;
+        }
+    }
+
+    static bool _IsManifestEntryEqual(const PluginManifestEntry& entry0, const PluginManifestEntry& entry1)
+    {
+        return entry0.modifiedtime == entry1.modifiedtime && entry0.filesize == entry1.filesize && entry0.bEager == entry1.bEager && entry0.info.version == entry1.info.version && entry0.info.interfacenames == entry1.info.interfacenames;
+    }
+
+    int _GetRegistrationStamp()
+    {
+        boost::mutex::scoped_lock lock(_mutexRegistrationStamp);
+        return _nRegistrationStamp;
+    }
+
+    /// \brief reads the plugin manifest, ignores it if it cannot be parsed.
+    ///
+    /// Each plugin has a line "plugin modifiedtime filesize eager version libraryname" followed by lines "interface type name" for all its interfaces.
+    void _ReadPluginManifest()
+    {
+        _mapPluginManifest.clear();
+        if( _manifestfilename.empty() ) {
+            return;
+        }
+        ifstream f(_manifestfilename.c_str());
+        if( !f ) {
+            return;
+        }
+        PluginManifestEntry* pentry = NULL;
+        std::string line, command;
+        while( !!getline(f, line) ) {
+            std::stringstream ss(line);
+            ss >> command;
+            if( !ss ) {
+                continue;
+            }
+            if( command == "plugin" ) {
+                PluginManifestEntry entry;
+                int eager = 1;
+                ss >> entry.modifiedtime >> entry.filesize >> eager >> entry.info.version;
+                std::string libraryname;
+                getline(ss, libraryname);
+                size_t startpos = libraryname.find_first_not_of(' ');
+                if( !ss || startpos == std::string::npos ) {
+                    RAVELOG_WARN_FORMAT("failed to parse plugin manifest %s, ignoring", _manifestfilename);
+                    _mapPluginManifest.clear();
+                    return;
+                }
+                entry.bEager = eager != 0;
+                pentry = &(_mapPluginManifest[libraryname.substr(startpos)] = entry);
+            }
+            else if( command == "interface" && pentry != NULL ) {
+                int type = 0;
+                std::string name;
+                ss >> type >> name;
+                if( !!ss && type >= PT_Planner && type <= PT_NumberOfInterfaces ) {
+                    pentry->info.interfacenames[static_cast<InterfaceType>(type)].push_back(name);
+                }
+            }
+        }
+        RAVELOG_VERBOSE_FORMAT("read %d plugins from manifest %s", _mapPluginManifest.size()%_manifestfilename);
+    }
+
+    /// \brief writes the plugin manifest to a temporary file and renames it so that concurrent processes never read a partial manifest
+    void _WritePluginManifest()
+    {
+        if( _manifestfilename.empty() ) {
+            return;
+        }
+#ifdef _WIN32
+        std::string tempfilename = str(boost::format("%s.%d")%_manifestfilename%GetCurrentProcessId());
+#else
+        std::string tempfilename = str(boost::format("%s.%d")%_manifestfilename%getpid());
+#endif
+        {
+            ofstream f(tempfilename.c_str());
+            if( !f ) {
+                RAVELOG_DEBUG_FORMAT("cannot write plugin manifest %s", tempfilename);
+                return;
+            }
+            FOREACHC(itentry, _mapPluginManifest) {
+                f << "plugin " << itentry->second.modifiedtime << " " << itentry->second.filesize << " " << (int)itentry->second.bEager << " " << itentry->second.info.version << " " << itentry->first << std::endl;
+                FOREACHC(itinterfaces, itentry->second.info.interfacenames) {
+                    FOREACHC(itname, itinterfaces->second) {
+                        f << "interface " << (int)itinterfaces->first << " " << *itname << std::endl;
+                    }
+                }
+            }
+            if( !f ) {
+                RAVELOG_DEBUG_FORMAT("failed to write plugin manifest %s", tempfilename);
+                f.close();
+                remove(tempfilename.c_str());
+                return;
+            }
+        }
+        if( rename(tempfilename.c_str(), _manifestfilename.c_str()) != 0 ) {
+            RAVELOG_DEBUG_FORMAT("failed to rename plugin manifest to %s", _manifestfilename);
+            remove(tempfilename.c_str());
+        }
+    }
+
     void _CleanupUnusedLibraries()
     {
         FOREACH(it,_listDestroyLibraryQueue) {
@@ -1131,6 +1359,15 @@ protected:
     std::list< boost::weak_ptr<RegisteredInterface> > _listRegisteredInterfaces;
     std::list<std::string> _listplugindirs;
 
+    /// \name plugin manifest, only used while scanning the plugin directories in Init
+    //@{
+    std::string _manifestfilename;
+    std::map<std::string, PluginManifestEntry> _mapPluginManifest; ///< library name -> cached info
+    bool _bManifestModified;
+    boost::mutex _mutexRegistrationStamp; ///< separate from _mutex since plugins can register readers while being loaded
+    int _nRegistrationStamp; ///< incremented on every reader or interface registration
+    //@}
+
     /// \name plugin loading
     //@{
     mutable boost::mutex _mutexPluginLoader;     ///< specifically for loading shared objects
@@ -0,0 +1,303 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2006-2016 Rosen Diankov <rosen.diankov@gmail.com>
+//
+// This file is part of OpenRAVE.
+// OpenRAVE is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include "libopenrave.h"
+
+#include <atomic>
+#include <chrono>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace OpenRAVE {
+
+namespace {
+
+static const int s_nProfilingHistogramBins = 40; ///< bin i counts durations in [2^i, 2^(i+1)) ns, the last bin counts everything above
+static const size_t s_nMaxTraceEventsPerThread = 8192; ///< size of the ring buffer of trace events kept for every thread
+
+static const char* s_profilingCategoryNames[PC_NumCategories] = {"CollisionCheck", "IkSolve", "PlannerInit", "PlannerPlan", "PlannerPostProcess", "TrajectorySample", "EnvironmentLockWait"};
+
+/// \brief counters of one category. Only written by the owning thread, so relaxed loads and stores are enough and no atomic read-modify-write is needed.
+struct ProfilingCounters
+{
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> totalduration;
+    std::atomic<uint64_t> maxduration;
+    std::atomic<uint64_t> histogram[s_nProfilingHistogramBins];
+};
+
+struct ProfilingTraceEvent
+{
+    ProfilingCategory category;
+    uint64_t starttime;
+    uint64_t duration;
+};
+
+/// \brief profiling state of one thread
+struct ThreadProfilingData
+{
+    ThreadProfilingData(int threadindex) : threadindex(threadindex), resetgeneration(0), nexttraceevent(0) {
+        _ClearCounters();
+    }
+
+    inline void _ClearCounters()
+    {
+        for(int icategory = 0; icategory < PC_NumCategories; ++icategory) {
+            ProfilingCounters& counters = vcounters[icategory];
+            counters.count.store(0, std::memory_order_relaxed);
+            counters.totalduration.store(0, std::memory_order_relaxed);
+            counters.maxduration.store(0, std::memory_order_relaxed);
+            for(int ibin = 0; ibin < s_nProfilingHistogramBins; ++ibin) {
+                counters.histogram[ibin].store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    const int threadindex; ///< small index used as the thread id in traces
+    std::atomic<int> resetgeneration; ///< generation of RaveResetProfilingStatistics the counters belong to. Counters of older generations are considered 0.
+    ProfilingCounters vcounters[PC_NumCategories];
+
+    boost::mutex mutexTrace; ///< protects the trace events, only taken when tracing is enabled
+    std::vector<ProfilingTraceEvent> vtraceevents; ///< ring buffer
+    size_t nexttraceevent; ///< next index to write in vtraceevents once it is full
+};
+
+typedef boost::shared_ptr<ThreadProfilingData> ThreadProfilingDataPtr;
+
+/// \brief global profiling state
+class ProfilingRegistry
+{
+public:
+    ProfilingRegistry() : options(0), resetgeneration(0), _nNextThreadIndex(0) {
+    }
+
+    /// \brief returns the data of the calling thread, registering it on the first call
+    inline ThreadProfilingData& GetThreadData()
+    {
+        static thread_local ThreadProfilingDataPtr s_pThreadData;
+        if( !s_pThreadData ) {
+            boost::mutex::scoped_lock lock(_mutex);
+            s_pThreadData.reset(new ThreadProfilingData(_nNextThreadIndex++));
+            s_pThreadData->resetgeneration.store(resetgeneration.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            _vThreadData.push_back(s_pThreadData);
+        }
+        return *s_pThreadData;
+    }
+
+    /// \brief returns the data of all threads that have recorded samples
+    void GetAllThreadData(std::vector<ThreadProfilingDataPtr>& vThreadData)
+    {
+        boost::mutex::scoped_lock lock(_mutex);
+        vThreadData = _vThreadData;
+    }
+
+    void Reset()
+    {
+        boost::mutex::scoped_lock lock(_mutex);
+        resetgeneration.fetch_add(1);
+        // forget threads that exited, their data is only referenced here
+        std::vector<ThreadProfilingDataPtr>::iterator itwrite = _vThreadData.begin();
+        FOREACH(itdata, _vThreadData) {
+            if( itdata->use_count() > 1 ) {
+                *itwrite++ = *itdata;
+            }
+            boost::mutex::scoped_lock locktrace((*itdata)->mutexTrace);
+            (*itdata)->vtraceevents.clear();
+            (*itdata)->nexttraceevent = 0;
+        }
+        _vThreadData.erase(itwrite, _vThreadData.end());
+    }
+
+    std::atomic<int> options; ///< combination of ProfilingOptions
+    std::atomic<int> resetgeneration;
+
+private:
+    boost::mutex _mutex; ///< protects _vThreadData
+    std::vector<ThreadProfilingDataPtr> _vThreadData;
+    int _nNextThreadIndex;
+};
+
+static ProfilingRegistry& GetProfilingRegistry()
+{
+    static ProfilingRegistry s_registry;
+    return s_registry;
+}
+
+} // end namespace
+
+const char* RaveGetProfilingCategoryName(ProfilingCategory category)
+{
+    if( category < 0 || category >= PC_NumCategories ) {
+        return "Unknown";
+    }
+    return s_profilingCategoryNames[category];
+}
+
+void RaveSetProfilingOptions(int options)
+{
+    GetProfilingRegistry().options.store(options);
+}
+
+int RaveGetProfilingOptions()
+{
+    return GetProfilingRegistry().options.load(std::memory_order_relaxed);
+}
+
+void RaveResetProfilingStatistics()
+{
+    GetProfilingRegistry().Reset();
+}
+
+uint64_t RaveGetProfilingTime()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void RaveAddProfilingSample(ProfilingCategory category, uint64_t starttime, uint64_t duration)
+{
+    if( category < 0 || category >= PC_NumCategories ) {
+        return;
+    }
+    ProfilingRegistry& registry = GetProfilingRegistry();
+    ThreadProfilingData& data = registry.GetThreadData();
+    int resetgeneration = registry.resetgeneration.load(std::memory_order_relaxed);
+    if( data.resetgeneration.load(std::memory_order_relaxed) != resetgeneration ) {
+        data._ClearCounters();
+        data.resetgeneration.store(resetgeneration, std::memory_order_release);
+    }
+
+    ProfilingCounters& counters = data.vcounters[category];
+    counters.count.store(counters.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    counters.totalduration.store(counters.totalduration.load(std::memory_order_relaxed) + duration, std::memory_order_relaxed);
+    if( duration > counters.maxduration.load(std::memory_order_relaxed) ) {
+        counters.maxduration.store(duration, std::memory_order_relaxed);
+    }
+    int ibin = 0;
+    for(uint64_t d = duration; d > 1 && ibin < s_nProfilingHistogramBins-1; d >>= 1) {
+        ++ibin;
+    }
+    counters.histogram[ibin].store(counters.histogram[ibin].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    if( registry.options.load(std::memory_order_relaxed) & PO_Trace ) {
+        ProfilingTraceEvent event;
+        event.category = category;
+        event.starttime = starttime;
+        event.duration = duration;
+        boost::mutex::scoped_lock lock(data.mutexTrace);
+        if( data.vtraceevents.size() < s_nMaxTraceEventsPerThread ) {
+            data.vtraceevents.push_back(event);
+        }
+        else {
+            data.vtraceevents[data.nexttraceevent] = event;
+            data.nexttraceevent = (data.nexttraceevent + 1) % s_nMaxTraceEventsPerThread;
+        }
+    }
+}
+
+void RaveGetProfilingStatistics(rapidjson::Value& rStatistics, rapidjson::Document::AllocatorType& alloc)
+{
+    ProfilingRegistry& registry = GetProfilingRegistry();
+    std::vector<ThreadProfilingDataPtr> vThreadData;
+    registry.GetAllThreadData(vThreadData);
+    int resetgeneration = registry.resetgeneration.load(std::memory_order_relaxed);
+
+    rStatistics.SetObject();
+    int options = registry.options.load(std::memory_order_relaxed);
+    orjson::SetJsonValueByKey(rStatistics, "counters", !!(options & PO_Counters), alloc);
+    orjson::SetJsonValueByKey(rStatistics, "trace", !!(options & PO_Trace), alloc);
+    orjson::SetJsonValueByKey(rStatistics, "numThreads", (int)vThreadData.size(), alloc);
+
+    rapidjson::Value rCategories(rapidjson::kObjectType);
+    for(int icategory = 0; icategory < PC_NumCategories; ++icategory) {
+        uint64_t count = 0, totalduration = 0, maxduration = 0;
+        std::vector<uint64_t> vhistogram(s_nProfilingHistogramBins, 0);
+        FOREACHC(itdata, vThreadData) {
+            if( (*itdata)->resetgeneration.load(std::memory_order_acquire) != resetgeneration ) {
+                continue;
+            }
+            const ProfilingCounters& counters = (*itdata)->vcounters[icategory];
+            count += counters.count.load(std::memory_order_relaxed);
+            totalduration += counters.totalduration.load(std::memory_order_relaxed);
+            maxduration = std::max(maxduration, counters.maxduration.load(std::memory_order_relaxed));
+            for(int ibin = 0; ibin < s_nProfilingHistogramBins; ++ibin) {
+                vhistogram[ibin] += counters.histogram[ibin].load(std::memory_order_relaxed);
+            }
+        }
+
+        rapidjson::Value rCategory(rapidjson::kObjectType);
+        orjson::SetJsonValueByKey(rCategory, "count", count, alloc);
+        orjson::SetJsonValueByKey(rCategory, "totalNS", totalduration, alloc);
+        orjson::SetJsonValueByKey(rCategory, "maxNS", maxduration, alloc);
+        orjson::SetJsonValueByKey(rCategory, "meanNS", count > 0 ? (double)totalduration/(double)count : 0.0, alloc);
+
+        // percentiles are the upper bound of the histogram bin they fall in
+        const double fpercentiles[] = {0.5, 0.9, 0.99};
+        const char* percentilenames[] = {"p50NS", "p90NS", "p99NS"};
+        for(int ipercentile = 0; ipercentile < 3; ++ipercentile) {
+            uint64_t threshold = (uint64_t)ceil(fpercentiles[ipercentile]*count), accumulated = 0, upperbound = 0;
+            for(int ibin = 0; ibin < s_nProfilingHistogramBins && count > 0; ++ibin) {
+                accumulated += vhistogram[ibin];
+                if( accumulated >= threshold ) {
+                    upperbound = ibin+1 < s_nProfilingHistogramBins ? (uint64_t(1)<<(ibin+1)) : maxduration;
+                    break;
+                }
+            }
+            orjson::SetJsonValueByKey(rCategory, percentilenames[ipercentile], std::min(upperbound, maxduration), alloc);
+        }
+        orjson::SetJsonValueByKey(rCategory, "histogramLog2NS", vhistogram, alloc);
+        orjson::SetJsonValueByKey(rCategories, RaveGetProfilingCategoryName((ProfilingCategory)icategory), rCategory, alloc);
+    }
+    rStatistics.AddMember("categories", rCategories, alloc);
+}
+
+void RaveGetProfilingTrace(rapidjson::Value& rTrace, rapidjson::Document::AllocatorType& alloc)
+{
+    std::vector<ThreadProfilingDataPtr> vThreadData;
+    GetProfilingRegistry().GetAllThreadData(vThreadData);
+#ifdef _WIN32
+    int pid = (int)GetCurrentProcessId();
+#else
+    int pid = (int)getpid();
+#endif
+
+    rTrace.SetObject();
+    rapidjson::Value rEvents(rapidjson::kArrayType);
+    std::vector<ProfilingTraceEvent> vtraceevents;
+    FOREACHC(itdata, vThreadData) {
+        {
+            boost::mutex::scoped_lock lock((*itdata)->mutexTrace);
+            vtraceevents = (*itdata)->vtraceevents;
+        }
+        FOREACHC(itevent, vtraceevents) {
+            // complete events, timestamps are in microseconds
+            rapidjson::Value rEvent(rapidjson::kObjectType);
+            orjson::SetJsonValueByKey(rEvent, "name", RaveGetProfilingCategoryName(itevent->category), alloc);
+            orjson::SetJsonValueByKey(rEvent, "cat", "openrave", alloc);
+            orjson::SetJsonValueByKey(rEvent, "ph", "X", alloc);
+            orjson::SetJsonValueByKey(rEvent, "ts", 1e-3*(double)itevent->starttime, alloc);
+            orjson::SetJsonValueByKey(rEvent, "dur", 1e-3*(double)itevent->duration, alloc);
+            orjson::SetJsonValueByKey(rEvent, "pid", pid, alloc);
+            orjson::SetJsonValueByKey(rEvent, "tid", (*itdata)->threadindex, alloc);
+            rEvents.PushBack(rEvent, alloc);
+        }
+    }
+    rTrace.AddMember("traceEvents", rEvents, alloc);
+    orjson::SetJsonValueByKey(rTrace, "displayTimeUnit", "ns", alloc);
+}
+
+} // end namespace OpenRAVE
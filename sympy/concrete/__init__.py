@@ -0,0 +1,2 @@
+from products import product, Product
+from summations import summation, Sum
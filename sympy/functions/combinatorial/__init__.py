@@ -0,0 +1,2 @@
+import factorials
+import numbers
@@ -0,0 +1,7 @@
+import gamma_functions
+import error_functions
+import zeta_functions
+import tensor_functions
+import delta_functions
+
+import polynomials
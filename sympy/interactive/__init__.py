@@ -0,0 +1,5 @@
+"""Helper module for setting up interactive SymPy sessions. """
+
+from printing import init_printing
+from session import init_session
+
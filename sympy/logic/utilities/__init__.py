@@ -0,0 +1,2 @@
+from dimacs import load_file
+
@@ -0,0 +1,2 @@
+def exec_(string, globals, locals):
+    exec string in globals, locals
@@ -0,0 +1 @@
+exec_ = exec
@@ -0,0 +1,6 @@
+"""
+A module that helps solving problems in physics
+"""
+
+import units
+from matrices import mgamma, msigma, minkowski_tensor
@@ -0,0 +1,504 @@
+"""Dirac notation for states."""
+
+
+from sympy import Expr
+from sympy.printing.pretty.stringpict import prettyForm
+
+from sympy.physics.quantum.qexpr import (
+    QExpr, dispatch_method
+)
+
+__all__ = [
+    'KetBase',
+    'BraBase',
+    'StateBase',
+    'State',
+    'Ket',
+    'Bra',
+    'TimeDepState',
+    'TimeDepBra',
+    'TimeDepKet'
+]
+
+
+#-----------------------------------------------------------------------------
+# States, bras and kets.
+#-----------------------------------------------------------------------------
+
+# LIGHT VERTICAL BAR
+_straight_bracket = u"\u2758"
+
+# MATHEMATICAL LEFT ANGLE BRACKET
+_lbracket = u"\u27E8"
+_rbracket = u"\u27E9"
+
+# Other options for unicode printing of <, > and | for Dirac notation.
+
+# VERTICAL LINE
+# _straight_bracket = u"\u007C"
+
+# LEFT-POINTING ANGLE BRACKET
+# _lbracket = u"\u2329"
+# _rbracket = u"\u232A"
+
+# LEFT ANGLE BRACKET
+# _lbracket = u"\u3008"
+# _rbracket = u"\u3009"
+
+
+class StateBase(QExpr):
+    """Abstract base class for general abstract states in quantum mechanics.
+
+    All other state classes defined will need to inherit from this class. It
+    carries the basic structure for all other states such as dual, _eval_dagger
+    and label.
+
+    This is an abstract base class and you should not instantiate it directly,
+    instead use State.
+    """
+
+    #-------------------------------------------------------------------------
+    # Dagger/dual
+    #-------------------------------------------------------------------------
+
+    @property
+    def dual(self):
+        """Return the dual state of this one."""
+        return self.dual_class._new_rawargs(self.hilbert_space, *self.args)
+
+    @property
+    def dual_class(self):
+        """Return the class used to construt the dual."""
+        raise NotImplementedError(
+            'dual_class must be implemented in a subclass'
+        )
+
+    def _eval_dagger(self):
+        """Compute the dagger of this state using the dual."""
+        return self.dual
+
+    #-------------------------------------------------------------------------
+    # Printing
+    #-------------------------------------------------------------------------
+
+    def _print_contents(self, printer, *args):
+        label = self._print_label(printer, *args)
+        return '%s%s%s' % (self.lbracket, label, self.rbracket)
+
+    def _print_contents_pretty(self, printer, *args):
+        from sympy.printing.pretty.stringpict import prettyForm
+        pform = self._print_label_pretty(printer, *args)
+        pform = prettyForm(*pform.left((self.lbracket_pretty)))
+        pform = prettyForm(*pform.right((self.rbracket_pretty)))
+        return pform
+
+    def _print_contents_latex(self, printer, *args):
+        label = self._print_label_latex(printer, *args)
+        # The extra {} brackets are needed to get matplotlib's latex
+        # rendered to render this properly.
+        return '{%s%s%s}' % (self.lbracket_latex, label, self.rbracket_latex)
+
+
+class KetBase(StateBase):
+    """Base class for Kets.
+
+    This class defines the dual property and the brackets for printing. This
+    is an abstract base class and you should not instantiate it directly,
+    instead use Ket.
+    """
+
+    lbracket = '|'
+    rbracket = '>'
+    lbracket_pretty = prettyForm(_straight_bracket)
+    rbracket_pretty = prettyForm(_rbracket)
+    lbracket_latex = r'\left|'
+    rbracket_latex = r'\right\rangle '
+
+    @property
+    def dual_class(self):
+        return BraBase
+
+    def __mul__(self, other):
+        """KetBase*other"""
+        from sympy.physics.quantum.operator import OuterProduct
+        if isinstance(other, BraBase):
+            return OuterProduct(self, other)
+        else:
+            return Expr.__mul__(self, other)
+
+    def __rmul__(self, other):
+        """other*KetBase"""
+        from sympy.physics.quantum.innerproduct import InnerProduct
+        if isinstance(other, BraBase):
+            return InnerProduct(other, self)
+        else:
+            return Expr.__rmul__(self, other)
+
+    #-------------------------------------------------------------------------
+    # _eval_* methods
+    #-------------------------------------------------------------------------
+
+    def _eval_innerproduct(self, bra, **hints):
+        """Evaluate the inner product betweeen this ket and a bra.
+
+        This is called to compute <bra|ket>, where the ket is ``self``.
+
+        This method will dispatch to sub-methods having the format::
+
+            def _eval_innerproduct_BraClass(self, **hints):
+
+        Subclasses should define these methods (one for each BraClass) to
+        teach the ket how to take inner products with bras.
+        """
+        return dispatch_method(self, '_eval_innerproduct', bra, **hints)
+
+    def _apply_operator(self, op, **options):
+        """Apply an Operator to this Ket.
+
+        This method will dispatch to methods having the format::
+
+            def _apply_operator_OperatorName(op, **options):
+
+        Subclasses should define these methods (one for each OperatorName) to
+        teach the Ket how operators act on it.
+
+        Parameters
+        ==========
+        op : Operator
+            The Operator that is acting on the Ket.
+        options : dict
+            A dict of key/value pairs that control how the operator is applied
+            to the Ket.
+        """
+        return dispatch_method(self, '_apply_operator', op, **options)
+
+
+class BraBase(StateBase):
+    """Base class for Bras.
+
+    This class defines the dual property and the brackets for printing. This
+    is an abstract base class and you should not instantiate it directly,
+    instead use Bra.
+    """
+
+    lbracket = '<'
+    rbracket = '|'
+    lbracket_pretty = prettyForm(_lbracket)
+    rbracket_pretty = prettyForm(_straight_bracket)
+    lbracket_latex = r'\left\langle '
+    rbracket_latex = r'\right|'
+
+    @property
+    def dual_class(self):
+        return KetBase
+
+    def __mul__(self, other):
+        """BraBase*other"""
+        from sympy.physics.quantum.innerproduct import InnerProduct
+        if isinstance(other, KetBase):
+            return InnerProduct(self, other)
+        else:
+            return Expr.__mul__(self, other)
+
+    def __rmul__(self, other):
+        """other*BraBase"""
+        from sympy.physics.quantum.operator import OuterProduct
+        if isinstance(other, KetBase):
+            return OuterProduct(other, self)
+        else:
+            return Expr.__rmul__(self, other)
+
+    def _represent(self, **options):
+        """A default represent that uses the Ket's version."""
+        from sympy.physics.quantum.dagger import Dagger
+        return Dagger(self.dual._represent(**options))
+
+
+class State(StateBase):
+    """General abstract quantum state used as a base class for Ket and Bra."""
+    pass
+
+
+
+class Ket(State, KetBase):
+    """A general time-independent Ket in quantum mechanics.
+
+    Inherits from State and KetBase. This class should be used as the base
+    class for all physical, time-independent Kets in a system. This class
+    and its subclasses will be the main classes that users will use for
+    expressing Kets in Dirac notation.
+
+    Parameters
+    ==========
+    args : tuple
+        The list of numbers or parameters that uniquely specify the
+        ket. This will usually be its symbol or its quantum numbers. For
+        time-dependent state, this will include the time.
+
+    Examples
+    ========
+
+    Create a simple Ket and looking at its properties::
+
+        >>> from sympy.physics.quantum import Ket, Bra
+        >>> from sympy import symbols, I
+        >>> k = Ket('psi')
+        >>> k
+        |psi>
+        >>> k.hilbert_space
+        H
+        >>> k.is_commutative
+        False
+        >>> k.label
+        (psi,)
+
+    Ket's know about their associated bra::
+
+        >>> k.dual
+        <psi|
+        >>> k.dual_class
+        <class 'sympy.physics.quantum.state.Bra'>
+
+    Take a linear combination of two kets::
+
+        >>> k0 = Ket(0)
+        >>> k1 = Ket(1)
+        >>> 2*I*k0 - 4*k1
+        2*I*|0> - 4*|1>
+
+    Compound labels are passed as tuples::
+
+        >>> n, m = symbols('n,m')
+        >>> k = Ket(n,m)
+        >>> k
+        |nm>
+
+    References
+    ==========
+
+    [1] http://en.wikipedia.org/wiki/Bra-ket_notation
+    """
+
+    @property
+    def dual_class(self):
+        return Bra
+
+
+class Bra(State, BraBase):
+    """A general time-independent Bra in quantum mechanics.
+
+    Inherits from State and BraBase. A Bra is the dual of a Ket [1]. This
+    class and its subclasses will be the main classes that users will use for
+    expressing Bras in Dirac notation.
+
+    Parameters
+    ==========
+    args : tuple
+        The list of numbers or parameters that uniquely specify the
+        ket. This will usually be its symbol or its quantum numbers. For
+        time-dependent state, this will include the time.
+
+    Examples
+    ========
+
+    Create a simple Bra and look at its properties::
+
+        >>> from sympy.physics.quantum import Ket, Bra
+        >>> from sympy import symbols, I
+        >>> b = Bra('psi')
+        >>> b
+        <psi|
+        >>> b.hilbert_space
+        H
+        >>> b.is_commutative
+        False
+
+    Bra's know about their dual Ket's::
+
+        >>> b.dual
+        |psi>
+        >>> b.dual_class
+        <class 'sympy.physics.quantum.state.Ket'>
+
+    Like Kets, Bras can have compound labels and be manipulated in a similar
+    manner::
+
+        >>> n, m = symbols('n,m')
+        >>> b = Bra(n,m) - I*Bra(m,n)
+        >>> b
+        -I*<mn| + <nm|
+
+    Symbols in a Bra can be substituted using ``.subs``::
+
+        >>> b.subs(n,m)
+        <mm| - I*<mm|
+
+    References
+    ==========
+
+    [1] http://en.wikipedia.org/wiki/Bra-ket_notation
+    """
+
+    @property
+    def dual_class(self):
+        return Ket
+
+#-----------------------------------------------------------------------------
+# Time dependent states, bras and kets.
+#-----------------------------------------------------------------------------
+
+class TimeDepState(StateBase):
+    """Base class for a general time-dependent quantum state.
+
+    This class is used as a base class for any time-dependent state. The main
+    difference between this class and the time-independent state is that this
+    class takes a second argument that is the time in addition to the usual
+    label argument.
+
+    Parameters
+    ==========
+    args : tuple
+        The list of numbers or parameters that uniquely specify the
+        ket. This will usually be its symbol or its quantum numbers. For
+        time-dependent state, this will include the time as the final
+        argument.
+    """
+
+    #-------------------------------------------------------------------------
+    # Initialization
+    #-------------------------------------------------------------------------
+
+    #-------------------------------------------------------------------------
+    # Properties
+    #-------------------------------------------------------------------------
+
+    @property
+    def label(self):
+        """The label of the state."""
+        return self.args[:-1]
+
+    @property
+    def time(self):
+        """The time of the state."""
+        return self.args[-1]
+
+    #-------------------------------------------------------------------------
+    # Printing
+    #-------------------------------------------------------------------------
+
+    def _print_time(self, printer, *args):
+        return printer._print(self.time, *args)
+
+    _print_time_repr = _print_time
+    _print_time_latex = _print_time
+
+    def _print_time_pretty(self, printer, *args):
+        pform = printer._print(self.time, *args)
+        return pform
+
+    def _print_contents(self, printer, *args):
+        label = self._print_label(printer, *args)
+        time = self._print_time(printer, *args)
+        return '%s%s;%s%s' % (self.lbracket, label, time, self.rbracket)
+
+    def _print_contents_repr(self, printer, *args):
+        label = self._print_label_repr(printer, *args)
+        time = self._print_time_repr(printer, *args)
+        return '%s,%s' % (label, time)
+
+    def _print_contents_pretty(self, printer, *args):
+        pform = self._print_label_pretty(printer, *args)
+        pform = prettyForm(*pform.left((self.lbracket_pretty)))
+        pform = prettyForm(*pform.right((';')))
+        nextpform = self._print_time_pretty(printer, *args)
+        pform = prettyForm(*pform.right((nextpform)))
+        pform = prettyForm(*pform.right((self.rbracket_pretty)))
+        return pform
+
+    def _print_contents_latex(self, printer, *args):
+        label = self._print_label_latex(printer, *args)
+        time = self._print_time_latex(printer, *args)
+        # The extra {} brackets are needed to get matplotlib's latex
+        # rendered to render this properly.
+        return '{%s%s;%s%s}' %\
+            (self.lbracket_latex, label, time, self.rbracket_latex)
+
+
+class TimeDepKet(TimeDepState, KetBase):
+    """General time-dependent Ket in quantum mechanics.
+
+    This inherits from TimeDepState and KetBase and is the main class that
+    should be used for Kets that vary with time. Its dual is a TimeDepBra.
+
+    Parameters
+    ==========
+    args : tuple
+        The list of numbers or parameters that uniquely specify the
+        ket. This will usually be its symbol or its quantum numbers. For
+        time-dependent state, this will include the time as the final
+        argument.
+
+    Examples
+    ========
+
+    Create a TimeDepKet and look at its attributes::
+
+        >>> from sympy.physics.quantum import TimeDepKet
+        >>> k = TimeDepKet('psi', 't')
+        >>> k
+        |psi;t>
+        >>> k.time
+        t
+        >>> k.label
+        (psi,)
+        >>> k.hilbert_space
+        H
+
+    TimeDepKets know about their dual bra::
+
+        >>> k.dual
+        <psi;t|
+        >>> k.dual_class
+        <class 'sympy.physics.quantum.state.TimeDepBra'>
+    """
+
+    @property
+    def dual_class(self):
+        return TimeDepBra
+
+
+class TimeDepBra(TimeDepState, BraBase):
+    """General time-dependent Bra in quantum mechanics.
+
+    This inherits from TimeDepState and BraBase and is the main class that
+    should be used for Bras that vary with time. Its dual is a TimeDepBra.
+
+    Parameters
+    ==========
+    args : tuple
+        The list of numbers or parameters that uniquely specify the
+        ket. This will usually be its symbol or its quantum numbers. For
+        time-dependent state, this will include the time as the final
+        argument.
+
+    Examples
+    ========
+
+        >>> from sympy.physics.quantum import TimeDepBra
+        >>> from sympy import symbols, I
+        >>> b = TimeDepBra('psi', 't')
+        >>> b
+        <psi;t|
+        >>> b.time
+        t
+        >>> b.label
+        (psi,)
+        >>> b.hilbert_space
+        H
+        >>> b.dual
+        |psi;t>
+    """
+
+    @property
+    def dual_class(self):
+        return TimeDepKet
@@ -0,0 +1,14 @@
+"""Printing subsystem"""
+
+from pretty import *
+from latex import latex, print_latex
+from mathml import mathml, print_mathml
+from python import python, print_python
+from ccode import ccode, print_ccode
+from fcode import fcode, print_fcode
+from gtk import *
+from preview import preview
+from repr import srepr
+from tree import print_tree
+from str import StrPrinter, sstr, sstrrepr
+
@@ -12,6 +12,7 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 from common_test_openrave import *
+import threading
 
 class RunCollision(EnvironmentSetup):
     def __init__(self,collisioncheckername):
@@ -220,6 +221,69 @@ class RunCollision(EnvironmentSetup):
         assert(env.CheckCollision(env.GetKinBody('mug1')))
         assert(len(reports)==1)
 
+    def test_collisionreleasesgil(self):
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        robot=env.GetRobots()[0]
+        mug=env.GetKinBody('mug1')
+
+        reports = []
+        def collisioncallback(report,fromphysics):
+            reports.append(report)
+            return CollisionAction.DefaultAction
+        handle = env.RegisterCollisionCallback(collisioncallback)
+        
+        results = []
+        def checkthread():
+            results.append(env.CheckCollision(mug))
+            results.append(robot.CheckSelfCollision())
+        
+        # the thread blocks on the environment lock inside the checks, so this thread can only keep running python if the checks released the GIL
+        env.Lock()
+        try:
+            t = threading.Thread(target=checkthread)
+            t.start()
+            time.sleep(0.2)
+            assert(len(results) == 0)
+        finally:
+            env.Unlock()
+        t.join(10.0)
+        assert(not t.isAlive())
+        assert(results == [True, False])
+        # the callback was called from the checking thread
+        assert(len(reports) == 1)
+        handle.Close()
+
+    def test_profilingcounters(self):
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        robot=env.GetRobots()[0]
+        try:
+            # the profiling commands are global and can be sent to any interface
+            output=robot.SendJSONCommand('SetProfilingOptions',{'counters':True,'trace':True,'reset':True})
+            assert(output['counters'] and output['trace'])
+            numchecks=10
+            for i in range(numchecks):
+                env.CheckCollision(robot)
+            statistics=robot.SendJSONCommand('GetProfilingStatistics',{})
+            collisionstats=statistics['categories']['CollisionCheck']
+            assert(collisionstats['count'] >= numchecks)
+            assert(sum(collisionstats['histogramLog2NS']) == collisionstats['count'])
+            assert(collisionstats['p50NS'] <= collisionstats['p90NS'] <= collisionstats['p99NS'] <= collisionstats['maxNS'])
+            assert(collisionstats['totalNS'] >= collisionstats['maxNS'])
+            trace=robot.SendJSONCommand('GetProfilingTrace',{})
+            assert(len([event for event in trace['traceEvents'] if event['name'] == 'CollisionCheck']) >= numchecks)
+
+            # reset while reading, then disabled profiling does not record anything
+            robot.SendJSONCommand('GetProfilingStatistics',{'reset':True})
+            robot.SendJSONCommand('SetProfilingOptions',{'counters':False,'trace':False})
+            env.CheckCollision(robot)
+            statistics=robot.SendJSONCommand('GetProfilingStatistics',{})
+            assert(not statistics['counters'])
+            assert(statistics['categories']['CollisionCheck']['count'] == 0)
+        finally:
+            robot.SendJSONCommand('SetProfilingOptions',{'counters':False,'trace':False,'reset':True})
+
     def test_activedofdistance(self):
         self.log.debug('test distance computation with active dofs')
         env=self.env
@@ -310,3 +310,56 @@ class TestConfigurationCache(EnvironmentSetup):
                 cachedcollisions, cachedcollisionhits, cachedfreehits, cachesize = cachechecker.SendCommand('GetSelfCacheStatistics').split()
                 assert(int(cachesize)==0)
                 self.log.info('self cache reset test passed')
+
+    def test_pathlibrary(self):
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        robot=env.GetRobots()[0]
+        with env:
+            robot.SetActiveDOFs(robot.GetActiveManipulator().GetArmIndices())
+            start=robot.GetActiveDOFValues()
+            planner=RaveCreatePlanner(env,'PathLibrary')
+            def plan(goal):
+                params=Planner.PlannerParameters()
+                params.SetRobotActiveJoints(robot)
+                params.SetInitialConfig(start)
+                params.SetGoalConfig(goal)
+                assert(planner.InitPlan(robot,params))
+                traj=RaveCreateTrajectory(env,'')
+                assert(planner.PlanPath(traj)==PlannerStatusCode.HasSolution)
+                points=reshape(traj.GetWaypoints(0,traj.GetNumWaypoints(),robot.GetActiveConfigurationSpecification()),(traj.GetNumWaypoints(),robot.GetActiveDOF()))
+                assert(transdist(points[0],start) <= g_epsilon)
+                assert(transdist(points[-1],goal) <= g_epsilon)
+            def getinfo():
+                return [int(x) for x in planner.SendCommand('GetLibraryInfo').split()]
+            
+            goals=[]
+            for offset in [1.0,-0.8,0.5]:
+                goal=array(start)
+                goal[0]+=offset
+                robot.SetActiveDOFValues(goal)
+                assert(not env.CheckCollision(robot) and not robot.CheckSelfCollision())
+                goals.append(goal)
+            robot.SetActiveDOFValues(start)
+            
+            assert(planner.SendCommand('SetLibraryParameters 2 100') is not None)
+            plan(goals[0])
+            assert(getinfo() == [1,1,0,1])
+            # the same query is repaired from the library
+            plan(goals[0])
+            assert(getinfo() == [1,1,1,1])
+            
+            # a stored feature further than the maximum distance is not used, the feature distance is in units of the resolutions
+            resolutions=robot.GetActiveDOFResolutions()
+            maxfeaturedist=0.5*abs(goals[2][0]-goals[0][0])/resolutions[0]
+            assert(planner.SendCommand('SetLibraryParameters 2 %.15e'%maxfeaturedist) is not None)
+            plan(goals[1])
+            assert(getinfo() == [2,2,1,2])
+            
+            # the library is capped, the oldest path is replaced so the first goal is planned from scratch again
+            plan(goals[2])
+            numpaths,numfeatures,numhits,numfallbacks=getinfo()
+            assert(numfallbacks == 3)
+            assert(numpaths == 2 and numfeatures == 2)
+            plan(goals[0])
+            assert(getinfo()[3] == 4)
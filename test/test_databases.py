@@ -12,6 +12,8 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 from common_test_openrave import *
+import shutil
+import tempfile
 
 class TestDatabases(EnvironmentSetup):
     def test_ikmodulegeneration(self):
@@ -37,6 +39,134 @@ class TestDatabases(EnvironmentSetup):
             out=ikmodule.SendCommand('LoadIKFastSolver %s %d 1'%(robot.GetName(),iktype))
             assert(out is not None)
             assert(manip.GetIkSolver() is not None)
+
+    def test_linkstatisticsnative(self):
+        # the native joint spheres have to give the same weights as the python ones, and the resolutions come from the max axis distances
+        env=self.env
+        self.LoadEnv('robots/barrettwam.robot.xml')
+        robot=env.GetRobots()[0]
+        with env:
+            assert(databases.linkstatistics.LinkStatisticsModel(robot).usenative)
+            robot.SetDOFValues(0.3*ones(robot.GetDOF()))
+            vweights = []
+            vjointspheres = []
+            for usenative in [False, True]:
+                lmodel=databases.linkstatistics.LinkStatisticsModel(robot, usenative=usenative)
+                lmodel.generate()
+                if usenative:
+                    assert(lmodel.sweptvolumes is not None and len(lmodel.sweptvolumes) > 0)
+                lmodel.setRobotWeights()
+                vweights.append(robot.GetDOFWeights())
+                # new grabbed sets are computed at the current configuration
+                lmodel.grabbedjointspheres = []
+                vjointspheres.append(lmodel._GetJointSpheresFromGrabbed(robot.GetGrabbedInfo()))
+            assert(transdist(vweights[0],vweights[1]) <= 1e-6)
+            assert(sorted(vjointspheres[0].keys()) == sorted(vjointspheres[1].keys()))
+            for ijoint, sphere in vjointspheres[0].iteritems():
+                nativesphere = vjointspheres[1][ijoint]
+                assert(transdist(sphere[0],nativesphere[0]) <= 1e-6 and abs(sphere[1]-nativesphere[1]) <= 1e-6)
+            
+            xyzdelta = 0.005
+            lmodel.setRobotResolutions(xyzdelta)
+            resolutions = robot.GetDOFResolutions()
+            for ijoint, nativesphere in vjointspheres[1].iteritems():
+                assert(nativesphere[2] > 1e-7)
+                assert(abs(resolutions[robot.GetJoints()[ijoint].GetDOFIndex()] - xyzdelta/nativesphere[2]) <= 1e-6)
             
 #     def test_database_paths(self):
 #         pass
+
+    def test_graspthreadeddeterminism(self):
+        # the noisy grasps have to be the same for any number of threads
+        env=self.env
+        self.LoadEnv('robots/barrettwam.robot.xml')
+        robot=env.GetRobots()[0]
+        target=env.ReadKinBodyURI('data/mug1.kinbody.xml')
+        env.Add(target,True)
+        gmodel=databases.grasping.GraspingModel(robot,target)
+        manip=robot.GetActiveManipulator()
+        grasper=interfaces.Grasper(robot)
+        with robot:
+            approachrays=gmodel.computeBoxApproachRays(delta=0.04,normalanglerange=0)
+            approachrays[:,3:6] = -approachrays[:,3:6]
+            robot.SetTransform(eye(4))
+            robot.SetActiveDOFs(manip.GetGripperIndices(),DOFAffine.X|DOFAffine.Y|DOFAffine.Z)
+            preshapes=array([robot.GetDOFValues(manip.GetGripperIndices())])
+            results=[]
+            for numthreads in [1,3,3]:
+                nextid,grasps=grasper.GraspThreaded(approachrays=approachrays,standoffs=array([0,0.025]),preshapes=preshapes,rolls=arange(0,2*pi,pi/2),manipulatordirections=array([manip.GetLocalToolDirection()]),target=target,graspingnoise=(0.005,3),forceclosurethreshold=1e-9,numthreads=numthreads,maxgrasps=5,randomseed=42)
+                assert(len(grasps)>0)
+                results.append((nextid,grasps))
+            for nextid,grasps in results[1:]:
+                assert(nextid==results[0][0])
+                assert(len(grasps)==len(results[0][1]))
+                for grasp,grasp0 in izip(grasps,results[0][1]):
+                    # position, direction, roll, standoff, manipulatordirection, mindist, volume, preshape, Tfinal, finalshape
+                    assert(transdist(grasp[:2],grasp0[:2])<=1e-7)
+                    assert(abs(grasp[2]-grasp0[2])<=1e-7 and abs(grasp[3]-grasp0[3])<=1e-7)
+                    assert(abs(grasp[5]-grasp0[5])<=1e-7 and abs(grasp[6]-grasp0[6])<=1e-7)
+                    assert(transdist(grasp[8],grasp0[8])<=1e-7)
+                    assert(transdist(grasp[9],grasp0[9])<=1e-7)
+
+    def test_inversereachabilitysampler(self):
+        # a distribution whose only point puts the robot where it is has to give back the current placement
+        env=self.env
+        self.LoadEnv('robots/barrettwam.robot.xml')
+        robot=env.GetRobots()[0]
+        manip=robot.GetActiveManipulator()
+        tempdir=tempfile.mkdtemp()
+        try:
+            with env:
+                robot.SetDOFValues([0.5,0.6,0.2,1.5,0.3,0.2,0.1],manip.GetArmIndices())
+                Tgrasp=manip.GetTransform()
+                Trobot=robot.GetTransform()
+                # end effector in the manipulator base with the rotation around z removed, same as sampleBaseDistributionIterator
+                posetarget=poseFromMatrix(dot(linalg.inv(manip.GetBase().GetTransform()),Tgrasp))
+                qnormalized,znormangles=normalizeZRotation(array([posetarget[0:4]]))
+                znormangle=znormangles[0]
+                xy=dot(array([[cos(znormangle),sin(znormangle)],[-sin(znormangle),cos(znormangle)]]),posetarget[4:6])
+                irmodel=databases.inversereachability.InverseReachabilityModel(robot)
+                irmodel.rotweight=0.2
+                irmodel.xyzdelta=0.02
+                irmodel.quatdelta=0.04
+                irmodel.equivalenceclasses=[(r_[qnormalized[0],posetarget[6]],array([0.01,0.01]),array([[-znormangle,-xy[0],-xy[1],1.0]]))]
+                sampler=irmodel.createNativeSampler(os.path.join(tempdir,'invreachability.native'))
+
+                # grasps at another height do not match the class
+                Thigh=array(Tgrasp)
+                Thigh[2,3]+=1
+                assert(int(sampler.SendCommand('SetGrasps grasps 1 %s'%' '.join(str(f) for f in poseFromMatrix(Thigh))))==0)
+                assert(int(sampler.SendCommand('SetGrasps weight 0.001 grasps 2 %s %s'%(' '.join(str(f) for f in poseFromMatrix(Thigh)),' '.join(str(f) for f in poseFromMatrix(Tgrasp)))))==1)
+
+                values=[float(f) for f in sampler.SendCommand('SampleVerified 5 50').split()]
+                numplacements=int(values.pop(0))
+                assert(numplacements==5)
+                for iplacement in range(numplacements):
+                    Tplacement=matrixFromPose(values[0:7])
+                    igrasp=int(values[7])
+                    solution=values[8:8+len(manip.GetArmIndices())]
+                    values=values[8+len(manip.GetArmIndices()):]
+                    assert(igrasp==1)
+                    assert(sum(abs(Tplacement-Trobot).flat)<=0.01)
+                    # the returned ik solution reaches the grasp from the returned placement
+                    with robot:
+                        robot.SetTransform(Tplacement)
+                        robot.SetDOFValues(solution,manip.GetArmIndices())
+                        assert(sum(abs(manip.GetTransform()-Tgrasp).flat)<=1e-4)
+                assert(len(values)==0)
+
+                # no placement is returned when the base is blocked
+                box=RaveCreateKinBody(env,'')
+                box.SetName('obstacle')
+                box.InitFromBoxes(array([r_[Trobot[0:3,3],0.3,0.3,0.3]]),True)
+                env.Add(box)
+                assert(int(sampler.SendCommand('SampleVerified 5 20').split()[0])==0)
+
+                # broken files are rejected
+                data=open(os.path.join(tempdir,'invreachability.native'),'rb').read()
+                open(os.path.join(tempdir,'truncated.native'),'wb').write(data[:-8])
+                assert(sampler.SendCommand('Load %s'%os.path.join(tempdir,'truncated.native')) is None)
+                open(os.path.join(tempdir,'badmagic.native'),'wb').write('X'+data[1:])
+                assert(sampler.SendCommand('Load %s'%os.path.join(tempdir,'badmagic.native')) is None)
+        finally:
+            shutil.rmtree(tempdir)
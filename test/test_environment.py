@@ -15,6 +15,10 @@ from common_test_openrave import *
 from subprocess import Popen, PIPE
 import shutil
 import threading
+import tempfile
+import json
+import socket
+import struct
 
 class TestEnvironment(EnvironmentSetup):
     def test_load(self):
@@ -56,6 +60,44 @@ class TestEnvironment(EnvironmentSetup):
         self.LoadDataEnv(xml)
         assert(env.GetBodies()[0].GetURI().find('data/mug1.dae') >= 0)
 
+    def test_jsonreferenceuri(self):
+        env=self.env
+        tempdir=tempfile.mkdtemp()
+        try:
+            def WriteBoxFile(filename, extents):
+                box=RaveCreateKinBody(env,'')
+                box.SetName('box')
+                box.InitFromBoxes(array([[0,0,0]+list(extents)]),True)
+                boxinfo=box.ExtractInfo().SerializeJSON()
+                boxinfo['id']='box'
+                with open(filename,'w') as f:
+                    json.dump({'bodies':[boxinfo]},f)
+
+            boxfilename=os.path.join(tempdir,'box.json')
+            scenefilename=os.path.join(tempdir,'scene.json')
+            with open(scenefilename,'w') as f:
+                json.dump({'bodies':[{'id':'box%d'%i, 'name':'box%d'%i, 'referenceUri':'file:%s#box'%boxfilename} for i in range(2)]},f)
+            
+            # the second body and the second load are expanded from the cache
+            WriteBoxFile(boxfilename,[0.1,0.2,0.3])
+            for iload in range(2):
+                env.Reset()
+                self.LoadEnv(scenefilename)
+                assert(len(env.GetBodies())==2)
+                for body in env.GetBodies():
+                    assert(transdist(body.GetLinks()[0].GetGeometries()[0].GetBoxExtents(),[0.1,0.2,0.3]) <= g_epsilon)
+                    
+            # modifying the referenced file has to invalidate the cache
+            WriteBoxFile(boxfilename,[0.25,0.5,0.75])
+            modifiedtime=os.path.getmtime(boxfilename)+10
+            os.utime(boxfilename,(modifiedtime,modifiedtime))
+            env.Reset()
+            self.LoadEnv(scenefilename)
+            for body in env.GetBodies():
+                assert(transdist(body.GetLinks()[0].GetGeometries()[0].GetBoxExtents(),[0.25,0.5,0.75]) <= g_epsilon)
+        finally:
+            shutil.rmtree(tempdir)
+
     def test_scalegeometry(self):
         env=self.env
         with env:
@@ -191,6 +233,63 @@ class TestEnvironment(EnvironmentSetup):
             assert(endtime <= 0.05)
             misc.CompareEnvironments(env,clonedenv,epsilon=g_epsilon)
             
+    def test_infodelta(self):
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        env2=Environment()
+        try:
+            with env:
+                robot=env.GetRobots()[0]
+                delta=env.ExtractInfoDelta(0)
+                assert(delta['isFull'])
+                assert(len(delta['bodies']) == len(env.GetBodies()))
+                created, modified, removed = env2.UpdateFromInfoDelta(delta)
+                assert(len(created) == len(env.GetBodies()))
+                misc.CompareEnvironments(env,env2,epsilon=g_epsilon)
+
+                # nothing changed
+                delta=env.ExtractInfoDelta(delta['stamp'])
+                assert(not delta['isFull'])
+                assert('bodies' not in delta and 'bodyStates' not in delta and 'removedBodies' not in delta)
+
+                # only the state of the robot changed
+                lower,upper=robot.GetDOFLimits()
+                robot.SetDOFValues(0.5*(lower+upper))
+                Trobot=robot.GetTransform()
+                Trobot[0,3] += 0.5
+                robot.SetTransform(Trobot)
+                delta=env.ExtractInfoDelta(delta['stamp'])
+                assert(not delta['isFull'])
+                assert('bodies' not in delta)
+                assert([bodystate['name'] for bodystate in delta['bodyStates']] == [robot.GetName()])
+                created, modified, removed = env2.UpdateFromInfoDelta(delta)
+                assert(len(created) == 0 and len(removed) == 0)
+                robot2=env2.GetRobot(robot.GetName())
+                assert(transdist(robot2.GetDOFValues(),robot.GetDOFValues()) <= g_epsilon)
+                assert(transdist(robot2.GetTransform(),robot.GetTransform()) <= g_epsilon)
+
+                # a body is removed and another one is added
+                removedbody=[body for body in env.GetBodies() if not body.IsRobot()][0]
+                env.Remove(removedbody)
+                box=RaveCreateKinBody(env,'')
+                box.SetName('deltabox')
+                box.InitFromBoxes(array([[0,0,0,0.1,0.1,0.1]]),True)
+                env.Add(box,True)
+                delta=env.ExtractInfoDelta(delta['stamp'])
+                assert(not delta['isFull'])
+                assert([removedinfo['name'] for removedinfo in delta['removedBodies']] == [removedbody.GetName()])
+                assert([bodyinfo['name'] for bodyinfo in delta['bodies']] == ['deltabox'])
+                created, modified, removed = env2.UpdateFromInfoDelta(delta)
+                assert([body.GetName() for body in created] == ['deltabox'])
+                assert([body.GetName() for body in removed] == [removedbody.GetName()])
+                misc.CompareEnvironments(env,env2,epsilon=g_epsilon)
+
+                # the delta of an unknown stamp is full
+                delta=env.ExtractInfoDelta(delta['stamp']+100)
+                assert(delta['isFull'])
+        finally:
+            env2.Destroy()
+
     def test_multithread(self):
         self.log.info('test multiple threads accessing same resource')
         def mythread(env,threadid):
@@ -209,6 +308,59 @@ class TestEnvironment(EnvironmentSetup):
         for t in threads:
             t.join()
 
+    def test_textserver(self):
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        robot=env.GetRobots()[0]
+        port=4765+random.randint(1,1000)
+        server=RaveCreateModule(env,'textserver')
+        assert(env.AddModule(server,'%d'%port)==0)
+        def ReceiveResponse(sock):
+            # responses are a 4 byte size followed by the data
+            data=''
+            while len(data) < 4:
+                chunk=sock.recv(4-len(data))
+                assert(len(chunk) > 0)
+                data+=chunk
+            size=struct.unpack('i',data)[0]
+            data=''
+            while len(data) < size:
+                chunk=sock.recv(size-len(data))
+                assert(len(chunk) > 0)
+                data+=chunk
+            return data
+        
+        sock=socket.create_connection(('localhost',port))
+        try:
+            sock.settimeout(30)
+            # pipeline many requests scheduled on the worker thread followed by read-only queries, which have to wait for the workers of their connection
+            numsteps=100
+            starttime=env.GetSimulationTime()
+            sock.sendall(''.join(['env_stepsimulation 0.001 0\nbody_getjoints %d\n'%robot.GetEnvironmentId() for i in range(numsteps)]))
+            for i in range(numsteps):
+                values=[float(f) for f in ReceiveResponse(sock).split()]
+                assert(transdist(values,robot.GetDOFValues()) <= 1e-5)
+            # every step is rounded up to microseconds
+            assert(abs(int(env.GetSimulationTime()-starttime)-numsteps*1000) <= numsteps)
+            
+            # binary framing, the size is in network byte order
+            def Frame(request):
+                return struct.pack('!I',len(request))+request
+            sock.sendall('framing binary\n'+Frame('env_getbodies')+Frame('body_getjoints %d'%robot.GetEnvironmentId()))
+            bodies=ReceiveResponse(sock)
+            assert(int(bodies.split()[0])==len(env.GetBodies()))
+            values=[float(f) for f in ReceiveResponse(sock).split()]
+            assert(transdist(values,robot.GetDOFValues()) <= 1e-5)
+            sock.sendall(Frame('framing text')+'env_getbodies\n')
+            assert(ReceiveResponse(sock)==bodies)
+            
+            # too large frames close the connection
+            sock.sendall('framing binary\n'+struct.pack('!I',0x7fffffff))
+            assert(sock.recv(4)=='')
+        finally:
+            sock.close()
+            env.Remove(server)
+
     def test_dataccess(self):
         RaveDestroy()
         OPENRAVE_DATA = os.environ.get('OPENRAVE_DATA','')
@@ -262,3 +414,87 @@ class TestEnvironment(EnvironmentSetup):
         # thread is done, so should be able to lock
         assert(env.Lock(1.0))
         env.Unlock()
+
+    def test_mutextracing(self):
+        env=self.env
+        self.log.info('test that environment mutex tracing records contention')
+        env.SetMutexTracing(True)
+        try:
+            env.ResetMutexTracingStatistics()
+            def OtherThread(env):
+                env.Lock()
+                env.Unlock()
+            env.Lock()
+            t=threading.Thread(target=OtherThread,args=(env,))
+            try:
+                t.start()
+                time.sleep(0.5)
+                # the other thread has given up on trylock and is blocked in lock
+                assert(env.GetMutexTracingStatistics()['numWaiters']>=1)
+            finally:
+                env.Unlock()
+            t.join()
+            statistics=env.GetMutexTracingStatistics()
+            assert(statistics['tracing'])
+            events=statistics['events']
+            assert(len(events)>=2)
+            # the main thread released with the other thread waiting, which waited for most of the sleep
+            assert(any(event['numWaiters']>=1 and event['holdNS']>=0.4e9 for event in events))
+            assert(any(event['waitNS']>=0.4e9 for event in events))
+            assert(sum(callsite['contended'] for callsite in statistics['callSites'])>=1)
+            assert(sum(callsite['count'] for callsite in statistics['callSites'])==len(events))
+            for callsite in statistics['callSites']:
+                assert(callsite['maxWaitNS']<=callsite['totalWaitNS'] and callsite['maxHoldNS']<=callsite['totalHoldNS'])
+
+            env.ResetMutexTracingStatistics()
+            env.SetMutexTracing(False)
+            with env:
+                pass
+            assert(len(env.GetMutexTracingStatistics()['events'])==0)
+        finally:
+            env.SetMutexTracing(False)
+
+    def test_depthcamera(self):
+        env=self.env
+        self.log.info('test that the cpu depth camera renders the depth and bodies of the scene')
+        width,height=64,48
+        sensor=RaveCreateSensor(env,'basedepthcamera')
+        assert(sensor.SendCommand('setdims %d %d'%(width,height)) is not None)
+        assert(sensor.SendCommand('setintrinsic 50 50 32 24') is not None)
+        sensor.SetTransform(eye(4))
+        with env:
+            # a wall filling the whole view behind a small box covering part of the right half
+            wall=RaveCreateKinBody(env,'')
+            wall.SetName('wall')
+            wall.InitFromBoxes(array([[0,0,3,2,2,0.1]]),True)
+            env.Add(wall)
+            box=RaveCreateKinBody(env,'')
+            box.SetName('box')
+            box.InitFromBoxes(array([[0.5,0,2,0.5,0.5,0.1]]),True)
+            env.Add(box)
+
+            sensor.SendCommand('RenderDepth')
+            values=sensor.SendCommand('GetDepthImage').split()
+            assert(int(values[0])==width and int(values[1])==height)
+            depth=array([float(value) for value in values[2:]]).reshape((height,width))
+            bodyids=array([int(value) for value in sensor.SendCommand('collidingbodies').split()]).reshape((height,width))
+            assert(abs(depth[24,40]-1.9)<=1e-4 and bodyids[24,40]==box.GetEnvironmentId())
+            assert(abs(depth[24,20]-2.9)<=1e-4 and bodyids[24,20]==wall.GetEnvironmentId())
+            assert(abs(depth[0,0]-2.9)<=1e-4 and abs(depth[height-1,width-1]-2.9)<=1e-4)
+            # the box spans x in [0,1] at z=1.9, which projects to the columns from 32 to 58
+            assert(all(bodyids[24,33:58]==box.GetEnvironmentId()))
+            assert(all(bodyids[24,:32]==wall.GetEnvironmentId()) and all(bodyids[24,59:]==wall.GetEnvironmentId()))
+
+            data=sensor.GetSensorData(Sensor.Type.Laser)
+            assert(len(data.ranges)==width*height)
+            assert(sum(abs(data.ranges[24*width+40]-array([(40-32)/50.0*1.9,0,1.9])))<=1e-4)
+
+            # disabled and removed bodies are not rendered
+            box.Enable(False)
+            sensor.SendCommand('RenderDepth')
+            depth=array([float(value) for value in sensor.SendCommand('GetDepthImage').split()[2:]])
+            assert(all(abs(depth-2.9)<=1e-4))
+            env.Remove(wall)
+            sensor.SendCommand('RenderDepth')
+            depth=array([float(value) for value in sensor.SendCommand('GetDepthImage').split()[2:]])
+            assert(all(depth==0))
@@ -24,6 +24,33 @@ def test_pluginloading():
     env=Environment()
     assert(RaveCreateProblem(env,'ikfast') is not None)
 
+def test_paralleljobs():
+    numthreads = RaveGetNumParallelJobThreads()
+    assert(numthreads >= 1)
+    # the serial path (maxthreads=1 or a single job) has to behave like the pool
+    for numjobs, maxthreads in [(1,0), (20,1), (20,0), (20,2)]:
+        finishedjobs = []
+        def job(jobindex, threadindex):
+            assert(threadindex >= 0 and threadindex < numthreads)
+            if maxthreads == 1:
+                assert(threadindex == 0)
+            finishedjobs.append(jobindex)
+        RaveRunParallelJobs(job, numjobs, maxthreads)
+        assert(sorted(finishedjobs) == range(numjobs))
+        
+        # the remaining jobs still run and the first exception is rethrown
+        del finishedjobs[:]
+        def failingjob(jobindex, threadindex):
+            finishedjobs.append(jobindex)
+            if jobindex == 0:
+                raise ValueError('job failed')
+        try:
+            RaveRunParallelJobs(failingjob, numjobs, maxthreads)
+            assert(False)
+        except openrave_exception:
+            pass
+        assert(sorted(finishedjobs) == range(numjobs))
+
 class RunTutorialExample(object):
     __name__= 'test_global.tutorialexample'
     def __call__(self,modulepath):
@@ -13,6 +13,9 @@
 # limitations under the License.
 from common_test_openrave import *
 import cPickle as pickle
+import shutil
+import struct
+import tempfile
 
 class TestIkSolver(EnvironmentSetup):
     def test_customfilter(self):
@@ -542,3 +545,75 @@ class TestIkSolver(EnvironmentSetup):
         
         sol = r.GetActiveManipulator().FindIKSolution(Tee, 0)
         assert( sol is None)
+
+    def test_reachabilitymap(self):
+        env=self.env
+        self.LoadEnv('robots/barrettwam.robot.xml')
+        robot=env.GetRobots()[0]
+        manip=robot.GetActiveManipulator()
+        assert(manip.GetIkSolver() is not None)
+        ikmodule=RaveCreateModule(env,'ikfast')
+        env.Add(ikmodule)
+        tempdir=tempfile.mkdtemp()
+        try:
+            # too many rotations for the 16 bit counts
+            assert(ikmodule.SendCommand('ComputeReachability robot %s filename %s numrotations 65536'%(robot.GetName(),os.path.join(tempdir,'toomany.bin'))) is None)
+
+            # the map does not depend on the number of threads
+            filenames=[]
+            for numthreads in [1,3]:
+                filename=os.path.join(tempdir,'reachability%d.bin'%numthreads)
+                numreachable=int(ikmodule.SendCommand('ComputeReachability robot %s filename %s xyzdelta 0.3 numrotations 8 numthreads %d'%(robot.GetName(),filename,numthreads)))
+                assert(numreachable > 0)
+                filenames.append(filename)
+            data=open(filenames[0],'rb').read()
+            assert(data==open(filenames[1],'rb').read())
+            assert(ikmodule.SendCommand('LoadReachability %s'%filenames[0]).split()==[robot.GetName(),manip.GetName()])
+
+            # find a reachable voxel and rotation in the file, header layout of ReachabilityMapHeader
+            headerformat='<8sII3iIdd3ddII64s64s'
+            headersize=struct.calcsize(headerformat)
+            header=struct.unpack(headerformat,data[:headersize])
+            dims=header[3:6]
+            numrotations=header[6]
+            xyzdelta=header[7]
+            origin=array(header[9:12])
+            recordsize=header[13]
+            assert(numrotations==8)
+            quats=reshape(struct.unpack('<%dd'%(4*numrotations),data[headersize:headersize+32*numrotations]),(numrotations,4))
+            voxelsoffset=headersize+32*numrotations
+            assert(len(data)==voxelsoffset+dims[0]*dims[1]*dims[2]*recordsize)
+            Treachable=None
+            numreachablevoxels=0
+            for ivoxel in range(dims[0]*dims[1]*dims[2]):
+                record=data[voxelsoffset+ivoxel*recordsize:voxelsoffset+(ivoxel+1)*recordsize]
+                numrotvalid=struct.unpack('<H',record[:2])[0]
+                if numrotvalid == 0:
+                    continue
+                numreachablevoxels += 1
+                rotationbits=[(ord(record[4+(irot>>3)])>>(irot&7))&1 for irot in range(numrotations)]
+                assert(sum(rotationbits)==numrotvalid)
+                if Treachable is None:
+                    index=array([ivoxel/(dims[1]*dims[2]),(ivoxel/dims[2])%dims[1],ivoxel%dims[2]])
+                    Treachable=matrixFromPose(r_[quats[rotationbits.index(1)],origin+index*xyzdelta])
+            assert(numreachablevoxels==numreachable)
+
+            with env:
+                # the pose is relative to the manipulator base
+                Tpose=dot(manip.GetBase().GetTransform(),Treachable)
+                assert(manip.FindIKSolution(Tpose,0) is not None)
+                Trobot=robot.GetTransform()
+                Tfar=array(Trobot)
+                Tfar[0,3]+=10
+                cmd='FindBestBasePlacements poses 1 %s bases 2 %s %s num 2'%(' '.join(str(f) for f in poseFromMatrix(Tpose)),' '.join(str(f) for f in poseFromMatrix(Tfar)),' '.join(str(f) for f in poseFromMatrix(Trobot)))
+                values=[float(f) for f in ikmodule.SendCommand(cmd).split()]
+                assert(int(values[0])==2)
+                assert(abs(values[1]-1)<=1e-7 and sum(abs(array(values[2:9])-poseFromMatrix(Trobot)))<=1e-5)
+                assert(values[9]==0)
+
+            # maps with too many rotations cannot be loaded
+            corruptfilename=os.path.join(tempdir,'corrupt.bin')
+            open(corruptfilename,'wb').write(data[:28]+struct.pack('<I',65536)+data[32:])
+            assert_raises(openrave_exception,ikmodule.SendCommand,'LoadReachability %s'%corruptfilename)
+        finally:
+            shutil.rmtree(tempdir)
@@ -12,6 +12,8 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 from common_test_openrave import *
+import shutil
+import tempfile
 
 class RunPlanning(EnvironmentSetup):
     def __init__(self,collisioncheckername):
@@ -621,6 +623,435 @@ class RunPlanning(EnvironmentSetup):
             assert(success)
             assert(not env.CheckCollision(collisionbody))
 
+    def test_manipconstraintscriticalstates(self):
+        # the manipulator constraints of the parabolic smoother compute the end effector velocity and acceleration at
+        # every ramp boundary with the jacobians and hessians. They have to match the link velocities and accelerations.
+        env=self.env
+        self.LoadEnv('robots/barrettwam.robot.xml')
+        with env:
+            robot=env.GetRobots()[0]
+            manip=robot.GetActiveManipulator()
+            dofindices=manip.GetArmIndices()
+            endeffindex=manip.GetEndEffector().GetIndex()
+            lower,upper=robot.GetDOFLimits(dofindices)
+            # sample RampND vector, each ramp is (x0, v0, a, duration)
+            random.seed(0)
+            ramps=[]
+            x0=0.5*(lower+upper)
+            v0=random.rand(len(dofindices))-0.5
+            for iramp in range(4):
+                a=4*random.rand(len(dofindices))-2
+                duration=0.1
+                ramps.append((x0,v0,a,duration))
+                x0=x0+v0*duration+0.5*a*duration**2
+                v0=v0+a*duration
+            
+            for itime in range(len(ramps)+1):
+                if itime > 0:
+                    x,v,a,duration=ramps[itime-1]
+                    q=x+v*duration+0.5*a*duration**2
+                    qd=v+a*duration
+                else:
+                    q,qd=ramps[0][0],ramps[0][1]
+                vaccels=[ramps[iramp][2] for iramp in [itime-1,itime] if iramp >= 0 and iramp < len(ramps)]
+                
+                robot.SetDOFValues(q,dofindices,checklimits=False)
+                Tlink=robot.GetLinks()[endeffindex].GetTransform()
+                Jt=robot.ComputeJacobianTranslation(endeffindex,Tlink[0:3,3],dofindices)
+                Ja=robot.ComputeJacobianAxisAngle(endeffindex,dofindices)
+                Ht=robot.ComputeHessianTranslation(endeffindex,Tlink[0:3,3],dofindices)
+                Ha=robot.ComputeHessianAxisAngle(endeffindex,dofindices)
+                
+                fullqd=zeros(robot.GetDOF())
+                fullqd[dofindices]=qd
+                robot.SetDOFVelocities(fullqd,linear=[0,0,0],angular=[0,0,0],checklimits=False)
+                linkvel=robot.GetLinkVelocities()[endeffindex]
+                assert(transdist(dot(Jt,qd),linkvel[0:3]) <= 1e-7)
+                assert(transdist(dot(Ja,qd),linkvel[3:6]) <= 1e-7)
+                for qdd in vaccels:
+                    fullqdd=zeros(robot.GetDOF())
+                    fullqdd[dofindices]=qdd
+                    linkaccel=robot.GetLinkAccelerations(fullqdd)[endeffindex]
+                    assert(transdist(dot(Jt,qdd)+dot(qd,dot(Ht,qd)),linkaccel[0:3]) <= 1e-7)
+                    assert(transdist(dot(Ja,qdd)+dot(qd,dot(Ha,qd)),linkaccel[3:6]) <= 1e-7)
+
+    def test_smoothermanipconstraints(self):
+        # parabolicsmoother2 has to keep the speed and acceleration of the end effector under maxmanipspeed and maxmanipaccel
+        env=self.env
+        self.LoadEnv('robots/barrettwam.robot.xml')
+        with env:
+            robot=env.GetRobots()[0]
+            manip=robot.GetActiveManipulator()
+            robot.SetActiveDOFs(manip.GetArmIndices())
+            dofindices=robot.GetActiveDOFIndices()
+            endeffindex=manip.GetEndEffector().GetIndex()
+            lower,upper=robot.GetActiveDOFLimits()
+            # corners of the box around the end effector links in the end effector frame, like ManipConstraintChecker2
+            Teeinv=linalg.inv(manip.GetEndEffector().GetTransform())
+            vmin,vmax=None,None
+            for link in manip.GetChildLinks():
+                ab=link.ComputeAABBFromTransform(dot(Teeinv,link.GetTransform()))
+                vmin=ab.pos()-ab.extents() if vmin is None else minimum(vmin,ab.pos()-ab.extents())
+                vmax=ab.pos()+ab.extents() if vmax is None else maximum(vmax,ab.pos()+ab.extents())
+            checkpoints=[array([x,y,z]) for x in [vmin[0],vmax[0]] for y in [vmin[1],vmax[1]] for z in [vmin[2],vmax[2]]]
+            
+            def ComputeToolSpeedAccel(q,qd,qdd):
+                fullqd=zeros(robot.GetDOF())
+                fullqd[dofindices]=qd
+                fullqdd=zeros(robot.GetDOF())
+                fullqdd[dofindices]=qdd
+                robot.SetDOFValues(q,dofindices,checklimits=False)
+                robot.SetDOFVelocities(fullqd,linear=[0,0,0],angular=[0,0,0],checklimits=False)
+                Tee=robot.GetLinks()[endeffindex].GetTransform()
+                linkvel=robot.GetLinkVelocities()[endeffindex]
+                linkaccel=robot.GetLinkAccelerations(fullqdd)[endeffindex]
+                maxspeed,maxaccel=0.0,0.0
+                for point in checkpoints:
+                    r=dot(Tee[0:3,0:3],point)
+                    w=linkvel[3:6]
+                    maxspeed=max(maxspeed,linalg.norm(linkvel[0:3]+cross(w,r)))
+                    maxaccel=max(maxaccel,linalg.norm(linkaccel[0:3]+cross(linkaccel[3:6],r)+cross(w,cross(w,r))))
+                return maxspeed,maxaccel
+            
+            maxmanipspeed=0.3
+            maxmanipaccel=1.0
+            waypoints=[0.5*(lower+upper), 0.45*lower+0.55*upper]
+            for q in waypoints:
+                robot.SetActiveDOFValues(q)
+                assert(not robot.CheckSelfCollision())
+            
+            traj=RaveCreateTrajectory(env,'')
+            traj.Init(robot.GetActiveConfigurationSpecification('linear'))
+            traj.Insert(0,r_[tuple(waypoints)])
+            ret=planningutils.SmoothActiveDOFTrajectory(traj,robot,plannername='parabolicsmoother2',plannerparameters='<manipname>%s</manipname><maxmanipspeed>%.15e</maxmanipspeed><maxmanipaccel>%.15e</maxmanipaccel>'%(manip.GetName(),maxmanipspeed,maxmanipaccel))
+            assert(ret.statusCode==PlannerStatusCode.HasSolution)
+            spec=traj.GetConfigurationSpecification()
+            assert(transdist(spec.ExtractJointValues(traj.GetWaypoint(-1),robot,dofindices,0),waypoints[-1]) <= g_epsilon)
+            
+            # the constraints are enforced exactly at the ramp boundaries, the accelerations of the ramps on both sides are checked
+            vq=[spec.ExtractJointValues(traj.GetWaypoint(i),robot,dofindices,0) for i in range(traj.GetNumWaypoints())]
+            vqd=[spec.ExtractJointValues(traj.GetWaypoint(i),robot,dofindices,1) for i in range(traj.GetNumWaypoints())]
+            vdeltatime=[spec.ExtractDeltaTime(traj.GetWaypoint(i)) for i in range(traj.GetNumWaypoints())]
+            vrampaccels=[(vqd[i]-vqd[i-1])/vdeltatime[i] for i in range(1,traj.GetNumWaypoints()) if vdeltatime[i] > g_epsilon]
+            assert(len(vrampaccels) > 0)
+            for i in range(traj.GetNumWaypoints()):
+                vaccels=[(vqd[j]-vqd[j-1])/vdeltatime[j] for j in [i,i+1] if j > 0 and j < traj.GetNumWaypoints() and vdeltatime[j] > g_epsilon]
+                for qdd in vaccels:
+                    speed,accel=ComputeToolSpeedAccel(vq[i],vqd[i],qdd)
+                    assert(speed <= maxmanipspeed*1.01)
+                    assert(accel <= maxmanipaccel*1.01)
+            
+            # inside the ramps the tool speed and acceleration are not exactly monotonic, so allow some slack
+            maxspeed,maxaccel=0.0,0.0
+            timestep=0.002
+            for t in arange(timestep,traj.GetDuration()-timestep,timestep):
+                data0=traj.Sample(t-0.5*timestep)
+                data1=traj.Sample(t+0.5*timestep)
+                data=traj.Sample(t)
+                qdd=(spec.ExtractJointValues(data1,robot,dofindices,1)-spec.ExtractJointValues(data0,robot,dofindices,1))/timestep
+                speed,accel=ComputeToolSpeedAccel(spec.ExtractJointValues(data,robot,dofindices,0),spec.ExtractJointValues(data,robot,dofindices,1),qdd)
+                maxspeed=max(maxspeed,speed)
+                maxaccel=max(maxaccel,accel)
+            assert(maxspeed > 0 and maxspeed <= maxmanipspeed*1.1)
+            assert(maxaccel > 0 and maxaccel <= maxmanipaccel*1.1)
+            
+    def test_timeoptimalretimer(self):
+        env=self.env
+        self.LoadEnv('robots/barrettwam.robot.xml')
+        with env:
+            robot=env.GetRobots()[0]
+            robot.SetActiveDOFs(robot.GetActiveManipulator().GetArmIndices())
+            lower,upper=robot.GetActiveDOFLimits()
+            vellimits=robot.GetActiveDOFMaxVel()
+            accellimits=robot.GetActiveDOFMaxAccel()
+            waypoints=[0.6*lower+0.4*upper, 0.5*(lower+upper), 0.3*lower+0.7*upper, 0.45*lower+0.55*upper]
+            controller_timestep=0.008
+            for interpolation,hastimestamps,steplength,outinterpolation in [('linear',False,0,'quadratic'),('linear',True,0,'quadratic'),('quadratic',True,0,'quadratic'),('quadratic',True,controller_timestep,'quadratic'),('quadratic',True,0,'cubic')]:
+                traj=RaveCreateTrajectory(env,'')
+                spec=robot.GetActiveConfigurationSpecification(interpolation)
+                if hastimestamps and interpolation == 'linear':
+                    timeoffset=spec.AddDeltaTimeGroup()
+                    traj.Init(spec)
+                    for i,waypoint in enumerate(waypoints):
+                        point=zeros(spec.GetDOF())
+                        point[0:len(waypoint)]=waypoint
+                        point[timeoffset]=0.5 if i > 0 else 0
+                        traj.Insert(i,point)
+                else:
+                    traj.Init(robot.GetActiveConfigurationSpecification())
+                    traj.Insert(0,concatenate(waypoints))
+                    if hastimestamps:
+                        planningutils.RetimeActiveDOFTrajectory(traj,robot,False)
+                
+                planner=RaveCreatePlanner(env,'TimeOptimalTrajectoryRetimer')
+                assert(planner.SendCommand('SetGridSize 400') is not None)
+                params=Planner.PlannerParameters()
+                params.SetRobotActiveJoints(robot)
+                params.SetExtraParameters('<hastimestamps>%d</hastimestamps><_fsteplength>%.15e</_fsteplength><interpolation>%s</interpolation>'%(hastimestamps,steplength,outinterpolation))
+                assert(planner.InitPlan(robot,params))
+                assert(planner.PlanPath(traj)==PlannerStatusCode.HasSolution)
+                
+                duration=traj.GetDuration()
+                assert(duration > 0)
+                if steplength > 0:
+                    assert( abs(modf(duration/steplength+0.5)[0]-0.5) <= 0.01 ) # has to be a multiple
+                outspec=traj.GetConfigurationSpecification()
+                assert(outspec.GetGroupFromName('joint_values').interpolation == outinterpolation)
+                indices=robot.GetActiveDOFIndices()
+                startdata=traj.Sample(0)
+                enddata=traj.Sample(duration)
+                assert(transdist(outspec.ExtractJointValues(startdata,robot,indices,0),waypoints[0]) <= g_epsilon)
+                assert(transdist(outspec.ExtractJointValues(enddata,robot,indices,0),waypoints[-1]) <= g_epsilon)
+                assert(transdist(outspec.ExtractJointValues(startdata,robot,indices,1),zeros(len(indices))) <= g_epsilon)
+                assert(transdist(outspec.ExtractJointValues(enddata,robot,indices,1),zeros(len(indices))) <= g_epsilon)
+                
+                # the limits have to be followed in between the grid points
+                dt=0.001
+                prevvel=None
+                for t in r_[arange(0,duration,dt),duration]:
+                    vel=outspec.ExtractJointValues(traj.Sample(t),robot,indices,1)
+                    assert(all(abs(vel) <= vellimits*(1+1e-5)+1e-7))
+                    if prevvel is not None:
+                        # the finite difference of the velocities is bounded by the largest acceleration in between
+                        accel=(vel-prevvel)/(t-prevt)
+                        assert(all(abs(accel) <= accellimits*(1+1e-3)+1e-5))
+                    prevvel,prevt=vel,t
+                
+                # the interpolation of every interval has to end at the position of the next point
+                data=traj.GetWaypoints(0,traj.GetNumWaypoints())
+                t=0
+                for i in range(1,traj.GetNumWaypoints()):
+                    point=data[i*outspec.GetDOF():(i+1)*outspec.GetDOF()]
+                    deltatime=outspec.ExtractDeltaTime(point)
+                    t+=deltatime
+                    if deltatime > 1e-6:
+                        before=outspec.ExtractJointValues(traj.Sample(t-1e-7),robot,indices,0)
+                        assert(transdist(before,outspec.ExtractJointValues(point,robot,indices,0)) <= 1e-7*sum(vellimits)+1e-8)
+                
+                if interpolation == 'linear':
+                    # q' jumps at the corners, so the robot has to stop at every waypoint
+                    data=traj.GetWaypoints(0,traj.GetNumWaypoints())
+                    for waypoint in waypoints[1:-1]:
+                        found=False
+                        for i in range(traj.GetNumWaypoints()):
+                            point=data[i*outspec.GetDOF():(i+1)*outspec.GetDOF()]
+                            if transdist(outspec.ExtractJointValues(point,robot,indices,0),waypoint) <= g_epsilon:
+                                assert(transdist(outspec.ExtractJointValues(point,robot,indices,1),zeros(len(indices))) <= g_epsilon)
+                                found=True
+                        assert(found)
+
+    def test_parallelbirrt(self):
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        robot=env.GetRobots()[0]
+        with env:
+            manip=robot.GetActiveManipulator()
+            robot.SetActiveDOFs(manip.GetArmIndices())
+            start=robot.GetActiveDOFValues()
+            goal=array(start)
+            goal[0]+=1.0
+            goal[1]-=0.3
+            robot.SetActiveDOFValues(goal)
+            assert(not env.CheckCollision(robot) and not robot.CheckSelfCollision())
+            robot.SetActiveDOFValues(start)
+            
+            planner=RaveCreatePlanner(env,'ParallelBiRRT')
+            assert(planner.SendCommand('SetNumThreads 4') is not None)
+            params=Planner.PlannerParameters()
+            params.SetRobotActiveJoints(robot)
+            params.SetGoalConfig(goal)
+            params.SetExtraParameters('<_nmaxiterations>4000</_nmaxiterations>')
+            resolutions=robot.GetActiveDOFResolutions()
+            # the environment clones of the threads are reused by the second InitPlan
+            for itry in range(2):
+                assert(planner.InitPlan(robot,params))
+                traj=RaveCreateTrajectory(env,'')
+                assert(planner.PlanPath(traj)==PlannerStatusCode.HasSolution)
+                data=traj.GetWaypoints(0,traj.GetNumWaypoints(),robot.GetActiveConfigurationSpecification())
+                points=reshape(data,(traj.GetNumWaypoints(),robot.GetActiveDOF()))
+                assert(transdist(points[0],start) <= g_epsilon)
+                assert(transdist(points[-1],goal) <= g_epsilon)
+                # the path found in the clones has to be collision free in the original environment
+                with robot:
+                    for i in range(len(points)-1):
+                        numsteps=int(ceil(max(abs(points[i+1]-points[i])/resolutions)))+1
+                        for t in linspace(0,1,numsteps+1):
+                            robot.SetActiveDOFValues(points[i]*(1-t)+points[i+1]*t)
+                            assert(not env.CheckCollision(robot) and not robot.CheckSelfCollision())
+
+    def test_persistentprm(self):
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        robot=env.GetRobots()[0]
+        with env:
+            manip=robot.GetActiveManipulator()
+            robot.SetActiveDOFs(manip.GetArmIndices())
+            start=robot.GetActiveDOFValues()
+            goal=array(start)
+            goal[0]+=1.0
+            goal[1]-=0.3
+            params=Planner.PlannerParameters()
+            params.SetRobotActiveJoints(robot)
+            params.SetGoalConfig(goal)
+            params.SetExtraParameters('<_nmaxiterations>2000</_nmaxiterations>')
+            def plan(planner):
+                assert(planner.InitPlan(robot,params))
+                traj=RaveCreateTrajectory(env,'')
+                assert(planner.PlanPath(traj)==PlannerStatusCode.HasSolution)
+                points=reshape(traj.GetWaypoints(0,traj.GetNumWaypoints(),robot.GetActiveConfigurationSpecification()),(traj.GetNumWaypoints(),robot.GetActiveDOF()))
+                assert(transdist(points[0],start) <= g_epsilon)
+                assert(transdist(points[-1],goal) <= g_epsilon)
+            def getinfo(planner):
+                return [int(x) for x in planner.SendCommand('GetRoadmapInfo').split()]
+            
+            planner=RaveCreatePlanner(env,'PersistentPRM')
+            plan(planner)
+            numnodes,numedges,epoch=getinfo(planner)
+            assert(numnodes > 0 and numedges > 0)
+            # the re-query with the same parameters keeps the roadmap and its validation results
+            plan(planner)
+            numnodes2,numedges2,epoch2=getinfo(planner)
+            assert(numnodes2 >= numnodes)
+            assert(epoch2 == epoch)
+            
+            # a different step length can change the validation results
+            params.SetExtraParameters('<_nmaxiterations>2000</_nmaxiterations><_fsteplength>0.02</_fsteplength>')
+            plan(planner)
+            epoch3=getinfo(planner)[2]
+            assert(epoch3 > epoch2)
+            plan(planner)
+            assert(getinfo(planner)[2] == epoch3)
+            
+            tempdir=tempfile.mkdtemp()
+            try:
+                filename=os.path.join(tempdir,'test_persistentprm.roadmap')
+                numnodes2,numedges2=getinfo(planner)[0:2]
+                assert(planner.SendCommand('SaveRoadmap %s'%filename) is not None)
+                # the initial and goal nodes of the queries are not kept, see OPENRAVEROADMP1 format
+                with open(filename,'rb') as f:
+                    data=f.read()
+                offset=16
+                for istring in range(2):
+                    offset+=4+int(numpy.fromstring(data[offset:offset+4],uint32)[0])
+                dof,savednodes=numpy.fromstring(data[offset:offset+8],uint32)
+                offset+=8
+                assert(dof==robot.GetActiveDOF() and savednodes==numnodes2)
+                nodes=reshape(numpy.fromstring(data[offset:offset+8*dof*savednodes],float64),(savednodes,dof))
+                assert(min(sqrt(sum((nodes-start)**2,1))) > g_epsilon)
+                assert(min(sqrt(sum((nodes-goal)**2,1))) > g_epsilon)
+            
+                # a new planner re-queries the loaded roadmap
+                planner2=RaveCreatePlanner(env,'PersistentPRM')
+                assert(planner2.InitPlan(robot,params))
+                assert(planner2.SendCommand('LoadRoadmap %s'%filename) is not None)
+                assert(getinfo(planner2)[0:2]==[numnodes2,numedges2])
+                plan(planner2)
+                assert(getinfo(planner2)[0]>=numnodes2)
+            finally:
+                shutil.rmtree(tempdir)
+
+    def test_adaptivecollisionstepping(self):
+        # the adaptive stepping of DynamicsCollisionConstraint skips configurations that are guaranteed to be free, it has to report the same collisions as the regular stepping
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        robot=env.GetRobots()[0]
+        with env:
+            robot.SetActiveDOFs(robot.GetActiveManipulator().GetArmIndices())
+            lower,upper=robot.GetActiveDOFLimits()
+            random.seed(0)
+            vcolliding=[]
+            vfree=[]
+            while len(vcolliding) < 4 or len(vfree) < 4:
+                q=lower+random.rand(len(lower))*(upper-lower)
+                robot.SetActiveDOFValues(q)
+                if env.CheckCollision(robot) or robot.CheckSelfCollision():
+                    if len(vcolliding) < 4:
+                        vcolliding.append(q)
+                elif len(vfree) < 4:
+                    vfree.append(q)
+            segments=[(qc,qf) for qc in vcolliding for qf in vfree]+[(qf,qc) for qc in vcolliding for qf in vfree]+zip(vcolliding[:-1],vcolliding[1:])+zip(vfree[:-1],vfree[1:])
+            
+            params=Planner.PlannerParameters()
+            params.SetRobotActiveJoints(robot)
+            checkoptions=3 # CFO_CheckEnvCollisions|CFO_CheckSelfCollisions
+            # the adaptive stepping needs distance queries, which not every checker supports
+            for checkername in [self.collisioncheckername,'pqp']:
+                checker=RaveCreateCollisionChecker(env,checkername)
+                if checker is None:
+                    continue
+                env.SetCollisionChecker(checker)
+                constraint=planningutils.DynamicsCollisionConstraint(params,[robot],checkoptions)
+                adaptiveconstraint=planningutils.DynamicsCollisionConstraint(params,[robot],checkoptions)
+                adaptiveconstraint.SetAdaptiveStepping(True)
+                for q0,q1 in segments:
+                    robot.SetActiveDOFValues(q0)
+                    bcollision0=env.CheckCollision(robot) or robot.CheckSelfCollision()
+                    for interval in [Interval.Open,Interval.OpenStart,Interval.OpenEnd,Interval.Closed]:
+                        ret=constraint.Check(q0,q1,[],[],0,interval,checkoptions)
+                        adaptiveret=adaptiveconstraint.Check(q0,q1,[],[],0,interval,checkoptions)
+                        assert((ret==0) == (adaptiveret==0))
+                        if bcollision0 and (interval == Interval.OpenEnd or interval == Interval.Closed):
+                            # the start is part of the interval
+                            assert(adaptiveret != 0)
+
+    def test_bisectionorder(self):
+        assert(len(planningutils.ComputeBisectionOrder(0)) == 0)
+        expectedorders = {1:[0], 2:[1,0], 7:[3,1,5,0,2,4,6], 8:[4,2,6,1,3,5,7,0]}
+        for numitems, expectedorder in expectedorders.iteritems():
+            assert(list(planningutils.ComputeBisectionOrder(numitems)) == expectedorder)
+        for numitems in range(1,100):
+            order = list(planningutils.ComputeBisectionOrder(numitems))
+            # has to be a permutation of all the items
+            assert(sorted(order) == range(numitems))
+            # the first item is the middle one
+            assert(order[0] == numitems/2)
+
+    def test_visibilitymap(self):
+        # the visibility map has to give the same answer as the full visibility check for the poses it was computed from
+        env=self.env
+        self.LoadEnv('data/pa10grasp.env.xml')
+        robot=env.GetRobots()[0]
+        target=env.GetKinBody('frootloops')
+        visualprob=interfaces.VisualFeedback(robot)
+        with env:
+            visualprob.SetCameraAndTarget(sensorindex=0,targetlink=target.GetLinks()[0])
+            transforms=visualprob.ProcessVisibilityExtents(sphere=[2,0.2,0.3])
+            assert(len(transforms) > 0)
+            visualprob.SetCameraTransforms(transforms=transforms)
+            Tcamera=robot.GetAttachedSensors()[0].GetTransform()
+            testtransforms=transforms[::max(1,len(transforms)/40)]
+            def ComputeVisibilities():
+                visibilities=[]
+                for pose in testtransforms:
+                    # move the target so that the camera is at the pose in the target coordinate system
+                    target.SetTransform(dot(Tcamera,linalg.inv(matrixFromPose(pose))))
+                    visibilities.append(visualprob.ComputeVisibility(checkocclusion=True))
+                return visibilities
+
+            Torig=target.GetTransform()
+            try:
+                exactvisibilities=ComputeVisibilities()
+                assert(any(exactvisibilities))
+                filename=os.path.join(tempfile.mkdtemp(),'visibilitymap.bin')
+                try:
+                    # coarse cells mix visible and invisible poses, those have to fall back to the full check
+                    for transres,rotres in [(0.001,0.001),(0.2,0.5)]:
+                        numvisible=visualprob.ComputeVisibilityMap(transres=transres,rotres=rotres)
+                        assert(numvisible > 0 and numvisible <= len(transforms))
+                        assert(ComputeVisibilities()==exactvisibilities)
+
+                        visualprob.SaveVisibilityMap(filename)
+                        # new camera transforms invalidate the map
+                        visualprob.SetCameraTransforms(transforms=transforms)
+                        assert_raises(PlanningError, visualprob.SaveVisibilityMap, filename)
+                        assert(visualprob.LoadVisibilityMap(filename)==numvisible)
+                        assert(ComputeVisibilities()==exactvisibilities)
+                        visualprob.SetCameraTransforms(transforms=transforms)
+                finally:
+                    shutil.rmtree(os.path.dirname(filename))
+            finally:
+                target.SetTransform(Torig)
+
 #generate_classes(RunPlanning, globals(), [('ode','ode'),('bullet','bullet')])
 
 class test_ode(RunPlanning):
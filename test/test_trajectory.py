@@ -607,6 +607,24 @@ class TestTrajectory(EnvironmentSetup):
         assert(traj.GetWaypoint(0,g)==55)
         assert(traj.GetWaypoint(1,ConfigurationSpecification(g))==56)
 
+    def test_insertarrays(self):
+        env=self.env
+        trajspec = ConfigurationSpecification()
+        trajspec.AddGroup('joint_values',3,'linear')
+        trajspec.AddGroup('customgroup',1,'previous')
+        orgpoints = array([[11., 12., 13., 0.], [21., 22., 23., 1.], [31., 32., 33., 2.]])
+        # 1-D, 2-D and non-contiguous 2-D data all insert the same waypoints
+        for data in [orgpoints.flatten(), orgpoints, array(orgpoints.T).T]:
+            traj = RaveCreateTrajectory(env,'')
+            traj.Init(trajspec)
+            traj.Insert(0,data)
+            assert(traj.GetNumWaypoints()==3)
+            assert(transdist(traj.GetWaypoints(0,3),orgpoints.flatten()) <= g_epsilon)
+        
+        traj.Insert(1,orgpoints[1:2,:]*2,True)
+        assert(traj.GetNumWaypoints()==3)
+        assert(transdist(traj.GetWaypoint(1),orgpoints[1]*2) <= g_epsilon)
+
     def test_robotdoortraj(self):
         env=self.env
         self.LoadEnv('data/wam_cabinet.env.xml')